@@ -0,0 +1,286 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/Dataset.h"
+#include "db/engine/ExecutionEngine.h"
+#include "utils/Error.h"
+
+#ifdef MILVUS_BENCH_WITH_HDF5
+#include <hdf5.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <utility>
+
+namespace milvus {
+namespace bench {
+
+namespace {
+
+template <typename T>
+Status
+ReadVecsFile(const std::string& file, std::vector<T>& data, uint64_t& count, uint16_t& dimension) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in.is_open()) {
+        return Status(SERVER_FILE_NOT_FOUND, "Cannot open file: " + file);
+    }
+
+    int32_t dim = 0;
+    in.read(reinterpret_cast<char*>(&dim), sizeof(dim));
+    if (!in || dim <= 0 || dim > UINT16_MAX) {
+        return Status(SERVER_INVALID_ARGUMENT, "Invalid vector dimension in file: " + file);
+    }
+
+    in.seekg(0, std::ios::end);
+    uint64_t file_size = in.tellg();
+    uint64_t record_size = sizeof(int32_t) + dim * sizeof(T);
+    if (file_size % record_size != 0) {
+        return Status(SERVER_INVALID_ARGUMENT, "File size is not a multiple of record size: " + file);
+    }
+
+    count = file_size / record_size;
+    dimension = static_cast<uint16_t>(dim);
+    data.resize(count * dim);
+
+    in.seekg(0, std::ios::beg);
+    for (uint64_t i = 0; i < count; ++i) {
+        int32_t record_dim = 0;
+        in.read(reinterpret_cast<char*>(&record_dim), sizeof(record_dim));
+        if (record_dim != dim) {
+            return Status(SERVER_INVALID_ARGUMENT, "Inconsistent vector dimension in file: " + file);
+        }
+        in.read(reinterpret_cast<char*>(data.data() + i * dim), dim * sizeof(T));
+    }
+
+    if (!in) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Failed to read file: " + file);
+    }
+    return Status::OK();
+}
+
+#ifdef MILVUS_BENCH_WITH_HDF5
+template <typename T>
+Status
+ReadHdf5Dataset(hid_t file, const std::string& name, hid_t mem_type, std::vector<T>& data, uint64_t& rows,
+                uint64_t& cols) {
+    hid_t dataset = H5Dopen2(file, name.c_str(), H5P_DEFAULT);
+    if (dataset < 0) {
+        return Status(SERVER_INVALID_ARGUMENT, "HDF5 dataset not found: " + name);
+    }
+
+    hid_t dataspace = H5Dget_space(dataset);
+    hsize_t dims[2] = {0, 0};
+    int rank = H5Sget_simple_extent_ndims(dataspace);
+    if (rank != 2) {
+        H5Sclose(dataspace);
+        H5Dclose(dataset);
+        return Status(SERVER_INVALID_ARGUMENT, "HDF5 dataset is not two dimensional: " + name);
+    }
+    H5Sget_simple_extent_dims(dataspace, dims, nullptr);
+    rows = dims[0];
+    cols = dims[1];
+    data.resize(rows * cols);
+
+    herr_t ret = H5Dread(dataset, mem_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+    H5Sclose(dataspace);
+    H5Dclose(dataset);
+    if (ret < 0) {
+        return Status(SERVER_UNEXPECTED_ERROR, "Failed to read HDF5 dataset: " + name);
+    }
+    return Status::OK();
+}
+#endif
+
+}  // namespace
+
+Status
+GenerateSynthetic(uint64_t base_count, uint64_t query_count, uint16_t dimension, uint32_t seed, Dataset& dataset) {
+    if (base_count == 0 || query_count == 0 || dimension == 0) {
+        return Status(SERVER_INVALID_ARGUMENT, "Synthetic dataset size and dimension must be positive");
+    }
+
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+
+    dataset.name_ = "synthetic-" + std::to_string(base_count) + "x" + std::to_string(dimension) + "-seed" +
+                    std::to_string(seed);
+    dataset.dimension_ = dimension;
+    dataset.base_count_ = base_count;
+    dataset.base_.resize(base_count * dimension);
+    for (auto& value : dataset.base_) {
+        value = dist(engine);
+    }
+
+    dataset.query_count_ = query_count;
+    dataset.queries_.resize(query_count * dimension);
+    for (auto& value : dataset.queries_) {
+        value = dist(engine);
+    }
+
+    dataset.gt_k_ = 0;
+    dataset.ground_truth_.clear();
+    return Status::OK();
+}
+
+Status
+LoadVecs(const std::string& base_file, const std::string& query_file, const std::string& gt_file, Dataset& dataset) {
+    uint16_t base_dim = 0, query_dim = 0;
+    auto status = ReadVecsFile(base_file, dataset.base_, dataset.base_count_, base_dim);
+    if (!status.ok()) {
+        return status;
+    }
+
+    status = ReadVecsFile(query_file, dataset.queries_, dataset.query_count_, query_dim);
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (base_dim != query_dim) {
+        return Status(SERVER_INVALID_ARGUMENT, "Base and query vectors have different dimension");
+    }
+    dataset.dimension_ = base_dim;
+    dataset.name_ = base_file;
+
+    dataset.gt_k_ = 0;
+    dataset.ground_truth_.clear();
+    if (gt_file.empty()) {
+        return Status::OK();
+    }
+
+    std::vector<int32_t> gt;
+    uint64_t gt_count = 0;
+    uint16_t gt_k = 0;
+    status = ReadVecsFile(gt_file, gt, gt_count, gt_k);
+    if (!status.ok()) {
+        return status;
+    }
+    if (gt_count != dataset.query_count_) {
+        return Status(SERVER_INVALID_ARGUMENT, "Ground truth count does not match query count");
+    }
+
+    dataset.gt_k_ = gt_k;
+    dataset.ground_truth_.assign(gt.begin(), gt.end());
+    return Status::OK();
+}
+
+Status
+LoadHdf5(const std::string& file, Dataset& dataset) {
+#ifdef MILVUS_BENCH_WITH_HDF5
+    hid_t handle = H5Fopen(file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (handle < 0) {
+        return Status(SERVER_FILE_NOT_FOUND, "Cannot open HDF5 file: " + file);
+    }
+
+    uint64_t base_dim = 0, query_dim = 0;
+    auto status = ReadHdf5Dataset(handle, "train", H5T_NATIVE_FLOAT, dataset.base_, dataset.base_count_, base_dim);
+    if (status.ok()) {
+        status = ReadHdf5Dataset(handle, "test", H5T_NATIVE_FLOAT, dataset.queries_, dataset.query_count_, query_dim);
+    }
+
+    std::vector<int32_t> gt;
+    uint64_t gt_count = 0, gt_k = 0;
+    if (status.ok()) {
+        status = ReadHdf5Dataset(handle, "neighbors", H5T_NATIVE_INT, gt, gt_count, gt_k);
+    }
+    H5Fclose(handle);
+
+    if (!status.ok()) {
+        return status;
+    }
+    if (base_dim != query_dim || base_dim == 0 || base_dim > UINT16_MAX) {
+        return Status(SERVER_INVALID_ARGUMENT, "Invalid vector dimension in HDF5 file: " + file);
+    }
+    if (gt_count != dataset.query_count_) {
+        return Status(SERVER_INVALID_ARGUMENT, "Ground truth count does not match query count");
+    }
+
+    dataset.name_ = file;
+    dataset.dimension_ = static_cast<uint16_t>(base_dim);
+    dataset.gt_k_ = gt_k;
+    dataset.ground_truth_.assign(gt.begin(), gt.end());
+    return Status::OK();
+#else
+    return Status(SERVER_UNSUPPORTED_ERROR, "milvus_bench is built without HDF5 support, cannot load: " + file);
+#endif
+}
+
+Status
+ComputeGroundTruth(Dataset& dataset, uint64_t k, int32_t metric_type, int32_t thread_num) {
+    if (k == 0 || k > dataset.base_count_) {
+        return Status(SERVER_INVALID_ARGUMENT, "Invalid ground truth k: " + std::to_string(k));
+    }
+
+    bool inner_product = (metric_type == static_cast<int32_t>(engine::MetricType::IP));
+    uint64_t dim = dataset.dimension_;
+    dataset.gt_k_ = k;
+    dataset.ground_truth_.assign(dataset.query_count_ * k, -1);
+
+    auto worker = [&](uint64_t begin, uint64_t end) {
+        // max heap on score so that the worst of the current top k is on top
+        std::vector<std::pair<float, int64_t>> heap;
+        heap.reserve(k + 1);
+        for (uint64_t q = begin; q < end; ++q) {
+            const float* query = dataset.queries_.data() + q * dim;
+            heap.clear();
+            for (uint64_t i = 0; i < dataset.base_count_; ++i) {
+                const float* base = dataset.base_.data() + i * dim;
+                float score = 0.0f;
+                for (uint64_t d = 0; d < dim; ++d) {
+                    if (inner_product) {
+                        score -= query[d] * base[d];
+                    } else {
+                        float diff = query[d] - base[d];
+                        score += diff * diff;
+                    }
+                }
+
+                if (heap.size() < k) {
+                    heap.emplace_back(score, i);
+                    std::push_heap(heap.begin(), heap.end());
+                } else if (score < heap.front().first) {
+                    std::pop_heap(heap.begin(), heap.end());
+                    heap.back() = std::make_pair(score, static_cast<int64_t>(i));
+                    std::push_heap(heap.begin(), heap.end());
+                }
+            }
+
+            std::sort_heap(heap.begin(), heap.end());
+            for (uint64_t j = 0; j < heap.size(); ++j) {
+                dataset.ground_truth_[q * k + j] = heap[j].second;
+            }
+        }
+    };
+
+    uint64_t threads = std::max<int32_t>(thread_num, 1);
+    threads = std::min<uint64_t>(threads, dataset.query_count_);
+    uint64_t step = (dataset.query_count_ + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    for (uint64_t begin = 0; begin < dataset.query_count_; begin += step) {
+        workers.emplace_back(worker, begin, std::min(begin + step, dataset.query_count_));
+    }
+    for (auto& t : workers) {
+        t.join();
+    }
+
+    return Status::OK();
+}
+
+}  // namespace bench
+}  // namespace milvus
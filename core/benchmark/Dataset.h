@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "utils/Status.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace bench {
+
+struct Dataset {
+    std::string name_;
+    uint16_t dimension_ = 0;
+
+    uint64_t base_count_ = 0;
+    std::vector<float> base_;
+
+    uint64_t query_count_ = 0;
+    std::vector<float> queries_;
+
+    // ground truth is query_count_ x gt_k_ row offsets into base_, which are also used as vector ids on insert
+    uint64_t gt_k_ = 0;
+    std::vector<int64_t> ground_truth_;
+};
+
+// uniform random vectors in [0, 1), fully determined by seed
+Status
+GenerateSynthetic(uint64_t base_count, uint64_t query_count, uint16_t dimension, uint32_t seed, Dataset& dataset);
+
+// texmex format (http://corpus-texmex.irisa.fr/), ground truth file is optional
+Status
+LoadVecs(const std::string& base_file, const std::string& query_file, const std::string& gt_file, Dataset& dataset);
+
+// ann-benchmarks format with "train", "test" and "neighbors" datasets
+Status
+LoadHdf5(const std::string& file, Dataset& dataset);
+
+// brute force search over base_, replaces ground_truth_
+Status
+ComputeGroundTruth(Dataset& dataset, uint64_t k, int32_t metric_type, int32_t thread_num);
+
+}  // namespace bench
+}  // namespace milvus
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/IOBench.h"
+#include "utils/CommonUtil.h"
+#include "utils/Error.h"
+#include "utils/FileIO.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace milvus {
+namespace bench {
+
+namespace {
+
+constexpr uint64_t MB = 1024 * 1024;
+
+using Clock = std::chrono::steady_clock;
+
+double
+ElapsedSeconds(const Clock::time_point& start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// flush the file and drop it from page cache so that reads hit the disk
+void
+DropPageCache(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+}
+
+milvus::json
+Throughput(uint64_t bytes, double seconds) {
+    return {{"seconds", seconds}, {"mb_per_second", bytes / MB / seconds}};
+}
+
+}  // namespace
+
+Status
+RunIOBenchmark(const std::string& dir, uint64_t size_mb, milvus::json& report) {
+    auto status = server::CommonUtil::CreateDirectory(dir);
+    if (!status.ok()) {
+        return status;
+    }
+
+    uint64_t size = size_mb * MB;
+    std::vector<uint8_t> data(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    std::string path = dir + "/milvus_io_bench";
+    auto& file_io = server::FileIO::GetInstance();
+    report["size_mb"] = size_mb;
+    report["chunk_size_mb"] = file_io.chunk_size() / MB;
+
+    // std::fstream, the way index files used to be written and read
+    auto start = Clock::now();
+    {
+        std::fstream out(path, std::ios::out | std::ios::binary);
+        out.write(reinterpret_cast<char*>(data.data()), size);
+    }
+    DropPageCache(path);
+    report["fstream_write"] = Throughput(size, ElapsedSeconds(start));
+
+    start = Clock::now();
+    {
+        std::fstream in(path, std::ios::in | std::ios::binary);
+        std::unique_ptr<char[]> buffer(new char[size]);
+        in.read(buffer.get(), size);
+    }
+    report["fstream_read"] = Throughput(size, ElapsedSeconds(start));
+
+    // server::FileIO
+    start = Clock::now();
+    status = file_io.WriteFile(path, {server::IOBuffer{data.data(), size}});
+    if (!status.ok()) {
+        return status;
+    }
+    DropPageCache(path);
+    report["fileio_write"] = Throughput(size, ElapsedSeconds(start));
+
+    start = Clock::now();
+    std::shared_ptr<uint8_t> buffer;
+    uint64_t read_size = 0;
+    status = file_io.ReadFile(path, buffer, read_size);
+    if (!status.ok()) {
+        return status;
+    }
+    report["fileio_read"] = Throughput(read_size, ElapsedSeconds(start));
+
+    unlink(path.c_str());
+    return Status::OK();
+}
+
+}  // namespace bench
+}  // namespace milvus
@@ -0,0 +1,33 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "utils/Json.h"
+#include "utils/Status.h"
+
+#include <string>
+
+namespace milvus {
+namespace bench {
+
+// compare write/read throughput of std::fstream and server::FileIO on one file of size_mb
+Status
+RunIOBenchmark(const std::string& dir, uint64_t size_mb, milvus::json& report);
+
+}  // namespace bench
+}  // namespace milvus
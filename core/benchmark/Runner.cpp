@@ -0,0 +1,360 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/Runner.h"
+#include "cache/CpuCacheMgr.h"
+#include "db/DBFactory.h"
+#include "db/engine/ExecutionEngine.h"
+#include "db/meta/MetaTypes.h"
+#include "scheduler/SchedInst.h"
+#include "server/Config.h"
+#include "utils/CommonUtil.h"
+#include "utils/Error.h"
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace milvus {
+namespace bench {
+
+namespace {
+
+constexpr const char* BENCH_CONFIG_FILE = "/milvus_bench.yaml";
+constexpr int64_t FLUSH_POLL_INTERVAL_MS = 100;
+
+using Clock = std::chrono::steady_clock;
+
+double
+ElapsedSeconds(const Clock::time_point& start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+double
+ElapsedMilliseconds(const Clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template <typename Func>
+void
+RunWorkers(int32_t thread_num, Func func) {
+    std::vector<std::thread> workers;
+    for (int32_t i = 0; i < std::max(thread_num, 1); ++i) {
+        workers.emplace_back(func);
+    }
+    for (auto& t : workers) {
+        t.join();
+    }
+}
+
+}  // namespace
+
+milvus::json
+SummarizeLatency(std::vector<double>& latency_ms) {
+    milvus::json summary;
+    summary["count"] = latency_ms.size();
+    if (latency_ms.empty()) {
+        return summary;
+    }
+
+    std::sort(latency_ms.begin(), latency_ms.end());
+    auto percentile = [&](double p) {
+        auto rank = static_cast<size_t>(std::ceil(p * latency_ms.size()));
+        return latency_ms[std::min(std::max<size_t>(rank, 1), latency_ms.size()) - 1];
+    };
+
+    double total = 0.0;
+    for (auto& value : latency_ms) {
+        total += value;
+    }
+
+    summary["mean_ms"] = total / latency_ms.size();
+    summary["p50_ms"] = percentile(0.50);
+    summary["p95_ms"] = percentile(0.95);
+    summary["p99_ms"] = percentile(0.99);
+    summary["max_ms"] = latency_ms.back();
+    return summary;
+}
+
+Runner::Runner(const BenchOptions& options, const Dataset& dataset) : options_(options), dataset_(dataset) {
+}
+
+Status
+Runner::Run(milvus::json& report) {
+    report["dataset"] = {{"name", dataset_.name_},
+                         {"dimension", dataset_.dimension_},
+                         {"base_count", dataset_.base_count_},
+                         {"query_count", dataset_.query_count_},
+                         {"ground_truth_k", dataset_.gt_k_}};
+    report["options"] = {{"engine_type", options_.engine_type_},
+                         {"metric_type", options_.metric_type_},
+                         {"nlist", options_.nlist_},
+                         {"index_file_size_mb", options_.index_file_size_},
+                         {"insert_batch", options_.insert_batch_},
+                         {"insert_threads", options_.insert_threads_},
+                         {"topk", options_.topk_},
+                         {"nprobe", options_.nprobe_},
+                         {"search_nq", options_.search_nq_},
+                         {"search_threads", options_.search_threads_},
+                         {"search_rounds", options_.search_rounds_}};
+
+    auto status = Setup();
+    if (status.ok()) {
+        status = Insert(report["insert"]);
+    }
+    if (status.ok()) {
+        status = Flush(report["flush"]);
+    }
+    if (status.ok()) {
+        status = BuildIndex(report["build_index"]);
+    }
+    if (status.ok()) {
+        status = Search(report["search"]);
+    }
+    Teardown();
+
+    return status;
+}
+
+Status
+Runner::Setup() {
+    // always start from an empty directory so that runs are comparable
+    boost::filesystem::remove_all(options_.db_path_);
+    auto status = server::CommonUtil::CreateDirectory(options_.db_path_);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // the server config validation rejects cpu only search resources, so load the file directly
+    std::string config_file = options_.db_path_ + BENCH_CONFIG_FILE;
+    std::ofstream config_stream(config_file, std::ios::out | std::ios::trunc);
+    if (!config_stream.is_open()) {
+        return Status(SERVER_CANNOT_CREATE_FILE, "Cannot create config file: " + config_file);
+    }
+    config_stream << "metric_config:\n"
+                  << "  enable_monitor: false\n"
+                  << "cache_config:\n"
+                  << "  cpu_cache_capacity: " << options_.cpu_cache_capacity_ << "\n"
+                  << "  cache_insert_data: false\n"
+                  << "resource_config:\n"
+                  << "  search_resources:\n"
+                  << "    - cpu\n"
+                  << "  index_build_device: cpu\n";
+    config_stream.close();
+
+    status = server::Config::GetInstance().LoadConfigFile(config_file);
+    if (!status.ok()) {
+        return status;
+    }
+
+    scheduler::StartSchedulerService();
+
+    auto options = engine::DBFactory::BuildOption();
+    options.meta_.path_ = options_.db_path_ + "/db";
+    options.meta_.backend_uri_ = "sqlite://:@:/";
+    try {
+        db_ = engine::DBFactory::Build(options);
+    } catch (std::exception& ex) {
+        return Status(DB_ERROR, std::string("Failed to open database: ") + ex.what());
+    }
+
+    engine::meta::TableSchema table_schema;
+    table_schema.table_id_ = options_.table_id_;
+    table_schema.dimension_ = dataset_.dimension_;
+    table_schema.index_file_size_ = options_.index_file_size_;
+    table_schema.metric_type_ = options_.metric_type_;
+    return db_->CreateTable(table_schema);
+}
+
+void
+Runner::Teardown() {
+    if (db_ != nullptr) {
+        db_->Stop();
+        if (!options_.keep_data_) {
+            db_->DropAll();
+        }
+        db_ = nullptr;
+    }
+
+    scheduler::StopSchedulerService();
+    scheduler::ResMgrInst::GetInstance()->Clear();
+    cache::CpuCacheMgr::GetInstance()->ClearCache();
+
+    if (!options_.keep_data_) {
+        boost::filesystem::remove_all(options_.db_path_);
+    }
+}
+
+Status
+Runner::Insert(milvus::json& report) {
+    uint64_t batch = std::max<uint64_t>(options_.insert_batch_, 1);
+    uint64_t batch_count = (dataset_.base_count_ + batch - 1) / batch;
+
+    std::atomic<uint64_t> next_batch(0);
+    std::mutex mutex;
+    std::vector<double> latency_ms;
+    Status status;
+
+    auto start = Clock::now();
+    RunWorkers(options_.insert_threads_, [&]() {
+        for (uint64_t b = next_batch++; b < batch_count; b = next_batch++) {
+            uint64_t offset = b * batch;
+            uint64_t n = std::min(batch, dataset_.base_count_ - offset);
+
+            // row offsets are used as ids so that results can be checked against the ground truth
+            engine::IDNumbers ids(n);
+            for (uint64_t i = 0; i < n; ++i) {
+                ids[i] = offset + i;
+            }
+
+            auto batch_start = Clock::now();
+            auto s = db_->InsertVectors(options_.table_id_, n, dataset_.base_.data() + offset * dataset_.dimension_,
+                                        ids);
+            double cost = ElapsedMilliseconds(batch_start);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            latency_ms.push_back(cost);
+            if (!s.ok() && status.ok()) {
+                status = s;
+            }
+        }
+    });
+    double seconds = ElapsedSeconds(start);
+
+    report["vectors"] = dataset_.base_count_;
+    report["seconds"] = seconds;
+    report["vectors_per_second"] = dataset_.base_count_ / seconds;
+    report["batch_latency"] = SummarizeLatency(latency_ms);
+    return status;
+}
+
+Status
+Runner::Flush(milvus::json& report) {
+    auto start = Clock::now();
+    uint64_t row_count = 0;
+    while (true) {
+        auto status = db_->GetTableRowCount(options_.table_id_, row_count);
+        if (!status.ok()) {
+            return status;
+        }
+        if (row_count >= dataset_.base_count_) {
+            break;
+        }
+        if (ElapsedSeconds(start) > options_.flush_timeout_sec_) {
+            return Status(DB_ERROR, "Flush timeout, " + std::to_string(row_count) + " of " +
+                                        std::to_string(dataset_.base_count_) + " vectors persisted");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(FLUSH_POLL_INTERVAL_MS));
+    }
+
+    report["seconds"] = ElapsedSeconds(start);
+    report["row_count"] = row_count;
+    return Status::OK();
+}
+
+Status
+Runner::BuildIndex(milvus::json& report) {
+    engine::TableIndex index;
+    index.engine_type_ = options_.engine_type_;
+    index.nlist_ = options_.nlist_;
+    index.metric_type_ = options_.metric_type_;
+
+    auto start = Clock::now();
+    auto status = db_->CreateIndex(options_.table_id_, index);
+    if (!status.ok()) {
+        return status;
+    }
+    report["seconds"] = ElapsedSeconds(start);
+
+    // load everything before searching so the first requests do not pay for disk reads
+    start = Clock::now();
+    status = db_->PreloadTable(options_.table_id_);
+    report["preload_seconds"] = ElapsedSeconds(start);
+    return status;
+}
+
+Status
+Runner::Search(milvus::json& report) {
+    uint64_t nq = std::max<uint64_t>(std::min(options_.search_nq_, dataset_.query_count_), 1);
+    uint64_t requests_per_round = (dataset_.query_count_ + nq - 1) / nq;
+    uint64_t request_count = requests_per_round * std::max(options_.search_rounds_, 1);
+    uint64_t recall_k = std::min(options_.topk_, dataset_.gt_k_);
+
+    std::atomic<uint64_t> next_request(0);
+    std::mutex mutex;
+    std::vector<double> latency_ms;
+    uint64_t query_vectors = 0;
+    uint64_t recall_hits = 0;
+    uint64_t recall_queries = 0;
+    Status status;
+
+    auto start = Clock::now();
+    RunWorkers(options_.search_threads_, [&]() {
+        for (uint64_t r = next_request++; r < request_count; r = next_request++) {
+            uint64_t offset = (r % requests_per_round) * nq;
+            uint64_t n = std::min(nq, dataset_.query_count_ - offset);
+
+            engine::ResultIds result_ids;
+            engine::ResultDistances result_distances;
+            auto request_start = Clock::now();
+            auto s = db_->Query(options_.table_id_, options_.topk_, n, options_.nprobe_,
+                                dataset_.queries_.data() + offset * dataset_.dimension_, result_ids, result_distances);
+            double cost = ElapsedMilliseconds(request_start);
+
+            uint64_t hits = 0;
+            if (s.ok() && recall_k > 0) {
+                for (uint64_t q = 0; q < n; ++q) {
+                    auto gt_begin = dataset_.ground_truth_.begin() + (offset + q) * dataset_.gt_k_;
+                    std::unordered_set<int64_t> expected(gt_begin, gt_begin + recall_k);
+                    for (uint64_t j = 0; j < recall_k && q * options_.topk_ + j < result_ids.size(); ++j) {
+                        hits += expected.count(result_ids[q * options_.topk_ + j]);
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            latency_ms.push_back(cost);
+            query_vectors += n;
+            recall_hits += hits;
+            recall_queries += n;
+            if (!s.ok() && status.ok()) {
+                status = s;
+            }
+        }
+    });
+    double seconds = ElapsedSeconds(start);
+
+    report["requests"] = request_count;
+    report["seconds"] = seconds;
+    report["qps"] = query_vectors / seconds;
+    report["requests_per_second"] = request_count / seconds;
+    report["latency"] = SummarizeLatency(latency_ms);
+    if (recall_k > 0) {
+        report["recall_k"] = recall_k;
+        report["recall"] = static_cast<double>(recall_hits) / (recall_queries * recall_k);
+    }
+    return status;
+}
+
+}  // namespace bench
+}  // namespace milvus
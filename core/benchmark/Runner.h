@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "benchmark/Dataset.h"
+#include "db/DB.h"
+#include "utils/Json.h"
+#include "utils/Status.h"
+
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace bench {
+
+struct BenchOptions {
+    std::string db_path_ = "/tmp/milvus_bench";
+    std::string table_id_ = "milvus_bench";
+    bool keep_data_ = false;
+
+    int32_t engine_type_ = 2;  // engine::EngineType::FAISS_IVFFLAT
+    int32_t metric_type_ = 1;  // engine::MetricType::L2
+    int32_t nlist_ = 1024;
+    int64_t index_file_size_ = 1024;  // MB
+    int64_t cpu_cache_capacity_ = 4;  // GB
+
+    uint64_t insert_batch_ = 10000;
+    int32_t insert_threads_ = 1;
+    int64_t flush_timeout_sec_ = 600;
+
+    uint64_t topk_ = 10;
+    uint64_t nprobe_ = 16;
+    uint64_t search_nq_ = 1;  // queries per request
+    int32_t search_threads_ = 4;
+    int32_t search_rounds_ = 1;  // passes over the query set
+};
+
+class Runner {
+ public:
+    Runner(const BenchOptions& options, const Dataset& dataset);
+
+    // full pipeline: insert, flush, build index, search; each phase adds a section to report
+    Status
+    Run(milvus::json& report);
+
+ private:
+    Status
+    Setup();
+
+    void
+    Teardown();
+
+    Status
+    Insert(milvus::json& report);
+
+    Status
+    Flush(milvus::json& report);
+
+    Status
+    BuildIndex(milvus::json& report);
+
+    Status
+    Search(milvus::json& report);
+
+ private:
+    BenchOptions options_;
+    const Dataset& dataset_;
+    engine::DBPtr db_;
+};
+
+// count, mean and p50/p95/p99/max of latency samples in milliseconds, samples get sorted
+milvus::json
+SummarizeLatency(std::vector<double>& latency_ms);
+
+}  // namespace bench
+}  // namespace milvus
@@ -0,0 +1,347 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <getopt.h>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "benchmark/Dataset.h"
+#include "benchmark/IOBench.h"
+#include "benchmark/Runner.h"
+#include "db/engine/ExecutionEngine.h"
+#include "external/easyloggingpp/easylogging++.h"
+#include "utils/Json.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+namespace {
+
+void
+print_help(const std::string& app_name) {
+    std::cout << std::endl << "Usage: " << app_name << " [OPTIONS]" << std::endl << std::endl;
+    std::cout << "  Dataset options:" << std::endl;
+    std::cout << "   --synthetic               Generate random vectors (default)" << std::endl;
+    std::cout << "   --nb count                Synthetic base vector count (default: 100000)" << std::endl;
+    std::cout << "   --nq count                Synthetic query vector count (default: 1000)" << std::endl;
+    std::cout << "   --dim dimension           Synthetic vector dimension (default: 128)" << std::endl;
+    std::cout << "   --seed seed               Synthetic random seed (default: 42)" << std::endl;
+    std::cout << "   --base filename           Load base vectors from fvecs file" << std::endl;
+    std::cout << "   --query filename          Load query vectors from fvecs file" << std::endl;
+    std::cout << "   --gt filename             Load ground truth from ivecs file" << std::endl;
+    std::cout << "   --hdf5 filename           Load ann-benchmarks HDF5 file" << std::endl;
+    std::cout << "   --gt_k k                  Ground truth depth computed by brute force (default: topk)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "  Index options:" << std::endl;
+    std::cout << "   --index type              idmap, ivfflat or ivfsq8 (default: ivfflat)" << std::endl;
+    std::cout << "   --metric type             l2 or ip (default: l2)" << std::endl;
+    std::cout << "   --nlist nlist             Index nlist (default: 1024)" << std::endl;
+    std::cout << "   --index_file_size size    Index file size in MB (default: 1024)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "  Workload options:" << std::endl;
+    std::cout << "   --batch count             Vectors per insert request (default: 10000)" << std::endl;
+    std::cout << "   --insert_threads num      Concurrent insert clients (default: 1)" << std::endl;
+    std::cout << "   --topk k                  Search topk (default: 10)" << std::endl;
+    std::cout << "   --nprobe nprobe           Search nprobe (default: 16)" << std::endl;
+    std::cout << "   --search_nq count         Query vectors per search request (default: 1)" << std::endl;
+    std::cout << "   --search_threads num      Concurrent search clients (default: 4)" << std::endl;
+    std::cout << "   --rounds num              Passes over the query set (default: 1)" << std::endl;
+    std::cout << "   --threads num             Threads for brute force ground truth (default: all cores)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "  Other options:" << std::endl;
+    std::cout << "   --db_path path            Working directory, wiped before and after run (default: "
+                 "/tmp/milvus_bench)"
+              << std::endl;
+    std::cout << "   --cache_capacity size     CPU cache capacity in GB (default: 4)" << std::endl;
+    std::cout << "   --keep                    Keep the database after run" << std::endl;
+    std::cout << "   --io_bench size           Only measure index file read/write throughput with a file of size MB"
+              << std::endl;
+    std::cout << "   --output filename         Write JSON report to file as well as stdout" << std::endl;
+    std::cout << "   --log_file filename       Server log file (default: /tmp/milvus_bench.log)" << std::endl;
+    std::cout << "   -h --help                 Print this help" << std::endl;
+    std::cout << std::endl;
+}
+
+bool
+parse_engine_type(const std::string& name, int32_t& engine_type) {
+    if (name == "idmap") {
+        engine_type = static_cast<int32_t>(milvus::engine::EngineType::FAISS_IDMAP);
+    } else if (name == "ivfflat") {
+        engine_type = static_cast<int32_t>(milvus::engine::EngineType::FAISS_IVFFLAT);
+    } else if (name == "ivfsq8") {
+        engine_type = static_cast<int32_t>(milvus::engine::EngineType::FAISS_IVFSQ8);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool
+parse_metric_type(const std::string& name, int32_t& metric_type) {
+    if (name == "l2") {
+        metric_type = static_cast<int32_t>(milvus::engine::MetricType::L2);
+    } else if (name == "ip") {
+        metric_type = static_cast<int32_t>(milvus::engine::MetricType::IP);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void
+init_log(const std::string& log_file) {
+    el::Configurations conf;
+    conf.setToDefault();
+    conf.setGlobally(el::ConfigurationType::ToStandardOutput, "false");
+    conf.setGlobally(el::ConfigurationType::ToFile, "true");
+    conf.setGlobally(el::ConfigurationType::Filename, log_file);
+    el::Loggers::reconfigureAllLoggers(conf);
+}
+
+}  // namespace
+
+int
+main(int argc, char* argv[]) {
+    enum {
+        OPT_SYNTHETIC = 256,
+        OPT_NB,
+        OPT_NQ,
+        OPT_DIM,
+        OPT_SEED,
+        OPT_BASE,
+        OPT_QUERY,
+        OPT_GT,
+        OPT_HDF5,
+        OPT_GT_K,
+        OPT_INDEX,
+        OPT_METRIC,
+        OPT_NLIST,
+        OPT_INDEX_FILE_SIZE,
+        OPT_BATCH,
+        OPT_INSERT_THREADS,
+        OPT_TOPK,
+        OPT_NPROBE,
+        OPT_SEARCH_NQ,
+        OPT_SEARCH_THREADS,
+        OPT_ROUNDS,
+        OPT_THREADS,
+        OPT_DB_PATH,
+        OPT_CACHE_CAPACITY,
+        OPT_KEEP,
+        OPT_OUTPUT,
+        OPT_LOG_FILE,
+        OPT_IO_BENCH,
+    };
+
+    static struct option long_options[] = {{"synthetic", no_argument, nullptr, OPT_SYNTHETIC},
+                                           {"nb", required_argument, nullptr, OPT_NB},
+                                           {"nq", required_argument, nullptr, OPT_NQ},
+                                           {"dim", required_argument, nullptr, OPT_DIM},
+                                           {"seed", required_argument, nullptr, OPT_SEED},
+                                           {"base", required_argument, nullptr, OPT_BASE},
+                                           {"query", required_argument, nullptr, OPT_QUERY},
+                                           {"gt", required_argument, nullptr, OPT_GT},
+                                           {"hdf5", required_argument, nullptr, OPT_HDF5},
+                                           {"gt_k", required_argument, nullptr, OPT_GT_K},
+                                           {"index", required_argument, nullptr, OPT_INDEX},
+                                           {"metric", required_argument, nullptr, OPT_METRIC},
+                                           {"nlist", required_argument, nullptr, OPT_NLIST},
+                                           {"index_file_size", required_argument, nullptr, OPT_INDEX_FILE_SIZE},
+                                           {"batch", required_argument, nullptr, OPT_BATCH},
+                                           {"insert_threads", required_argument, nullptr, OPT_INSERT_THREADS},
+                                           {"topk", required_argument, nullptr, OPT_TOPK},
+                                           {"nprobe", required_argument, nullptr, OPT_NPROBE},
+                                           {"search_nq", required_argument, nullptr, OPT_SEARCH_NQ},
+                                           {"search_threads", required_argument, nullptr, OPT_SEARCH_THREADS},
+                                           {"rounds", required_argument, nullptr, OPT_ROUNDS},
+                                           {"threads", required_argument, nullptr, OPT_THREADS},
+                                           {"db_path", required_argument, nullptr, OPT_DB_PATH},
+                                           {"cache_capacity", required_argument, nullptr, OPT_CACHE_CAPACITY},
+                                           {"keep", no_argument, nullptr, OPT_KEEP},
+                                           {"output", required_argument, nullptr, OPT_OUTPUT},
+                                           {"log_file", required_argument, nullptr, OPT_LOG_FILE},
+                                           {"io_bench", required_argument, nullptr, OPT_IO_BENCH},
+                                           {"help", no_argument, nullptr, 'h'},
+                                           {nullptr, 0, nullptr, 0}};
+
+    std::string app_name = argv[0];
+    milvus::bench::BenchOptions options;
+    uint64_t nb = 100000, nq = 1000, gt_k = 0, io_bench_size = 0;
+    uint16_t dim = 128;
+    uint32_t seed = 42;
+    int32_t gt_threads = static_cast<int32_t>(std::thread::hardware_concurrency());
+    std::string base_file, query_file, gt_file, hdf5_file, output_file;
+    std::string log_file = "/tmp/milvus_bench.log";
+
+    int option_index = 0;
+    int value;
+    try {
+        while ((value = getopt_long(argc, argv, "h", long_options, &option_index)) != -1) {
+            switch (value) {
+                case OPT_SYNTHETIC:
+                    base_file.clear();
+                    hdf5_file.clear();
+                    break;
+                case OPT_NB:
+                    nb = std::stoull(optarg);
+                    break;
+                case OPT_NQ:
+                    nq = std::stoull(optarg);
+                    break;
+                case OPT_DIM:
+                    dim = static_cast<uint16_t>(std::stoul(optarg));
+                    break;
+                case OPT_SEED:
+                    seed = static_cast<uint32_t>(std::stoul(optarg));
+                    break;
+                case OPT_BASE:
+                    base_file = optarg;
+                    break;
+                case OPT_QUERY:
+                    query_file = optarg;
+                    break;
+                case OPT_GT:
+                    gt_file = optarg;
+                    break;
+                case OPT_HDF5:
+                    hdf5_file = optarg;
+                    break;
+                case OPT_GT_K:
+                    gt_k = std::stoull(optarg);
+                    break;
+                case OPT_INDEX:
+                    if (!parse_engine_type(optarg, options.engine_type_)) {
+                        std::cerr << "Unknown index type: " << optarg << std::endl;
+                        return EXIT_FAILURE;
+                    }
+                    break;
+                case OPT_METRIC:
+                    if (!parse_metric_type(optarg, options.metric_type_)) {
+                        std::cerr << "Unknown metric type: " << optarg << std::endl;
+                        return EXIT_FAILURE;
+                    }
+                    break;
+                case OPT_NLIST:
+                    options.nlist_ = std::stoi(optarg);
+                    break;
+                case OPT_INDEX_FILE_SIZE:
+                    options.index_file_size_ = std::stoll(optarg);
+                    break;
+                case OPT_BATCH:
+                    options.insert_batch_ = std::stoull(optarg);
+                    break;
+                case OPT_INSERT_THREADS:
+                    options.insert_threads_ = std::stoi(optarg);
+                    break;
+                case OPT_TOPK:
+                    options.topk_ = std::stoull(optarg);
+                    break;
+                case OPT_NPROBE:
+                    options.nprobe_ = std::stoull(optarg);
+                    break;
+                case OPT_SEARCH_NQ:
+                    options.search_nq_ = std::stoull(optarg);
+                    break;
+                case OPT_SEARCH_THREADS:
+                    options.search_threads_ = std::stoi(optarg);
+                    break;
+                case OPT_ROUNDS:
+                    options.search_rounds_ = std::stoi(optarg);
+                    break;
+                case OPT_THREADS:
+                    gt_threads = std::stoi(optarg);
+                    break;
+                case OPT_DB_PATH:
+                    options.db_path_ = optarg;
+                    break;
+                case OPT_CACHE_CAPACITY:
+                    options.cpu_cache_capacity_ = std::stoll(optarg);
+                    break;
+                case OPT_KEEP:
+                    options.keep_data_ = true;
+                    break;
+                case OPT_OUTPUT:
+                    output_file = optarg;
+                    break;
+                case OPT_LOG_FILE:
+                    log_file = optarg;
+                    break;
+                case OPT_IO_BENCH:
+                    io_bench_size = std::stoull(optarg);
+                    break;
+                case 'h':
+                    print_help(app_name);
+                    return EXIT_SUCCESS;
+                default:
+                    print_help(app_name);
+                    return EXIT_FAILURE;
+            }
+        }
+    } catch (std::exception& ex) {
+        std::cerr << "Invalid argument: " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    init_log(log_file);
+
+    milvus::json report;
+    milvus::Status s;
+    if (io_bench_size > 0) {
+        s = milvus::bench::RunIOBenchmark(options.db_path_, io_bench_size, report);
+        report["status"] = s.ok() ? "OK" : s.message();
+        std::cout << report.dump(4) << std::endl;
+        return s.ok() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    milvus::bench::Dataset dataset;
+    if (!hdf5_file.empty()) {
+        s = milvus::bench::LoadHdf5(hdf5_file, dataset);
+    } else if (!base_file.empty()) {
+        s = milvus::bench::LoadVecs(base_file, query_file, gt_file, dataset);
+    } else {
+        s = milvus::bench::GenerateSynthetic(nb, nq, dim, seed, dataset);
+    }
+    if (!s.ok()) {
+        std::cerr << "Failed to prepare dataset: " << s.message() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // compute the ground truth when the dataset does not provide one deep enough for topk
+    if (dataset.gt_k_ < options.topk_) {
+        s = milvus::bench::ComputeGroundTruth(dataset, gt_k > 0 ? gt_k : options.topk_, options.metric_type_,
+                                              gt_threads);
+        if (!s.ok()) {
+            std::cerr << "Failed to compute ground truth: " << s.message() << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    milvus::bench::Runner runner(options, dataset);
+    s = runner.Run(report);
+    report["status"] = s.ok() ? "OK" : s.message();
+
+    std::string content = report.dump(4);
+    std::cout << content << std::endl;
+    if (!output_file.empty()) {
+        std::ofstream out(output_file, std::ios::out | std::ios::trunc);
+        out << content << std::endl;
+    }
+
+    return s.ok() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -3,6 +3,7 @@
 BUILD_OUTPUT_DIR="cmake_build"
 BUILD_TYPE="Debug"
 BUILD_UNITTEST="OFF"
+BUILD_BENCHMARK="OFF"
 INSTALL_PREFIX=$(pwd)/milvus
 MAKE_CLEAN="OFF"
 BUILD_COVERAGE="OFF"
@@ -21,7 +22,7 @@ else
   CUSTOMIZATION="OFF"
 fi
 
-while getopts "p:d:t:ulrcgjhx" arg
+while getopts "p:d:t:ublrcgjhx" arg
 do
         case $arg in
              p)
@@ -37,6 +38,10 @@ do
                 echo "Build and run unittest cases" ;
                 BUILD_UNITTEST="ON";
                 ;;
+             b)
+                echo "Build milvus_bench benchmark" ;
+                BUILD_BENCHMARK="ON";
+                ;;
              l)
                 RUN_CPPLINT="ON"
                 ;;
@@ -66,6 +71,7 @@ parameter:
 -d: db data path(default: /tmp/milvus)
 -t: build type(default: Debug)
 -u: building unit test options(default: OFF)
+-b: building milvus_bench benchmark(default: OFF)
 -l: run cpplint, clang-format and clang-tidy(default: OFF)
 -r: remove previous build directory(default: OFF)
 -c: code coverage(default: OFF)
@@ -74,7 +80,7 @@ parameter:
 -h: help
 
 usage:
-./build.sh -p \${INSTALL_PREFIX} -t \${BUILD_TYPE} [-u] [-l] [-r] [-c] [-g] [-j] [-h]
+./build.sh -p \${INSTALL_PREFIX} -t \${BUILD_TYPE} [-u] [-b] [-l] [-r] [-c] [-g] [-j] [-h]
                 "
                 exit 0
                 ;;
@@ -97,6 +103,7 @@ make rebuild_cache > /dev/null 2>&1
 
 CMAKE_CMD="cmake \
 -DBUILD_UNIT_TEST=${BUILD_UNITTEST} \
+-DBUILD_BENCHMARK=${BUILD_BENCHMARK} \
 -DCMAKE_INSTALL_PREFIX=${INSTALL_PREFIX}
 -DCMAKE_BUILD_TYPE=${BUILD_TYPE} \
 -DCMAKE_CUDA_COMPILER=${CUDA_COMPILER} \
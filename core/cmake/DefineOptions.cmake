@@ -98,6 +98,13 @@ else()
     define_option(MILVUS_BUILD_TESTS "Build the MILVUS googletest unit tests" OFF)
 endif(BUILD_UNIT_TEST)
 
+unset(MILVUS_BUILD_BENCHMARK CACHE)
+if (BUILD_BENCHMARK)
+    define_option(MILVUS_BUILD_BENCHMARK "Build the milvus_bench end-to-end benchmark" ON)
+else()
+    define_option(MILVUS_BUILD_BENCHMARK "Build the milvus_bench end-to-end benchmark" OFF)
+endif(BUILD_BENCHMARK)
+
 #----------------------------------------------------------------------
 macro(config_summary)
     message(STATUS "---------------------------------------------------------------------")
@@ -24,6 +24,9 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace milvus {
 namespace cache {
@@ -75,6 +78,10 @@ class Cache {
     void
     erase(const std::string& key);
 
+    // keys from most to least recently used, with the number of hits of each
+    std::vector<std::pair<std::string, uint64_t>>
+    snapshot();
+
     void
     print();
 
@@ -91,6 +98,7 @@ class Cache {
     double freemem_percent_;
 
     LRU<std::string, ItemObj> lru_;
+    std::unordered_map<std::string, uint64_t> hits_;
     mutable std::mutex mutex_;
 };
 
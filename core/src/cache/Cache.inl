@@ -63,6 +63,7 @@ Cache<ItemObj>::get(const std::string &key) {
         return nullptr;
     }
 
+    hits_[key]++;
     return lru_.get(key);
 }
 
@@ -125,6 +126,20 @@ Cache<ItemObj>::erase(const std::string &key) {
     SERVER_LOG_DEBUG << "Erase " << key << " size: " << old_item->Size();
 
     lru_.erase(key);
+    hits_.erase(key);
+}
+
+template<typename ItemObj>
+std::vector<std::pair<std::string, uint64_t>>
+Cache<ItemObj>::snapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::pair<std::string, uint64_t>> keys;
+    keys.reserve(lru_.size());
+    for (auto it = lru_.begin(); it != lru_.end(); ++it) {
+        auto hits = hits_.find(it->first);
+        keys.emplace_back(it->first, hits == hits_.end() ? 0 : hits->second);
+    }
+    return keys;
 }
 
 template<typename ItemObj>
@@ -132,6 +147,7 @@ void
 Cache<ItemObj>::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
     lru_.clear();
+    hits_.clear();
     usage_ = 0;
     SERVER_LOG_DEBUG << "Clear cache !";
 }
@@ -23,6 +23,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace milvus {
 namespace cache {
@@ -45,6 +47,10 @@ class CacheMgr {
     virtual void
     EraseItem(const std::string& key);
 
+    // cached keys from most to least recently used, with their hit counts
+    std::vector<std::pair<std::string, uint64_t>>
+    Snapshot();
+
     virtual void
     PrintInfo();
 
@@ -86,6 +86,17 @@ CacheMgr<ItemObj>::EraseItem(const std::string &key) {
     server::Metrics::GetInstance().CacheAccessTotalIncrement();
 }
 
+template<typename ItemObj>
+std::vector<std::pair<std::string, uint64_t>>
+CacheMgr<ItemObj>::Snapshot() {
+    if (cache_ == nullptr) {
+        SERVER_LOG_ERROR << "Cache doesn't exist";
+        return {};
+    }
+
+    return cache_->snapshot();
+}
+
 template<typename ItemObj>
 void
 CacheMgr<ItemObj>::PrintInfo() {
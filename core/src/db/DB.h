@@ -19,6 +19,7 @@
 
 #include "Options.h"
 #include "Types.h"
+#include "engine/AttrFilter.h"
 #include "meta/Meta.h"
 #include "utils/Status.h"
 
@@ -58,25 +59,51 @@ class DB {
     virtual Status
     GetTableRowCount(const std::string& table_id, uint64_t& row_count) = 0;
     virtual Status
-    PreloadTable(const std::string& table_id) = 0;
+    PreloadTable(const std::string& table_id, PreloadProgress* progress = nullptr) = 0;
+    // tables in descending order of the queries they received, kept across restarts
+    virtual Status
+    TablesByAccess(std::vector<std::string>& table_ids) = 0;
+    // load the index files cached before the last stop again, most used first, returns when done
+    virtual Status
+    WarmUpCache(PreloadProgress* progress = nullptr) = 0;
     virtual Status
     UpdateTableFlag(const std::string& table_id, int64_t flag) = 0;
 
+    // attrs holds the attribute values of the vectors for a table with attributes, the vectors are kept in the
+    // segments of partition_tag, "" for the default partition
+    virtual Status
+    InsertVectors(const std::string& table_id_, uint64_t n, const float* vectors, IDNumbers& vector_ids_,
+                  const AttrColumns& attrs = AttrColumns(), const std::string& partition_tag = "") = 0;
+
+    // insert vectors with user ids, the vectors inserted before with the same ids are deleted
     virtual Status
-    InsertVectors(const std::string& table_id_, uint64_t n, const float* vectors, IDNumbers& vector_ids_) = 0;
+    UpsertVectors(const std::string& table_id, uint64_t n, const float* vectors, IDNumbers& vector_ids,
+                  const AttrColumns& attrs = AttrColumns(), const std::string& partition_tag = "") = 0;
 
     virtual Status
     Query(const std::string& table_id, uint64_t k, uint64_t nq, uint64_t nprobe, const float* vectors,
           ResultIds& result_ids, ResultDistances& result_distances) = 0;
 
+    // only the vectors whose attributes match filter are returned when it is set, only the segments of
+    // partition_tags are searched when it isn't empty
     virtual Status
     Query(const std::string& table_id, uint64_t k, uint64_t nq, uint64_t nprobe, const float* vectors,
-          const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) = 0;
+          const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances,
+          const AttrFilterPtr& filter = nullptr, const meta::PartitionTags& partition_tags = meta::PartitionTags()) = 0;
 
     virtual Status
     Query(const std::string& table_id, const std::vector<std::string>& file_ids, uint64_t k, uint64_t nq,
           uint64_t nprobe, const float* vectors, const meta::DatesT& dates, ResultIds& result_ids,
-          ResultDistances& result_distances) = 0;
+          ResultDistances& result_distances, const AttrFilterPtr& filter = nullptr) = 0;
+
+    // the stored vector of id, DB_NOT_FOUND when no searchable file holds it
+    virtual Status
+    GetVectorByID(const std::string& table_id, IDNumber vector_id, std::vector<float>& vector) = 0;
+
+    // query the table with the stored vector of id
+    virtual Status
+    QueryByID(const std::string& table_id, uint64_t k, uint64_t nprobe, IDNumber vector_id, const meta::DatesT& dates,
+              ResultIds& result_ids, ResultDistances& result_distances) = 0;
 
     virtual Status
     Size(uint64_t& result) = 0;
@@ -20,24 +20,38 @@
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
 #include "engine/EngineFactory.h"
+#include "engine/SegmentAttrs.h"
+#include "engine/SegmentIdIndex.h"
+#include "engine/SegmentTombstones.h"
 #include "insert/MemMenagerFactory.h"
+#include "knowhere/common/Cancel.h"
+#include "knowhere/common/HugePage.h"
 #include "meta/MetaConsts.h"
 #include "meta/MetaFactory.h"
 #include "meta/SqliteMetaImpl.h"
+#include "meta/TableFileCatalog.h"
 #include "metrics/Metrics.h"
+#include "metrics/Tracer.h"
 #include "scheduler/SchedInst.h"
 #include "scheduler/job/BuildIndexJob.h"
 #include "scheduler/job/DeleteJob.h"
 #include "scheduler/job/SearchJob.h"
+#include "tier/TierManager.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
 #include <assert.h>
 #include <algorithm>
 #include <boost/filesystem.hpp>
+#include <cctype>
+#include <cerrno>
 #include <chrono>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <thread>
 
 namespace milvus {
@@ -48,6 +62,65 @@ namespace {
 constexpr uint64_t METRIC_ACTION_INTERVAL = 1;
 constexpr uint64_t COMPACT_ACTION_INTERVAL = 1;
 constexpr uint64_t INDEX_ACTION_INTERVAL = 1;
+constexpr uint64_t SNAPSHOT_INTERVAL = 60;
+constexpr int64_t CATALOG_TAIL_INTERVAL_MS = 200;
+// longest pause of a compaction between two files while searches are running
+constexpr int64_t COMPACTION_YIELD_MAX_MS = 100;
+
+constexpr const char* TABLE_ACCESS_FILE = "table_access";
+constexpr const char* CACHE_SNAPSHOT_FILE = "cache_snapshot";
+
+// write content to path through a temporary file, a crash leaves either the old or the new content
+bool
+ReplaceFile(const std::string& path, const std::string& content) {
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::trunc);
+        file << content;
+        if (!file.good()) {
+            return false;
+        }
+    }
+    return rename(tmp_path.c_str(), path.c_str()) == 0;
+}
+
+// ids tombstoned in merged source files after they were read would come back alive in the merged
+// file, they are tombstoned there too; the caller holds SegmentTombstones::WriteMutex
+Status
+CarryTombstones(const std::string& location, const meta::TableFilesSchema& sources,
+                const std::map<std::string, SegmentTombstonesPtr>& applied) {
+    IDNumbers late_ids;
+    for (auto& file : sources) {
+        auto tombstones = SegmentTombstones::Get(file.location_);
+        auto iter = applied.find(file.location_);
+        for (auto id : tombstones->Ids()) {
+            if (iter == applied.end() || !iter->second->Contains(id)) {
+                late_ids.push_back(id);
+            }
+        }
+    }
+    return SegmentTombstones::Append(location, late_ids);
+}
+
+// attributes of a file merged from sources, a table without attributes writes none
+Status
+MergeAttrs(const std::string& location, const meta::TableFilesSchema& sources) {
+    std::vector<std::string> locations;
+    for (auto& file : sources) {
+        locations.push_back(file.location_);
+    }
+    return SegmentAttrs::Merge(location, locations);
+}
+
+// files of one date split by partition, compaction never mixes the vectors of two partitions
+std::map<std::string, meta::TableFilesSchema>
+GroupByPartition(const meta::TableFilesSchema& files) {
+    std::map<std::string, meta::TableFilesSchema> partition_files;
+    for (auto& file : files) {
+        partition_files[file.partition_tag_].push_back(file);
+    }
+    return partition_files;
+}
 
 }  // namespace
 
@@ -55,6 +128,7 @@ DBImpl::DBImpl(const DBOptions& options)
     : options_(options), shutting_down_(true), compact_thread_pool_(1, 1), index_thread_pool_(1, 1) {
     meta_ptr_ = MetaFactory::Build(options.meta_, options.mode_);
     mem_mgr_ = MemManagerFactory::Build(meta_ptr_, options_);
+    TierManager::GetInstance().Init(options_.tier_conf_);
     Start();
 }
 
@@ -74,10 +148,15 @@ DBImpl::Start() {
     ENGINE_LOG_TRACE << "DB service start";
     shutting_down_.store(false, std::memory_order_release);
 
+    LoadTableAccess();
+
     // for distribute version, some nodes are read only
     if (options_.mode_ != DBOptions::MODE::CLUSTER_READONLY) {
         ENGINE_LOG_TRACE << "StartTimerTasks";
         bg_timer_thread_ = std::thread(&DBImpl::BackgroundTimerTask, this);
+    } else {
+        catalog_ = std::make_shared<meta::TableFileCatalog>(options_.meta_);
+        catalog_thread_ = std::thread(&DBImpl::BackgroundCatalogTask, this);
     }
 
     return Status::OK();
@@ -95,7 +174,15 @@ DBImpl::Stop() {
     MemSerialize();
 
     // wait compaction/buildindex finish
-    bg_timer_thread_.join();
+    if (bg_timer_thread_.joinable()) {
+        bg_timer_thread_.join();
+    }
+    if (catalog_thread_.joinable()) {
+        catalog_thread_.join();
+    }
+
+    SaveTableAccess();
+    SaveCacheSnapshot();
 
     if (options_.mode_ != DBOptions::MODE::CLUSTER_READONLY) {
         meta_ptr_->CleanUp();
@@ -139,6 +226,9 @@ DBImpl::DeleteTable(const std::string& table_id, const meta::DatesT& dates) {
         scheduler::DeleteJobPtr job = std::make_shared<scheduler::DeleteJob>(table_id, meta_ptr_, nres);
         scheduler::JobMgrInst::GetInstance()->Put(job);
         job->WaitAndDelete();
+
+        std::lock_guard<std::mutex> lock(access_mutex_);
+        table_access_changed_ = table_access_.erase(table_id) > 0 || table_access_changed_;
     } else {
         meta_ptr_->DropPartitionsByDates(table_id, dates);
     }
@@ -176,7 +266,7 @@ DBImpl::AllTables(std::vector<meta::TableSchema>& table_schema_array) {
 }
 
 Status
-DBImpl::PreloadTable(const std::string& table_id) {
+DBImpl::PreloadTable(const std::string& table_id, PreloadProgress* progress) {
     if (shutting_down_.load(std::memory_order_acquire)) {
         return Status(DB_ERROR, "Milsvus server is shutdown!");
     }
@@ -185,7 +275,7 @@ DBImpl::PreloadTable(const std::string& table_id) {
 
     meta::DatesT dates;
     std::vector<size_t> ids;
-    auto status = meta_ptr_->FilesToSearch(table_id, ids, dates, files);
+    auto status = meta_ptr_->FilesToSearch(table_id, ids, dates, meta::PartitionTags(), files);
     if (!status.ok()) {
         return status;
     }
@@ -195,6 +285,9 @@ DBImpl::PreloadTable(const std::string& table_id) {
     int64_t cache_usage = cache::CpuCacheMgr::GetInstance()->CacheUsage();
     int64_t available_size = cache_total - cache_usage;
 
+    // step 1: pick the files fitting in the cache, mapped ivf files are only charged with their resident part
+    Status result = Status::OK();
+    std::vector<std::pair<meta::TableFileSchema, ExecutionEnginePtr>> to_load;
     for (auto& day_files : files) {
         for (auto& file : day_files.second) {
             ExecutionEnginePtr engine =
@@ -205,21 +298,200 @@ DBImpl::PreloadTable(const std::string& table_id) {
                 return Status(DB_ERROR, "Invalid engine type");
             }
 
-            size += engine->PhysicalSize();
+            bool mapped = file.file_type_ == meta::TableFileSchema::INDEX && engine->IsIndexMapped();
+            if (!mapped) {
+                size += file.file_size_;
+            }
             if (size > available_size) {
-                return Status(SERVER_CACHE_FULL, "Cache is full");
+                result = Status(SERVER_CACHE_FULL, "Cache is full");
+                break;
+            }
+            to_load.emplace_back(file, engine);
+        }
+        if (!result.ok()) {
+            break;
+        }
+    }
+
+    // step 2: fetch and load them in parallel
+    if (progress != nullptr) {
+        progress->files_total += to_load.size();
+    }
+    ThreadPool load_pool(std::max(options_.preload_thread_num_, 1));
+    std::vector<std::future<Status>> load_results;
+    for (auto& item : to_load) {
+        load_results.push_back(load_pool.enqueue([this, &item, progress]() {
+            Status status;
+            if (shutting_down_.load(std::memory_order_acquire)) {
+                status = Status(DB_ERROR, "Milsvus server is shutdown!");
             } else {
+                status = TierManager::GetInstance().Fetch(item.first);
                 try {
-                    // step 1: load index
-                    engine->Load(true);
+                    if (status.ok()) {
+                        status = item.second->Load(true);
+                    }
                 } catch (std::exception& ex) {
                     std::string msg = "Pre-load table encounter exception: " + std::string(ex.what());
                     ENGINE_LOG_ERROR << msg;
-                    return Status(DB_ERROR, msg);
+                    status = Status(DB_ERROR, msg);
+                }
+            }
+
+            if (progress != nullptr) {
+                if (status.ok()) {
+                    progress->files_loaded++;
+                    progress->bytes_loaded += item.first.file_size_;
+                } else {
+                    progress->files_failed++;
+                }
+            }
+            return status;
+        }));
+    }
+    for (auto& load_result : load_results) {
+        auto status = load_result.get();
+        if (!status.ok() && result.ok()) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+Status
+DBImpl::TablesByAccess(std::vector<std::string>& table_ids) {
+    std::vector<std::pair<uint64_t, std::string>> ranking;
+    {
+        std::lock_guard<std::mutex> lock(access_mutex_);
+        for (auto& iter : table_access_) {
+            ranking.emplace_back(iter.second, iter.first);
+        }
+    }
+    std::sort(ranking.begin(), ranking.end(), std::greater<std::pair<uint64_t, std::string>>());
+
+    table_ids.clear();
+    for (auto& item : ranking) {
+        table_ids.push_back(item.second);
+    }
+    return Status::OK();
+}
+
+Status
+DBImpl::WarmUpCache(PreloadProgress* progress) {
+    if (!options_.warm_restart_) {
+        return Status::OK();
+    }
+    if (shutting_down_.load(std::memory_order_acquire)) {
+        return Status(DB_ERROR, "Milsvus server is shutdown!");
+    }
+
+    struct SnapshotItem {
+        uint64_t hits_;
+        size_t recency_;
+        std::string location_;
+    };
+    std::vector<SnapshotItem> items;
+    {
+        std::ifstream file(options_.meta_.path_ + "/" + CACHE_SNAPSHOT_FILE);
+        std::string line;
+        while (std::getline(file, line)) {
+            // "<hits> <location>", a torn or edited snapshot must not stop the warm up
+            auto pos = line.find(' ');
+            char* end = nullptr;
+            errno = 0;
+            uint64_t hits = std::strtoull(line.c_str(), &end, 10);
+            bool valid = pos != std::string::npos && pos + 1 < line.size() &&
+                         std::isdigit(static_cast<unsigned char>(line[0])) && errno == 0 && end == line.c_str() + pos;
+            if (!valid) {
+                ENGINE_LOG_WARNING << "Skip malformed line of cache snapshot: " << line;
+                continue;
+            }
+            items.push_back(SnapshotItem{hits, items.size(), line.substr(pos + 1)});
+        }
+    }
+    // most hit first, recency breaks ties
+    std::sort(items.begin(), items.end(), [](const SnapshotItem& a, const SnapshotItem& b) {
+        return a.hits_ != b.hits_ ? a.hits_ > b.hits_ : a.recency_ < b.recency_;
+    });
+
+    // files merged or deleted since the snapshot are no longer searched, they are skipped
+    std::unordered_map<std::string, meta::TableFileSchema> files_by_location;
+    if (!items.empty()) {
+        std::vector<meta::TableSchema> tables;
+        auto status = meta_ptr_->AllTables(tables);
+        if (!status.ok()) {
+            return status;
+        }
+        for (auto& table : tables) {
+            meta::DatePartionedTableFilesSchema files;
+            status = meta_ptr_->FilesToSearch(table.table_id_, std::vector<size_t>(), meta::DatesT(),
+                                              meta::PartitionTags(), files);
+            if (!status.ok()) {
+                return status;
+            }
+            for (auto& day_files : files) {
+                for (auto& file : day_files.second) {
+                    files_by_location[file.location_] = file;
                 }
             }
         }
     }
+
+    auto cache_mgr = cache::CpuCacheMgr::GetInstance();
+    auto begin = std::chrono::steady_clock::now();
+    uint64_t bytes_read = 0;
+    for (auto& item : items) {
+        if (shutting_down_.load(std::memory_order_acquire)) {
+            return Status(DB_ERROR, "Milsvus server is shutdown!");
+        }
+
+        auto iter = files_by_location.find(item.location_);
+        if (iter == files_by_location.end() || cache_mgr->ItemExists(item.location_)) {
+            continue;
+        }
+        auto& file = iter->second;
+        if ((int64_t)file.file_size_ > cache_mgr->CacheCapacity() - cache_mgr->CacheUsage()) {
+            continue;
+        }
+
+        if (progress != nullptr) {
+            progress->files_total++;
+        }
+        ExecutionEnginePtr engine =
+            EngineFactory::Build(file.dimension_, file.location_, (EngineType)file.engine_type_,
+                                 (MetricType)file.metric_type_, file.nlist_);
+        Status status = Status(DB_ERROR, "Invalid engine type");
+        try {
+            if (engine != nullptr) {
+                status = TierManager::GetInstance().Fetch(file);
+            }
+            if (status.ok()) {
+                status = engine->Load(true);
+            }
+        } catch (std::exception& ex) {
+            status = Status(DB_ERROR, ex.what());
+        }
+        if (!status.ok()) {
+            ENGINE_LOG_WARNING << "Failed to warm up " << file.location_ << ": " << status.message();
+            if (progress != nullptr) {
+                progress->files_failed++;
+            }
+            continue;
+        }
+        if (progress != nullptr) {
+            progress->files_loaded++;
+            progress->bytes_loaded += file.file_size_;
+        }
+
+        // keep the average read rate under the limit, so that warming up doesn't starve the searches
+        bytes_read += file.file_size_;
+        auto due = begin + std::chrono::microseconds(bytes_read * 1000000 / options_.warm_up_io_rate_);
+        while (std::chrono::steady_clock::now() < due && !shutting_down_.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                due - std::chrono::steady_clock::now(), std::chrono::milliseconds(100)));
+        }
+    }
+
+    cache_warmed_up_ = true;
     return Status::OK();
 }
 
@@ -242,7 +514,8 @@ DBImpl::GetTableRowCount(const std::string& table_id, uint64_t& row_count) {
 }
 
 Status
-DBImpl::InsertVectors(const std::string& table_id, uint64_t n, const float* vectors, IDNumbers& vector_ids) {
+DBImpl::InsertVectors(const std::string& table_id, uint64_t n, const float* vectors, IDNumbers& vector_ids,
+                      const AttrColumns& attrs, const std::string& partition_tag) {
     //    ENGINE_LOG_DEBUG << "Insert " << n << " vectors to cache";
     if (shutting_down_.load(std::memory_order_acquire)) {
         return Status(DB_ERROR, "Milsvus server is shutdown!");
@@ -250,11 +523,120 @@ DBImpl::InsertVectors(const std::string& table_id, uint64_t n, const float* vect
 
     Status status;
     milvus::server::CollectInsertMetrics metrics(n, status);
-    status = mem_mgr_->InsertVectors(table_id, n, vectors, vector_ids);
+    status = mem_mgr_->InsertVectors(table_id, n, vectors, vector_ids, attrs, partition_tag);
 
     return status;
 }
 
+Status
+DBImpl::UpsertVectors(const std::string& table_id, uint64_t n, const float* vectors, IDNumbers& vector_ids,
+                      const AttrColumns& attrs, const std::string& partition_tag) {
+    if (shutting_down_.load(std::memory_order_acquire)) {
+        return Status(DB_ERROR, "Milsvus server is shutdown!");
+    }
+
+    // the old copies are looked up under the insert lock, so the id indexes are loaded before it is taken
+    auto status = PrepareDeleteFromFiles(table_id);
+    if (!status.ok()) {
+        return status;
+    }
+
+    milvus::server::CollectInsertMetrics metrics(n, status);
+    status = mem_mgr_->UpsertVectors(
+        table_id, n, vectors, vector_ids, attrs, partition_tag,
+        [this](const std::string& id, const IDNumbers& sorted_ids) { return DeleteFromFiles(id, sorted_ids); });
+
+    return status;
+}
+
+Status
+DBImpl::BuildIdLookupEngine(meta::TableFileSchema& file, ExecutionEnginePtr& engine) {
+    engine = EngineFactory::Build(file.dimension_, file.location_, (EngineType)file.engine_type_,
+                                  (MetricType)file.metric_type_, file.nlist_);
+    if (engine == nullptr) {
+        return Status(DB_ERROR, "Invalid engine type");
+    }
+
+    // id indexes stay on local disk when files are demoted, a missing one is rebuilt from the file
+    if (!boost::filesystem::exists(SegmentIdIndex::FileName(file.location_))) {
+        return TierManager::GetInstance().Fetch(file);
+    }
+    return Status::OK();
+}
+
+Status
+DBImpl::PrepareDeleteFromFiles(const std::string& table_id) {
+    std::vector<size_t> ids;
+    meta::DatePartionedTableFilesSchema files;
+    auto status = meta_ptr_->FilesToSearch(table_id, ids, meta::DatesT(), meta::PartitionTags(), files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    for (auto& day_files : files) {
+        for (auto& file : day_files.second) {
+            status = utils::CheckIdLookup(file);
+            if (!status.ok()) {
+                return Status(DB_ERROR, "Upsert is not supported by table " + table_id + ": " + status.message());
+            }
+
+            ExecutionEnginePtr engine;
+            status = BuildIdLookupEngine(file, engine);
+            if (!status.ok()) {
+                return status;
+            }
+            status = engine->LoadIdIndex();
+            if (!status.ok()) {
+                return status;
+            }
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+DBImpl::DeleteFromFiles(const std::string& table_id, const IDNumbers& sorted_ids) {
+    // a merge or index build cannot publish a file built from these files until the tombstones are written
+    std::lock_guard<std::mutex> lock(SegmentTombstones::WriteMutex());
+
+    std::vector<size_t> ids;
+    meta::DatePartionedTableFilesSchema files;
+    auto status = meta_ptr_->FilesToSearch(table_id, ids, meta::DatesT(), meta::PartitionTags(), files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    for (auto& day_files : files) {
+        for (auto& file : day_files.second) {
+            // an index built after PrepareDeleteFromFiles
+            status = utils::CheckIdLookup(file);
+            if (!status.ok()) {
+                return Status(DB_ERROR, "Upsert is not supported by table " + table_id + ": " + status.message());
+            }
+
+            ExecutionEnginePtr engine;
+            status = BuildIdLookupEngine(file, engine);
+            if (!status.ok()) {
+                return status;
+            }
+
+            // the bloom filter of the file rejects most of the batch before the sorted ids are joined
+            IDNumbers found;
+            status = engine->FindIDs(sorted_ids, found);
+            if (!status.ok()) {
+                return status;
+            }
+            status = SegmentTombstones::Append(file.location_, found);
+            if (!status.ok()) {
+                return status;
+            }
+        }
+    }
+
+    return Status::OK();
+}
+
 Status
 DBImpl::CreateIndex(const std::string& table_id, const TableIndex& index) {
     {
@@ -349,17 +731,48 @@ DBImpl::Query(const std::string& table_id, uint64_t k, uint64_t nq, uint64_t npr
 
 Status
 DBImpl::Query(const std::string& table_id, uint64_t k, uint64_t nq, uint64_t nprobe, const float* vectors,
-              const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) {
+              const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances,
+              const AttrFilterPtr& filter, const meta::PartitionTags& partition_tags) {
     if (shutting_down_.load(std::memory_order_acquire)) {
         return Status(DB_ERROR, "Milsvus server is shutdown!");
     }
 
-    ENGINE_LOG_DEBUG << "Query by dates for table: " << table_id << " date range count: " << dates.size();
+    ENGINE_LOG_DEBUG << "Query by dates for table: " << table_id << " date range count: " << dates.size()
+                     << " partition count: " << partition_tags.size();
 
     // get all table files from table
     meta::DatePartionedTableFilesSchema files;
     std::vector<size_t> ids;
-    auto status = meta_ptr_->FilesToSearch(table_id, ids, dates, files);
+    Status status;
+    if (catalog_ == nullptr || !catalog_->FilesToSearch(table_id, dates, partition_tags, files)) {
+        server::ScopedTraceSpan span(server::GetThreadTraceContext(), "meta files to search");
+        uint64_t token = (catalog_ != nullptr) ? catalog_->BeginLoad(table_id) : 0;
+        if (token == 0) {
+            status = meta_ptr_->FilesToSearch(table_id, ids, dates, partition_tags, files);
+        } else {
+            // load the whole table into the catalog, the following searches needn't go to meta
+            meta::TableSchema table_schema;
+            meta::DatePartionedTableFilesSchema table_files;
+            table_schema.table_id_ = table_id;
+            status = meta_ptr_->DescribeTable(table_schema);
+            if (status.ok()) {
+                status = meta_ptr_->FilesToSearch(table_id, ids, meta::DatesT(), meta::PartitionTags(), table_files);
+            }
+            if (!status.ok()) {
+                catalog_->AbortLoad(table_id, token);
+                return status;
+            }
+
+            std::vector<std::string> evicted;
+            catalog_->FinishLoad(token, table_schema, table_files, evicted);
+            for (auto& location : evicted) {
+                cache::CpuCacheMgr::GetInstance()->EraseItem(location);
+            }
+            if (!catalog_->FilesToSearch(table_id, dates, partition_tags, files)) {
+                status = meta_ptr_->FilesToSearch(table_id, ids, dates, partition_tags, files);
+            }
+        }
+    }
     if (!status.ok()) {
         return status;
     }
@@ -372,7 +785,7 @@ DBImpl::Query(const std::string& table_id, uint64_t k, uint64_t nq, uint64_t npr
     }
 
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(table_id, file_id_array, k, nq, nprobe, vectors, result_ids, result_distances);
+    status = QueryAsync(table_id, file_id_array, k, nq, nprobe, vectors, result_ids, result_distances, filter);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
     return status;
 }
@@ -380,7 +793,7 @@ DBImpl::Query(const std::string& table_id, uint64_t k, uint64_t nq, uint64_t npr
 Status
 DBImpl::Query(const std::string& table_id, const std::vector<std::string>& file_ids, uint64_t k, uint64_t nq,
               uint64_t nprobe, const float* vectors, const meta::DatesT& dates, ResultIds& result_ids,
-              ResultDistances& result_distances) {
+              ResultDistances& result_distances, const AttrFilterPtr& filter) {
     if (shutting_down_.load(std::memory_order_acquire)) {
         return Status(DB_ERROR, "Milsvus server is shutdown!");
     }
@@ -397,7 +810,11 @@ DBImpl::Query(const std::string& table_id, const std::vector<std::string>& file_
     }
 
     meta::DatePartionedTableFilesSchema files_array;
-    auto status = meta_ptr_->FilesToSearch(table_id, ids, dates, files_array);
+    Status status;
+    {
+        server::ScopedTraceSpan span(server::GetThreadTraceContext(), "meta files to search");
+        status = meta_ptr_->FilesToSearch(table_id, ids, dates, meta::PartitionTags(), files_array);
+    }
     if (!status.ok()) {
         return status;
     }
@@ -414,11 +831,76 @@ DBImpl::Query(const std::string& table_id, const std::vector<std::string>& file_
     }
 
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(table_id, file_id_array, k, nq, nprobe, vectors, result_ids, result_distances);
+    status = QueryAsync(table_id, file_id_array, k, nq, nprobe, vectors, result_ids, result_distances, filter);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
     return status;
 }
 
+Status
+DBImpl::GetVectorByID(const std::string& table_id, IDNumber vector_id, std::vector<float>& vector) {
+    if (shutting_down_.load(std::memory_order_acquire)) {
+        return Status(DB_ERROR, "Milsvus server is shutdown!");
+    }
+
+    // vectors still in the insert buffer are not visible, as for searches
+    std::vector<size_t> ids;
+    meta::DatePartionedTableFilesSchema files;
+    auto status = meta_ptr_->FilesToSearch(table_id, ids, meta::DatesT(), meta::PartitionTags(), files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // the id index of each file rejects it by its bloom filter, only the file holding the id is loaded
+    for (auto& day_files : files) {
+        for (auto& file : day_files.second) {
+            // skipped before anything is loaded
+            status = utils::CheckIdLookup(file);
+            if (!status.ok()) {
+                ENGINE_LOG_DEBUG << "Skip " << file.location_ << " in lookup by id: " << status.message();
+                continue;
+            }
+
+            ExecutionEnginePtr engine;
+            status = BuildIdLookupEngine(file, engine);
+            if (!status.ok()) {
+                return status;
+            }
+
+            int64_t slot = 0;
+            bool found = false;
+            status = engine->FindID(vector_id, slot, found);
+            if (!status.ok()) {
+                return status;
+            }
+            if (!found || SegmentTombstones::Get(file.location_)->Contains(vector_id)) {
+                continue;
+            }
+
+            status = TierManager::GetInstance().Fetch(file);
+            if (!status.ok()) {
+                return status;
+            }
+            vector.resize(file.dimension_);
+            return engine->GetVector(slot, vector.data());
+        }
+    }
+
+    vector.clear();
+    return Status(DB_NOT_FOUND, "Vector id " + std::to_string(vector_id) + " not found in table " + table_id);
+}
+
+Status
+DBImpl::QueryByID(const std::string& table_id, uint64_t k, uint64_t nprobe, IDNumber vector_id,
+                  const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) {
+    std::vector<float> vector;
+    auto status = GetVectorByID(table_id, vector_id, vector);
+    if (!status.ok()) {
+        return status;
+    }
+
+    return Query(table_id, k, 1, nprobe, vector.data(), dates, result_ids, result_distances);
+}
+
 Status
 DBImpl::Size(uint64_t& result) {
     if (shutting_down_.load(std::memory_order_acquire)) {
@@ -433,27 +915,92 @@ DBImpl::Size(uint64_t& result) {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 Status
 DBImpl::QueryAsync(const std::string& table_id, const meta::TableFilesSchema& files, uint64_t k, uint64_t nq,
-                   uint64_t nprobe, const float* vectors, ResultIds& result_ids, ResultDistances& result_distances) {
+                   uint64_t nprobe, const float* vectors, ResultIds& result_ids, ResultDistances& result_distances,
+                   const AttrFilterPtr& filter) {
+    // the caller bounds the query with the cancel token of its thread, the same way it passes its trace context
+    auto& cancel_token = knowhere::CancelScope::Current();
+    if (cancel_token != nullptr && cancel_token->Cancelled()) {
+        server::Metrics::GetInstance().SearchCancelledIncrement("scheduler");
+        return Status(DB_TIMEOUT, "Search deadline exceeded before the query started");
+    }
+
     server::CollectQueryMetrics metrics(nq);
+    server::Metrics::GetInstance().SearchNqHistogramObserve(table_id, nq);
+    {
+        std::lock_guard<std::mutex> lock(access_mutex_);
+        table_access_[table_id]++;
+        table_access_changed_ = true;
+    }
+    server::Metrics::GetInstance().SearchTopkHistogramObserve(table_id, k);
 
     TimeRecorder rc("");
 
     // step 1: get files to search
     ENGINE_LOG_DEBUG << "Engine query begin, index file count: " << files.size();
     scheduler::SearchJobPtr job = std::make_shared<scheduler::SearchJob>(k, nq, nprobe, vectors);
+    meta::TableFilesSchema search_files;
     for (auto& file : files) {
+        if (filter != nullptr) {
+            // files whose zone maps or bitmap leave no row are not loaded at all
+            auto attrs = SegmentAttrs::Get(file.location_);
+            if (!filter->MayMatch(*attrs)) {
+                continue;
+            }
+
+            AttrBitmap bitmap;
+            filter->Evaluate(*attrs, bitmap);
+            auto tombstones = SegmentTombstones::Get(file.location_);
+            if (!tombstones->Empty()) {
+                std::vector<int64_t> deleted_rows;
+                auto& row_ids = attrs->Ids();
+                bitmap.ForEach([&](int64_t row) {
+                    if (tombstones->Contains(row_ids[row])) {
+                        deleted_rows.push_back(row);
+                    }
+                });
+                for (auto row : deleted_rows) {
+                    bitmap.Clear(row);
+                }
+            }
+            if (bitmap.Count() == 0) {
+                continue;
+            }
+            job->AddAllowList(file.id_, std::make_shared<AttrAllowList>(attrs, std::move(bitmap)));
+        }
+
         scheduler::TableFileSchemaPtr file_ptr = std::make_shared<meta::TableFileSchema>(file);
         job->AddIndexFile(file_ptr);
+        search_files.push_back(file);
+    }
+    if (filter != nullptr) {
+        ENGINE_LOG_DEBUG << "Attribute filter keeps " << search_files.size() << " of " << files.size() << " files";
+    }
+
+    auto trace_context = server::GetThreadTraceContext();
+    if (trace_context != nullptr) {
+        trace_context->SetAttribute("index_file_count", std::to_string(search_files.size()));
+        job->set_trace_context(trace_context);
+    }
+    job->set_cancel_token(cancel_token);
+
+    // step 2: queue until the work of the job fits into the search capacity
+    auto admission = scheduler::AdmissionMgrInst::GetInstance();
+    int64_t work = nq * search_files.size();
+    if (not admission->Admit(work, cancel_token)) {
+        server::Metrics::GetInstance().SearchCancelledIncrement("admission");
+        return Status(DB_TIMEOUT, "Search deadline exceeded while waiting for admission");
     }
 
-    // step 2: put search task to scheduler
+    // step 3: put search task to scheduler, cold files are fetched ahead of the loader
+    TierManager::GetInstance().Prefetch(search_files);
     scheduler::JobMgrInst::GetInstance()->Put(job);
     job->WaitResult();
+    admission->Release(work);
     if (!job->GetStatus().ok()) {
         return job->GetStatus();
     }
 
-    // step 3: construct results
+    // step 4: construct results
     result_ids = job->GetResultIds();
     result_distances = job->GetResultDistances();
     rc.ElapseFromBegin("Engine query totally cost");
@@ -479,6 +1026,72 @@ DBImpl::BackgroundTimerTask() {
         StartMetricTask();
         StartCompactionTask();
         StartBuildIndexTask();
+        StartSnapshotTask();
+    }
+}
+
+void
+DBImpl::BackgroundCatalogTask() {
+    meta::ChangeFeedReader reader(options_.meta_.path_ + "/" + meta::CHANGE_FEED_FILE);
+    auto cache_mgr = cache::CpuCacheMgr::GetInstance();
+    while (true) {
+        if (shutting_down_.load(std::memory_order_acquire)) {
+            ENGINE_LOG_DEBUG << "DB catalog thread exit";
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(CATALOG_TAIL_INTERVAL_MS));
+
+        meta::FileChanges changes;
+        bool reset = false;
+        auto status = reader.Tail(changes, reset);
+        if (!status.ok()) {
+            ENGINE_LOG_WARNING << "Failed to tail change feed: " << status.message();
+            continue;
+        }
+        if (reset) {
+            ENGINE_LOG_WARNING << "Missed some changes of the feed, tables are read from meta again";
+            catalog_->Clear();
+        }
+        if (changes.empty()) {
+            continue;
+        }
+
+        // merged away files are evicted at once, new index files are loaded before the searches need them
+        std::vector<std::string> evicted;
+        meta::TableFilesSchema indexed;
+        catalog_->Apply(changes, evicted, indexed);
+        for (auto& location : evicted) {
+            cache_mgr->EraseItem(location);
+        }
+
+        for (auto& file : indexed) {
+            if (shutting_down_.load(std::memory_order_acquire)) {
+                break;
+            }
+            if (cache_mgr->ItemExists(file.location_) ||
+                (int64_t)file.file_size_ > cache_mgr->CacheCapacity() - cache_mgr->CacheUsage()) {
+                continue;
+            }
+
+            ExecutionEnginePtr engine =
+                EngineFactory::Build(file.dimension_, file.location_, (EngineType)file.engine_type_,
+                                     (MetricType)file.metric_type_, file.nlist_);
+            status = Status(DB_ERROR, "Invalid engine type");
+            try {
+                if (engine != nullptr) {
+                    status = TierManager::GetInstance().Fetch(file);
+                }
+                if (status.ok()) {
+                    status = engine->Load(true);
+                }
+            } catch (std::exception& ex) {
+                status = Status(DB_ERROR, ex.what());
+            }
+            if (!status.ok()) {
+                ENGINE_LOG_WARNING << "Failed to load new index file " << file.location_ << ": " << status.message();
+            }
+        }
     }
 }
 
@@ -519,6 +1132,13 @@ DBImpl::StartMetricTask() {
     }
 
     server::Metrics::GetInstance().GpuCacheUsageGaugeSet();
+
+    auto huge_page_stats = knowhere::GetHugePageStats();
+    server::Metrics::GetInstance().HugePageBytesGaugeSet("hugetlb", huge_page_stats.hugetlb_bytes);
+    server::Metrics::GetInstance().HugePageBytesGaugeSet("madvise", huge_page_stats.madvise_bytes);
+    server::Metrics::GetInstance().HugePageBytesGaugeSet("fallback", huge_page_stats.fallback_bytes);
+    server::Metrics::GetInstance().HugePageBytesGaugeSet("advised", huge_page_stats.advised_bytes);
+
     uint64_t size;
     Size(size);
     server::Metrics::GetInstance().DataFileSizeGaugeSet(size);
@@ -535,6 +1155,71 @@ DBImpl::StartMetricTask() {
     ENGINE_LOG_TRACE << "Metric task finished";
 }
 
+void
+DBImpl::StartSnapshotTask() {
+    static uint64_t snapshot_clock_tick = 0;
+    snapshot_clock_tick++;
+    if (snapshot_clock_tick % SNAPSHOT_INTERVAL != 0) {
+        return;
+    }
+
+    SaveTableAccess();
+    SaveCacheSnapshot();
+}
+
+void
+DBImpl::LoadTableAccess() {
+    std::ifstream file(options_.meta_.path_ + "/" + TABLE_ACCESS_FILE);
+    if (!file.is_open()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(access_mutex_);
+    std::string table_id;
+    uint64_t count = 0;
+    while (file >> table_id >> count) {
+        table_access_[table_id] += count;
+    }
+}
+
+void
+DBImpl::SaveTableAccess() {
+    std::string content;
+    {
+        std::lock_guard<std::mutex> lock(access_mutex_);
+        if (!table_access_changed_) {
+            return;
+        }
+        for (auto& iter : table_access_) {
+            content += iter.first + " " + std::to_string(iter.second) + "\n";
+        }
+        table_access_changed_ = false;
+    }
+
+    std::string path = options_.meta_.path_ + "/" + TABLE_ACCESS_FILE;
+    if (!ReplaceFile(path, content)) {
+        ENGINE_LOG_WARNING << "Failed to save table access ranking to " << path;
+    }
+}
+
+void
+DBImpl::SaveCacheSnapshot() {
+    if (!options_.warm_restart_ || !cache_warmed_up_) {
+        return;
+    }
+
+    // one "<hits> <location>" line per cached index file, most recently used first
+    std::string content;
+    for (auto& item : cache::CpuCacheMgr::GetInstance()->Snapshot()) {
+        content += std::to_string(item.second) + " " + item.first + "\n";
+    }
+
+    std::string path = options_.meta_.path_ + "/" + CACHE_SNAPSHOT_FILE;
+    if (!ReplaceFile(path, content)) {
+        ENGINE_LOG_WARNING << "Failed to save cache snapshot to " << path;
+    }
+}
+
 Status
 DBImpl::MemSerialize() {
     std::lock_guard<std::mutex> lck(mem_serialize_mutex_);
@@ -592,6 +1277,7 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::DateT& date, const m
     meta::TableFileSchema table_file;
     table_file.table_id_ = table_id;
     table_file.date_ = date;
+    table_file.partition_tag_ = files.front().partition_tag_;
     table_file.file_type_ = meta::TableFileSchema::NEW_MERGE;
     Status status = meta_ptr_->CreateTableFile(table_file);
 
@@ -606,11 +1292,14 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::DateT& date, const m
                              (MetricType)table_file.metric_type_, table_file.nlist_);
 
     meta::TableFilesSchema updated;
+    std::map<std::string, SegmentTombstonesPtr> applied;
     int64_t index_size = 0;
 
     for (auto& file : files) {
+        YieldToSearches();
         server::CollectMergeFilesMetrics metrics;
 
+        applied[file.location_] = SegmentTombstones::Get(file.location_);
         index->Merge(file.location_);
         auto file_schema = file;
         file_schema.file_type_ = meta::TableFileSchema::TO_DELETE;
@@ -644,7 +1333,10 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::DateT& date, const m
     // step 4: update table files state
     // if index type isn't IDMAP, set file type to TO_INDEX if file size execeed index_file_size
     // else set file type to RAW, no need to build index
-    if (table_file.engine_type_ != (int)EngineType::FAISS_IDMAP) {
+    // an extended graph is an index already
+    if (files.front().file_type_ == meta::TableFileSchema::INDEX) {
+        table_file.file_type_ = meta::TableFileSchema::INDEX;
+    } else if (table_file.engine_type_ != (int)EngineType::FAISS_IDMAP) {
         table_file.file_type_ = (index->PhysicalSize() >= table_file.index_file_size_) ? meta::TableFileSchema::TO_INDEX
                                                                                        : meta::TableFileSchema::RAW;
     } else {
@@ -652,8 +1344,25 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::DateT& date, const m
     }
     table_file.file_size_ = index->PhysicalSize();
     table_file.row_count_ = index->Count();
-    updated.push_back(table_file);
-    status = meta_ptr_->UpdateTableFiles(updated);
+    status = MergeAttrs(table_file.location_, updated);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Failed to merge attributes: " << status.ToString();
+        table_file.file_type_ = meta::TableFileSchema::TO_DELETE;
+        meta_ptr_->UpdateTableFile(table_file);
+        return status;
+    }
+    {
+        std::lock_guard<std::mutex> lock(SegmentTombstones::WriteMutex());
+        status = CarryTombstones(table_file.location_, updated, applied);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Failed to carry tombstones to merged file: " << status.ToString();
+            table_file.file_type_ = meta::TableFileSchema::TO_DELETE;
+            meta_ptr_->UpdateTableFile(table_file);
+            return status;
+        }
+        updated.push_back(table_file);
+        status = meta_ptr_->UpdateTableFiles(updated);
+    }
     ENGINE_LOG_DEBUG << "New merged file " << table_file.file_id_ << " of size " << index->PhysicalSize() << " bytes";
 
     if (options_.insert_cache_immediately_) {
@@ -663,6 +1372,47 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::DateT& date, const m
     return status;
 }
 
+void
+DBImpl::YieldToSearches() {
+    // compaction runs outside the scheduler, it gives the cpus to running searches between two files
+    auto admission = scheduler::AdmissionMgrInst::GetInstance();
+    for (int64_t waited = 0; waited < COMPACTION_YIELD_MAX_MS && admission->Running() > 0; ++waited) {
+        if (shutting_down_.load(std::memory_order_acquire)) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+bool
+DBImpl::FindGraphToExtend(const std::string& table_id, const meta::DateT& date, const std::string& partition_tag,
+                          meta::TableFileSchema& graph_file) {
+    meta::DatePartionedTableFilesSchema files;
+    auto status = meta_ptr_->FilesToSearch(table_id, {}, {date}, {}, files);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Failed to get index files for table: " << table_id;
+        return false;
+    }
+
+    bool found = false;
+    for (auto& file : files[date]) {
+        if (file.file_type_ != meta::TableFileSchema::INDEX || file.tier_ != meta::TableFileSchema::LOCAL ||
+            file.engine_type_ != (int)EngineType::NSG_MIX || file.partition_tag_ != partition_tag) {
+            continue;
+        }
+        uint64_t raw_size = file.row_count_ * file.dimension_ * sizeof(float);
+        if (raw_size >= (uint64_t)file.index_file_size_) {
+            continue;
+        }
+        // the smallest segment, it takes the most raw files before it is full
+        if (!found || file.row_count_ < graph_file.row_count_) {
+            graph_file = file;
+            found = true;
+        }
+    }
+    return found;
+}
+
 Status
 DBImpl::BackgroundMergeFiles(const std::string& table_id) {
     meta::DatePartionedTableFilesSchema raw_files;
@@ -673,18 +1423,181 @@ DBImpl::BackgroundMergeFiles(const std::string& table_id) {
     }
 
     for (auto& kv : raw_files) {
-        auto files = kv.second;
-        if (files.size() < options_.merge_trigger_number_) {
-            ENGINE_LOG_DEBUG << "Files number not greater equal than merge trigger number, skip merge action";
-            continue;
+        for (auto& partition : GroupByPartition(kv.second)) {
+            auto& files = partition.second;
+            if (files.size() < options_.merge_trigger_number_) {
+                ENGINE_LOG_DEBUG << "Files number not greater equal than merge trigger number, skip merge action";
+                continue;
+            }
+
+            // raw files extend an undersized graph segment, they are graph searchable without a rebuild
+            if (files.front().engine_type_ == (int)EngineType::NSG_MIX) {
+                meta::TableFileSchema graph_file;
+                if (FindGraphToExtend(table_id, kv.first, partition.first, graph_file)) {
+                    files.insert(files.begin(), graph_file);
+                }
+            }
+
+            MergeFiles(table_id, kv.first, files);
+
+            if (shutting_down_.load(std::memory_order_acquire)) {
+                ENGINE_LOG_DEBUG << "Server will shutdown, skip merge action for table: " << table_id;
+                return Status::OK();
+            }
         }
+    }
 
-        MergeFiles(table_id, kv.first, kv.second);
+    return Status::OK();
+}
 
-        if (shutting_down_.load(std::memory_order_acquire)) {
-            ENGINE_LOG_DEBUG << "Server will shutdown, skip merge action for table: " << table_id;
+Status
+DBImpl::MergeIndexFiles(const std::string& table_id, const meta::DateT& date, const meta::TableFilesSchema& files) {
+    ENGINE_LOG_DEBUG << "Merge index files for table: " << table_id;
+
+    // step 1: create table file
+    meta::TableFileSchema table_file;
+    table_file.table_id_ = table_id;
+    table_file.date_ = date;
+    table_file.partition_tag_ = files.front().partition_tag_;
+    table_file.file_type_ = meta::TableFileSchema::NEW_MERGE;
+    Status status = meta_ptr_->CreateTableFile(table_file);
+
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Failed to create table: " << status.ToString();
+        return status;
+    }
+
+    // step 2: concatenate the inverted lists, no file is touched until the merged one is persisted
+    ExecutionEnginePtr index =
+        EngineFactory::Build(table_file.dimension_, table_file.location_, (EngineType)table_file.engine_type_,
+                             (MetricType)table_file.metric_type_, table_file.nlist_);
+
+    meta::TableFilesSchema updated;
+    for (auto& file : files) {
+        if (file.engine_type_ != table_file.engine_type_) {
+            continue;  // built before the table index changed
+        }
+
+        YieldToSearches();
+        server::CollectMergeFilesMetrics metrics;
+        status = index->Merge(file.location_);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Failed to merge index file " << file.file_id_ << ": " << status.ToString();
             break;
         }
+        auto file_schema = file;
+        file_schema.file_type_ = meta::TableFileSchema::TO_DELETE;
+        updated.push_back(file_schema);
+        ENGINE_LOG_DEBUG << "Merging index file " << file_schema.file_id_;
+
+        if (index->Count() * index->Dimension() * sizeof(float) >= (uint64_t)table_file.index_file_size_) {
+            break;
+        }
+    }
+
+    if (updated.size() < 2) {
+        // nothing to coalesce, a single source file would only be copied
+        table_file.file_type_ = meta::TableFileSchema::TO_DELETE;
+        meta_ptr_->UpdateTableFile(table_file);
+        return status;
+    }
+
+    // step 3: serialize to disk
+    try {
+        index->Serialize();
+    } catch (std::exception& ex) {
+        std::string msg = "Serialize merged index encounter exception: " + std::string(ex.what());
+        ENGINE_LOG_ERROR << msg;
+
+        table_file.file_type_ = meta::TableFileSchema::TO_DELETE;
+        status = meta_ptr_->UpdateTableFile(table_file);
+        ENGINE_LOG_DEBUG << "Failed to update file to index, mark file: " << table_file.file_id_ << " to to_delete";
+
+        return Status(DB_ERROR, msg);
+    }
+
+    // step 4: the merged file is searchable as an index at once, the sources are dropped in the same update
+    table_file.file_type_ = meta::TableFileSchema::INDEX;
+    table_file.file_size_ = index->PhysicalSize();
+    table_file.row_count_ = index->Count();
+    status = MergeAttrs(table_file.location_, updated);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Failed to merge attributes to merged index file: " << status.ToString();
+        table_file.file_type_ = meta::TableFileSchema::TO_DELETE;
+        meta_ptr_->UpdateTableFile(table_file);
+        return status;
+    }
+    {
+        // inverted lists are concatenated as they are, every tombstone of the sources still applies
+        std::lock_guard<std::mutex> lock(SegmentTombstones::WriteMutex());
+        status = CarryTombstones(table_file.location_, updated, {});
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Failed to carry tombstones to merged index file: " << status.ToString();
+            table_file.file_type_ = meta::TableFileSchema::TO_DELETE;
+            meta_ptr_->UpdateTableFile(table_file);
+            return status;
+        }
+        updated.push_back(table_file);
+        status = meta_ptr_->UpdateTableFiles(updated);
+    }
+    ENGINE_LOG_DEBUG << "New merged index file " << table_file.file_id_ << " of size " << index->PhysicalSize()
+                     << " bytes from " << updated.size() - 1 << " files";
+
+    if (options_.insert_cache_immediately_) {
+        index->Cache();
+    }
+
+    return status;
+}
+
+Status
+DBImpl::BackgroundMergeIndexFiles(const std::string& table_id) {
+    meta::DatePartionedTableFilesSchema files;
+    auto status = meta_ptr_->FilesToSearch(table_id, {}, {}, {}, files);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Failed to get index files for table: " << table_id;
+        return status;
+    }
+
+    for (auto& kv : files) {
+        for (auto& partition : GroupByPartition(kv.second)) {
+            // every index segment costs a coarse quantizer pass per query, coalesce the undersized ones
+            meta::TableFilesSchema small_files;
+            for (auto& file : partition.second) {
+                if (file.file_type_ != meta::TableFileSchema::INDEX || file.tier_ != meta::TableFileSchema::LOCAL) {
+                    continue;
+                }
+                // segments train their own quantizers, only flat lists can take vectors assigned by another one;
+                // sq8 codes would be encoded a second time with the ranges of the target segment
+                if (file.engine_type_ != (int)EngineType::FAISS_IVFFLAT) {
+                    continue;
+                }
+                // an index file with deleted vectors may hold the old copy of a live vector of another small file,
+                // the tombstones carried over to the merged file would delete both
+                if (!SegmentTombstones::Get(file.location_)->Empty()) {
+                    continue;
+                }
+                // index files are compressed, compare the raw size they hold with the segment size
+                uint64_t raw_size = file.row_count_ * file.dimension_ * sizeof(float);
+                if (raw_size < (uint64_t)file.index_file_size_) {
+                    small_files.push_back(file);
+                }
+            }
+
+            if (small_files.size() < options_.merge_trigger_number_) {
+                continue;
+            }
+
+            status = MergeIndexFiles(table_id, kv.first, small_files);
+            if (!status.ok()) {
+                ENGINE_LOG_ERROR << "Merge index files for table " << table_id << " failed: " << status.ToString();
+            }
+
+            if (shutting_down_.load(std::memory_order_acquire)) {
+                ENGINE_LOG_DEBUG << "Server will shutdown, skip merge action for table: " << table_id;
+                return Status::OK();
+            }
+        }
     }
 
     return Status::OK();
@@ -701,13 +1614,24 @@ DBImpl::BackgroundCompaction(std::set<std::string> table_ids) {
             ENGINE_LOG_ERROR << "Merge files for table " << table_id << " failed: " << status.ToString();
         }
 
+        status = BackgroundMergeIndexFiles(table_id);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Merge index files for table " << table_id << " failed: " << status.ToString();
+        }
+
         if (shutting_down_.load(std::memory_order_acquire)) {
             ENGINE_LOG_DEBUG << "Server will shutdown, skip merge action";
             break;
         }
     }
 
-    meta_ptr_->Archive();
+    meta::TableFilesSchema archived;
+    meta_ptr_->Archive(archived);
+
+    status = TierManager::GetInstance().Demote(meta_ptr_);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Demote cold files failed: " << status.ToString();
+    }
 
     int ttl = 5 * meta::M_SEC;  // default: file will be deleted after 5 minutes
     if (options_.mode_ == DBOptions::MODE::CLUSTER_WRITABLE) {
@@ -30,6 +30,7 @@
 #include <set>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace milvus {
@@ -39,6 +40,7 @@ class Env;
 
 namespace meta {
 class Meta;
+class TableFileCatalog;
 }
 
 class DBImpl : public DB {
@@ -69,7 +71,13 @@ class DBImpl : public DB {
     AllTables(std::vector<meta::TableSchema>& table_schema_array) override;
 
     Status
-    PreloadTable(const std::string& table_id) override;
+    PreloadTable(const std::string& table_id, PreloadProgress* progress = nullptr) override;
+
+    Status
+    TablesByAccess(std::vector<std::string>& table_ids) override;
+
+    Status
+    WarmUpCache(PreloadProgress* progress = nullptr) override;
 
     Status
     UpdateTableFlag(const std::string& table_id, int64_t flag);
@@ -78,7 +86,12 @@ class DBImpl : public DB {
     GetTableRowCount(const std::string& table_id, uint64_t& row_count) override;
 
     Status
-    InsertVectors(const std::string& table_id, uint64_t n, const float* vectors, IDNumbers& vector_ids) override;
+    InsertVectors(const std::string& table_id, uint64_t n, const float* vectors, IDNumbers& vector_ids,
+                  const AttrColumns& attrs = AttrColumns(), const std::string& partition_tag = "") override;
+
+    Status
+    UpsertVectors(const std::string& table_id, uint64_t n, const float* vectors, IDNumbers& vector_ids,
+                  const AttrColumns& attrs = AttrColumns(), const std::string& partition_tag = "") override;
 
     Status
     CreateIndex(const std::string& table_id, const TableIndex& index) override;
@@ -95,12 +108,21 @@ class DBImpl : public DB {
 
     Status
     Query(const std::string& table_id, uint64_t k, uint64_t nq, uint64_t nprobe, const float* vectors,
-          const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) override;
+          const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances,
+          const AttrFilterPtr& filter = nullptr,
+          const meta::PartitionTags& partition_tags = meta::PartitionTags()) override;
 
     Status
     Query(const std::string& table_id, const std::vector<std::string>& file_ids, uint64_t k, uint64_t nq,
           uint64_t nprobe, const float* vectors, const meta::DatesT& dates, ResultIds& result_ids,
-          ResultDistances& result_distances) override;
+          ResultDistances& result_distances, const AttrFilterPtr& filter = nullptr) override;
+
+    Status
+    GetVectorByID(const std::string& table_id, IDNumber vector_id, std::vector<float>& vector) override;
+
+    Status
+    QueryByID(const std::string& table_id, uint64_t k, uint64_t nprobe, IDNumber vector_id, const meta::DatesT& dates,
+              ResultIds& result_ids, ResultDistances& result_distances) override;
 
     Status
     Size(uint64_t& result) override;
@@ -108,11 +130,25 @@ class DBImpl : public DB {
  private:
     Status
     QueryAsync(const std::string& table_id, const meta::TableFilesSchema& files, uint64_t k, uint64_t nq,
-               uint64_t nprobe, const float* vectors, ResultIds& result_ids, ResultDistances& result_distances);
+               uint64_t nprobe, const float* vectors, ResultIds& result_ids, ResultDistances& result_distances,
+               const AttrFilterPtr& filter);
+
+    // engine to look vectors of the file up by id, a missing id index is fetched with the file to be rebuilt
+    Status
+    BuildIdLookupEngine(meta::TableFileSchema& file, ExecutionEnginePtr& engine);
+
+    // reject tables with index files that cannot be searched by id, and cache the id indexes of the others
+    Status
+    PrepareDeleteFromFiles(const std::string& table_id);
+
+    Status
+    DeleteFromFiles(const std::string& table_id, const IDNumbers& sorted_ids);
 
     void
     BackgroundTimerTask();
     void
+    BackgroundCatalogTask();
+    void
     WaitMergeFileFinish();
     void
     WaitBuildIndexFinish();
@@ -122,10 +158,19 @@ class DBImpl : public DB {
 
     void
     StartCompactionTask();
+    void
+    YieldToSearches();
     Status
     MergeFiles(const std::string& table_id, const meta::DateT& date, const meta::TableFilesSchema& files);
+    bool
+    FindGraphToExtend(const std::string& table_id, const meta::DateT& date, const std::string& partition_tag,
+                      meta::TableFileSchema& graph_file);
     Status
     BackgroundMergeFiles(const std::string& table_id);
+    Status
+    MergeIndexFiles(const std::string& table_id, const meta::DateT& date, const meta::TableFilesSchema& files);
+    Status
+    BackgroundMergeIndexFiles(const std::string& table_id);
     void
     BackgroundCompaction(std::set<std::string> table_ids);
 
@@ -137,6 +182,15 @@ class DBImpl : public DB {
     Status
     MemSerialize();
 
+    void
+    StartSnapshotTask();
+    void
+    LoadTableAccess();
+    void
+    SaveTableAccess();
+    void
+    SaveCacheSnapshot();
+
  private:
     const DBOptions options_;
 
@@ -144,6 +198,10 @@ class DBImpl : public DB {
 
     std::thread bg_timer_thread_;
 
+    // readonly nodes search the files of the catalog, kept up to date from the change feed of the writable node
+    std::shared_ptr<meta::TableFileCatalog> catalog_;
+    std::thread catalog_thread_;
+
     meta::MetaPtr meta_ptr_;
     MemManagerPtr mem_mgr_;
     std::mutex mem_serialize_mutex_;
@@ -158,6 +216,13 @@ class DBImpl : public DB {
     std::list<std::future<void>> index_thread_results_;
 
     std::mutex build_index_mutex_;
+
+    std::mutex access_mutex_;
+    std::unordered_map<std::string, uint64_t> table_access_;
+    bool table_access_changed_ = false;
+
+    // the cache is only snapshotted once the previous snapshot was warmed up, a restart during the warm up keeps it
+    std::atomic<bool> cache_warmed_up_{false};
 };  // DBImpl
 
 }  // namespace engine
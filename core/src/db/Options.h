@@ -67,6 +67,12 @@ struct DBMetaOptions {
     ArchiveConf archive_conf_ = ArchiveConf("delete");
 };  // DBMetaOptions
 
+struct TierConf {
+    std::string path_;                       // root path of secondary tier, empty means no tiering
+    int32_t cold_days_ = 30;                 // index files older than this are moved to secondary tier
+    uint64_t local_capacity_ = 16 * ONE_GB;  // local disk for index files fetched back from secondary tier
+};  // TierConf
+
 struct DBOptions {
     typedef enum { SINGLE = 0, CLUSTER_READONLY, CLUSTER_WRITABLE } MODE;
 
@@ -76,6 +82,11 @@ struct DBOptions {
 
     size_t insert_buffer_size_ = 4 * ONE_GB;
     bool insert_cache_immediately_ = false;
+    int32_t preload_thread_num_ = 2;
+    bool warm_restart_ = false;
+    uint64_t warm_up_io_rate_ = 200 * ONE_MB;  // bytes per second
+
+    TierConf tier_conf_;
 };  // Options
 
 }  // namespace engine
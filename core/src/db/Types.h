@@ -21,6 +21,7 @@
 
 #include <faiss/Index.h>
 #include <stdint.h>
+#include <atomic>
 #include <utility>
 #include <vector>
 
@@ -41,5 +42,13 @@ struct TableIndex {
     int32_t metric_type_ = (int)MetricType::L2;
 };
 
+// counters of a running preload, updated by the loader threads
+struct PreloadProgress {
+    std::atomic<int64_t> files_total{0};
+    std::atomic<int64_t> files_loaded{0};
+    std::atomic<int64_t> files_failed{0};
+    std::atomic<int64_t> bytes_loaded{0};
+};
+
 }  // namespace engine
 }  // namespace milvus
@@ -15,7 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include "db/engine/SegmentAttrs.h"
+#include "db/engine/SegmentIdIndex.h"
+#include "db/engine/SegmentTombstones.h"
 #include "db/Utils.h"
+#include "db/engine/ExecutionEngine.h"
+#include "db/tier/TierManager.h"
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
 
@@ -153,6 +158,12 @@ GetTableFilePath(const DBMetaOptions& options, meta::TableFileSchema& table_file
         }
     }
 
+    // cold file moved to secondary tier, it will be fetched back to primary path on load
+    if (TierManager::GetInstance().Exists(table_file)) {
+        table_file.location_ = ConstructParentFolder(options.path_, table_file) + "/" + table_file.file_id_;
+        return Status::OK();
+    }
+
     std::string msg = "Table file doesn't exist: " + file_path;
     ENGINE_LOG_ERROR << msg << " in path: " << options.path_ << " for table: " << table_file.table_id_;
 
@@ -163,7 +174,10 @@ Status
 DeleteTableFilePath(const DBMetaOptions& options, meta::TableFileSchema& table_file) {
     utils::GetTableFilePath(options, table_file);
     boost::filesystem::remove(table_file.location_);
-    return Status::OK();
+    boost::filesystem::remove(engine::SegmentIdIndex::FileName(table_file.location_));
+    boost::filesystem::remove(engine::SegmentTombstones::FileName(table_file.location_));
+    boost::filesystem::remove(engine::SegmentAttrs::FileName(table_file.location_));
+    return TierManager::GetInstance().Remove(table_file);
 }
 
 bool
@@ -172,6 +186,23 @@ IsSameIndex(const TableIndex& index1, const TableIndex& index2) {
            index1.metric_type_ == index2.metric_type_;
 }
 
+Status
+CheckIdLookup(const meta::TableFileSchema& file) {
+    if (file.file_type_ != meta::TableFileSchema::INDEX) {
+        return Status::OK();
+    }
+
+    switch (static_cast<EngineType>(file.engine_type_)) {
+        case EngineType::SPTAG_KDT:
+        case EngineType::SPTAG_BKT:
+            return Status(DB_ERROR, "SPTAG indexes do not support lookup by id");
+        case EngineType::FAISS_IVFSQ8H:
+            return Status(DB_ERROR, "IVFSQ8H indexes do not support lookup by id");
+        default:
+            return Status::OK();
+    }
+}
+
 meta::DateT
 GetDate(const std::time_t& t, int day_delta) {
     struct tm ltm;
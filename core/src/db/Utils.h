@@ -46,6 +46,10 @@ DeleteTableFilePath(const DBMetaOptions& options, meta::TableFileSchema& table_f
 bool
 IsSameIndex(const TableIndex& index1, const TableIndex& index2);
 
+// OK when the vectors of the file can be looked up by id: raw files and most index types keep them
+Status
+CheckIdLookup(const meta::TableFileSchema& file);
+
 meta::DateT
 GetDate(const std::time_t& t, int day_delta = 0);
 meta::DateT
@@ -0,0 +1,396 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "db/engine/AttrFilter.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <utility>
+
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+template <typename T>
+inline bool
+Compare(CompareOp op, T a, T b) {
+    switch (op) {
+        case CompareOp::EQ:
+            return a == b;
+        case CompareOp::NE:
+            return a != b;
+        case CompareOp::LT:
+            return a < b;
+        case CompareOp::LE:
+            return a <= b;
+        case CompareOp::GT:
+            return a > b;
+        default:
+            return a >= b;
+    }
+}
+
+// rows [begin, n) one at a time, the op is a template argument so that the switch is resolved at compile time
+template <CompareOp OP, typename T>
+void
+CompareRows(const T* data, int64_t begin, int64_t n, T value, uint64_t* words) {
+    for (int64_t i = begin; i < n; ++i) {
+        words[i >> 6] |= uint64_t(Compare(OP, data[i], value)) << (i & 63);
+    }
+}
+
+#ifdef __x86_64__
+// the simd kernels are compiled for avx and avx2 whatever the build flags, and only called when the cpu has them
+bool
+CpuHasAvx() {
+    static const bool has = __builtin_cpu_supports("avx");
+    return has;
+}
+
+bool
+CpuHasAvx2() {
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+}
+
+// 4 rows per instruction, returns the rows done, a multiple of 64
+template <CompareOp OP>
+__attribute__((target("avx2"))) int64_t
+CompareInt64Avx2(const int64_t* data, int64_t n, int64_t value, uint64_t* words) {
+    const __m256i v = _mm256_set1_epi64x(value);
+    // only == and > exist for 64 bit integers, the other ops are derived by swapping or negating
+    const bool negate = (OP == CompareOp::NE || OP == CompareOp::LE || OP == CompareOp::GE);
+    const int64_t full = n / 64 * 64;
+    for (int64_t base = 0; base < full; base += 64) {
+        uint64_t bits = 0;
+        for (int64_t j = 0; j < 64; j += 4) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + base + j));
+            __m256i mask;
+            if (OP == CompareOp::EQ || OP == CompareOp::NE) {
+                mask = _mm256_cmpeq_epi64(x, v);
+            } else if (OP == CompareOp::GT || OP == CompareOp::LE) {
+                mask = _mm256_cmpgt_epi64(x, v);
+            } else {
+                mask = _mm256_cmpgt_epi64(v, x);
+            }
+            uint64_t lanes = static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(mask)));
+            bits |= (negate ? lanes ^ 0xF : lanes) << j;
+        }
+        words[base >> 6] = bits;
+    }
+    return full;
+}
+
+constexpr int
+AvxPredicate(CompareOp op) {
+    switch (op) {
+        case CompareOp::EQ:
+            return _CMP_EQ_OQ;
+        case CompareOp::NE:
+            return _CMP_NEQ_UQ;
+        case CompareOp::LT:
+            return _CMP_LT_OQ;
+        case CompareOp::LE:
+            return _CMP_LE_OQ;
+        case CompareOp::GT:
+            return _CMP_GT_OQ;
+        default:
+            return _CMP_GE_OQ;
+    }
+}
+
+template <CompareOp OP>
+__attribute__((target("avx"))) int64_t
+CompareDoubleAvx(const double* data, int64_t n, double value, uint64_t* words) {
+    const __m256d v = _mm256_set1_pd(value);
+    const int64_t full = n / 64 * 64;
+    for (int64_t base = 0; base < full; base += 64) {
+        uint64_t bits = 0;
+        for (int64_t j = 0; j < 64; j += 4) {
+            __m256d x = _mm256_loadu_pd(data + base + j);
+            bits |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_cmp_pd(x, v, AvxPredicate(OP)))) << j;
+        }
+        words[base >> 6] = bits;
+    }
+    return full;
+}
+#endif
+
+template <CompareOp OP>
+void
+CompareColumn(const AttrColumn& column, const AttrPredicate& predicate, uint64_t* words) {
+    int64_t n = static_cast<int64_t>(column.Rows());
+    int64_t done = 0;
+    if (column.type_ == AttrType::INT64) {
+#ifdef __x86_64__
+        if (CpuHasAvx2()) {
+            done = CompareInt64Avx2<OP>(column.int_data_.data(), n, predicate.int_value_, words);
+        }
+#endif
+        CompareRows<OP>(column.int_data_.data(), done, n, predicate.int_value_, words);
+    } else {
+#ifdef __x86_64__
+        if (CpuHasAvx()) {
+            done = CompareDoubleAvx<OP>(column.double_data_.data(), n, predicate.double_value_, words);
+        }
+#endif
+        CompareRows<OP>(column.double_data_.data(), done, n, predicate.double_value_, words);
+    }
+}
+
+// words must be zero on entry
+void
+EvaluatePredicate(const AttrColumn& column, const AttrPredicate& predicate, uint64_t* words) {
+    switch (predicate.op_) {
+        case CompareOp::EQ:
+            CompareColumn<CompareOp::EQ>(column, predicate, words);
+            break;
+        case CompareOp::NE:
+            CompareColumn<CompareOp::NE>(column, predicate, words);
+            break;
+        case CompareOp::LT:
+            CompareColumn<CompareOp::LT>(column, predicate, words);
+            break;
+        case CompareOp::LE:
+            CompareColumn<CompareOp::LE>(column, predicate, words);
+            break;
+        case CompareOp::GT:
+            CompareColumn<CompareOp::GT>(column, predicate, words);
+            break;
+        default:
+            CompareColumn<CompareOp::GE>(column, predicate, words);
+            break;
+    }
+}
+
+// whether some value in [min, max] may satisfy "value op constant"
+template <typename T>
+bool
+RangeMayMatch(CompareOp op, T min, T max, T constant) {
+    switch (op) {
+        case CompareOp::EQ:
+            return min <= constant && constant <= max;
+        case CompareOp::NE:
+            return !(min == constant && max == constant);
+        case CompareOp::LT:
+            return min < constant;
+        case CompareOp::LE:
+            return min <= constant;
+        case CompareOp::GT:
+            return max > constant;
+        default:
+            return max >= constant;
+    }
+}
+
+void
+SkipSpaces(const std::string& text, size_t& pos) {
+    while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) {
+        ++pos;
+    }
+}
+
+bool
+ParseName(const std::string& text, size_t& pos, std::string& name) {
+    size_t begin = pos;
+    while (pos < text.size() && (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '_')) {
+        ++pos;
+    }
+    name = text.substr(begin, pos - begin);
+    return !name.empty() && !std::isdigit(static_cast<unsigned char>(name[0]));
+}
+
+bool
+ParseOp(const std::string& text, size_t& pos, CompareOp& op) {
+    static const std::vector<std::pair<std::string, CompareOp>> ops = {
+        {"==", CompareOp::EQ}, {"!=", CompareOp::NE}, {"<=", CompareOp::LE},
+        {">=", CompareOp::GE}, {"<", CompareOp::LT},  {">", CompareOp::GT},
+    };
+    for (auto& item : ops) {
+        if (text.compare(pos, item.first.size(), item.first) == 0) {
+            pos += item.first.size();
+            op = item.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+ParseConstant(const std::string& text, size_t& pos, AttrPredicate& predicate) {
+    size_t begin = pos;
+    while (pos < text.size() && (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '.' ||
+                                 text[pos] == '+' || text[pos] == '-')) {
+        ++pos;
+    }
+    std::string constant = text.substr(begin, pos - begin);
+    if (constant.empty()) {
+        return false;
+    }
+
+    char* end = nullptr;
+    errno = 0;
+    if (predicate.type_ == AttrType::INT64) {
+        predicate.int_value_ = std::strtoll(constant.c_str(), &end, 10);
+    } else {
+        predicate.double_value_ = std::strtod(constant.c_str(), &end);
+    }
+    return errno == 0 && *end == '\0';
+}
+
+}  // namespace
+
+AttrBitmap::AttrBitmap(int64_t rows, bool value) : rows_(rows), words_((rows + 63) / 64, value ? ~uint64_t(0) : 0) {
+    if (value && (rows & 63) != 0) {
+        words_.back() = (uint64_t(1) << (rows & 63)) - 1;
+    }
+}
+
+int64_t
+AttrBitmap::Count() const {
+    int64_t count = 0;
+    for (auto word : words_) {
+        count += __builtin_popcountll(word);
+    }
+    return count;
+}
+
+void
+AttrBitmap::And(const AttrBitmap& other) {
+    for (size_t i = 0; i < words_.size(); ++i) {
+        words_[i] &= (i < other.words_.size()) ? other.words_[i] : 0;
+    }
+}
+
+Status
+AttrFilter::Parse(const std::string& expression, const AttrSchema& schema, AttrFilterPtr& filter) {
+    filter = nullptr;
+    size_t pos = 0;
+    SkipSpaces(expression, pos);
+    if (pos == expression.size()) {
+        return Status::OK();
+    }
+
+    auto error = [&](const std::string& msg) {
+        return Status(DB_ERROR, msg + " at position " + std::to_string(pos) + " of filter '" + expression + "'");
+    };
+
+    auto result = std::make_shared<AttrFilter>();
+    while (true) {
+        AttrPredicate predicate;
+        SkipSpaces(expression, pos);
+        if (!ParseName(expression, pos, predicate.name_)) {
+            return error("Expect an attribute name");
+        }
+        auto field = std::find_if(schema.begin(), schema.end(),
+                                  [&](const AttrField& item) { return item.name_ == predicate.name_; });
+        if (field == schema.end()) {
+            return error("Unknown attribute " + predicate.name_);
+        }
+        predicate.type_ = field->type_;
+
+        SkipSpaces(expression, pos);
+        if (!ParseOp(expression, pos, predicate.op_)) {
+            return error("Expect one of == != < <= > >=");
+        }
+        SkipSpaces(expression, pos);
+        if (!ParseConstant(expression, pos, predicate)) {
+            return error(predicate.type_ == AttrType::INT64 ? "Expect an integer" : "Expect a number");
+        }
+        result->predicates_.push_back(predicate);
+
+        SkipSpaces(expression, pos);
+        if (pos == expression.size()) {
+            break;
+        }
+        if (expression.compare(pos, 2, "&&") != 0) {
+            return error("Expect &&");
+        }
+        pos += 2;
+    }
+
+    filter = result;
+    return Status::OK();
+}
+
+bool
+AttrFilter::MayMatch(const SegmentAttrs& attrs) const {
+    if (attrs.Rows() == 0) {
+        return false;
+    }
+    for (auto& predicate : predicates_) {
+        auto zone = attrs.Zone(predicate.name_);
+        if (zone == nullptr) {
+            return false;
+        }
+        bool may_match = (predicate.type_ == AttrType::INT64)
+                             ? RangeMayMatch(predicate.op_, zone->int_min_, zone->int_max_, predicate.int_value_)
+                             : RangeMayMatch(predicate.op_, zone->double_min_, zone->double_max_,
+                                             predicate.double_value_);
+        if (!may_match) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+AttrFilter::Evaluate(const SegmentAttrs& attrs, AttrBitmap& bitmap) const {
+    bitmap = AttrBitmap(attrs.Rows(), predicates_.empty());
+    AttrBitmap scratch;
+    for (size_t i = 0; i < predicates_.size(); ++i) {
+        auto& predicate = predicates_[i];
+        auto column = attrs.Column(predicate.name_);
+        if (column == nullptr || column->type_ != predicate.type_ ||
+            static_cast<int64_t>(column->Rows()) != attrs.Rows()) {
+            bitmap = AttrBitmap(attrs.Rows(), false);
+            return;
+        }
+
+        // the first predicate writes the result, the next ones are and-ed to it
+        AttrBitmap& target = (i == 0) ? bitmap : scratch;
+        if (i > 0) {
+            target = AttrBitmap(attrs.Rows(), false);
+        }
+        EvaluatePredicate(*column, predicate, target.Words().data());
+        if (i > 0) {
+            bitmap.And(scratch);
+        }
+    }
+}
+
+AttrAllowList::AttrAllowList(SegmentAttrsPtr attrs, AttrBitmap bitmap)
+    : attrs_(std::move(attrs)), bitmap_(std::move(bitmap)) {
+    auto& ids = attrs_->Ids();
+    allowed_ids_.reserve(bitmap_.Count());
+    bitmap_.ForEach([&](int64_t row) { allowed_ids_.push_back(ids[row]); });
+    std::sort(allowed_ids_.begin(), allowed_ids_.end());
+}
+
+bool
+AttrAllowList::Contains(int64_t id) const {
+    return std::binary_search(allowed_ids_.begin(), allowed_ids_.end(), id);
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include "db/engine/SegmentAttrs.h"
+#include "utils/Status.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+enum class CompareOp {
+    EQ,
+    NE,
+    LT,
+    LE,
+    GT,
+    GE,
+};
+
+// comparison of an attribute with a constant, the constant is of the attribute type
+struct AttrPredicate {
+    std::string name_;
+    AttrType type_ = AttrType::INT64;
+    CompareOp op_ = CompareOp::EQ;
+    int64_t int_value_ = 0;
+    double double_value_ = 0;
+};
+
+// one bit per row of a table file
+class AttrBitmap {
+ public:
+    AttrBitmap() = default;
+
+    AttrBitmap(int64_t rows, bool value);
+
+    int64_t
+    Rows() const {
+        return rows_;
+    }
+
+    bool
+    Test(int64_t row) const {
+        return (words_[row >> 6] >> (row & 63)) & 1;
+    }
+
+    void
+    Clear(int64_t row) {
+        words_[row >> 6] &= ~(uint64_t(1) << (row & 63));
+    }
+
+    // number of rows set
+    int64_t
+    Count() const;
+
+    void
+    And(const AttrBitmap& other);
+
+    std::vector<uint64_t>&
+    Words() {
+        return words_;
+    }
+
+    // call func with each row set, in ascending order
+    template <typename Func>
+    void
+    ForEach(Func func) const {
+        for (size_t w = 0; w < words_.size(); ++w) {
+            uint64_t word = words_[w];
+            while (word != 0) {
+                func(static_cast<int64_t>(w << 6) + __builtin_ctzll(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+ private:
+    int64_t rows_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+class AttrFilter;
+using AttrFilterPtr = std::shared_ptr<AttrFilter>;
+
+// Conjunction of comparisons between attributes and constants, e.g. "category == 3 && price < 9.5".
+// Each predicate is evaluated over a whole column at once into a bitmap of the matching rows.
+class AttrFilter {
+ public:
+    // filter is nullptr for a blank expression; names and constants are checked against schema
+    static Status
+    Parse(const std::string& expression, const AttrSchema& schema, AttrFilterPtr& filter);
+
+    // false when the zone maps of the file prove that none of its rows matches
+    bool
+    MayMatch(const SegmentAttrs& attrs) const;
+
+    // rows of attrs matching every predicate, a file without the attribute matches nothing
+    void
+    Evaluate(const SegmentAttrs& attrs, AttrBitmap& bitmap) const;
+
+    const std::vector<AttrPredicate>&
+    Predicates() const {
+        return predicates_;
+    }
+
+ private:
+    std::vector<AttrPredicate> predicates_;
+};
+
+// Rows of one table file a filtered search may return. The bitmap is over the rows of the attributes
+// of the file, the sorted ids serve the index files whose vectors are in another order.
+class AttrAllowList {
+ public:
+    AttrAllowList(SegmentAttrsPtr attrs, AttrBitmap bitmap);
+
+    const AttrBitmap&
+    Bitmap() const {
+        return bitmap_;
+    }
+
+    // id of each row of the bitmap
+    const std::vector<int64_t>&
+    RowIds() const {
+        return attrs_->Ids();
+    }
+
+    int64_t
+    Count() const {
+        return static_cast<int64_t>(allowed_ids_.size());
+    }
+
+    // ids of the rows set, ascending
+    const std::vector<int64_t>&
+    AllowedIds() const {
+        return allowed_ids_;
+    }
+
+    bool
+    Contains(int64_t id) const;
+
+ private:
+    SegmentAttrsPtr attrs_;
+    AttrBitmap bitmap_;
+    std::vector<int64_t> allowed_ids_;
+};
+
+using AttrAllowListPtr = std::shared_ptr<AttrAllowList>;
+
+}  // namespace engine
+}  // namespace milvus
@@ -33,7 +33,9 @@ enum class EngineType {
     FAISS_IVFSQ8,
     NSG_MIX,
     FAISS_IVFSQ8H,
-    MAX_VALUE = FAISS_IVFSQ8H,
+    SPTAG_KDT,
+    SPTAG_BKT,
+    MAX_VALUE = SPTAG_BKT,
 };
 
 enum class MetricType {
@@ -41,6 +43,8 @@ enum class MetricType {
     IP = 2,
 };
 
+class AttrAllowList;
+
 class ExecutionEngine {
  public:
     virtual Status
@@ -76,12 +80,35 @@ class ExecutionEngine {
     virtual std::shared_ptr<ExecutionEngine>
     Clone() = 0;
 
+    // append the vectors of the file at location, the ones it has tombstones for are left out
     virtual Status
     Merge(const std::string& location) = 0;
 
+    // position of id in this file, found stays false when the file does not hold it.
+    // Only the id index is read, the index file is needed just to rebuild a missing one.
+    virtual Status
+    FindID(int64_t id, int64_t& slot, bool& found) = 0;
+
+    // the ids of sorted_ids held by this file, appended to found
+    virtual Status
+    FindIDs(const std::vector<int64_t>& sorted_ids, std::vector<int64_t>& found) = 0;
+
+    // read the id index into the cache ahead of FindID/FindIDs, a missing one is rebuilt from the index file
+    virtual Status
+    LoadIdIndex() = 0;
+
+    // copy the vector at a position returned by FindID, loading the index file
+    virtual Status
+    GetVector(int64_t slot, float* vector) = 0;
+
     virtual Status
     Search(int64_t n, const float* data, int64_t k, int64_t nprobe, float* distances, int64_t* labels, bool hybrid) = 0;
 
+    // search only among the vectors of allow, rows without a result get label -1
+    virtual Status
+    Search(int64_t n, const float* data, int64_t k, int64_t nprobe, const AttrAllowList& allow, float* distances,
+           int64_t* labels, bool hybrid) = 0;
+
     virtual std::shared_ptr<ExecutionEngine>
     BuildIndex(const std::string& location, EngineType engine_type) = 0;
 
@@ -97,6 +124,10 @@ class ExecutionEngine {
     virtual EngineType
     IndexEngineType() const = 0;
 
+    // whether Load keeps the inverted lists of the built index file on disk, see read_index_mapped
+    virtual bool
+    IsIndexMapped() const = 0;
+
     virtual MetricType
     IndexMetricType() const = 0;
 
@@ -18,7 +18,11 @@
 #include "db/engine/ExecutionEngineImpl.h"
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
+#include "db/engine/AttrFilter.h"
+#include "db/engine/SegmentTombstones.h"
+#include "knowhere/common/Cancel.h"
 #include "knowhere/common/Config.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
 #include "metrics/Metrics.h"
 #include "scheduler/Utils.h"
 #include "server/Config.h"
@@ -30,6 +34,10 @@
 #include "wrapper/VecImpl.h"
 #include "wrapper/VecIndex.h"
 
+#include <faiss/utils/distances.h>
+#include <algorithm>
+#include <limits>
+#include <queue>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -38,6 +46,11 @@
 namespace milvus {
 namespace engine {
 
+// a filter allowing at most this many vectors of an index file is searched exactly over their vectors
+static constexpr int64_t FILTERED_EXACT_SEARCH_ROWS = 4096;
+// largest k asked from an index when its results are filtered afterwards, as the gpu indexes accept
+static constexpr int64_t FILTERED_SEARCH_MAX_K = 2048;
+
 class CachedQuantizer : public cache::DataObj {
  public:
     explicit CachedQuantizer(knowhere::QuantizerPtr data) : data_(std::move(data)) {
@@ -92,11 +105,19 @@ ExecutionEngineImpl::CreatetVecIndex(EngineType type) {
             break;
         }
         case EngineType::FAISS_IVFFLAT: {
-            index = GetVecIndexFactory(IndexType::FAISS_IVFFLAT_MIX);
+            if (gpu_num_ == server::CPU_DEVICE_ID) {
+                index = GetVecIndexFactory(IndexType::FAISS_IVFFLAT_CPU);
+            } else {
+                index = GetVecIndexFactory(IndexType::FAISS_IVFFLAT_MIX);
+            }
             break;
         }
         case EngineType::FAISS_IVFSQ8: {
-            index = GetVecIndexFactory(IndexType::FAISS_IVFSQ8_MIX);
+            if (gpu_num_ == server::CPU_DEVICE_ID) {
+                index = GetVecIndexFactory(IndexType::FAISS_IVFSQ8_CPU);
+            } else {
+                index = GetVecIndexFactory(IndexType::FAISS_IVFSQ8_MIX);
+            }
             break;
         }
         case EngineType::NSG_MIX: {
@@ -107,6 +128,14 @@ ExecutionEngineImpl::CreatetVecIndex(EngineType type) {
             index = GetVecIndexFactory(IndexType::FAISS_IVFSQ8_HYBRID);
             break;
         }
+        case EngineType::SPTAG_KDT: {
+            index = GetVecIndexFactory(IndexType::SPTAG_KDT_RNT_CPU);
+            break;
+        }
+        case EngineType::SPTAG_BKT: {
+            index = GetVecIndexFactory(IndexType::SPTAG_BKT_RNT_CPU);
+            break;
+        }
         default: {
             ENGINE_LOG_ERROR << "Unsupported index type";
             return nullptr;
@@ -223,9 +252,121 @@ ExecutionEngineImpl::PhysicalSize() const {
 Status
 ExecutionEngineImpl::Serialize() {
     auto status = write_index(index_, location_);
+    if (status.ok()) {
+        WriteIdIndex();
+    }
     return status;
 }
 
+void
+ExecutionEngineImpl::WriteIdIndex() {
+    // only an accelerator for lookups by id, a missing one is rebuilt from the index file
+    std::vector<int64_t> ids, slots;
+    if (!index_->GetIds(ids, slots).ok()) {
+        return;
+    }
+
+    SegmentIdIndex id_index(ids, slots);
+    auto status = id_index.Write(location_);
+    if (!status.ok()) {
+        ENGINE_LOG_WARNING << "Failed to write id index of " << location_ << ": " << status.message();
+    }
+    cache::CpuCacheMgr::GetInstance()->EraseItem(SegmentIdIndex::FileName(location_));
+}
+
+Status
+ExecutionEngineImpl::LoadIdIndex(SegmentIdIndexPtr& id_index) {
+    const std::string key = SegmentIdIndex::FileName(location_);
+    id_index = std::static_pointer_cast<SegmentIdIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(key));
+    if (id_index != nullptr) {
+        return Status::OK();
+    }
+
+    auto status = SegmentIdIndex::Read(location_, id_index);
+    if (!status.ok()) {
+        // files written before id indexes existed, or serialized from a gpu index
+        ENGINE_LOG_DEBUG << "Rebuild id index of " << location_ << ": " << status.message();
+        status = Load(true);
+        if (!status.ok()) {
+            return status;
+        }
+
+        std::vector<int64_t> ids, slots;
+        status = index_->GetIds(ids, slots);
+        if (!status.ok()) {
+            return status;
+        }
+        id_index = std::make_shared<SegmentIdIndex>(ids, slots);
+
+        // written back, so the next miss in the cache does not load the whole index file again
+        status = id_index->Write(location_);
+        if (!status.ok()) {
+            ENGINE_LOG_WARNING << "Failed to write id index of " << location_ << ": " << status.message();
+        }
+    }
+
+    cache::CpuCacheMgr::GetInstance()->InsertItem(key, id_index);
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::LoadIdIndex() {
+    SegmentIdIndexPtr id_index;
+    return LoadIdIndex(id_index);
+}
+
+Status
+ExecutionEngineImpl::FindID(int64_t id, int64_t& slot, bool& found) {
+    SegmentIdIndexPtr id_index;
+    auto status = LoadIdIndex(id_index);
+    if (!status.ok()) {
+        return status;
+    }
+
+    found = id_index->Find(id, slot);
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::FindIDs(const std::vector<int64_t>& sorted_ids, std::vector<int64_t>& found) {
+    SegmentIdIndexPtr id_index;
+    auto status = LoadIdIndex(id_index);
+    if (!status.ok()) {
+        return status;
+    }
+
+    id_index->FindBatch(sorted_ids, found);
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::GetVector(int64_t slot, float* vector) {
+    auto status = Load(true);
+    if (!status.ok()) {
+        return status;
+    }
+    return index_->Reconstruct(slot, vector);
+}
+
+bool
+ExecutionEngineImpl::IsIndexMapped() const {
+    bool use_mmap = false;
+    server::Config::GetInstance().GetEngineConfigUseMmap(use_mmap);
+    if (!use_mmap) {
+        return false;
+    }
+
+    // built index files of these engines are saved as cpu ivf indexes
+    switch (index_type_) {
+        case EngineType::FAISS_IVFFLAT:
+            return IsMappableIndexType(IndexType::FAISS_IVFFLAT_CPU);
+        case EngineType::FAISS_IVFSQ8:
+            return IsMappableIndexType(IndexType::FAISS_IVFSQ8_CPU);
+        default:
+            return false;
+    }
+}
+
 Status
 ExecutionEngineImpl::Load(bool to_cache) {
     index_ = std::static_pointer_cast<VecIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(location_));
@@ -234,7 +375,7 @@ ExecutionEngineImpl::Load(bool to_cache) {
         try {
             double physical_size = PhysicalSize();
             server::CollectExecutionEngineMetrics metrics(physical_size);
-            index_ = read_index(location_);
+            index_ = IsIndexMapped() ? read_index_mapped(location_) : read_index(location_);
             if (index_ == nullptr) {
                 std::string msg = "Failed to load index from " + location_;
                 ENGINE_LOG_ERROR << msg;
@@ -374,6 +515,38 @@ ExecutionEngineImpl::Merge(const std::string& location) {
     }
     ENGINE_LOG_DEBUG << "Merge index file: " << location << " to: " << location_;
 
+    if (index_ == nullptr) {
+        ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, failed to merge";
+        return Status(DB_ERROR, "index is null");
+    }
+
+    // an empty engine adopts a private copy of the first index file, a cached one is shared with searches
+    if (index_type_ != EngineType::FAISS_IDMAP && index_->GetType() == IndexType::FAISS_IDMAP &&
+        index_->Count() == 0) {
+        try {
+            double physical_size = server::CommonUtil::GetFileSize(location);
+            server::CollectExecutionEngineMetrics metrics(physical_size);
+            auto adopted = read_index(location);
+            if (adopted != nullptr && adopted->GetType() != IndexType::FAISS_IDMAP) {
+                // a graph extended by a merge drops the vectors replaced by upserts before new ones are added,
+                // the old copies are marked by id and would otherwise share it with their replacements
+                auto tombstones = SegmentTombstones::Get(location);
+                if (!tombstones->Empty()) {
+                    auto status = adopted->Delete(tombstones->Count(), tombstones->Ids().data());
+                    if (!status.ok()) {
+                        ENGINE_LOG_ERROR << "Merge: " << status.message();
+                        return status;
+                    }
+                }
+                index_ = adopted;
+                return Status::OK();
+            }
+        } catch (std::exception& e) {
+            ENGINE_LOG_ERROR << e.what();
+            return Status(DB_ERROR, e.what());
+        }
+    }
+
     auto to_merge = cache::CpuCacheMgr::GetInstance()->GetIndex(location);
     if (!to_merge) {
         try {
@@ -386,20 +559,39 @@ ExecutionEngineImpl::Merge(const std::string& location) {
         }
     }
 
-    if (index_ == nullptr) {
-        ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, failed to merge";
-        return Status(DB_ERROR, "index is null");
-    }
-
     if (auto file_index = std::dynamic_pointer_cast<BFIndex>(to_merge)) {
-        auto status = index_->Add(file_index->Count(), file_index->GetRawVectors(), file_index->GetRawIds());
+        // vectors replaced by an upsert are dropped for good here
+        auto tombstones = SegmentTombstones::Get(location);
+        const float* vectors = file_index->GetRawVectors();
+        const int64_t* ids = file_index->GetRawIds();
+        int64_t count = file_index->Count();
+        std::vector<float> live_vectors;
+        std::vector<int64_t> live_ids;
+        if (!tombstones->Empty()) {
+            for (int64_t i = 0; i < count; ++i) {
+                if (!tombstones->Contains(ids[i])) {
+                    live_vectors.insert(live_vectors.end(), vectors + i * dim_, vectors + (i + 1) * dim_);
+                    live_ids.push_back(ids[i]);
+                }
+            }
+            ENGINE_LOG_DEBUG << "Merge: drop " << count - live_ids.size() << " deleted vectors of " << location;
+            vectors = live_vectors.data();
+            ids = live_ids.data();
+            count = static_cast<int64_t>(live_ids.size());
+        }
+
+        auto status = index_->Add(count, vectors, ids);
         if (!status.ok()) {
             ENGINE_LOG_ERROR << "Merge: Add Error";
         }
         return status;
-    } else {
-        return Status(DB_ERROR, "file index type is not idmap");
     }
+
+    auto status = index_->Merge(std::static_pointer_cast<VecIndex>(to_merge));
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Merge: " << status.message();
+    }
+    return status;
 }
 
 ExecutionEnginePtr
@@ -524,6 +716,153 @@ ExecutionEngineImpl::Search(int64_t n, const float* data, int64_t k, int64_t npr
     return status;
 }
 
+Status
+ExecutionEngineImpl::Search(int64_t n, const float* data, int64_t k, int64_t nprobe, const AttrAllowList& allow,
+                            float* distances, int64_t* labels, bool hybrid) {
+    if (index_ == nullptr) {
+        ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, failed to search";
+        return Status(DB_ERROR, "index is null");
+    }
+
+    // raw files are scanned over the allowed rows only
+    if (auto bf_index = std::dynamic_pointer_cast<BFIndex>(index_)) {
+        const int64_t* ids = bf_index->GetRawIds();
+        int64_t count = bf_index->Count();
+        std::vector<int64_t> rows;
+        rows.reserve(allow.Count());
+        auto& row_ids = allow.RowIds();
+        if (static_cast<int64_t>(row_ids.size()) == count && std::equal(row_ids.begin(), row_ids.end(), ids)) {
+            // the attribute rows of a raw file are in the order of its vectors
+            allow.Bitmap().ForEach([&](int64_t row) { rows.push_back(row); });
+        } else {
+            for (int64_t i = 0; i < count; ++i) {
+                if (allow.Contains(ids[i])) {
+                    rows.push_back(i);
+                }
+            }
+        }
+        SearchRows(n, data, k, bf_index->GetRawVectors(), ids, rows, distances, labels);
+        return Status::OK();
+    }
+
+    // a selective filter on an index: the allowed vectors are taken out of it and scanned exactly
+    if (allow.Count() <= FILTERED_EXACT_SEARCH_ROWS) {
+        SegmentIdIndexPtr id_index;
+        auto status = LoadIdIndex(id_index);
+        if (status.ok()) {
+            std::vector<float> vectors(allow.Count() * dim_);
+            std::vector<int64_t> ids, rows;
+            for (auto id : allow.AllowedIds()) {
+                int64_t slot = 0;
+                if (!id_index->Find(id, slot)) {
+                    continue;
+                }
+                status = index_->Reconstruct(slot, vectors.data() + ids.size() * dim_);
+                if (!status.ok()) {
+                    break;
+                }
+                rows.push_back(ids.size());
+                ids.push_back(id);
+            }
+            if (status.ok()) {
+                SearchRows(n, data, k, vectors.data(), ids.data(), rows, distances, labels);
+                return Status::OK();
+            }
+        }
+        ENGINE_LOG_DEBUG << "Filtered search of " << location_ << " falls back to the index: " << status.message();
+    }
+
+    // nsg skips the rejected ids while it collects the results, as it does with deleted nodes
+    if (index_->GetType() == IndexType::NSG_MIX) {
+        TempMetaConf temp_conf;
+        temp_conf.k = k;
+        temp_conf.nprobe = nprobe;
+        auto adapter = AdapterMgr::GetInstance().GetAdapter(index_->GetType());
+        auto conf = adapter->MatchSearch(temp_conf, index_->GetType());
+        std::static_pointer_cast<knowhere::NSGCfg>(conf)->allow = [&allow](int64_t id) { return allow.Contains(id); };
+        auto status = index_->Search(n, data, distances, labels, conf);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Search error";
+        }
+        return status;
+    }
+
+    // otherwise ask the index for enough candidates that about k of them are allowed, and drop the others
+    int64_t count = static_cast<int64_t>(Count());
+    int64_t search_k = k;
+    if (allow.Count() > 0) {
+        search_k = std::max(k, 2 * k * count / allow.Count());
+    }
+    search_k = std::max(std::min({search_k, count, FILTERED_SEARCH_MAX_K}), k);
+
+    std::vector<float> candidate_distances(n * search_k);
+    std::vector<int64_t> candidate_labels(n * search_k);
+    auto status = Search(n, data, search_k, nprobe, candidate_distances.data(), candidate_labels.data(), hybrid);
+    if (!status.ok()) {
+        return status;
+    }
+
+    float missing = (metric_type_ == MetricType::L2) ? std::numeric_limits<float>::max()
+                                                     : std::numeric_limits<float>::lowest();
+    for (int64_t i = 0; i < n; ++i) {
+        int64_t kept = 0;
+        for (int64_t j = i * search_k; j < (i + 1) * search_k && kept < k; ++j) {
+            if (candidate_labels[j] >= 0 && allow.Contains(candidate_labels[j])) {
+                labels[i * k + kept] = candidate_labels[j];
+                distances[i * k + kept] = candidate_distances[j];
+                ++kept;
+            }
+        }
+        for (; kept < k; ++kept) {
+            labels[i * k + kept] = -1;
+            distances[i * k + kept] = missing;
+        }
+    }
+    return Status::OK();
+}
+
+void
+ExecutionEngineImpl::SearchRows(int64_t n, const float* data, int64_t k, const float* vectors, const int64_t* ids,
+                                const std::vector<int64_t>& rows, float* distances, int64_t* labels) const {
+    // scores are ascending for both metrics, the heap keeps the k smallest
+    bool l2 = (metric_type_ == MetricType::L2);
+    using Candidate = std::pair<float, int64_t>;
+    std::vector<Candidate> heap;
+    heap.reserve(k);
+    auto& cancel_token = knowhere::CancelScope::Current();
+    for (int64_t i = 0; i < n; ++i) {
+        if (cancel_token != nullptr && cancel_token->Cancelled()) {
+            break;  // the results of a cancelled search are discarded
+        }
+
+        const float* query = data + i * dim_;
+        heap.clear();
+        for (auto row : rows) {
+            const float* vector = vectors + row * dim_;
+            float score = l2 ? faiss::fvec_L2sqr(query, vector, dim_) : -faiss::fvec_inner_product(query, vector, dim_);
+            if (static_cast<int64_t>(heap.size()) < k) {
+                heap.emplace_back(score, ids[row]);
+                std::push_heap(heap.begin(), heap.end());
+            } else if (score < heap.front().first) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = Candidate(score, ids[row]);
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+        std::sort_heap(heap.begin(), heap.end());
+
+        for (int64_t j = 0; j < k; ++j) {
+            if (j < static_cast<int64_t>(heap.size())) {
+                labels[i * k + j] = heap[j].second;
+                distances[i * k + j] = l2 ? heap[j].first : -heap[j].first;
+            } else {
+                labels[i * k + j] = -1;
+                distances[i * k + j] = l2 ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+            }
+        }
+    }
+}
+
 Status
 ExecutionEngineImpl::Cache() {
     cache::DataObjPtr obj = std::static_pointer_cast<cache::DataObj>(index_);
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "ExecutionEngine.h"
+#include "SegmentIdIndex.h"
 #include "wrapper/VecIndex.h"
 
 #include <memory>
@@ -74,6 +75,22 @@ class ExecutionEngineImpl : public ExecutionEngine {
     Search(int64_t n, const float* data, int64_t k, int64_t nprobe, float* distances, int64_t* labels,
            bool hybrid = false) override;
 
+    Status
+    Search(int64_t n, const float* data, int64_t k, int64_t nprobe, const AttrAllowList& allow, float* distances,
+           int64_t* labels, bool hybrid = false) override;
+
+    Status
+    FindID(int64_t id, int64_t& slot, bool& found) override;
+
+    Status
+    FindIDs(const std::vector<int64_t>& sorted_ids, std::vector<int64_t>& found) override;
+
+    Status
+    LoadIdIndex() override;
+
+    Status
+    GetVector(int64_t slot, float* vector) override;
+
     ExecutionEnginePtr
     BuildIndex(const std::string& location, EngineType engine_type) override;
 
@@ -91,6 +108,9 @@ class ExecutionEngineImpl : public ExecutionEngine {
         return index_type_;
     }
 
+    bool
+    IsIndexMapped() const override;
+
     MetricType
     IndexMetricType() const override {
         return metric_type_;
@@ -114,6 +134,18 @@ class ExecutionEngineImpl : public ExecutionEngine {
     void
     HybridUnset() const;
 
+    // the sorted ids of this file with the bloom filter, read from the sidecar or rebuilt from the index
+    Status
+    LoadIdIndex(SegmentIdIndexPtr& id_index);
+
+    void
+    WriteIdIndex();
+
+    // exact top k of the vectors at rows of a row-major array
+    void
+    SearchRows(int64_t n, const float* data, int64_t k, const float* vectors, const int64_t* ids,
+               const std::vector<int64_t>& rows, float* distances, int64_t* labels) const;
+
  protected:
     VecIndexPtr index_ = nullptr;
     EngineType index_type_;
@@ -0,0 +1,379 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "db/engine/SegmentAttrs.h"
+#include "cache/CpuCacheMgr.h"
+#include "db/engine/SegmentTombstones.h"
+#include "utils/FileIO.h"
+#include "utils/Log.h"
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <set>
+#include <sstream>
+#include <utility>
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+constexpr size_t MAX_ATTR_NAME_LENGTH = 255;
+
+struct FileHeader {
+    uint64_t rows_;
+    uint64_t columns_;
+};
+
+struct ColumnHeader {
+    int32_t type_;
+    uint32_t name_length_;
+};
+
+bool
+ValidAttrName(const std::string& name) {
+    if (name.empty() || name.size() > MAX_ATTR_NAME_LENGTH || std::isdigit(static_cast<unsigned char>(name[0]))) {
+        return false;
+    }
+    return std::all_of(name.begin(), name.end(),
+                       [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; });
+}
+
+std::string
+AttrTypeName(AttrType type) {
+    return (type == AttrType::INT64) ? "int64" : "double";
+}
+
+template <typename T>
+void
+MinMax(const std::vector<T>& data, T& min, T& max) {
+    if (data.empty()) {
+        return;
+    }
+    auto range = std::minmax_element(data.begin(), data.end());
+    min = *range.first;
+    max = *range.second;
+}
+
+}  // namespace
+
+void
+AttrColumn::Append(const AttrColumn& other, size_t offset, size_t count) {
+    if (type_ == AttrType::INT64) {
+        int_data_.insert(int_data_.end(), other.int_data_.begin() + offset, other.int_data_.begin() + offset + count);
+    } else {
+        double_data_.insert(double_data_.end(), other.double_data_.begin() + offset,
+                            other.double_data_.begin() + offset + count);
+    }
+}
+
+Status
+ParseAttrSchema(const std::string& text, AttrSchema& schema) {
+    schema.clear();
+    if (text.empty()) {
+        return Status::OK();
+    }
+
+    std::set<std::string> names;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        auto pos = item.find(':');
+        if (pos == std::string::npos) {
+            return Status(DB_ERROR, "Invalid attribute '" + item + "', expect name:type");
+        }
+
+        AttrField field;
+        field.name_ = item.substr(0, pos);
+        std::string type = item.substr(pos + 1);
+        if (type == "int64") {
+            field.type_ = AttrType::INT64;
+        } else if (type == "double") {
+            field.type_ = AttrType::DOUBLE;
+        } else {
+            return Status(DB_ERROR, "Invalid type '" + type + "' of attribute " + field.name_);
+        }
+        if (!ValidAttrName(field.name_)) {
+            return Status(DB_ERROR, "Invalid attribute name '" + field.name_ + "'");
+        }
+        if (!names.insert(field.name_).second) {
+            return Status(DB_ERROR, "Duplicated attribute " + field.name_);
+        }
+        schema.push_back(field);
+    }
+    return Status::OK();
+}
+
+std::string
+FormatAttrSchema(const AttrSchema& schema) {
+    std::string text;
+    for (auto& field : schema) {
+        if (!text.empty()) {
+            text += ",";
+        }
+        text += field.name_ + ":" + AttrTypeName(field.type_);
+    }
+    return text;
+}
+
+Status
+ValidateAttrColumns(const AttrSchema& schema, const AttrColumns& columns, size_t count) {
+    if (columns.size() != schema.size()) {
+        return Status(DB_ERROR, "The table has " + std::to_string(schema.size()) + " attributes but " +
+                                    std::to_string(columns.size()) + " are given");
+    }
+
+    for (auto& field : schema) {
+        auto iter = std::find_if(columns.begin(), columns.end(),
+                                 [&](const AttrColumn& column) { return column.name_ == field.name_; });
+        if (iter == columns.end()) {
+            return Status(DB_ERROR, "Attribute " + field.name_ + " is missing");
+        }
+        if (iter->type_ != field.type_) {
+            return Status(DB_ERROR, "Attribute " + field.name_ + " must be of type " + AttrTypeName(field.type_));
+        }
+        if (iter->Rows() != count) {
+            return Status(DB_ERROR, "Attribute " + field.name_ + " must have a value for each vector");
+        }
+    }
+    return Status::OK();
+}
+
+SegmentAttrs::SegmentAttrs(std::vector<int64_t> ids, AttrColumns columns)
+    : ids_(std::move(ids)), columns_(std::move(columns)) {
+    std::sort(columns_.begin(), columns_.end(),
+              [](const AttrColumn& a, const AttrColumn& b) { return a.name_ < b.name_; });
+
+    zone_maps_.resize(columns_.size());
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        auto& column = columns_[i];
+        auto& zone = zone_maps_[i];
+        if (column.type_ == AttrType::INT64) {
+            MinMax(column.int_data_, zone.int_min_, zone.int_max_);
+        } else {
+            MinMax(column.double_data_, zone.double_min_, zone.double_max_);
+        }
+    }
+}
+
+int
+SegmentAttrs::Find(const std::string& name) const {
+    auto iter = std::lower_bound(columns_.begin(), columns_.end(), name,
+                                 [](const AttrColumn& column, const std::string& key) { return column.name_ < key; });
+    if (iter == columns_.end() || iter->name_ != name) {
+        return -1;
+    }
+    return static_cast<int>(iter - columns_.begin());
+}
+
+const AttrColumn*
+SegmentAttrs::Column(const std::string& name) const {
+    int i = Find(name);
+    return (i < 0) ? nullptr : &columns_[i];
+}
+
+const ZoneMap*
+SegmentAttrs::Zone(const std::string& name) const {
+    int i = Find(name);
+    return (i < 0) ? nullptr : &zone_maps_[i];
+}
+
+int64_t
+SegmentAttrs::Size() {
+    return static_cast<int64_t>((ids_.size() * (columns_.size() + 1)) * sizeof(int64_t));
+}
+
+Status
+SegmentAttrs::Write(const std::string& location) const {
+    FileHeader header{ids_.size(), columns_.size()};
+    std::vector<ColumnHeader> column_headers;
+    for (auto& column : columns_) {
+        column_headers.push_back({static_cast<int32_t>(column.type_), static_cast<uint32_t>(column.name_.size())});
+    }
+
+    std::vector<server::IOBuffer> buffers = {{&header, sizeof(header)}};
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        buffers.push_back({&column_headers[i], sizeof(ColumnHeader)});
+        buffers.push_back({columns_[i].name_.data(), columns_[i].name_.size()});
+    }
+    buffers.push_back({ids_.data(), ids_.size() * sizeof(int64_t)});
+    for (auto& column : columns_) {
+        if (column.type_ == AttrType::INT64) {
+            buffers.push_back({column.int_data_.data(), column.int_data_.size() * sizeof(int64_t)});
+        } else {
+            buffers.push_back({column.double_data_.data(), column.double_data_.size() * sizeof(double)});
+        }
+    }
+    return server::FileIO::GetInstance().WriteFile(FileName(location), buffers, true);
+}
+
+SegmentAttrsPtr
+SegmentAttrs::Get(const std::string& location) {
+    const std::string key = FileName(location);
+    auto attrs = std::static_pointer_cast<SegmentAttrs>(cache::CpuCacheMgr::GetInstance()->GetIndex(key));
+    if (attrs != nullptr) {
+        return attrs;
+    }
+
+    auto status = Read(location, attrs);
+    if (!status.ok()) {
+        // rows without attributes match no filter, the vectors themselves are still searchable
+        ENGINE_LOG_ERROR << status.message();
+        return std::make_shared<SegmentAttrs>(std::vector<int64_t>(), AttrColumns());
+    }
+    cache::CpuCacheMgr::GetInstance()->InsertItem(key, attrs);
+    return attrs;
+}
+
+Status
+SegmentAttrs::Merge(const std::string& location, const std::vector<std::string>& sources) {
+    std::vector<int64_t> ids;
+    AttrColumns columns;
+    bool first = true;
+    for (auto& source : sources) {
+        auto attrs = Get(source);
+        if (attrs->columns_.empty()) {
+            continue;
+        }
+
+        if (first) {
+            for (auto& column : attrs->columns_) {
+                AttrColumn empty;
+                empty.name_ = column.name_;
+                empty.type_ = column.type_;
+                columns.push_back(empty);
+            }
+            first = false;
+        } else if (attrs->columns_.size() != columns.size() ||
+                   !std::equal(columns.begin(), columns.end(), attrs->columns_.begin(),
+                               [](const AttrColumn& a, const AttrColumn& b) {
+                                   return a.name_ == b.name_ && a.type_ == b.type_;
+                               })) {
+            return Status(DB_ERROR, "Attributes of " + source + " do not match the other files");
+        }
+
+        // copy runs of rows between the tombstoned ones
+        auto tombstones = SegmentTombstones::Get(source);
+        size_t rows = attrs->ids_.size();
+        size_t begin = 0;
+        for (size_t row = 0; row <= rows; ++row) {
+            if (row < rows && !tombstones->Contains(attrs->ids_[row])) {
+                continue;
+            }
+            if (row > begin) {
+                ids.insert(ids.end(), attrs->ids_.begin() + begin, attrs->ids_.begin() + row);
+                for (size_t i = 0; i < columns.size(); ++i) {
+                    columns[i].Append(attrs->columns_[i], begin, row - begin);
+                }
+            }
+            begin = row + 1;
+        }
+    }
+
+    if (first) {
+        return Status::OK();
+    }
+    return SegmentAttrs(std::move(ids), std::move(columns)).Write(location);
+}
+
+Status
+SegmentAttrs::Copy(const std::string& origin, const std::string& location) {
+    if (!boost::filesystem::exists(FileName(origin))) {
+        return Status::OK();
+    }
+
+    boost::system::error_code err;
+    boost::filesystem::copy_file(FileName(origin), FileName(location),
+                                 boost::filesystem::copy_option::overwrite_if_exists, err);
+    if (err) {
+        return Status(DB_ERROR, "Failed to copy attributes of " + origin + ": " + err.message());
+    }
+    return Status::OK();
+}
+
+Status
+SegmentAttrs::Read(const std::string& location, SegmentAttrsPtr& attrs) {
+    const std::string path = FileName(location);
+    if (!boost::filesystem::exists(path)) {
+        attrs = std::make_shared<SegmentAttrs>(std::vector<int64_t>(), AttrColumns());
+        return Status::OK();
+    }
+
+    std::shared_ptr<uint8_t> buffer;
+    uint64_t size = 0;
+    auto status = server::FileIO::GetInstance().ReadFile(path, buffer, size);
+    if (!status.ok()) {
+        return status;
+    }
+
+    const Status corrupted(DB_ERROR, "Corrupted attributes of " + location);
+    const uint8_t* data = buffer.get();
+    uint64_t offset = 0;
+    auto take = [&](void* target, uint64_t length) {
+        if (offset + length > size) {
+            return false;
+        }
+        if (length == 0) {
+            return true;
+        }
+        memcpy(target, data + offset, length);
+        offset += length;
+        return true;
+    };
+
+    FileHeader header;
+    if (!take(&header, sizeof(header)) || header.columns_ * sizeof(ColumnHeader) > size) {
+        return corrupted;
+    }
+
+    AttrColumns columns(header.columns_);
+    for (auto& column : columns) {
+        ColumnHeader column_header;
+        if (!take(&column_header, sizeof(column_header)) || column_header.name_length_ > MAX_ATTR_NAME_LENGTH ||
+            (column_header.type_ != static_cast<int32_t>(AttrType::INT64) &&
+             column_header.type_ != static_cast<int32_t>(AttrType::DOUBLE))) {
+            return corrupted;
+        }
+        column.type_ = static_cast<AttrType>(column_header.type_);
+        column.name_.resize(column_header.name_length_);
+        if (!take(&column.name_[0], column_header.name_length_)) {
+            return corrupted;
+        }
+    }
+
+    if (size - offset != header.rows_ * (header.columns_ + 1) * sizeof(int64_t)) {
+        return corrupted;
+    }
+    std::vector<int64_t> ids(header.rows_);
+    take(ids.data(), header.rows_ * sizeof(int64_t));
+    for (auto& column : columns) {
+        if (column.type_ == AttrType::INT64) {
+            column.int_data_.resize(header.rows_);
+            take(column.int_data_.data(), header.rows_ * sizeof(int64_t));
+        } else {
+            column.double_data_.resize(header.rows_);
+            take(column.double_data_.data(), header.rows_ * sizeof(double));
+        }
+    }
+
+    attrs = std::make_shared<SegmentAttrs>(std::move(ids), std::move(columns));
+    return Status::OK();
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include "cache/DataObj.h"
+#include "utils/Status.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+enum class AttrType {
+    INT64 = 1,
+    DOUBLE = 2,
+};
+
+// scalar attribute a table stores next to each vector
+struct AttrField {
+    std::string name_;
+    AttrType type_ = AttrType::INT64;
+};
+using AttrSchema = std::vector<AttrField>;
+
+// values of one attribute for consecutive rows, only the array of its type is filled
+struct AttrColumn {
+    std::string name_;
+    AttrType type_ = AttrType::INT64;
+    std::vector<int64_t> int_data_;
+    std::vector<double> double_data_;
+
+    size_t
+    Rows() const {
+        return (type_ == AttrType::INT64) ? int_data_.size() : double_data_.size();
+    }
+
+    // append rows [offset, offset + count) of other
+    void
+    Append(const AttrColumn& other, size_t offset, size_t count);
+};
+using AttrColumns = std::vector<AttrColumn>;
+
+// parse the "name:int64,name:double" form the schema is kept in by the table meta
+Status
+ParseAttrSchema(const std::string& text, AttrSchema& schema);
+
+std::string
+FormatAttrSchema(const AttrSchema& schema);
+
+// columns must give count values for each field of schema and nothing else
+Status
+ValidateAttrColumns(const AttrSchema& schema, const AttrColumns& columns, size_t count);
+
+// smallest and largest value of a column in one file, only the pair of the column type is set
+struct ZoneMap {
+    int64_t int_min_ = 0;
+    int64_t int_max_ = 0;
+    double double_min_ = 0;
+    double double_max_ = 0;
+};
+
+class SegmentAttrs;
+using SegmentAttrsPtr = std::shared_ptr<SegmentAttrs>;
+
+// Attribute columns of the vectors of one table file, with the id of every row. Each column is one
+// contiguous typed array so that a predicate is evaluated over it in a single pass, and the zone maps
+// let searches skip files without looking at their rows. Rows of a raw file are in the order of its
+// vectors, files built from others may keep the rows of their origin.
+class SegmentAttrs : public cache::DataObj {
+ public:
+    // columns are kept sorted by name
+    SegmentAttrs(std::vector<int64_t> ids, AttrColumns columns);
+
+    static std::string
+    FileName(const std::string& location) {
+        return location + ".attr";
+    }
+
+    int64_t
+    Rows() const {
+        return static_cast<int64_t>(ids_.size());
+    }
+
+    const std::vector<int64_t>&
+    Ids() const {
+        return ids_;
+    }
+
+    const AttrColumns&
+    Columns() const {
+        return columns_;
+    }
+
+    // nullptr when the file has no such column
+    const AttrColumn*
+    Column(const std::string& name) const;
+
+    const ZoneMap*
+    Zone(const std::string& name) const;
+
+    int64_t
+    Size() override;
+
+    Status
+    Write(const std::string& location) const;
+
+    // attributes of the file at location, from the cpu cache or disk, without rows when the file has none
+    static SegmentAttrsPtr
+    Get(const std::string& location);
+
+    // attributes of a file merged from sources, in the order of the sources; rows tombstoned in a
+    // source are left out as the merge leaves out their vectors
+    static Status
+    Merge(const std::string& location, const std::vector<std::string>& sources);
+
+    // the file at location holds the vectors of the one at origin, e.g. an index built from it
+    static Status
+    Copy(const std::string& origin, const std::string& location);
+
+ private:
+    int
+    Find(const std::string& name) const;
+
+    static Status
+    Read(const std::string& location, SegmentAttrsPtr& attrs);
+
+ private:
+    std::vector<int64_t> ids_;
+    AttrColumns columns_;
+    std::vector<ZoneMap> zone_maps_;
+};
+
+}  // namespace engine
+}  // namespace milvus
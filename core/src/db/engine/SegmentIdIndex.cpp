@@ -0,0 +1,185 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "db/engine/SegmentIdIndex.h"
+#include "utils/FileIO.h"
+#include "utils/Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+// ~1% false positives
+constexpr uint64_t FILTER_BITS_PER_ID = 10;
+constexpr uint64_t FILTER_HASH_COUNT = 7;
+
+uint64_t
+Mix(uint64_t x) {
+    // splitmix64 finalizer, ids are often sequential and need to be spread over the filter
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+struct FileHeader {
+    uint64_t count_;
+    uint64_t filter_words_;
+};
+
+}  // namespace
+
+SegmentIdIndex::SegmentIdIndex(const std::vector<int64_t>& ids, const std::vector<int64_t>& slots) {
+    std::vector<size_t> order(ids.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return ids[a] < ids[b]; });
+
+    ids_.reserve(ids.size());
+    slots_.reserve(ids.size());
+    for (auto i : order) {
+        ids_.push_back(ids[i]);
+        slots_.push_back(slots[i]);
+    }
+    BuildFilter();
+}
+
+void
+SegmentIdIndex::BuildFilter() {
+    filter_.assign(std::max<uint64_t>(1, (ids_.size() * FILTER_BITS_PER_ID + 63) / 64), 0);
+    uint64_t bits = filter_.size() * 64;
+    for (auto id : ids_) {
+        uint64_t h1 = Mix(static_cast<uint64_t>(id));
+        uint64_t h2 = (h1 >> 32) | 1;
+        for (uint64_t i = 0; i < FILTER_HASH_COUNT; ++i) {
+            uint64_t bit = (h1 + i * h2) % bits;
+            filter_[bit / 64] |= (1ULL << (bit % 64));
+        }
+    }
+}
+
+bool
+SegmentIdIndex::MayContain(int64_t id) const {
+    uint64_t bits = filter_.size() * 64;
+    uint64_t h1 = Mix(static_cast<uint64_t>(id));
+    uint64_t h2 = (h1 >> 32) | 1;
+    for (uint64_t i = 0; i < FILTER_HASH_COUNT; ++i) {
+        uint64_t bit = (h1 + i * h2) % bits;
+        if ((filter_[bit / 64] & (1ULL << (bit % 64))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+SegmentIdIndex::Find(int64_t id, int64_t& slot) const {
+    if (!MayContain(id)) {
+        return false;
+    }
+    auto iter = std::lower_bound(ids_.begin(), ids_.end(), id);
+    if (iter == ids_.end() || *iter != id) {
+        return false;
+    }
+    slot = slots_[iter - ids_.begin()];
+    return true;
+}
+
+void
+SegmentIdIndex::FindBatch(const std::vector<int64_t>& sorted_ids, std::vector<int64_t>& found) const {
+    // probe without early exit, the loop over the batch has no data dependent branch
+    uint64_t bits = filter_.size() * 64;
+    std::vector<uint8_t> maybe(sorted_ids.size());
+    for (size_t i = 0; i < sorted_ids.size(); ++i) {
+        uint64_t h1 = Mix(static_cast<uint64_t>(sorted_ids[i]));
+        uint64_t h2 = (h1 >> 32) | 1;
+        uint64_t hit = 1;
+        for (uint64_t k = 0; k < FILTER_HASH_COUNT; ++k) {
+            uint64_t bit = (h1 + k * h2) % bits;
+            hit &= (filter_[bit / 64] >> (bit % 64));
+        }
+        maybe[i] = static_cast<uint8_t>(hit & 1);
+    }
+
+    // both sides are sorted, each search resumes where the previous one stopped
+    auto begin = ids_.begin();
+    for (size_t i = 0; i < sorted_ids.size() && begin != ids_.end(); ++i) {
+        if (!maybe[i]) {
+            continue;
+        }
+        begin = std::lower_bound(begin, ids_.end(), sorted_ids[i]);
+        if (begin != ids_.end() && *begin == sorted_ids[i]) {
+            found.push_back(sorted_ids[i]);
+        }
+    }
+}
+
+int64_t
+SegmentIdIndex::Size() {
+    return static_cast<int64_t>((ids_.size() + slots_.size()) * sizeof(int64_t) + filter_.size() * sizeof(uint64_t));
+}
+
+Status
+SegmentIdIndex::Write(const std::string& location) const {
+    FileHeader header{ids_.size(), filter_.size()};
+    std::vector<server::IOBuffer> buffers = {
+        {&header, sizeof(header)},
+        {ids_.data(), ids_.size() * sizeof(int64_t)},
+        {slots_.data(), slots_.size() * sizeof(int64_t)},
+        {filter_.data(), filter_.size() * sizeof(uint64_t)},
+    };
+    return server::FileIO::GetInstance().WriteFile(FileName(location), buffers);
+}
+
+Status
+SegmentIdIndex::Read(const std::string& location, SegmentIdIndexPtr& index) {
+    std::shared_ptr<uint8_t> buffer;
+    uint64_t size = 0;
+    auto status = server::FileIO::GetInstance().ReadFile(FileName(location), buffer, size);
+    if (!status.ok()) {
+        return status;
+    }
+
+    FileHeader header;
+    if (size < sizeof(header)) {
+        return Status(DB_ERROR, "Corrupted id index of " + location);
+    }
+    memcpy(&header, buffer.get(), sizeof(header));
+    uint64_t expected = sizeof(header) + header.count_ * 2 * sizeof(int64_t) + header.filter_words_ * sizeof(uint64_t);
+    if (header.filter_words_ == 0 || size != expected) {
+        return Status(DB_ERROR, "Corrupted id index of " + location);
+    }
+
+    index = SegmentIdIndexPtr(new SegmentIdIndex());
+    auto data = buffer.get() + sizeof(header);
+    index->ids_.resize(header.count_);
+    memcpy(index->ids_.data(), data, header.count_ * sizeof(int64_t));
+    data += header.count_ * sizeof(int64_t);
+    index->slots_.resize(header.count_);
+    memcpy(index->slots_.data(), data, header.count_ * sizeof(int64_t));
+    data += header.count_ * sizeof(int64_t);
+    index->filter_.resize(header.filter_words_);
+    memcpy(index->filter_.data(), data, header.filter_words_ * sizeof(uint64_t));
+    return Status::OK();
+}
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "cache/DataObj.h"
+#include "utils/Status.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+class SegmentIdIndex;
+using SegmentIdIndexPtr = std::shared_ptr<SegmentIdIndex>;
+
+// Sorted ids of one table file with the position of each vector in the file's index, plus a bloom
+// filter over the ids. It is persisted next to the file, so a lookup by id only opens the files
+// whose filter matches instead of every file of the table.
+class SegmentIdIndex : public cache::DataObj {
+ public:
+    // ids and slots as returned by VecIndex::GetIds, in any order
+    SegmentIdIndex(const std::vector<int64_t>& ids, const std::vector<int64_t>& slots);
+
+    static std::string
+    FileName(const std::string& location) {
+        return location + ".ids";
+    }
+
+    // false means the file does not hold id, true may be a false positive
+    bool
+    MayContain(int64_t id) const;
+
+    // position of id to pass to VecIndex::Reconstruct, false when the file does not hold id
+    bool
+    Find(int64_t id, int64_t& slot) const;
+
+    // appends to found the ids of sorted_ids held by the file, one filter pass over the whole batch
+    // narrows it down before the survivors are joined with the sorted ids of the file
+    void
+    FindBatch(const std::vector<int64_t>& sorted_ids, std::vector<int64_t>& found) const;
+
+    int64_t
+    Count() const {
+        return static_cast<int64_t>(ids_.size());
+    }
+
+    int64_t
+    Size() override;
+
+    Status
+    Write(const std::string& location) const;
+
+    static Status
+    Read(const std::string& location, SegmentIdIndexPtr& index);
+
+ private:
+    SegmentIdIndex() = default;
+
+    void
+    BuildFilter();
+
+ private:
+    std::vector<int64_t> ids_;
+    std::vector<int64_t> slots_;
+    std::vector<uint64_t> filter_;
+};
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "db/engine/SegmentTombstones.h"
+#include "cache/CpuCacheMgr.h"
+#include "utils/FileIO.h"
+#include "utils/Log.h"
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+// a reader must not cache tombstones older than the ones an appender just published
+std::mutex&
+CacheFillMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+}  // namespace
+
+SegmentTombstones::SegmentTombstones(std::vector<int64_t> ids) : ids_(std::move(ids)) {
+    std::sort(ids_.begin(), ids_.end());
+    ids_.erase(std::unique(ids_.begin(), ids_.end()), ids_.end());
+}
+
+bool
+SegmentTombstones::Contains(int64_t id) const {
+    return std::binary_search(ids_.begin(), ids_.end(), id);
+}
+
+std::mutex&
+SegmentTombstones::WriteMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+SegmentTombstonesPtr
+SegmentTombstones::Get(const std::string& location) {
+    const std::string key = FileName(location);
+    auto tombstones = std::static_pointer_cast<SegmentTombstones>(cache::CpuCacheMgr::GetInstance()->GetIndex(key));
+    if (tombstones != nullptr) {
+        return tombstones;
+    }
+
+    std::lock_guard<std::mutex> lock(CacheFillMutex());
+    tombstones = std::static_pointer_cast<SegmentTombstones>(cache::CpuCacheMgr::GetInstance()->GetIndex(key));
+    if (tombstones != nullptr) {
+        return tombstones;
+    }
+
+    auto status = Read(location, tombstones);
+    if (!status.ok()) {
+        // deleting a vector must never resurrect others, but a broken sidecar should not fail searches either
+        ENGINE_LOG_ERROR << status.message();
+        return std::make_shared<SegmentTombstones>(std::vector<int64_t>());
+    }
+    cache::CpuCacheMgr::GetInstance()->InsertItem(key, tombstones);
+    return tombstones;
+}
+
+Status
+SegmentTombstones::Append(const std::string& location, const std::vector<int64_t>& ids) {
+    if (ids.empty()) {
+        return Status::OK();
+    }
+
+    SegmentTombstonesPtr current;
+    auto status = Read(location, current);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::vector<int64_t> merged = current->ids_;
+    merged.insert(merged.end(), ids.begin(), ids.end());
+    auto tombstones = std::make_shared<SegmentTombstones>(std::move(merged));
+    if (tombstones->Count() == current->Count()) {
+        return Status::OK();
+    }
+
+    uint64_t count = tombstones->ids_.size();
+    std::vector<server::IOBuffer> buffers = {
+        {&count, sizeof(count)},
+        {tombstones->ids_.data(), count * sizeof(int64_t)},
+    };
+    const std::string path = FileName(location);
+    const std::string temp_path = path + ".tmp";
+    status = server::FileIO::GetInstance().WriteFile(temp_path, buffers, true);
+    if (!status.ok()) {
+        return status;
+    }
+    boost::system::error_code err;
+    boost::filesystem::rename(temp_path, path, err);
+    if (err) {
+        return Status(DB_ERROR, "Failed to publish tombstones of " + location + ": " + err.message());
+    }
+
+    std::lock_guard<std::mutex> lock(CacheFillMutex());
+    cache::CpuCacheMgr::GetInstance()->InsertItem(path, tombstones);
+    return Status::OK();
+}
+
+Status
+SegmentTombstones::Read(const std::string& location, SegmentTombstonesPtr& tombstones) {
+    const std::string path = FileName(location);
+    if (!boost::filesystem::exists(path)) {
+        tombstones = std::make_shared<SegmentTombstones>(std::vector<int64_t>());
+        return Status::OK();
+    }
+
+    std::shared_ptr<uint8_t> buffer;
+    uint64_t size = 0;
+    auto status = server::FileIO::GetInstance().ReadFile(path, buffer, size);
+    if (!status.ok()) {
+        return status;
+    }
+
+    uint64_t count = 0;
+    if (size < sizeof(count)) {
+        return Status(DB_ERROR, "Corrupted tombstones of " + location);
+    }
+    memcpy(&count, buffer.get(), sizeof(count));
+    if (size != sizeof(count) + count * sizeof(int64_t)) {
+        return Status(DB_ERROR, "Corrupted tombstones of " + location);
+    }
+
+    std::vector<int64_t> ids(count);
+    memcpy(ids.data(), buffer.get() + sizeof(count), count * sizeof(int64_t));
+    tombstones = std::make_shared<SegmentTombstones>(std::move(ids));
+    return Status::OK();
+}
+
+}  // namespace engine
+}  // namespace milvus
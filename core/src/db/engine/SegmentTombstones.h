@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include "cache/DataObj.h"
+#include "utils/Status.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+class SegmentTombstones;
+using SegmentTombstonesPtr = std::shared_ptr<SegmentTombstones>;
+
+// Sorted ids of the vectors of one table file that were replaced by an upsert. The vectors stay in
+// the file until it is merged, searches drop them from the results of the file.
+class SegmentTombstones : public cache::DataObj {
+ public:
+    explicit SegmentTombstones(std::vector<int64_t> ids);
+
+    static std::string
+    FileName(const std::string& location) {
+        return location + ".del";
+    }
+
+    bool
+    Contains(int64_t id) const;
+
+    bool
+    Empty() const {
+        return ids_.empty();
+    }
+
+    int64_t
+    Count() const {
+        return static_cast<int64_t>(ids_.size());
+    }
+
+    const std::vector<int64_t>&
+    Ids() const {
+        return ids_;
+    }
+
+    int64_t
+    Size() override {
+        return static_cast<int64_t>(ids_.size() * sizeof(int64_t));
+    }
+
+    // tombstones of the file at location, from the cpu cache or disk, empty when the file has none
+    static SegmentTombstonesPtr
+    Get(const std::string& location);
+
+    // add ids to the tombstones of the file at location, the sidecar is replaced atomically
+    static Status
+    Append(const std::string& location, const std::vector<int64_t>& ids);
+
+    // serializes tombstone writers with the jobs that replace table files, so that ids tombstoned in a
+    // source file while it was merged or indexed are carried over to the new file before it goes live
+    static std::mutex&
+    WriteMutex();
+
+ private:
+    static Status
+    Read(const std::string& location, SegmentTombstonesPtr& tombstones);
+
+ private:
+    std::vector<int64_t> ids_;
+};
+
+}  // namespace engine
+}  // namespace milvus
@@ -18,8 +18,10 @@
 #pragma once
 
 #include "db/Types.h"
+#include "db/engine/SegmentAttrs.h"
 #include "utils/Status.h"
 
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
@@ -29,8 +31,19 @@ namespace engine {
 
 class MemManager {
  public:
+    // tombstones the copies of sorted_ids in the serialized files of a table
+    using DeleteFlushedHandler = std::function<Status(const std::string& table_id, const IDNumbers& sorted_ids)>;
+
+    // the vectors go to the segments of partition_tag, "" for the default partition
+    virtual Status
+    InsertVectors(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids,
+                  const AttrColumns& attrs, const std::string& partition_tag) = 0;
+
+    // insert vectors with user ids, replacing the vectors previously inserted with the same ids
     virtual Status
-    InsertVectors(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids) = 0;
+    UpsertVectors(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids,
+                  const AttrColumns& attrs, const std::string& partition_tag,
+                  const DeleteFlushedHandler& delete_flushed) = 0;
 
     virtual Status
     Serialize(std::set<std::string>& table_ids) = 0;
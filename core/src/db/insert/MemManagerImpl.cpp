@@ -20,38 +20,42 @@
 #include "db/Constants.h"
 #include "utils/Log.h"
 
+#include <algorithm>
 #include <thread>
 
 namespace milvus {
 namespace engine {
 
 MemTablePtr
-MemManagerImpl::GetMemByTable(const std::string& table_id) {
-    auto memIt = mem_id_map_.find(table_id);
+MemManagerImpl::GetMemByTable(const std::string& table_id, const std::string& partition_tag) {
+    auto key = std::make_pair(table_id, partition_tag);
+    auto memIt = mem_id_map_.find(key);
     if (memIt != mem_id_map_.end()) {
         return memIt->second;
     }
 
-    mem_id_map_[table_id] = std::make_shared<MemTable>(table_id, meta_, options_);
-    return mem_id_map_[table_id];
+    mem_id_map_[key] = std::make_shared<MemTable>(table_id, meta_, options_, partition_tag);
+    return mem_id_map_[key];
 }
 
 Status
-MemManagerImpl::InsertVectors(const std::string& table_id_, size_t n_, const float* vectors_, IDNumbers& vector_ids_) {
+MemManagerImpl::InsertVectors(const std::string& table_id_, size_t n_, const float* vectors_, IDNumbers& vector_ids_,
+                              const AttrColumns& attrs, const std::string& partition_tag) {
     while (GetCurrentMem() > options_.insert_buffer_size_) {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 
     std::unique_lock<std::mutex> lock(mutex_);
 
-    return InsertVectorsNoLock(table_id_, n_, vectors_, vector_ids_);
+    return InsertVectorsNoLock(table_id_, n_, vectors_, vector_ids_, attrs, partition_tag);
 }
 
 Status
 MemManagerImpl::InsertVectorsNoLock(const std::string& table_id, size_t n, const float* vectors,
-                                    IDNumbers& vector_ids) {
-    MemTablePtr mem = GetMemByTable(table_id);
-    VectorSourcePtr source = std::make_shared<VectorSource>(n, vectors);
+                                    IDNumbers& vector_ids, const AttrColumns& attrs,
+                                    const std::string& partition_tag) {
+    MemTablePtr mem = GetMemByTable(table_id, partition_tag);
+    VectorSourcePtr source = std::make_shared<VectorSource>(n, vectors, &attrs);
 
     auto status = mem->Add(source, vector_ids);
     if (status.ok()) {
@@ -62,6 +66,57 @@ MemManagerImpl::InsertVectorsNoLock(const std::string& table_id, size_t n, const
     return status;
 }
 
+Status
+MemManagerImpl::UpsertVectors(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids,
+                              const AttrColumns& attrs, const std::string& partition_tag,
+                              const DeleteFlushedHandler& delete_flushed) {
+    if (vector_ids.size() != n) {
+        return Status(DB_ERROR, "Upsert requires an id for every vector");
+    }
+
+    IDNumbers sorted_ids = vector_ids;
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    if (std::adjacent_find(sorted_ids.begin(), sorted_ids.end()) != sorted_ids.end()) {
+        return Status(DB_ERROR, "Upsert batch contains duplicate ids");
+    }
+
+    while (GetCurrentMem() > options_.insert_buffer_size_) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // no buffer may become immutable during the check: an old copy is either still buffered
+    // and found below, or already serialized and visible to delete_flushed
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // ids are unique across the partitions of a table, the old copy may be in any of them
+    IDNumbers found;
+    for (auto iter = mem_id_map_.lower_bound(std::make_pair(table_id, std::string()));
+         iter != mem_id_map_.end() && iter->first.first == table_id; ++iter) {
+        auto status = iter->second->Delete(sorted_ids, found);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    for (auto& mem : immu_mem_list_) {
+        if (mem->GetTableId() != table_id) {
+            continue;
+        }
+        auto status = mem->Delete(sorted_ids, found);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    auto status = delete_flushed(table_id, sorted_ids);
+    if (!status.ok()) {
+        return status;
+    }
+    ENGINE_LOG_DEBUG << "Upsert " << n << " vectors into table " << table_id << ", " << found.size()
+                     << " buffered vectors replaced";
+
+    return InsertVectorsNoLock(table_id, n, vectors, vector_ids, attrs, partition_tag);
+}
+
 Status
 MemManagerImpl::ToImmutable() {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -88,6 +143,7 @@ MemManagerImpl::Serialize(std::set<std::string>& table_ids) {
         mem->Serialize();
         table_ids.insert(mem->GetTableId());
     }
+    std::unique_lock<std::mutex> mem_lock(mutex_);
     immu_mem_list_.clear();
     return Status::OK();
 }
@@ -96,7 +152,10 @@ Status
 MemManagerImpl::EraseMemVector(const std::string& table_id) {
     {  // erase MemVector from rapid-insert cache
         std::unique_lock<std::mutex> lock(mutex_);
-        mem_id_map_.erase(table_id);
+        auto iter = mem_id_map_.lower_bound(std::make_pair(table_id, std::string()));
+        while (iter != mem_id_map_.end() && iter->first.first == table_id) {
+            iter = mem_id_map_.erase(iter);
+        }
     }
 
     {  // erase MemVector from serialize cache
@@ -28,6 +28,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace milvus {
@@ -41,7 +42,13 @@ class MemManagerImpl : public MemManager {
     }
 
     Status
-    InsertVectors(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids) override;
+    InsertVectors(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids,
+                  const AttrColumns& attrs, const std::string& partition_tag) override;
+
+    Status
+    UpsertVectors(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids,
+                  const AttrColumns& attrs, const std::string& partition_tag,
+                  const DeleteFlushedHandler& delete_flushed) override;
 
     Status
     Serialize(std::set<std::string>& table_ids) override;
@@ -60,14 +67,16 @@ class MemManagerImpl : public MemManager {
 
  private:
     MemTablePtr
-    GetMemByTable(const std::string& table_id);
+    GetMemByTable(const std::string& table_id, const std::string& partition_tag);
 
     Status
-    InsertVectorsNoLock(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids);
+    InsertVectorsNoLock(const std::string& table_id, size_t n, const float* vectors, IDNumbers& vector_ids,
+                        const AttrColumns& attrs, const std::string& partition_tag);
     Status
     ToImmutable();
 
-    using MemIdMap = std::map<std::string, MemTablePtr>;
+    // one buffer per partition of a table, keyed by (table id, partition tag)
+    using MemIdMap = std::map<std::pair<std::string, std::string>, MemTablePtr>;
     using MemList = std::vector<MemTablePtr>;
     MemIdMap mem_id_map_;
     MemList immu_mem_list_;
@@ -24,8 +24,9 @@
 namespace milvus {
 namespace engine {
 
-MemTable::MemTable(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options)
-    : table_id_(table_id), meta_(meta), options_(options) {
+MemTable::MemTable(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options,
+                   const std::string& partition_tag)
+    : table_id_(table_id), partition_tag_(partition_tag), meta_(meta), options_(options) {
 }
 
 Status
@@ -38,7 +39,8 @@ MemTable::Add(VectorSourcePtr& source, IDNumbers& vector_ids) {
 
         Status status;
         if (mem_table_file_list_.empty() || current_mem_table_file->IsFull()) {
-            MemTableFilePtr new_mem_table_file = std::make_shared<MemTableFile>(table_id_, meta_, options_);
+            MemTableFilePtr new_mem_table_file =
+                std::make_shared<MemTableFile>(table_id_, meta_, options_, partition_tag_);
             status = new_mem_table_file->Add(source, vector_ids);
             if (status.ok()) {
                 mem_table_file_list_.emplace_back(new_mem_table_file);
@@ -56,6 +58,18 @@ MemTable::Add(VectorSourcePtr& source, IDNumbers& vector_ids) {
     return Status::OK();
 }
 
+Status
+MemTable::Delete(const IDNumbers& sorted_ids, IDNumbers& found) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& mem_table_file : mem_table_file_list_) {
+        auto status = mem_table_file->Delete(sorted_ids, found);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
 void
 MemTable::GetCurrentMemTableFile(MemTableFilePtr& mem_table_file) {
     mem_table_file = mem_table_file_list_.back();
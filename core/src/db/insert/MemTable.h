@@ -33,11 +33,16 @@ class MemTable {
  public:
     using MemTableFileList = std::vector<MemTableFilePtr>;
 
-    MemTable(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options);
+    MemTable(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options,
+             const std::string& partition_tag = "");
 
     Status
     Add(VectorSourcePtr& source, IDNumbers& vector_ids);
 
+    // tombstone the buffered vectors of sorted_ids, their ids are appended to found
+    Status
+    Delete(const IDNumbers& sorted_ids, IDNumbers& found);
+
     void
     GetCurrentMemTableFile(MemTableFilePtr& mem_table_file);
 
@@ -53,12 +58,19 @@ class MemTable {
     const std::string&
     GetTableId() const;
 
+    const std::string&
+    GetPartitionTag() const {
+        return partition_tag_;
+    }
+
     size_t
     GetCurrentMem();
 
  private:
     const std::string table_id_;
 
+    const std::string partition_tag_;
+
     MemTableFileList mem_table_file_list_;
 
     meta::MetaPtr meta_;
@@ -18,6 +18,8 @@
 #include "db/insert/MemTableFile.h"
 #include "db/Constants.h"
 #include "db/engine/EngineFactory.h"
+#include "db/engine/SegmentAttrs.h"
+#include "db/engine/SegmentTombstones.h"
 #include "metrics/Metrics.h"
 #include "utils/Log.h"
 
@@ -27,8 +29,9 @@
 namespace milvus {
 namespace engine {
 
-MemTableFile::MemTableFile(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options)
-    : table_id_(table_id), meta_(meta), options_(options) {
+MemTableFile::MemTableFile(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options,
+                           const std::string& partition_tag)
+    : table_id_(table_id), partition_tag_(partition_tag), meta_(meta), options_(options) {
     current_mem_ = 0;
     auto status = CreateTableFile();
     if (status.ok()) {
@@ -42,6 +45,7 @@ Status
 MemTableFile::CreateTableFile() {
     meta::TableFileSchema table_file_schema;
     table_file_schema.table_id_ = table_id_;
+    table_file_schema.partition_tag_ = partition_tag_;
     auto status = meta_->CreateTableFile(table_file_schema);
     if (status.ok()) {
         table_file_schema_ = table_file_schema;
@@ -71,6 +75,13 @@ MemTableFile::Add(const VectorSourcePtr& source, IDNumbers& vector_ids) {
             source->Add(execution_engine_, table_file_schema_, num_vectors_to_add, num_vectors_added, vector_ids);
         if (status.ok()) {
             current_mem_ += (num_vectors_added * single_vector_mem_size);
+            auto& source_ids = source->GetVectorIds();
+            auto added = source_ids.end() - num_vectors_added;
+            if (id_set_built_) {
+                id_set_.insert(added, source_ids.end());
+            }
+            ids_.insert(ids_.end(), added, source_ids.end());
+            source->CopyAttrs(source->GetNumVectorsAdded() - num_vectors_added, num_vectors_added, attrs_);
         }
         return status;
     }
@@ -90,7 +101,35 @@ MemTableFile::GetMemLeft() {
 bool
 MemTableFile::IsFull() {
     size_t single_vector_mem_size = table_file_schema_.dimension_ * VECTOR_TYPE_SIZE;
-    return (GetMemLeft() < single_vector_mem_size);
+    return sealed_ || (GetMemLeft() < single_vector_mem_size);
+}
+
+Status
+MemTableFile::Delete(const IDNumbers& sorted_ids, IDNumbers& found) {
+    if (!id_set_built_) {
+        id_set_.insert(ids_.begin(), ids_.end());
+        id_set_built_ = true;
+    }
+
+    IDNumbers hits;
+    for (auto id : sorted_ids) {
+        if (id_set_.find(id) != id_set_.end()) {
+            hits.push_back(id);
+        }
+    }
+    if (hits.empty()) {
+        return Status::OK();
+    }
+    sealed_ = true;
+    found.insert(found.end(), hits.begin(), hits.end());
+
+    std::lock_guard<std::mutex> lock(delete_mutex_);
+    if (!serialized_) {
+        deleted_ids_.insert(deleted_ids_.end(), hits.begin(), hits.end());
+        return Status::OK();
+    }
+    std::lock_guard<std::mutex> write_lock(SegmentTombstones::WriteMutex());
+    return SegmentTombstones::Append(table_file_schema_.location_, hits);
 }
 
 Status
@@ -99,6 +138,27 @@ MemTableFile::Serialize() {
     server::CollectSerializeMetrics metrics(size);
 
     execution_engine_->Serialize();
+    {
+        // the file is not searchable before the meta update below, its tombstones are in place by then
+        std::lock_guard<std::mutex> lock(delete_mutex_);
+        std::lock_guard<std::mutex> write_lock(SegmentTombstones::WriteMutex());
+        auto status = SegmentTombstones::Append(table_file_schema_.location_, deleted_ids_);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Failed to write tombstones of file " << table_file_schema_.file_id_ << ": "
+                             << status.message();
+            return status;
+        }
+        deleted_ids_.clear();
+        serialized_ = true;
+    }
+    if (!attrs_.empty()) {
+        auto status = SegmentAttrs(ids_, attrs_).Write(table_file_schema_.location_);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Failed to write attributes of file " << table_file_schema_.file_id_ << ": "
+                             << status.message();
+            return status;
+        }
+    }
     table_file_schema_.file_size_ = execution_engine_->PhysicalSize();
     table_file_schema_.row_count_ = execution_engine_->Count();
 
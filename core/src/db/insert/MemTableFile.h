@@ -23,14 +23,17 @@
 #include "utils/Status.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 
 namespace milvus {
 namespace engine {
 
 class MemTableFile {
  public:
-    MemTableFile(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options);
+    MemTableFile(const std::string& table_id, const meta::MetaPtr& meta, const DBOptions& options,
+                 const std::string& partition_tag = "");
 
     Status
     Add(const VectorSourcePtr& source, IDNumbers& vector_ids);
@@ -44,6 +47,11 @@ class MemTableFile {
     bool
     IsFull();
 
+    // tombstone the vectors of sorted_ids held by this file and append their ids to found, the file
+    // takes no more vectors afterwards so that it never holds a live and a deleted copy of one id
+    Status
+    Delete(const IDNumbers& sorted_ids, IDNumbers& found);
+
     Status
     Serialize();
 
@@ -53,12 +61,25 @@ class MemTableFile {
 
  private:
     const std::string table_id_;
+    const std::string partition_tag_;
     meta::TableFileSchema table_file_schema_;
     meta::MetaPtr meta_;
     DBOptions options_;
     size_t current_mem_;
 
     ExecutionEnginePtr execution_engine_;
+
+    // ids of the vectors added so far, hashed on the first upsert that checks this file
+    IDNumbers ids_;
+    AttrColumns attrs_;
+    std::unordered_set<IDNumber> id_set_;
+    bool id_set_built_ = false;
+    bool sealed_ = false;
+
+    // tombstones are written with the file, or straight to its sidecar once it is serialized
+    std::mutex delete_mutex_;
+    IDNumbers deleted_ids_;
+    bool serialized_ = false;
 };  // MemTableFile
 
 using MemTableFilePtr = std::shared_ptr<MemTableFile>;
@@ -24,8 +24,8 @@
 namespace milvus {
 namespace engine {
 
-VectorSource::VectorSource(const size_t& n, const float* vectors)
-    : n_(n), vectors_(vectors), id_generator_(std::make_shared<SimpleIDGenerator>()) {
+VectorSource::VectorSource(const size_t& n, const float* vectors, const AttrColumns* attrs)
+    : n_(n), vectors_(vectors), attrs_(attrs), id_generator_(std::make_shared<SimpleIDGenerator>()) {
     current_num_vectors_added = 0;
 }
 
@@ -69,10 +69,33 @@ VectorSource::AllAdded() {
     return (current_num_vectors_added == n_);
 }
 
-IDNumbers
+const IDNumbers&
 VectorSource::GetVectorIds() {
     return vector_ids_;
 }
 
+void
+VectorSource::CopyAttrs(size_t offset, size_t count, AttrColumns& columns) const {
+    if (attrs_ == nullptr || attrs_->empty()) {
+        return;
+    }
+    if (columns.empty()) {
+        for (auto& attr : *attrs_) {
+            AttrColumn column;
+            column.name_ = attr.name_;
+            column.type_ = attr.type_;
+            columns.emplace_back(column);
+        }
+    }
+    for (auto& column : columns) {
+        for (auto& attr : *attrs_) {
+            if (attr.name_ == column.name_) {
+                column.Append(attr, offset, count);
+                break;
+            }
+        }
+    }
+}
+
 }  // namespace engine
 }  // namespace milvus
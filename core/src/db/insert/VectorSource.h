@@ -19,6 +19,7 @@
 
 #include "db/IDGenerator.h"
 #include "db/engine/ExecutionEngine.h"
+#include "db/engine/SegmentAttrs.h"
 #include "db/meta/Meta.h"
 #include "utils/Status.h"
 
@@ -29,7 +30,7 @@ namespace engine {
 
 class VectorSource {
  public:
-    VectorSource(const size_t& n, const float* vectors);
+    VectorSource(const size_t& n, const float* vectors, const AttrColumns* attrs = nullptr);
 
     Status
     Add(const ExecutionEnginePtr& execution_engine, const meta::TableFileSchema& table_file_schema,
@@ -41,12 +42,17 @@ class VectorSource {
     bool
     AllAdded();
 
-    IDNumbers
+    const IDNumbers&
     GetVectorIds();
 
+    // append the attribute values of vectors [offset, offset + count) to columns
+    void
+    CopyAttrs(size_t offset, size_t count, AttrColumns& columns) const;
+
  private:
     const size_t n_;
     const float* vectors_;
+    const AttrColumns* attrs_;
     IDNumbers vector_ids_;
 
     size_t current_num_vectors_added;
@@ -0,0 +1,241 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "db/meta/ChangeFeed.h"
+#include "utils/Log.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+namespace {
+
+// the feed is rotated to <path>.1 beyond this size, a reader still holding the old one reads it to the end
+constexpr int64_t MAX_FEED_SIZE = 64 * 1024 * 1024;
+constexpr size_t READ_CHUNK_SIZE = 64 * 1024;
+constexpr int64_t LAST_LINE_SEARCH_SIZE = 4096;
+
+std::string
+FormatChange(const FileChange& change) {
+    auto& file = change.file_;
+    std::stringstream ss;
+    ss << change.version_ << " " << file.table_id_ << " " << file.file_id_ << " " << file.id_ << " "
+       << file.file_type_ << " " << file.file_size_ << " " << file.row_count_ << " " << file.date_ << " "
+       << file.engine_type_ << " " << file.tier_ << " " << file.partition_tag_ << "\n";
+    return ss.str();
+}
+
+bool
+ParseChange(const std::string& line, FileChange& change) {
+    auto& file = change.file_;
+    std::istringstream ss(line);
+    ss >> change.version_ >> file.table_id_ >> file.file_id_ >> file.id_ >> file.file_type_ >> file.file_size_ >>
+        file.row_count_ >> file.date_ >> file.engine_type_ >> file.tier_;
+    if (ss.fail()) {
+        return false;
+    }
+
+    // partition tags have no blanks, the tag is missing for the default partition and in older feeds
+    if (!(ss >> file.partition_tag_)) {
+        file.partition_tag_.clear();
+    }
+    return true;
+}
+
+// offset just past the last complete line of the feed and the version of that line, 0 for an empty feed
+int64_t
+LastLine(int fd, uint64_t& version) {
+    version = 0;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        return 0;
+    }
+
+    int64_t start = std::max<int64_t>(0, st.st_size - LAST_LINE_SEARCH_SIZE);
+    std::string buf(st.st_size - start, '\0');
+    ssize_t n = pread(fd, &buf[0], buf.size(), start);
+    if (n <= 0) {
+        return 0;
+    }
+    buf.resize(n);
+
+    auto end = buf.rfind('\n');
+    if (end == std::string::npos) {
+        return 0;
+    }
+    auto begin = (end == 0) ? std::string::npos : buf.rfind('\n', end - 1);
+    begin = (begin == std::string::npos) ? 0 : begin + 1;
+
+    FileChange change;
+    if (ParseChange(buf.substr(begin, end - begin), change)) {
+        version = change.version_;
+    }
+    return start + end + 1;
+}
+
+}  // namespace
+
+ChangeFeedWriter::ChangeFeedWriter(const std::string& path) : path_(path) {
+}
+
+ChangeFeedWriter::~ChangeFeedWriter() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+Status
+ChangeFeedWriter::Open() {
+    fd_ = open(path_.c_str(), O_RDWR | O_APPEND | O_CREAT, 0644);
+    if (fd_ < 0) {
+        return Status(DB_ERROR, "Failed to open change feed " + path_ + ": " + strerror(errno));
+    }
+
+    // versions continue after a restart or a rotation
+    uint64_t last_version = 0;
+    size_ = LastLine(fd_, last_version);
+    version_ = std::max(version_, last_version);
+    return Status::OK();
+}
+
+Status
+ChangeFeedWriter::Append(FileChanges& changes) {
+    if (changes.empty()) {
+        return Status::OK();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ < 0) {
+        auto status = Open();
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    std::string content;
+    for (auto& change : changes) {
+        change.version_ = ++version_;
+        content += FormatChange(change);
+    }
+
+    if (size_ > 0 && size_ + (int64_t)content.size() > MAX_FEED_SIZE) {
+        std::string rotated_path = path_ + ".1";
+        rename(path_.c_str(), rotated_path.c_str());
+        close(fd_);
+        auto status = Open();
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    // one write per batch, readers never see a batch partly unless the storage splits it
+    ssize_t written = write(fd_, content.data(), content.size());
+    if (written != (ssize_t)content.size()) {
+        return Status(DB_ERROR, "Failed to append change feed " + path_ + ": " + strerror(errno));
+    }
+    size_ += written;
+    return Status::OK();
+}
+
+ChangeFeedReader::ChangeFeedReader(const std::string& path) : path_(path) {
+    Open(true);
+}
+
+ChangeFeedReader::~ChangeFeedReader() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+bool
+ChangeFeedReader::Open(bool from_end) {
+    fd_ = open(path_.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        return false;
+    }
+
+    struct stat st;
+    fstat(fd_, &st);
+    inode_ = st.st_ino;
+    if (from_end) {
+        lseek(fd_, LastLine(fd_, version_), SEEK_SET);
+    }
+    return true;
+}
+
+void
+ChangeFeedReader::ReadLines(FileChanges& changes, bool& reset) {
+    std::string chunk(READ_CHUNK_SIZE, '\0');
+    ssize_t n;
+    while ((n = read(fd_, &chunk[0], chunk.size())) > 0) {
+        pending_.append(chunk.data(), n);
+    }
+
+    size_t begin = 0;
+    for (auto end = pending_.find('\n'); end != std::string::npos; end = pending_.find('\n', begin)) {
+        FileChange change;
+        if (!ParseChange(pending_.substr(begin, end - begin), change)) {
+            ENGINE_LOG_WARNING << "Invalid line in change feed " << path_;
+            reset = true;
+        } else {
+            if (version_ != 0 && change.version_ != version_ + 1) {
+                ENGINE_LOG_WARNING << "Change feed " << path_ << " skipped from version " << version_ << " to "
+                                   << change.version_;
+                reset = true;
+            }
+            version_ = change.version_;
+            changes.emplace_back(change);
+        }
+        begin = end + 1;
+    }
+    pending_.erase(0, begin);
+}
+
+Status
+ChangeFeedReader::Tail(FileChanges& changes, bool& reset) {
+    changes.clear();
+    reset = false;
+
+    // a feed created after the reader started only holds changes the reader hasn't seen
+    if (fd_ < 0 && !Open(false)) {
+        return Status::OK();
+    }
+    ReadLines(changes, reset);
+
+    // the feed was rotated, the rest of the old one was read above
+    struct stat st;
+    if (stat(path_.c_str(), &st) == 0 && st.st_ino != inode_) {
+        close(fd_);
+        pending_.clear();
+        if (Open(false)) {
+            ReadLines(changes, reset);
+        }
+    }
+    return Status::OK();
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
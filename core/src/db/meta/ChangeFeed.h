@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "MetaTypes.h"
+#include "utils/Status.h"
+
+#include <sys/types.h>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+// The change feed is a log of table file state transitions, appended by the writable node of a cluster and tailed
+// by the readonly nodes sharing its storage, so that they needn't poll meta to see new files.
+// Every line is one change: "version table_id file_id id file_type file_size row_count date engine_type tier".
+// A change with file_id TABLE_CHANGE is about a whole table (or one date of it when date is set), the readers reload
+// the files of the table from meta; a TO_DELETE table change means the files are gone.
+
+static const char* CHANGE_FEED_FILE = "change_feed";
+static const char* TABLE_CHANGE = "*";
+
+struct FileChange {
+    uint64_t version_ = 0;
+    TableFileSchema file_;
+};
+
+using FileChanges = std::vector<FileChange>;
+
+class ChangeFeedWriter {
+ public:
+    explicit ChangeFeedWriter(const std::string& path);
+
+    ~ChangeFeedWriter();
+
+    // assign the next versions to the changes and append them to the feed
+    Status
+    Append(FileChanges& changes);
+
+ private:
+    Status
+    Open();
+
+ private:
+    std::string path_;
+    std::mutex mutex_;
+    int fd_ = -1;
+    int64_t size_ = 0;
+    uint64_t version_ = 0;
+};
+
+class ChangeFeedReader {
+ public:
+    // the reader starts at the end of the feed, the changes already in it are reflected by meta
+    explicit ChangeFeedReader(const std::string& path);
+
+    ~ChangeFeedReader();
+
+    // changes appended since the last call; reset is set when some changes were missed (the feed was rotated away
+    // or restarted by the writer), the state built from the feed must be rebuilt from meta
+    Status
+    Tail(FileChanges& changes, bool& reset);
+
+ private:
+    bool
+    Open(bool from_end);
+
+    void
+    ReadLines(FileChanges& changes, bool& reset);
+
+ private:
+    std::string path_;
+    int fd_ = -1;
+    ino_t inode_ = 0;
+    std::string pending_;
+    uint64_t version_ = 0;
+};
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,253 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "db/meta/ChangeFeedMeta.h"
+#include "utils/Log.h"
+
+#include <utility>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+ChangeFeedMeta::ChangeFeedMeta(const MetaPtr& meta, const std::string& feed_path) : meta_(meta), writer_(feed_path) {
+}
+
+void
+ChangeFeedMeta::PublishFiles(const TableFilesSchema& files) {
+    FileChanges changes;
+    for (auto& file : files) {
+        // new files are invisible to searches until they turn into raw or index files
+        if (file.file_type_ == TableFileSchema::NEW || file.file_type_ == TableFileSchema::NEW_MERGE ||
+            file.file_type_ == TableFileSchema::NEW_INDEX) {
+            continue;
+        }
+        FileChange change;
+        change.file_ = file;
+        changes.emplace_back(std::move(change));
+    }
+
+    // meta is already updated, a lost change is caught up by the readers when they see the version gap
+    auto status = writer_.Append(changes);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << status.message();
+    }
+}
+
+void
+ChangeFeedMeta::PublishTable(const std::string& table_id, int32_t file_type, DateT date) {
+    FileChanges changes(1);
+    auto& file = changes[0].file_;
+    file.table_id_ = table_id;
+    file.file_id_ = TABLE_CHANGE;
+    file.file_type_ = file_type;
+    file.date_ = date;
+
+    auto status = writer_.Append(changes);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << status.message();
+    }
+}
+
+Status
+ChangeFeedMeta::CreateTable(TableSchema& table_schema) {
+    return meta_->CreateTable(table_schema);
+}
+
+Status
+ChangeFeedMeta::DescribeTable(TableSchema& table_schema) {
+    return meta_->DescribeTable(table_schema);
+}
+
+Status
+ChangeFeedMeta::HasTable(const std::string& table_id, bool& has_or_not) {
+    return meta_->HasTable(table_id, has_or_not);
+}
+
+Status
+ChangeFeedMeta::AllTables(std::vector<TableSchema>& table_schema_array) {
+    return meta_->AllTables(table_schema_array);
+}
+
+Status
+ChangeFeedMeta::UpdateTableIndex(const std::string& table_id, const TableIndex& index) {
+    auto status = meta_->UpdateTableIndex(table_id, index);
+    if (status.ok()) {
+        PublishTable(table_id, TableFileSchema::NEW);
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::UpdateTableFlag(const std::string& table_id, int64_t flag) {
+    return meta_->UpdateTableFlag(table_id, flag);
+}
+
+Status
+ChangeFeedMeta::DeleteTable(const std::string& table_id) {
+    auto status = meta_->DeleteTable(table_id);
+    if (status.ok()) {
+        PublishTable(table_id, TableFileSchema::TO_DELETE);
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::DeleteTableFiles(const std::string& table_id) {
+    auto status = meta_->DeleteTableFiles(table_id);
+    if (status.ok()) {
+        PublishTable(table_id, TableFileSchema::TO_DELETE);
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::CreateTableFile(TableFileSchema& file_schema) {
+    return meta_->CreateTableFile(file_schema);
+}
+
+Status
+ChangeFeedMeta::DropPartitionsByDates(const std::string& table_id, const DatesT& dates) {
+    auto status = meta_->DropPartitionsByDates(table_id, dates);
+    if (status.ok()) {
+        for (auto date : dates) {
+            PublishTable(table_id, TableFileSchema::TO_DELETE, date);
+        }
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids,
+                              TableFilesSchema& table_files) {
+    return meta_->GetTableFiles(table_id, ids, table_files);
+}
+
+Status
+ChangeFeedMeta::UpdateTableFilesToIndex(const std::string& table_id) {
+    auto status = meta_->UpdateTableFilesToIndex(table_id);
+    if (status.ok()) {
+        PublishTable(table_id, TableFileSchema::TO_INDEX);
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::UpdateTableFile(TableFileSchema& file_schema) {
+    auto status = meta_->UpdateTableFile(file_schema);
+    if (status.ok()) {
+        PublishFiles({file_schema});
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::UpdateTableFiles(TableFilesSchema& files) {
+    auto status = meta_->UpdateTableFiles(files);
+    if (status.ok()) {
+        PublishFiles(files);
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, const DatesT& dates,
+                              const PartitionTags& partition_tags, DatePartionedTableFilesSchema& files) {
+    return meta_->FilesToSearch(table_id, ids, dates, partition_tags, files);
+}
+
+Status
+ChangeFeedMeta::FilesToMerge(const std::string& table_id, DatePartionedTableFilesSchema& files) {
+    return meta_->FilesToMerge(table_id, files);
+}
+
+Status
+ChangeFeedMeta::Size(uint64_t& result) {
+    return meta_->Size(result);
+}
+
+Status
+ChangeFeedMeta::Archive(TableFilesSchema& archived) {
+    auto status = meta_->Archive(archived);
+    // files archived before a failure are already TO_DELETE in meta
+    PublishFiles(archived);
+    return status;
+}
+
+Status
+ChangeFeedMeta::FilesToIndex(TableFilesSchema& files) {
+    return meta_->FilesToIndex(files);
+}
+
+Status
+ChangeFeedMeta::FilesToDemote(int64_t created_before, TableFilesSchema& files) {
+    return meta_->FilesToDemote(created_before, files);
+}
+
+Status
+ChangeFeedMeta::UpdateTableFileTier(TableFileSchema& file_schema) {
+    auto status = meta_->UpdateTableFileTier(file_schema);
+    if (status.ok()) {
+        PublishFiles({file_schema});
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                            std::vector<std::string>& file_ids) {
+    return meta_->FilesByType(table_id, file_types, file_ids);
+}
+
+Status
+ChangeFeedMeta::DescribeTableIndex(const std::string& table_id, TableIndex& index) {
+    return meta_->DescribeTableIndex(table_id, index);
+}
+
+Status
+ChangeFeedMeta::DropTableIndex(const std::string& table_id) {
+    auto status = meta_->DropTableIndex(table_id);
+    if (status.ok()) {
+        PublishTable(table_id, TableFileSchema::NEW);
+    }
+    return status;
+}
+
+Status
+ChangeFeedMeta::CleanUp() {
+    return meta_->CleanUp();
+}
+
+Status
+ChangeFeedMeta::CleanUpFilesWithTTL(uint16_t seconds) {
+    // only removes TO_DELETE files, every file turning TO_DELETE was published by the call that changed it
+    return meta_->CleanUpFilesWithTTL(seconds);
+}
+
+Status
+ChangeFeedMeta::DropAll() {
+    return meta_->DropAll();
+}
+
+Status
+ChangeFeedMeta::Count(const std::string& table_id, uint64_t& result) {
+    return meta_->Count(table_id, result);
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
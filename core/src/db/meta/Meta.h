@@ -80,9 +80,10 @@ class Meta {
     virtual Status
     UpdateTableFiles(TableFilesSchema& files) = 0;
 
+    // an empty dates or partition_tags matches all the files
     virtual Status
     FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, const DatesT& dates,
-                  DatePartionedTableFilesSchema& files) = 0;
+                  const PartitionTags& partition_tags, DatePartionedTableFilesSchema& files) = 0;
 
     virtual Status
     FilesToMerge(const std::string& table_id, DatePartionedTableFilesSchema& files) = 0;
@@ -90,12 +91,19 @@ class Meta {
     virtual Status
     Size(uint64_t& result) = 0;
 
+    // archived returns the files turned to TO_DELETE
     virtual Status
-    Archive() = 0;
+    Archive(TableFilesSchema& archived) = 0;
 
     virtual Status
     FilesToIndex(TableFilesSchema&) = 0;
 
+    virtual Status
+    FilesToDemote(int64_t created_before, TableFilesSchema& files) = 0;
+
+    virtual Status
+    UpdateTableFileTier(TableFileSchema& file_schema) = 0;
+
     virtual Status
     FilesByType(const std::string& table_id, const std::vector<int>& file_types,
                 std::vector<std::string>& file_ids) = 0;
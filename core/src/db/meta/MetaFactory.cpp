@@ -16,6 +16,7 @@
 // under the License.
 
 #include "db/meta/MetaFactory.h"
+#include "ChangeFeedMeta.h"
 #include "MySQLMetaImpl.h"
 #include "SqliteMetaImpl.h"
 #include "db/Utils.h"
@@ -60,16 +61,23 @@ MetaFactory::Build(const DBMetaOptions& metaOptions, const int& mode) {
         throw InvalidArgumentException("Wrong URI format ");
     }
 
+    meta::MetaPtr meta;
     if (strcasecmp(uri_info.dialect_.c_str(), "mysql") == 0) {
         ENGINE_LOG_INFO << "Using MySQL";
-        return std::make_shared<meta::MySQLMetaImpl>(metaOptions, mode);
+        meta = std::make_shared<meta::MySQLMetaImpl>(metaOptions, mode);
     } else if (strcasecmp(uri_info.dialect_.c_str(), "sqlite") == 0) {
         ENGINE_LOG_INFO << "Using SQLite";
-        return std::make_shared<meta::SqliteMetaImpl>(metaOptions);
+        meta = std::make_shared<meta::SqliteMetaImpl>(metaOptions);
     } else {
         ENGINE_LOG_ERROR << "Invalid dialect in URI: dialect = " << uri_info.dialect_;
         throw InvalidArgumentException("URI dialect is not mysql / sqlite");
     }
+
+    // the readonly nodes sharing the storage follow the file changes of the writable node through the feed
+    if (mode == DBOptions::MODE::CLUSTER_WRITABLE) {
+        meta = std::make_shared<meta::ChangeFeedMeta>(meta, metaOptions.path_ + "/" + meta::CHANGE_FEED_FILE);
+    }
+    return meta;
 }
 
 }  // namespace engine
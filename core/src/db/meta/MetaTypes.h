@@ -40,6 +40,8 @@ constexpr int64_t FLAG_MASK_HAS_USERID = 0x1 << 1;
 using DateT = int;
 const DateT EmptyDate = -1;
 using DatesT = std::vector<DateT>;
+// user defined partitions of a table, the vectors inserted without a tag are in the "" one
+using PartitionTags = std::vector<std::string>;
 
 struct TableSchema {
     typedef enum {
@@ -57,6 +59,7 @@ struct TableSchema {
     int32_t engine_type_ = DEFAULT_ENGINE_TYPE;
     int32_t nlist_ = DEFAULT_NLIST;
     int32_t metric_type_ = DEFAULT_METRIC_TYPE;
+    std::string attributes_;  // scalar attribute columns, "name:type,..."
 };  // TableSchema
 
 struct TableFileSchema {
@@ -71,6 +74,11 @@ struct TableFileSchema {
         BACKUP,
     } FILE_TYPE;
 
+    typedef enum {
+        LOCAL,
+        REMOTE,
+    } FILE_TIER;
+
     size_t id_ = 0;
     std::string table_id_;
     std::string file_id_;
@@ -78,10 +86,12 @@ struct TableFileSchema {
     size_t file_size_ = 0;
     size_t row_count_ = 0;
     DateT date_ = EmptyDate;
+    std::string partition_tag_;
     uint16_t dimension_ = 0;
     std::string location_;
     int64_t updated_time_ = 0;
     int64_t created_on_ = 0;
+    int32_t tier_ = LOCAL;
     int64_t index_file_size_ = DEFAULT_INDEX_FILE_SIZE;  // not persist to meta
     int32_t engine_type_ = DEFAULT_ENGINE_TYPE;
     int32_t nlist_ = DEFAULT_NLIST;              // not persist to meta
@@ -72,6 +72,12 @@ class MetaField {
         return name_ + " " + type_ + " " + setting_;
     }
 
+    // a field with default value can be added to an existing table
+    bool
+    HasDefault() const {
+        return setting_.find("DEFAULT") != std::string::npos;
+    }
+
     // mysql field type has additional information. for instance, a filed type is defined as 'BIGINT'
     // we get the type from sql is 'bigint(20)', so we need to ignore the '(20)'
     bool
@@ -128,6 +134,26 @@ class MetaSchema {
         return found_field.size() == fields_.size();
     }
 
+    // return this MetaSchema fields which are not contained in the outer fields
+    MetaFields
+    MissingFields(const MetaFields& fields) const {
+        MetaFields missing;
+        for (const auto& this_field : fields_) {
+            bool found = false;
+            for (const auto& outer_field : fields) {
+                if (this_field.IsEqual(outer_field)) {
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                missing.push_back(this_field);
+            }
+        }
+
+        return missing;
+    }
+
  private:
     std::string name_;
     MetaFields fields_;
@@ -145,6 +171,7 @@ static const MetaSchema TABLES_SCHEMA(META_TABLES, {
                                                        MetaField("engine_type", "INT", "DEFAULT 1 NOT NULL"),
                                                        MetaField("nlist", "INT", "DEFAULT 16384 NOT NULL"),
                                                        MetaField("metric_type", "INT", "DEFAULT 1 NOT NULL"),
+                                                       MetaField("attributes", "VARCHAR(4096)", "DEFAULT '' NOT NULL"),
                                                    });
 
 // TableFiles schema
@@ -159,6 +186,9 @@ static const MetaSchema TABLEFILES_SCHEMA(META_TABLEFILES, {
                                                                MetaField("updated_time", "BIGINT", "NOT NULL"),
                                                                MetaField("created_on", "BIGINT", "NOT NULL"),
                                                                MetaField("date", "INT", "DEFAULT -1 NOT NULL"),
+                                                               MetaField("tier", "INT", "DEFAULT 0 NOT NULL"),
+                                                               MetaField("partition_tag", "VARCHAR(255)",
+                                                                         "DEFAULT '' NOT NULL"),
                                                            });
 
 }  // namespace
@@ -226,7 +256,30 @@ MySQLMetaImpl::ValidateMetaSchema() {
             return true;
         }
 
-        return schema.IsEqual(exist_fields);
+        if (schema.IsEqual(exist_fields)) {
+            return true;
+        }
+
+        // fields added by newer version with default value, add them to the existing table
+        MetaFields missing_fields = schema.MissingFields(exist_fields);
+        for (auto& field : missing_fields) {
+            if (!field.HasDefault()) {
+                return false;
+            }
+        }
+
+        for (auto& field : missing_fields) {
+            mysqlpp::Query alter_statement = connectionPtr->query();
+            alter_statement << "ALTER TABLE " << schema.name() << " ADD COLUMN " << field.ToString() << ";";
+
+            ENGINE_LOG_DEBUG << "MySQLMetaImpl::ValidateMetaSchema: " << alter_statement.str();
+
+            if (!alter_statement.exec()) {
+                ENGINE_LOG_ERROR << "Failed to add field " << field.name() << ": " << alter_statement.error();
+                return false;
+            }
+        }
+        return true;
     };
 
     // verify Tables
@@ -426,11 +479,13 @@ MySQLMetaImpl::CreateTable(TableSchema& table_schema) {
             std::string engine_type = std::to_string(table_schema.engine_type_);
             std::string nlist = std::to_string(table_schema.nlist_);
             std::string metric_type = std::to_string(table_schema.metric_type_);
+            std::string attributes = table_schema.attributes_;
 
             createTableQuery << "INSERT INTO " << META_TABLES << " "
                              << "VALUES(" << id << ", " << mysqlpp::quote << table_id << ", " << state << ", "
                              << dimension << ", " << created_on << ", " << flag << ", " << index_file_size << ", "
-                             << engine_type << ", " << nlist << ", " << metric_type << ");";
+                             << engine_type << ", " << nlist << ", " << metric_type << ", " << mysqlpp::quote
+                             << attributes << ");";
 
             ENGINE_LOG_DEBUG << "MySQLMetaImpl::CreateTable: " << createTableQuery.str();
 
@@ -812,8 +867,8 @@ MySQLMetaImpl::DescribeTable(TableSchema& table_schema) {
 
             mysqlpp::Query describeTableQuery = connectionPtr->query();
             describeTableQuery
-                << "SELECT id, state, dimension, created_on, flag, index_file_size, engine_type, nlist, metric_type "
-                << " FROM " << META_TABLES << " "
+                << "SELECT id, state, dimension, created_on, flag, index_file_size, engine_type, nlist, metric_type, "
+                << "attributes FROM " << META_TABLES << " "
                 << "WHERE table_id = " << mysqlpp::quote << table_schema.table_id_ << " "
                 << "AND state <> " << std::to_string(TableSchema::TO_DELETE) << ";";
 
@@ -842,6 +897,8 @@ MySQLMetaImpl::DescribeTable(TableSchema& table_schema) {
             table_schema.nlist_ = resRow["nlist"];
 
             table_schema.metric_type_ = resRow["metric_type"];
+
+            resRow["attributes"].to_string(table_schema.attributes_);
         } else {
             return Status(DB_NOT_FOUND, "Table " + table_schema.table_id_ + " not found");
         }
@@ -900,8 +957,8 @@ MySQLMetaImpl::AllTables(std::vector<TableSchema>& table_schema_array) {
             }
 
             mysqlpp::Query allTablesQuery = connectionPtr->query();
-            allTablesQuery << "SELECT id, table_id, dimension, engine_type, nlist, index_file_size, metric_type FROM "
-                           << META_TABLES << " "
+            allTablesQuery << "SELECT id, table_id, dimension, engine_type, nlist, index_file_size, metric_type, "
+                           << "attributes FROM " << META_TABLES << " "
                            << "WHERE state <> " << std::to_string(TableSchema::TO_DELETE) << ";";
 
             ENGINE_LOG_DEBUG << "MySQLMetaImpl::AllTables: " << allTablesQuery.str();
@@ -928,6 +985,8 @@ MySQLMetaImpl::AllTables(std::vector<TableSchema>& table_schema_array) {
 
             table_schema.metric_type_ = resRow["metric_type"];
 
+            resRow["attributes"].to_string(table_schema.attributes_);
+
             table_schema_array.emplace_back(table_schema);
         }
     } catch (std::exception& e) {
@@ -973,6 +1032,7 @@ MySQLMetaImpl::CreateTableFile(TableFileSchema& file_schema) {
         std::string updated_time = std::to_string(file_schema.updated_time_);
         std::string created_on = std::to_string(file_schema.created_on_);
         std::string date = std::to_string(file_schema.date_);
+        std::string partition_tag = file_schema.partition_tag_;
 
         {
             mysqlpp::ScopedConnection connectionPtr(*mysql_connection_pool_, safe_grab_);
@@ -983,10 +1043,14 @@ MySQLMetaImpl::CreateTableFile(TableFileSchema& file_schema) {
 
             mysqlpp::Query createTableFileQuery = connectionPtr->query();
 
+            // the columns are named, the ones added by newer versions keep their defaults
             createTableFileQuery << "INSERT INTO " << META_TABLEFILES << " "
+                                 << "(id, table_id, engine_type, file_id, file_type, file_size, row_count, "
+                                 << "updated_time, created_on, date, partition_tag) "
                                  << "VALUES(" << id << ", " << mysqlpp::quote << table_id << ", " << engine_type << ", "
                                  << mysqlpp::quote << file_id << ", " << file_type << ", " << file_size << ", "
-                                 << row_count << ", " << updated_time << ", " << created_on << ", " << date << ");";
+                                 << row_count << ", " << updated_time << ", " << created_on << ", " << date << ", "
+                                 << mysqlpp::quote << partition_tag << ");";
 
             ENGINE_LOG_DEBUG << "MySQLMetaImpl::CreateTableFile: " << createTableFileQuery.str();
 
@@ -1022,8 +1086,8 @@ MySQLMetaImpl::FilesToIndex(TableFilesSchema& files) {
 
             mysqlpp::Query filesToIndexQuery = connectionPtr->query();
             filesToIndexQuery
-                << "SELECT id, table_id, engine_type, file_id, file_type, file_size, row_count, date, created_on FROM "
-                << META_TABLEFILES << " "
+                << "SELECT id, table_id, engine_type, file_id, file_type, file_size, row_count, date, created_on, "
+                << "partition_tag FROM " << META_TABLEFILES << " "
                 << "WHERE file_type = " << std::to_string(TableFileSchema::TO_INDEX) << ";";
 
             ENGINE_LOG_DEBUG << "MySQLMetaImpl::FilesToIndex: " << filesToIndexQuery.str();
@@ -1057,6 +1121,8 @@ MySQLMetaImpl::FilesToIndex(TableFilesSchema& files) {
 
             table_file.created_on_ = resRow["created_on"];
 
+            resRow["partition_tag"].to_string(table_file.partition_tag_);
+
             auto groupItr = groups.find(table_file.table_id_);
             if (groupItr == groups.end()) {
                 TableSchema table_schema;
@@ -1089,9 +1155,84 @@ MySQLMetaImpl::FilesToIndex(TableFilesSchema& files) {
     }
 }
 
+Status
+MySQLMetaImpl::FilesToDemote(int64_t created_before, TableFilesSchema& files) {
+    files.clear();
+
+    try {
+        server::MetricCollector metric;
+        mysqlpp::StoreQueryResult res;
+        {
+            mysqlpp::ScopedConnection connectionPtr(*mysql_connection_pool_, safe_grab_);
+
+            if (connectionPtr == nullptr) {
+                return Status(DB_ERROR, "Failed to connect to database server");
+            }
+
+            mysqlpp::Query filesToDemoteQuery = connectionPtr->query();
+            filesToDemoteQuery
+                << "SELECT id, table_id, engine_type, file_id, file_size, row_count, date, created_on, partition_tag "
+                << "FROM " << META_TABLEFILES << " "
+                << "WHERE file_type = " << std::to_string(TableFileSchema::INDEX) << " AND "
+                << "tier = " << std::to_string(TableFileSchema::LOCAL) << " AND "
+                << "created_on < " << std::to_string(created_before) << " "
+                << "ORDER BY created_on;";
+
+            ENGINE_LOG_DEBUG << "MySQLMetaImpl::FilesToDemote: " << filesToDemoteQuery.str();
+
+            res = filesToDemoteQuery.store();
+        }  // Scoped Connection
+
+        Status ret;
+        TableFileSchema table_file;
+        for (auto& resRow : res) {
+            table_file.id_ = resRow["id"];  // implicit conversion
+
+            std::string table_id;
+            resRow["table_id"].to_string(table_id);
+            table_file.table_id_ = table_id;
+
+            table_file.engine_type_ = resRow["engine_type"];
+
+            std::string file_id;
+            resRow["file_id"].to_string(file_id);
+            table_file.file_id_ = file_id;
+
+            table_file.file_type_ = TableFileSchema::INDEX;
+
+            table_file.file_size_ = resRow["file_size"];
+
+            table_file.row_count_ = resRow["row_count"];
+
+            table_file.date_ = resRow["date"];
+
+            table_file.created_on_ = resRow["created_on"];
+
+            resRow["partition_tag"].to_string(table_file.partition_tag_);
+
+            table_file.tier_ = TableFileSchema::LOCAL;
+
+            auto status = utils::GetTableFilePath(options_, table_file);
+            if (!status.ok()) {
+                ret = status;
+                continue;
+            }
+
+            files.push_back(table_file);
+        }
+
+        if (res.size() > 0) {
+            ENGINE_LOG_DEBUG << "Collect " << res.size() << " to-demote files";
+        }
+        return ret;
+    } catch (std::exception& e) {
+        return HandleException("GENERAL ERROR WHEN FINDING TABLE FILES TO DEMOTE", e.what());
+    }
+}
+
 Status
 MySQLMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, const DatesT& dates,
-                             DatePartionedTableFilesSchema& files) {
+                             const PartitionTags& partition_tags, DatePartionedTableFilesSchema& files) {
     files.clear();
 
     try {
@@ -1106,8 +1247,8 @@ MySQLMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size
 
             mysqlpp::Query filesToSearchQuery = connectionPtr->query();
             filesToSearchQuery
-                << "SELECT id, table_id, engine_type, file_id, file_type, file_size, row_count, date FROM "
-                << META_TABLEFILES << " "
+                << "SELECT id, table_id, engine_type, file_id, file_type, file_size, row_count, date, tier, "
+                << "partition_tag FROM " << META_TABLEFILES << " "
                 << "WHERE table_id = " << mysqlpp::quote << table_id;
 
             if (!dates.empty()) {
@@ -1133,6 +1274,14 @@ MySQLMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size
                 filesToSearchQuery << " AND "
                                    << "(" << idStr << ")";
             }
+
+            if (!partition_tags.empty()) {
+                filesToSearchQuery << " AND partition_tag IN (";
+                for (size_t i = 0; i < partition_tags.size(); ++i) {
+                    filesToSearchQuery << (i == 0 ? "" : ", ") << mysqlpp::quote << partition_tags[i];
+                }
+                filesToSearchQuery << ")";
+            }
             // End
             filesToSearchQuery << " AND "
                                << "(file_type = " << std::to_string(TableFileSchema::RAW) << " OR "
@@ -1180,6 +1329,10 @@ MySQLMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size
 
             table_file.date_ = resRow["date"];
 
+            table_file.tier_ = resRow["tier"];
+
+            resRow["partition_tag"].to_string(table_file.partition_tag_);
+
             table_file.dimension_ = table_schema.dimension_;
 
             auto status = utils::GetTableFilePath(options_, table_file);
@@ -1229,8 +1382,8 @@ MySQLMetaImpl::FilesToMerge(const std::string& table_id, DatePartionedTableFiles
 
             mysqlpp::Query filesToMergeQuery = connectionPtr->query();
             filesToMergeQuery
-                << "SELECT id, table_id, file_id, file_type, file_size, row_count, date, engine_type, created_on FROM "
-                << META_TABLEFILES << " "
+                << "SELECT id, table_id, file_id, file_type, file_size, row_count, date, engine_type, created_on, "
+                << "partition_tag FROM " << META_TABLEFILES << " "
                 << "WHERE table_id = " << mysqlpp::quote << table_id << " AND "
                 << "file_type = " << std::to_string(TableFileSchema::RAW) << " "
                 << "ORDER BY row_count DESC"
@@ -1275,6 +1428,8 @@ MySQLMetaImpl::FilesToMerge(const std::string& table_id, DatePartionedTableFiles
 
             table_file.created_on_ = resRow["created_on"];
 
+            resRow["partition_tag"].to_string(table_file.partition_tag_);
+
             table_file.dimension_ = table_schema.dimension_;
 
             auto status = utils::GetTableFilePath(options_, table_file);
@@ -1324,8 +1479,8 @@ MySQLMetaImpl::GetTableFiles(const std::string& table_id, const std::vector<size
 
             mysqlpp::Query getTableFileQuery = connectionPtr->query();
             getTableFileQuery
-                << "SELECT id, engine_type, file_id, file_type, file_size, row_count, date, created_on FROM "
-                << META_TABLEFILES << " "
+                << "SELECT id, engine_type, file_id, file_type, file_size, row_count, date, created_on, tier, "
+                << "partition_tag FROM " << META_TABLEFILES << " "
                 << "WHERE table_id = " << mysqlpp::quote << table_id << " AND "
                 << "(" << idStr << ") AND "
                 << "file_type <> " << std::to_string(TableFileSchema::TO_DELETE) << ";";
@@ -1369,6 +1524,10 @@ MySQLMetaImpl::GetTableFiles(const std::string& table_id, const std::vector<size
 
             file_schema.created_on_ = resRow["created_on"];
 
+            file_schema.tier_ = resRow["tier"];
+
+            resRow["partition_tag"].to_string(file_schema.partition_tag_);
+
             file_schema.dimension_ = table_schema.dimension_;
 
             utils::GetTableFilePath(options_, file_schema);
@@ -1383,9 +1542,9 @@ MySQLMetaImpl::GetTableFiles(const std::string& table_id, const std::vector<size
     }
 }
 
-// TODO(myh): Support swap to cloud storage
 Status
-MySQLMetaImpl::Archive() {
+MySQLMetaImpl::Archive(TableFilesSchema& archived) {
+    archived.clear();
     auto& criterias = options_.archive_conf_.GetCriterias();
     if (criterias.empty()) {
         return Status::OK();
@@ -1406,15 +1565,40 @@ MySQLMetaImpl::Archive() {
                 }
 
                 mysqlpp::Query archiveQuery = connectionPtr->query();
-                archiveQuery << "UPDATE " << META_TABLEFILES << " "
-                             << "SET file_type = " << std::to_string(TableFileSchema::TO_DELETE) << " "
+                archiveQuery << "SELECT id, table_id, file_id, date FROM " << META_TABLEFILES << " "
                              << "WHERE created_on < " << std::to_string(now - usecs) << " AND "
                              << "file_type <> " << std::to_string(TableFileSchema::TO_DELETE) << ";";
 
                 ENGINE_LOG_DEBUG << "MySQLMetaImpl::Archive: " << archiveQuery.str();
 
-                if (!archiveQuery.exec()) {
-                    return HandleException("QUERY ERROR DURING ARCHIVE", archiveQuery.error());
+                mysqlpp::StoreQueryResult res = archiveQuery.store();
+                if (res.num_rows() > 0) {
+                    TableFilesSchema files;
+                    TableFileSchema table_file;
+                    table_file.file_type_ = TableFileSchema::TO_DELETE;
+                    std::stringstream idsToArchiveSS;
+                    for (auto& resRow : res) {
+                        table_file.id_ = resRow["id"];
+                        resRow["table_id"].to_string(table_file.table_id_);
+                        resRow["file_id"].to_string(table_file.file_id_);
+                        table_file.date_ = resRow["date"];
+                        idsToArchiveSS << std::to_string(table_file.id_) << ", ";
+                        files.push_back(table_file);
+                    }
+
+                    std::string idsToArchiveStr = idsToArchiveSS.str();
+                    idsToArchiveStr = idsToArchiveStr.substr(0, idsToArchiveStr.size() - 2);  // remove the last ", "
+
+                    archiveQuery << "UPDATE " << META_TABLEFILES << " "
+                                 << "SET file_type = " << std::to_string(TableFileSchema::TO_DELETE) << " "
+                                 << "WHERE id IN (" << idsToArchiveStr << ");";
+
+                    ENGINE_LOG_DEBUG << "MySQLMetaImpl::Archive: " << archiveQuery.str();
+
+                    if (!archiveQuery.exec()) {
+                        return HandleException("QUERY ERROR DURING ARCHIVE", archiveQuery.error());
+                    }
+                    archived.insert(archived.end(), files.begin(), files.end());
                 }
 
                 ENGINE_LOG_DEBUG << "Archive old files";
@@ -1427,7 +1611,7 @@ MySQLMetaImpl::Archive() {
             Size(sum);
 
             auto to_delete = (sum - limit * G);
-            DiscardFiles(to_delete);
+            DiscardFiles(to_delete, archived);
 
             ENGINE_LOG_DEBUG << "Archive files to free disk";
         }
@@ -1471,7 +1655,7 @@ MySQLMetaImpl::Size(uint64_t& result) {
 }
 
 Status
-MySQLMetaImpl::DiscardFiles(int64_t to_discard_size) {
+MySQLMetaImpl::DiscardFiles(int64_t to_discard_size, TableFilesSchema& discarded) {
     if (to_discard_size <= 0) {
         return Status::OK();
     }
@@ -1488,7 +1672,7 @@ MySQLMetaImpl::DiscardFiles(int64_t to_discard_size) {
             }
 
             mysqlpp::Query discardFilesQuery = connectionPtr->query();
-            discardFilesQuery << "SELECT id, file_size FROM " << META_TABLEFILES << " "
+            discardFilesQuery << "SELECT id, file_size, table_id, file_id, date FROM " << META_TABLEFILES << " "
                               << "WHERE file_type <> " << std::to_string(TableFileSchema::TO_DELETE) << " "
                               << "ORDER BY id ASC "
                               << "LIMIT 10;";
@@ -1500,7 +1684,9 @@ MySQLMetaImpl::DiscardFiles(int64_t to_discard_size) {
                 return Status::OK();
             }
 
+            TableFilesSchema files;
             TableFileSchema table_file;
+            table_file.file_type_ = TableFileSchema::TO_DELETE;
             std::stringstream idsToDiscardSS;
             for (auto& resRow : res) {
                 if (to_discard_size <= 0) {
@@ -1508,6 +1694,10 @@ MySQLMetaImpl::DiscardFiles(int64_t to_discard_size) {
                 }
                 table_file.id_ = resRow["id"];
                 table_file.file_size_ = resRow["file_size"];
+                resRow["table_id"].to_string(table_file.table_id_);
+                resRow["file_id"].to_string(table_file.file_id_);
+                table_file.date_ = resRow["date"];
+                files.push_back(table_file);
                 idsToDiscardSS << "id = " << std::to_string(table_file.id_) << " OR ";
                 ENGINE_LOG_DEBUG << "Discard table_file.id=" << table_file.file_id_
                                  << " table_file.size=" << table_file.file_size_;
@@ -1528,9 +1718,10 @@ MySQLMetaImpl::DiscardFiles(int64_t to_discard_size) {
             if (!status) {
                 return HandleException("QUERY ERROR WHEN DISCARDING FILES", discardFilesQuery.error());
             }
+            discarded.insert(discarded.end(), files.begin(), files.end());
         }  // Scoped Connection
 
-        return DiscardFiles(to_discard_size);
+        return DiscardFiles(to_discard_size, discarded);
     } catch (std::exception& e) {
         return HandleException("GENERAL ERROR WHEN DISCARDING FILES", e.what());
     }
@@ -1609,6 +1800,42 @@ MySQLMetaImpl::UpdateTableFile(TableFileSchema& file_schema) {
     return Status::OK();
 }
 
+Status
+MySQLMetaImpl::UpdateTableFileTier(TableFileSchema& file_schema) {
+    file_schema.updated_time_ = utils::GetMicroSecTimeStamp();
+
+    try {
+        server::MetricCollector metric;
+        {
+            mysqlpp::ScopedConnection connectionPtr(*mysql_connection_pool_, safe_grab_);
+
+            if (connectionPtr == nullptr) {
+                return Status(DB_ERROR, "Failed to connect to database server");
+            }
+
+            // only touch the tier column, the file may be marked as TO_DELETE meanwhile
+            mysqlpp::Query updateTableFileTierQuery = connectionPtr->query();
+            updateTableFileTierQuery << "UPDATE " << META_TABLEFILES << " "
+                                     << "SET tier = " << std::to_string(file_schema.tier_) << ", "
+                                     << "updated_time = " << std::to_string(file_schema.updated_time_) << " "
+                                     << "WHERE id = " << std::to_string(file_schema.id_) << ";";
+
+            ENGINE_LOG_DEBUG << "MySQLMetaImpl::UpdateTableFileTier: " << updateTableFileTierQuery.str();
+
+            if (!updateTableFileTierQuery.exec()) {
+                return HandleException("QUERY ERROR WHEN UPDATING TABLE FILE TIER", updateTableFileTierQuery.error());
+            }
+        }  // Scoped Connection
+
+        ENGINE_LOG_DEBUG << "Update table file tier, file id = " << file_schema.file_id_
+                         << " tier = " << file_schema.tier_;
+    } catch (std::exception& e) {
+        return HandleException("GENERAL ERROR WHEN UPDATING TABLE FILE TIER", e.what());
+    }
+
+    return Status::OK();
+}
+
 Status
 MySQLMetaImpl::UpdateTableFilesToIndex(const std::string& table_id) {
     try {
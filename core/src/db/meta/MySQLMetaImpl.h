@@ -90,7 +90,7 @@ class MySQLMetaImpl : public Meta {
 
     Status
     FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, const DatesT& dates,
-                  DatePartionedTableFilesSchema& files) override;
+                  const PartitionTags& partition_tags, DatePartionedTableFilesSchema& files) override;
 
     Status
     FilesToMerge(const std::string& table_id, DatePartionedTableFilesSchema& files) override;
@@ -99,7 +99,13 @@ class MySQLMetaImpl : public Meta {
     FilesToIndex(TableFilesSchema&) override;
 
     Status
-    Archive() override;
+    FilesToDemote(int64_t created_before, TableFilesSchema& files) override;
+
+    Status
+    UpdateTableFileTier(TableFileSchema& file_schema) override;
+
+    Status
+    Archive(TableFilesSchema& archived) override;
 
     Status
     Size(uint64_t& result) override;
@@ -122,7 +128,7 @@ class MySQLMetaImpl : public Meta {
     Status
     NextTableId(std::string& table_id);
     Status
-    DiscardFiles(int64_t to_discard_size);
+    DiscardFiles(int64_t to_discard_size, TableFilesSchema& discarded);
 
     void
     ValidateMetaSchema();
@@ -70,7 +70,8 @@ StoragePrototype(const std::string &path) {
                                    make_column("index_file_size", &TableSchema::index_file_size_),
                                    make_column("engine_type", &TableSchema::engine_type_),
                                    make_column("nlist", &TableSchema::nlist_),
-                                   make_column("metric_type", &TableSchema::metric_type_)),
+                                   make_column("metric_type", &TableSchema::metric_type_),
+                                   make_column("attributes", &TableSchema::attributes_, default_value(""))),
                         make_table(META_TABLEFILES,
                                    make_column("id", &TableFileSchema::id_, primary_key()),
                                    make_column("table_id", &TableFileSchema::table_id_),
@@ -81,7 +82,9 @@ StoragePrototype(const std::string &path) {
                                    make_column("row_count", &TableFileSchema::row_count_, default_value(0)),
                                    make_column("updated_time", &TableFileSchema::updated_time_),
                                    make_column("created_on", &TableFileSchema::created_on_),
-                                   make_column("date", &TableFileSchema::date_)));
+                                   make_column("date", &TableFileSchema::date_),
+                                   make_column("tier", &TableFileSchema::tier_, default_value(0)),
+                                   make_column("partition_tag", &TableFileSchema::partition_tag_, default_value(""))));
 }
 
 using ConnectorT = decltype(StoragePrototype(""));
@@ -314,7 +317,8 @@ SqliteMetaImpl::DescribeTable(TableSchema &table_schema) {
                                                    &TableSchema::index_file_size_,
                                                    &TableSchema::engine_type_,
                                                    &TableSchema::nlist_,
-                                                   &TableSchema::metric_type_),
+                                                   &TableSchema::metric_type_,
+                                                   &TableSchema::attributes_),
                                            where(c(&TableSchema::table_id_) == table_schema.table_id_
                                                      and c(&TableSchema::state_) != (int) TableSchema::TO_DELETE));
 
@@ -328,6 +332,7 @@ SqliteMetaImpl::DescribeTable(TableSchema &table_schema) {
             table_schema.engine_type_ = std::get<6>(groups[0]);
             table_schema.nlist_ = std::get<7>(groups[0]);
             table_schema.metric_type_ = std::get<8>(groups[0]);
+            table_schema.attributes_ = std::get<9>(groups[0]);
         } else {
             return Status(DB_NOT_FOUND, "Table " + table_schema.table_id_ + " not found");
         }
@@ -401,7 +406,8 @@ SqliteMetaImpl::UpdateTableIndex(const std::string &table_id, const TableIndex &
                                                    &TableSchema::dimension_,
                                                    &TableSchema::created_on_,
                                                    &TableSchema::flag_,
-                                                   &TableSchema::index_file_size_),
+                                                   &TableSchema::index_file_size_,
+                                                   &TableSchema::attributes_),
                                            where(c(&TableSchema::table_id_) == table_id
                                                      and c(&TableSchema::state_) != (int) TableSchema::TO_DELETE));
 
@@ -414,6 +420,7 @@ SqliteMetaImpl::UpdateTableIndex(const std::string &table_id, const TableIndex &
             table_schema.created_on_ = std::get<3>(tables[0]);
             table_schema.flag_ = std::get<4>(tables[0]);
             table_schema.index_file_size_ = std::get<5>(tables[0]);
+            table_schema.attributes_ = std::get<6>(tables[0]);
             table_schema.engine_type_ = index.engine_type_;
             table_schema.nlist_ = index.nlist_;
             table_schema.metric_type_ = index.metric_type_;
@@ -563,7 +570,8 @@ SqliteMetaImpl::AllTables(std::vector<TableSchema> &table_schema_array) {
                                                      &TableSchema::index_file_size_,
                                                      &TableSchema::engine_type_,
                                                      &TableSchema::nlist_,
-                                                     &TableSchema::metric_type_),
+                                                     &TableSchema::metric_type_,
+                                                     &TableSchema::attributes_),
                                              where(c(&TableSchema::state_) != (int) TableSchema::TO_DELETE));
         for (auto &table : selected) {
             TableSchema schema;
@@ -576,6 +584,7 @@ SqliteMetaImpl::AllTables(std::vector<TableSchema> &table_schema_array) {
             schema.engine_type_ = std::get<6>(table);
             schema.nlist_ = std::get<7>(table);
             schema.metric_type_ = std::get<8>(table);
+            schema.attributes_ = std::get<9>(table);
 
             table_schema_array.emplace_back(schema);
         }
@@ -642,7 +651,8 @@ SqliteMetaImpl::FilesToIndex(TableFilesSchema &files) {
                                                      &TableFileSchema::row_count_,
                                                      &TableFileSchema::date_,
                                                      &TableFileSchema::engine_type_,
-                                                     &TableFileSchema::created_on_),
+                                                     &TableFileSchema::created_on_,
+                                                     &TableFileSchema::partition_tag_),
                                              where(c(&TableFileSchema::file_type_)
                                                        == (int) TableFileSchema::TO_INDEX));
 
@@ -660,6 +670,7 @@ SqliteMetaImpl::FilesToIndex(TableFilesSchema &files) {
             table_file.date_ = std::get<6>(file);
             table_file.engine_type_ = std::get<7>(file);
             table_file.created_on_ = std::get<8>(file);
+            table_file.partition_tag_ = std::get<9>(file);
 
             auto status = utils::GetTableFilePath(options_, table_file);
             if (!status.ok()) {
@@ -691,10 +702,64 @@ SqliteMetaImpl::FilesToIndex(TableFilesSchema &files) {
     }
 }
 
+Status
+SqliteMetaImpl::FilesToDemote(int64_t created_before, TableFilesSchema &files) {
+    files.clear();
+
+    try {
+        server::MetricCollector metric;
+
+        auto selected = ConnectorPtr->select(columns(&TableFileSchema::id_,
+                                                     &TableFileSchema::table_id_,
+                                                     &TableFileSchema::file_id_,
+                                                     &TableFileSchema::file_size_,
+                                                     &TableFileSchema::row_count_,
+                                                     &TableFileSchema::date_,
+                                                     &TableFileSchema::engine_type_,
+                                                     &TableFileSchema::created_on_,
+                                                     &TableFileSchema::partition_tag_),
+                                             where(c(&TableFileSchema::file_type_) == (int) TableFileSchema::INDEX
+                                                   and c(&TableFileSchema::tier_) == (int) TableFileSchema::LOCAL
+                                                   and c(&TableFileSchema::created_on_) < created_before),
+                                             order_by(&TableFileSchema::created_on_));
+
+        Status ret;
+        TableFileSchema table_file;
+        for (auto &file : selected) {
+            table_file.id_ = std::get<0>(file);
+            table_file.table_id_ = std::get<1>(file);
+            table_file.file_id_ = std::get<2>(file);
+            table_file.file_type_ = (int) TableFileSchema::INDEX;
+            table_file.file_size_ = std::get<3>(file);
+            table_file.row_count_ = std::get<4>(file);
+            table_file.date_ = std::get<5>(file);
+            table_file.engine_type_ = std::get<6>(file);
+            table_file.created_on_ = std::get<7>(file);
+            table_file.partition_tag_ = std::get<8>(file);
+            table_file.tier_ = (int) TableFileSchema::LOCAL;
+
+            auto status = utils::GetTableFilePath(options_, table_file);
+            if (!status.ok()) {
+                ret = status;
+                continue;
+            }
+            files.push_back(table_file);
+        }
+
+        if (selected.size() > 0) {
+            ENGINE_LOG_DEBUG << "Collect " << selected.size() << " to-demote files";
+        }
+        return ret;
+    } catch (std::exception &e) {
+        return HandleException("Encounter exception when iterate cold files", e.what());
+    }
+}
+
 Status
 SqliteMetaImpl::FilesToSearch(const std::string &table_id,
                               const std::vector<size_t> &ids,
                               const DatesT &dates,
+                              const PartitionTags &partition_tags,
                               DatePartionedTableFilesSchema &files) {
     files.clear();
     server::MetricCollector metric;
@@ -707,7 +772,9 @@ SqliteMetaImpl::FilesToSearch(const std::string &table_id,
                                       &TableFileSchema::file_size_,
                                       &TableFileSchema::row_count_,
                                       &TableFileSchema::date_,
-                                      &TableFileSchema::engine_type_);
+                                      &TableFileSchema::engine_type_,
+                                      &TableFileSchema::tier_,
+                                      &TableFileSchema::partition_tag_);
 
         auto match_tableid = c(&TableFileSchema::table_id_) == table_id;
 
@@ -773,9 +840,16 @@ SqliteMetaImpl::FilesToSearch(const std::string &table_id,
             }
         }
 
+        //sqlite_orm cannot add the partition condition to the branches above, the tags are matched here
+        std::set<std::string> tag_set(partition_tags.begin(), partition_tags.end());
+
         Status ret;
         TableFileSchema table_file;
         for (auto &file : selected) {
+            if (!tag_set.empty() && tag_set.find(std::get<9>(file)) == tag_set.end()) {
+                continue;
+            }
+
             table_file.id_ = std::get<0>(file);
             table_file.table_id_ = std::get<1>(file);
             table_file.file_id_ = std::get<2>(file);
@@ -784,6 +858,8 @@ SqliteMetaImpl::FilesToSearch(const std::string &table_id,
             table_file.row_count_ = std::get<5>(file);
             table_file.date_ = std::get<6>(file);
             table_file.engine_type_ = std::get<7>(file);
+            table_file.tier_ = std::get<8>(file);
+            table_file.partition_tag_ = std::get<9>(file);
             table_file.dimension_ = table_schema.dimension_;
             table_file.index_file_size_ = table_schema.index_file_size_;
             table_file.nlist_ = table_schema.nlist_;
@@ -837,7 +913,8 @@ SqliteMetaImpl::FilesToMerge(const std::string &table_id,
                                                      &TableFileSchema::file_size_,
                                                      &TableFileSchema::row_count_,
                                                      &TableFileSchema::date_,
-                                                     &TableFileSchema::created_on_),
+                                                     &TableFileSchema::created_on_,
+                                                     &TableFileSchema::partition_tag_),
                                              where(c(&TableFileSchema::file_type_) == (int) TableFileSchema::RAW and
                                                  c(&TableFileSchema::table_id_) == table_id),
                                              order_by(&TableFileSchema::file_size_).desc());
@@ -857,6 +934,7 @@ SqliteMetaImpl::FilesToMerge(const std::string &table_id,
             table_file.row_count_ = std::get<5>(file);
             table_file.date_ = std::get<6>(file);
             table_file.created_on_ = std::get<7>(file);
+            table_file.partition_tag_ = std::get<8>(file);
             table_file.dimension_ = table_schema.dimension_;
             table_file.index_file_size_ = table_schema.index_file_size_;
             table_file.nlist_ = table_schema.nlist_;
@@ -896,7 +974,9 @@ SqliteMetaImpl::GetTableFiles(const std::string &table_id,
                                                   &TableFileSchema::row_count_,
                                                   &TableFileSchema::date_,
                                                   &TableFileSchema::engine_type_,
-                                                  &TableFileSchema::created_on_),
+                                                  &TableFileSchema::created_on_,
+                                                  &TableFileSchema::tier_,
+                                                  &TableFileSchema::partition_tag_),
                                           where(c(&TableFileSchema::table_id_) == table_id and
                                               in(&TableFileSchema::id_, ids) and
                                               c(&TableFileSchema::file_type_) != (int) TableFileSchema::TO_DELETE));
@@ -920,6 +1000,8 @@ SqliteMetaImpl::GetTableFiles(const std::string &table_id,
             file_schema.date_ = std::get<5>(file);
             file_schema.engine_type_ = std::get<6>(file);
             file_schema.created_on_ = std::get<7>(file);
+            file_schema.tier_ = std::get<8>(file);
+            file_schema.partition_tag_ = std::get<9>(file);
             file_schema.dimension_ = table_schema.dimension_;
             file_schema.index_file_size_ = table_schema.index_file_size_;
             file_schema.nlist_ = table_schema.nlist_;
@@ -937,9 +1019,9 @@ SqliteMetaImpl::GetTableFiles(const std::string &table_id,
     }
 }
 
-// TODO(myh): Support swap to cloud storage
 Status
-SqliteMetaImpl::Archive() {
+SqliteMetaImpl::Archive(TableFilesSchema &archived) {
+    archived.clear();
     auto &criterias = options_.archive_conf_.GetCriterias();
     if (criterias.size() == 0) {
         return Status::OK();
@@ -955,12 +1037,34 @@ SqliteMetaImpl::Archive() {
                 //multi-threads call sqlite update may get exception('bad logic', etc), so we add a lock here
                 std::lock_guard<std::mutex> meta_lock(meta_mutex_);
 
-                ConnectorPtr->update_all(
-                    set(
-                        c(&TableFileSchema::file_type_) = (int) TableFileSchema::TO_DELETE),
-                    where(
-                        c(&TableFileSchema::created_on_) < (int64_t) (now - usecs) and
-                            c(&TableFileSchema::file_type_) != (int) TableFileSchema::TO_DELETE));
+                auto selected = ConnectorPtr->select(columns(&TableFileSchema::id_,
+                                                             &TableFileSchema::table_id_,
+                                                             &TableFileSchema::file_id_,
+                                                             &TableFileSchema::date_),
+                                                     where(
+                                                         c(&TableFileSchema::created_on_) < (int64_t) (now - usecs) and
+                                                             c(&TableFileSchema::file_type_)
+                                                                 != (int) TableFileSchema::TO_DELETE));
+
+                std::vector<int> ids;
+                TableFileSchema table_file;
+                table_file.file_type_ = (int) TableFileSchema::TO_DELETE;
+                for (auto &file : selected) {
+                    table_file.id_ = std::get<0>(file);
+                    table_file.table_id_ = std::get<1>(file);
+                    table_file.file_id_ = std::get<2>(file);
+                    table_file.date_ = std::get<3>(file);
+                    ids.push_back(table_file.id_);
+                    archived.push_back(table_file);
+                }
+
+                if (!ids.empty()) {
+                    ConnectorPtr->update_all(
+                        set(
+                            c(&TableFileSchema::file_type_) = (int) TableFileSchema::TO_DELETE),
+                        where(
+                            in(&TableFileSchema::id_, ids)));
+                }
             } catch (std::exception &e) {
                 return HandleException("Encounter exception when update table files", e.what());
             }
@@ -972,7 +1076,7 @@ SqliteMetaImpl::Archive() {
             Size(sum);
 
             int64_t to_delete = (int64_t) sum - limit * G;
-            DiscardFiles(to_delete);
+            DiscardFiles(to_delete, archived);
 
             ENGINE_LOG_DEBUG << "Archive files to free disk";
         }
@@ -1002,7 +1106,7 @@ SqliteMetaImpl::Size(uint64_t &result) {
 }
 
 Status
-SqliteMetaImpl::DiscardFiles(int64_t to_discard_size) {
+SqliteMetaImpl::DiscardFiles(int64_t to_discard_size, TableFilesSchema &discarded) {
     if (to_discard_size <= 0) {
         return Status::OK();
     }
@@ -1015,9 +1119,13 @@ SqliteMetaImpl::DiscardFiles(int64_t to_discard_size) {
         //multi-threads call sqlite update may get exception('bad logic', etc), so we add a lock here
         std::lock_guard<std::mutex> meta_lock(meta_mutex_);
 
+        TableFilesSchema files;
         auto commited = ConnectorPtr->transaction([&]() mutable {
             auto selected = ConnectorPtr->select(columns(&TableFileSchema::id_,
-                                                         &TableFileSchema::file_size_),
+                                                         &TableFileSchema::file_size_,
+                                                         &TableFileSchema::table_id_,
+                                                         &TableFileSchema::file_id_,
+                                                         &TableFileSchema::date_),
                                                  where(c(&TableFileSchema::file_type_)
                                                            != (int) TableFileSchema::TO_DELETE),
                                                  order_by(&TableFileSchema::id_),
@@ -1025,12 +1133,17 @@ SqliteMetaImpl::DiscardFiles(int64_t to_discard_size) {
 
             std::vector<int> ids;
             TableFileSchema table_file;
+            table_file.file_type_ = (int) TableFileSchema::TO_DELETE;
 
             for (auto &file : selected) {
                 if (to_discard_size <= 0) break;
                 table_file.id_ = std::get<0>(file);
                 table_file.file_size_ = std::get<1>(file);
+                table_file.table_id_ = std::get<2>(file);
+                table_file.file_id_ = std::get<3>(file);
+                table_file.date_ = std::get<4>(file);
                 ids.push_back(table_file.id_);
+                files.push_back(table_file);
                 ENGINE_LOG_DEBUG << "Discard table_file.id=" << table_file.file_id_
                                  << " table_file.size=" << table_file.file_size_;
                 to_discard_size -= table_file.file_size_;
@@ -1053,11 +1166,13 @@ SqliteMetaImpl::DiscardFiles(int64_t to_discard_size) {
         if (!commited) {
             return HandleException("DiscardFiles error: sqlite transaction failed");
         }
+
+        discarded.insert(discarded.end(), files.begin(), files.end());
     } catch (std::exception &e) {
         return HandleException("Encounter exception when discard table file", e.what());
     }
 
-    return DiscardFiles(to_discard_size);
+    return DiscardFiles(to_discard_size, discarded);
 }
 
 Status
@@ -1089,6 +1204,33 @@ SqliteMetaImpl::UpdateTableFile(TableFileSchema &file_schema) {
     return Status::OK();
 }
 
+Status
+SqliteMetaImpl::UpdateTableFileTier(TableFileSchema &file_schema) {
+    file_schema.updated_time_ = utils::GetMicroSecTimeStamp();
+    try {
+        server::MetricCollector metric;
+
+        //multi-threads call sqlite update may get exception('bad logic', etc), so we add a lock here
+        std::lock_guard<std::mutex> meta_lock(meta_mutex_);
+
+        //only touch the tier column, the file may be marked as TO_DELETE meanwhile
+        ConnectorPtr->update_all(
+            set(
+                c(&TableFileSchema::tier_) = file_schema.tier_,
+                c(&TableFileSchema::updated_time_) = file_schema.updated_time_),
+            where(
+                c(&TableFileSchema::id_) == file_schema.id_));
+
+        ENGINE_LOG_DEBUG << "Update table file tier, file id = " << file_schema.file_id_
+                         << " tier = " << file_schema.tier_;
+    } catch (std::exception &e) {
+        std::string msg = "Exception update table file tier: table_id = " + file_schema.table_id_
+            + " file_id = " + file_schema.file_id_;
+        return HandleException(msg, e.what());
+    }
+    return Status::OK();
+}
+
 Status
 SqliteMetaImpl::UpdateTableFilesToIndex(const std::string &table_id) {
     try {
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "db/meta/TableFileCatalog.h"
+#include "db/Utils.h"
+#include "utils/Log.h"
+
+#include <set>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+TableFileCatalog::TableFileCatalog(const DBMetaOptions& options) : options_(options) {
+}
+
+bool
+TableFileCatalog::FilesToSearch(const std::string& table_id, const DatesT& dates, const PartitionTags& partition_tags,
+                                DatePartionedTableFilesSchema& files) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = tables_.find(table_id);
+    if (iter == tables_.end() || iter->second.loading_) {
+        return false;
+    }
+
+    std::set<DateT> date_set(dates.begin(), dates.end());
+    std::set<std::string> tag_set(partition_tags.begin(), partition_tags.end());
+    for (auto& item : iter->second.files_) {
+        auto& file = item.second;
+        if (!date_set.empty() && date_set.find(file.date_) == date_set.end()) {
+            continue;
+        }
+        if (!tag_set.empty() && tag_set.find(file.partition_tag_) == tag_set.end()) {
+            continue;
+        }
+        files[file.date_].push_back(file);
+    }
+    return true;
+}
+
+uint64_t
+TableFileCatalog::BeginLoad(const std::string& table_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tables_.find(table_id) != tables_.end()) {
+        return 0;
+    }
+
+    auto& entry = tables_[table_id];
+    entry.token_ = ++last_token_;
+    return entry.token_;
+}
+
+void
+TableFileCatalog::FinishLoad(uint64_t token, const TableSchema& table_schema,
+                             const DatePartionedTableFilesSchema& files, std::vector<std::string>& evicted) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = tables_.find(table_schema.table_id_);
+    if (iter == tables_.end() || iter->second.token_ != token) {
+        return;
+    }
+
+    auto& entry = iter->second;
+    entry.schema_ = table_schema;
+    for (auto& day_files : files) {
+        for (auto& file : day_files.second) {
+            entry.files_[file.id_] = file;
+        }
+    }
+
+    // the files read from meta may predate some of the buffered changes, replaying them all is harmless
+    TableFilesSchema indexed;
+    for (auto& change : entry.pending_) {
+        ApplyFile(entry, change.file_, evicted, indexed);
+    }
+    entry.pending_.clear();
+    entry.loading_ = false;
+    ENGINE_LOG_DEBUG << "Catalog loaded table " << table_schema.table_id_ << " with " << entry.files_.size()
+                     << " files";
+}
+
+void
+TableFileCatalog::AbortLoad(const std::string& table_id, uint64_t token) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = tables_.find(table_id);
+    if (iter != tables_.end() && iter->second.token_ == token) {
+        tables_.erase(iter);
+    }
+}
+
+void
+TableFileCatalog::Apply(const FileChanges& changes, std::vector<std::string>& evicted, TableFilesSchema& indexed) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& change : changes) {
+        auto& file = change.file_;
+        auto iter = tables_.find(file.table_id_);
+        if (iter == tables_.end()) {
+            continue;
+        }
+
+        auto& entry = iter->second;
+        if (file.file_id_ == TABLE_CHANGE) {
+            // the table is read from meta again on the next search, the files of dropped dates are evicted now
+            if (file.file_type_ == (int)TableFileSchema::TO_DELETE) {
+                for (auto& item : entry.files_) {
+                    if (file.date_ == EmptyDate || item.second.date_ == file.date_) {
+                        evicted.push_back(item.second.location_);
+                    }
+                }
+            }
+            tables_.erase(iter);
+        } else if (entry.loading_) {
+            entry.pending_.push_back(change);
+        } else {
+            ApplyFile(entry, file, evicted, indexed);
+        }
+    }
+}
+
+void
+TableFileCatalog::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tables_.clear();
+}
+
+void
+TableFileCatalog::ApplyFile(TableEntry& entry, const TableFileSchema& file, std::vector<std::string>& evicted,
+                            TableFilesSchema& indexed) {
+    auto iter = entry.files_.find(file.id_);
+    switch (file.file_type_) {
+        case (int)TableFileSchema::RAW:
+        case (int)TableFileSchema::TO_INDEX:
+        case (int)TableFileSchema::INDEX: {
+            bool new_index = file.file_type_ == (int)TableFileSchema::INDEX &&
+                             (iter == entry.files_.end() || iter->second.file_type_ != (int)TableFileSchema::INDEX);
+
+            TableFileSchema table_file = file;
+            table_file.dimension_ = entry.schema_.dimension_;
+            table_file.index_file_size_ = entry.schema_.index_file_size_;
+            table_file.nlist_ = entry.schema_.nlist_;
+            table_file.metric_type_ = entry.schema_.metric_type_;
+            utils::GetTableFilePath(options_, table_file);
+            entry.files_[table_file.id_] = table_file;
+
+            if (new_index) {
+                indexed.push_back(table_file);
+            }
+            break;
+        }
+        default: {
+            if (iter != entry.files_.end()) {
+                evicted.push_back(iter->second.location_);
+                entry.files_.erase(iter);
+            }
+            break;
+        }
+    }
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "ChangeFeed.h"
+#include "MetaTypes.h"
+#include "db/Options.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+// Searchable files of the tables queried on a readonly node. A table is read from meta once, then kept up to date
+// with the change feed, so that searches needn't go to meta for the file list.
+class TableFileCatalog {
+ public:
+    explicit TableFileCatalog(const DBMetaOptions& options);
+
+    // false if the table isn't in the catalog (yet), the files must be read from meta
+    bool
+    FilesToSearch(const std::string& table_id, const DatesT& dates, const PartitionTags& partition_tags,
+                  DatePartionedTableFilesSchema& files);
+
+    // returns a load token, 0 if the table is being loaded already; the changes arriving until FinishLoad are
+    // replayed on top of the files read from meta
+    uint64_t
+    BeginLoad(const std::string& table_id);
+
+    // a load invalidated by a table change in the meantime is dropped
+    void
+    FinishLoad(uint64_t token, const TableSchema& table_schema, const DatePartionedTableFilesSchema& files,
+               std::vector<std::string>& evicted);
+
+    void
+    AbortLoad(const std::string& table_id, uint64_t token);
+
+    // evicted gets the locations of the files no longer searchable, indexed the new index files of the catalog
+    void
+    Apply(const FileChanges& changes, std::vector<std::string>& evicted, TableFilesSchema& indexed);
+
+    // forget all tables, after some changes were missed
+    void
+    Clear();
+
+ private:
+    struct TableEntry {
+        uint64_t token_ = 0;
+        bool loading_ = true;
+        TableSchema schema_;
+        FileChanges pending_;
+        std::map<size_t, TableFileSchema> files_;
+    };
+
+    void
+    ApplyFile(TableEntry& entry, const TableFileSchema& file, std::vector<std::string>& evicted,
+              TableFilesSchema& indexed);
+
+ private:
+    DBMetaOptions options_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, TableEntry> tables_;
+    uint64_t last_token_ = 0;
+};
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
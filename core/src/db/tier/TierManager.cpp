@@ -0,0 +1,246 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "db/tier/TierManager.h"
+#include "db/Utils.h"
+#include "db/meta/MetaConsts.h"
+#include "utils/CommonUtil.h"
+#include "utils/Log.h"
+#include "utils/TimeRecorder.h"
+
+#include <boost/filesystem.hpp>
+#include <limits>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+constexpr uint64_t FETCH_THREAD_NUM = 4;
+constexpr uint64_t MAX_DEMOTE_FILES_PER_ROUND = 16;
+
+}  // namespace
+
+TierManager&
+TierManager::GetInstance() {
+    static TierManager instance;
+    return instance;
+}
+
+TierManager::TierManager() : local_files_(std::numeric_limits<size_t>::max()) {
+}
+
+void
+TierManager::Init(const TierConf& conf, const TierStoragePtr& storage) {
+    conf_ = conf;
+    storage_ = storage;
+    if (storage_ == nullptr && !conf_.path_.empty()) {
+        storage_ = std::make_shared<LocalTierStorage>(conf_.path_);
+    }
+
+    if (storage_ == nullptr) {
+        return;
+    }
+
+    if (fetch_pool_ == nullptr) {
+        fetch_pool_ = std::make_shared<ThreadPool>(FETCH_THREAD_NUM);
+    }
+
+    ENGINE_LOG_DEBUG << "Tiered storage enabled, secondary path: " << conf_.path_
+                     << " cold days: " << conf_.cold_days_ << " local capacity: " << conf_.local_capacity_;
+}
+
+std::string
+TierManager::Key(const meta::TableFileSchema& file) const {
+    return file.table_id_ + "/" + file.file_id_;
+}
+
+Status
+TierManager::Demote(const meta::MetaPtr& meta) {
+    if (!Enabled()) {
+        return Status::OK();
+    }
+
+    int64_t cold_usecs = static_cast<int64_t>(conf_.cold_days_) * meta::D_SEC * meta::US_PS;
+    meta::TableFilesSchema files;
+    auto status = meta->FilesToDemote(utils::GetMicroSecTimeStamp() - cold_usecs, files);
+    if (!status.ok()) {
+        ENGINE_LOG_WARNING << "Some cold files are skipped: " << status.message();
+    }
+
+    if (files.size() > MAX_DEMOTE_FILES_PER_ROUND) {
+        files.resize(MAX_DEMOTE_FILES_PER_ROUND);
+    }
+
+    for (auto& file : files) {
+        std::string key = Key(file);
+        status = storage_->Put(key, file.location_);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Failed to demote file " << file.file_id_ << ": " << status.message();
+            return status;
+        }
+
+        file.tier_ = meta::TableFileSchema::REMOTE;
+        status = meta->UpdateTableFileTier(file);
+        if (!status.ok()) {
+            storage_->Delete(key);
+            return status;
+        }
+
+        // a search already reading the file keeps its handle, later ones fetch it back
+        boost::filesystem::remove(file.location_);
+        ENGINE_LOG_DEBUG << "Demote file " << file.file_id_ << " of table " << file.table_id_
+                         << " size: " << file.file_size_;
+    }
+
+    return Status::OK();
+}
+
+std::shared_ptr<std::packaged_task<Status()>>
+TierManager::StartFetch(const meta::TableFileSchema& file, std::shared_future<Status>& future) {
+    std::lock_guard<std::mutex> lock(fetch_mutex_);
+    auto iter = fetching_.find(file.location_);
+    if (iter != fetching_.end()) {
+        future = iter->second;
+        return nullptr;
+    }
+
+    auto task = std::make_shared<std::packaged_task<Status()>>([this, file]() {
+        auto status = DoFetch(file);
+        std::lock_guard<std::mutex> lock(fetch_mutex_);
+        fetching_.erase(file.location_);
+        return status;
+    });
+    future = task->get_future().share();
+    fetching_[file.location_] = future;
+    return task;
+}
+
+Status
+TierManager::DoFetch(const meta::TableFileSchema& file) {
+    TimeRecorder rc("Fetch file " + file.file_id_);
+    auto status = storage_->Get(Key(file), file.location_);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Failed to fetch file " << file.file_id_ << ": " << status.message();
+        return status;
+    }
+
+    Touch(file.location_, server::CommonUtil::GetFileSize(file.location_));
+    rc.ElapseFromBegin("done");
+    return Status::OK();
+}
+
+Status
+TierManager::Fetch(const meta::TableFileSchema& file) {
+    if (!Enabled()) {
+        return Status::OK();
+    }
+
+    if (server::CommonUtil::IsFileExist(file.location_)) {
+        if (file.tier_ == meta::TableFileSchema::REMOTE) {
+            Touch(file.location_, file.file_size_);
+        }
+        return Status::OK();
+    }
+
+    std::shared_future<Status> future;
+    auto task = StartFetch(file, future);
+    if (task != nullptr) {
+        (*task)();
+    }
+
+    return future.get();
+}
+
+void
+TierManager::Prefetch(const meta::TableFilesSchema& files) {
+    if (!Enabled()) {
+        return;
+    }
+
+    for (auto& file : files) {
+        if (file.tier_ != meta::TableFileSchema::REMOTE || server::CommonUtil::IsFileExist(file.location_)) {
+            continue;
+        }
+
+        std::shared_future<Status> future;
+        auto task = StartFetch(file, future);
+        if (task != nullptr) {
+            fetch_pool_->enqueue([task]() { (*task)(); });
+        }
+    }
+}
+
+bool
+TierManager::Exists(const meta::TableFileSchema& file) {
+    return Enabled() && storage_->Exists(Key(file));
+}
+
+Status
+TierManager::Remove(const meta::TableFileSchema& file) {
+    if (!Enabled()) {
+        return Status::OK();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(lru_mutex_);
+        if (local_files_.exists(file.location_)) {
+            local_usage_ -= local_files_.get(file.location_);
+            local_files_.erase(file.location_);
+        }
+    }
+
+    return storage_->Delete(Key(file));
+}
+
+uint64_t
+TierManager::LocalUsage() {
+    std::lock_guard<std::mutex> lock(lru_mutex_);
+    return local_usage_;
+}
+
+void
+TierManager::Touch(const std::string& location, uint64_t size) {
+    std::vector<std::string> evicted;
+    {
+        std::lock_guard<std::mutex> lock(lru_mutex_);
+        if (local_files_.exists(location)) {
+            local_files_.get(location);
+            return;
+        }
+
+        local_files_.put(location, size);
+        local_usage_ += size;
+
+        // the secondary tier keeps a copy, so local files can simply be removed
+        while (local_usage_ > conf_.local_capacity_ && local_files_.size() > 1) {
+            auto last = *local_files_.rbegin();
+            local_usage_ -= last.second;
+            local_files_.erase(last.first);
+            evicted.push_back(last.first);
+        }
+    }
+
+    for (auto& path : evicted) {
+        boost::filesystem::remove(path);
+        ENGINE_LOG_DEBUG << "Evict fetched file from local disk: " << path;
+    }
+}
+
+}  // namespace engine
+}  // namespace milvus
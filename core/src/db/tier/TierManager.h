@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "cache/LRU.h"
+#include "db/Options.h"
+#include "db/meta/Meta.h"
+#include "db/tier/TierStorage.h"
+#include "utils/Status.h"
+#include "utils/ThreadPool.h"
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace milvus {
+namespace engine {
+
+// Moves cold index files to the secondary tier and brings them back when they are searched.
+// Files fetched back are kept on local disk in LRU order within TierConf::local_capacity_.
+class TierManager {
+ public:
+    static TierManager&
+    GetInstance();
+
+    // storage is built from conf.path_ when not given, tiering is disabled when both are empty
+    void
+    Init(const TierConf& conf, const TierStoragePtr& storage = nullptr);
+
+    bool
+    Enabled() const {
+        return storage_ != nullptr;
+    }
+
+    // move index files older than TierConf::cold_days_ to the secondary tier
+    Status
+    Demote(const meta::MetaPtr& meta);
+
+    // make sure the file exists at its location, fetch it from the secondary tier if necessary
+    Status
+    Fetch(const meta::TableFileSchema& file);
+
+    // start fetching the secondary tier files in background, so that loader find them on local disk
+    void
+    Prefetch(const meta::TableFilesSchema& files);
+
+    bool
+    Exists(const meta::TableFileSchema& file);
+
+    // delete the secondary tier copy of the file
+    Status
+    Remove(const meta::TableFileSchema& file);
+
+    uint64_t
+    LocalUsage();
+
+ private:
+    TierManager();
+
+    std::string
+    Key(const meta::TableFileSchema& file) const;
+
+    // return the fetch task if the caller is the first one to fetch the file, otherwise nullptr
+    std::shared_ptr<std::packaged_task<Status()>>
+    StartFetch(const meta::TableFileSchema& file, std::shared_future<Status>& future);
+
+    Status
+    DoFetch(const meta::TableFileSchema& file);
+
+    void
+    Touch(const std::string& location, uint64_t size);
+
+ private:
+    TierConf conf_;
+    TierStoragePtr storage_;
+    std::shared_ptr<ThreadPool> fetch_pool_;
+
+    std::mutex fetch_mutex_;
+    std::unordered_map<std::string, std::shared_future<Status>> fetching_;
+
+    std::mutex lru_mutex_;
+    cache::LRU<std::string, uint64_t> local_files_;
+    uint64_t local_usage_ = 0;
+};
+
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "db/tier/TierStorage.h"
+#include "utils/CommonUtil.h"
+#include "utils/Error.h"
+#include "utils/Log.h"
+
+#include <zlib.h>
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+namespace {
+
+constexpr size_t TRANSFER_BLOCK_SIZE = 4 * 1024 * 1024;
+constexpr const char* OBJECT_SUFFIX = ".gz";
+constexpr const char* TEMP_SUFFIX = ".tmp";
+
+Status
+CreateParentDirectory(const std::string& path) {
+    boost::filesystem::path parent = boost::filesystem::path(path).parent_path();
+    return server::CommonUtil::CreateDirectory(parent.string());
+}
+
+}  // namespace
+
+LocalTierStorage::LocalTierStorage(const std::string& root_path) : root_path_(root_path) {
+}
+
+std::string
+LocalTierStorage::ObjectPath(const std::string& key) const {
+    return root_path_ + "/" + key + OBJECT_SUFFIX;
+}
+
+Status
+LocalTierStorage::Put(const std::string& key, const std::string& local_path) {
+    std::string object_path = ObjectPath(key);
+    auto status = CreateParentDirectory(object_path);
+    if (!status.ok()) {
+        return status;
+    }
+
+    FILE* src = fopen(local_path.c_str(), "rb");
+    if (src == nullptr) {
+        return Status(DB_ERROR, "Failed to open file: " + local_path);
+    }
+
+    // write to a temporary object first, a half written object must never be fetched
+    std::string temp_path = object_path + TEMP_SUFFIX;
+    gzFile dst = gzopen(temp_path.c_str(), "wb1");
+    if (dst == nullptr) {
+        fclose(src);
+        return Status(DB_ERROR, "Failed to create tier object: " + temp_path);
+    }
+
+    std::vector<char> block(TRANSFER_BLOCK_SIZE);
+    bool failed = false;
+    size_t len = 0;
+    while ((len = fread(block.data(), 1, block.size(), src)) > 0) {
+        if (gzwrite(dst, block.data(), static_cast<unsigned>(len)) != static_cast<int>(len)) {
+            failed = true;
+            break;
+        }
+    }
+    failed = failed || ferror(src) != 0;
+    fclose(src);
+    failed = (gzclose(dst) != Z_OK) || failed;
+
+    if (failed || rename(temp_path.c_str(), object_path.c_str()) != 0) {
+        boost::filesystem::remove(temp_path);
+        return Status(DB_ERROR, "Failed to write tier object: " + object_path);
+    }
+
+    return Status::OK();
+}
+
+Status
+LocalTierStorage::Get(const std::string& key, const std::string& local_path) {
+    std::string object_path = ObjectPath(key);
+    gzFile src = gzopen(object_path.c_str(), "rb");
+    if (src == nullptr) {
+        return Status(DB_NOT_FOUND, "Tier object not found: " + object_path);
+    }
+    gzbuffer(src, TRANSFER_BLOCK_SIZE);
+
+    auto status = CreateParentDirectory(local_path);
+    if (!status.ok()) {
+        gzclose(src);
+        return status;
+    }
+
+    // readers only see the file once it is complete
+    std::string temp_path = local_path + TEMP_SUFFIX;
+    FILE* dst = fopen(temp_path.c_str(), "wb");
+    if (dst == nullptr) {
+        gzclose(src);
+        return Status(DB_ERROR, "Failed to create file: " + temp_path);
+    }
+
+    std::vector<char> block(TRANSFER_BLOCK_SIZE);
+    bool failed = false;
+    int len = 0;
+    while ((len = gzread(src, block.data(), static_cast<unsigned>(block.size()))) > 0) {
+        if (fwrite(block.data(), 1, len, dst) != static_cast<size_t>(len)) {
+            failed = true;
+            break;
+        }
+    }
+    failed = failed || len < 0;
+    failed = (fclose(dst) != 0) || failed;
+    gzclose(src);
+
+    if (failed || rename(temp_path.c_str(), local_path.c_str()) != 0) {
+        boost::filesystem::remove(temp_path);
+        return Status(DB_ERROR, "Failed to fetch tier object: " + object_path);
+    }
+
+    return Status::OK();
+}
+
+Status
+LocalTierStorage::Delete(const std::string& key) {
+    boost::system::error_code err;
+    boost::filesystem::remove(ObjectPath(key), err);
+    if (err) {
+        return Status(DB_ERROR, "Failed to delete tier object: " + err.message());
+    }
+
+    return Status::OK();
+}
+
+bool
+LocalTierStorage::Exists(const std::string& key) {
+    return server::CommonUtil::IsFileExist(ObjectPath(key));
+}
+
+}  // namespace engine
+}  // namespace milvus
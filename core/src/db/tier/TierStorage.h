@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "utils/Status.h"
+
+#include <memory>
+#include <string>
+
+namespace milvus {
+namespace engine {
+
+// Secondary storage tier for cold index files. Objects are kept compressed, so the cost of
+// moving files between tiers is paid in cpu instead of bandwidth. An S3-compatible store can
+// implement the same interface.
+class TierStorage {
+ public:
+    virtual ~TierStorage() = default;
+
+    // compress the local file and store it as key
+    virtual Status
+    Put(const std::string& key, const std::string& local_path) = 0;
+
+    // decompress the object of key into the local file
+    virtual Status
+    Get(const std::string& key, const std::string& local_path) = 0;
+
+    virtual Status
+    Delete(const std::string& key) = 0;
+
+    virtual bool
+    Exists(const std::string& key) = 0;
+};
+
+using TierStoragePtr = std::shared_ptr<TierStorage>;
+
+// secondary tier on a (slower) local or mounted file system, objects are gzip files under root path
+class LocalTierStorage : public TierStorage {
+ public:
+    explicit LocalTierStorage(const std::string& root_path);
+
+    Status
+    Put(const std::string& key, const std::string& local_path) override;
+
+    Status
+    Get(const std::string& key, const std::string& local_path) override;
+
+    Status
+    Delete(const std::string& key) override;
+
+    bool
+    Exists(const std::string& key) override;
+
+ private:
+    std::string
+    ObjectPath(const std::string& key) const;
+
+ private:
+    std::string root_path_;
+};
+
+}  // namespace engine
+}  // namespace milvus
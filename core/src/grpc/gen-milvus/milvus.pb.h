@@ -48,7 +48,7 @@ struct TableStruct_milvus_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[17]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[22]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -57,6 +57,12 @@ struct TableStruct_milvus_2eproto {
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_milvus_2eproto;
 namespace milvus {
 namespace grpc {
+class AttrColumn;
+class AttrColumnDefaultTypeInternal;
+extern AttrColumnDefaultTypeInternal _AttrColumn_default_instance_;
+class AttrField;
+class AttrFieldDefaultTypeInternal;
+extern AttrFieldDefaultTypeInternal _AttrField_default_instance_;
 class BoolReply;
 class BoolReplyDefaultTypeInternal;
 extern BoolReplyDefaultTypeInternal _BoolReply_default_instance_;
@@ -81,6 +87,9 @@ extern RangeDefaultTypeInternal _Range_default_instance_;
 class RowRecord;
 class RowRecordDefaultTypeInternal;
 extern RowRecordDefaultTypeInternal _RowRecord_default_instance_;
+class SearchByIDParam;
+class SearchByIDParamDefaultTypeInternal;
+extern SearchByIDParamDefaultTypeInternal _SearchByIDParam_default_instance_;
 class SearchInFilesParam;
 class SearchInFilesParamDefaultTypeInternal;
 extern SearchInFilesParamDefaultTypeInternal _SearchInFilesParam_default_instance_;
@@ -105,12 +114,20 @@ extern TableSchemaDefaultTypeInternal _TableSchema_default_instance_;
 class TopKQueryResult;
 class TopKQueryResultDefaultTypeInternal;
 extern TopKQueryResultDefaultTypeInternal _TopKQueryResult_default_instance_;
+class VectorData;
+class VectorDataDefaultTypeInternal;
+extern VectorDataDefaultTypeInternal _VectorData_default_instance_;
+class VectorIdentity;
+class VectorIdentityDefaultTypeInternal;
+extern VectorIdentityDefaultTypeInternal _VectorIdentity_default_instance_;
 class VectorIds;
 class VectorIdsDefaultTypeInternal;
 extern VectorIdsDefaultTypeInternal _VectorIds_default_instance_;
 }  // namespace grpc
 }  // namespace milvus
 PROTOBUF_NAMESPACE_OPEN
+template<> ::milvus::grpc::AttrColumn* Arena::CreateMaybeMessage<::milvus::grpc::AttrColumn>(Arena*);
+template<> ::milvus::grpc::AttrField* Arena::CreateMaybeMessage<::milvus::grpc::AttrField>(Arena*);
 template<> ::milvus::grpc::BoolReply* Arena::CreateMaybeMessage<::milvus::grpc::BoolReply>(Arena*);
 template<> ::milvus::grpc::Command* Arena::CreateMaybeMessage<::milvus::grpc::Command>(Arena*);
 template<> ::milvus::grpc::DeleteByRangeParam* Arena::CreateMaybeMessage<::milvus::grpc::DeleteByRangeParam>(Arena*);
@@ -119,6 +136,7 @@ template<> ::milvus::grpc::IndexParam* Arena::CreateMaybeMessage<::milvus::grpc:
 template<> ::milvus::grpc::InsertParam* Arena::CreateMaybeMessage<::milvus::grpc::InsertParam>(Arena*);
 template<> ::milvus::grpc::Range* Arena::CreateMaybeMessage<::milvus::grpc::Range>(Arena*);
 template<> ::milvus::grpc::RowRecord* Arena::CreateMaybeMessage<::milvus::grpc::RowRecord>(Arena*);
+template<> ::milvus::grpc::SearchByIDParam* Arena::CreateMaybeMessage<::milvus::grpc::SearchByIDParam>(Arena*);
 template<> ::milvus::grpc::SearchInFilesParam* Arena::CreateMaybeMessage<::milvus::grpc::SearchInFilesParam>(Arena*);
 template<> ::milvus::grpc::SearchParam* Arena::CreateMaybeMessage<::milvus::grpc::SearchParam>(Arena*);
 template<> ::milvus::grpc::StringReply* Arena::CreateMaybeMessage<::milvus::grpc::StringReply>(Arena*);
@@ -127,6 +145,8 @@ template<> ::milvus::grpc::TableNameList* Arena::CreateMaybeMessage<::milvus::gr
 template<> ::milvus::grpc::TableRowCount* Arena::CreateMaybeMessage<::milvus::grpc::TableRowCount>(Arena*);
 template<> ::milvus::grpc::TableSchema* Arena::CreateMaybeMessage<::milvus::grpc::TableSchema>(Arena*);
 template<> ::milvus::grpc::TopKQueryResult* Arena::CreateMaybeMessage<::milvus::grpc::TopKQueryResult>(Arena*);
+template<> ::milvus::grpc::VectorData* Arena::CreateMaybeMessage<::milvus::grpc::VectorData>(Arena*);
+template<> ::milvus::grpc::VectorIdentity* Arena::CreateMaybeMessage<::milvus::grpc::VectorIdentity>(Arena*);
 template<> ::milvus::grpc::VectorIds* Arena::CreateMaybeMessage<::milvus::grpc::VectorIds>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace milvus {
@@ -424,6 +444,150 @@ class TableNameList :
 };
 // -------------------------------------------------------------------
 
+class AttrField :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.AttrField) */ {
+ public:
+  AttrField();
+  virtual ~AttrField();
+
+  AttrField(const AttrField& from);
+  AttrField(AttrField&& from) noexcept
+    : AttrField() {
+    *this = ::std::move(from);
+  }
+
+  inline AttrField& operator=(const AttrField& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AttrField& operator=(AttrField&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AttrField& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AttrField* internal_default_instance() {
+    return reinterpret_cast<const AttrField*>(
+               &_AttrField_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(AttrField& a, AttrField& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AttrField* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AttrField* New() const final {
+    return CreateMaybeMessage<AttrField>(nullptr);
+  }
+
+  AttrField* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AttrField>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AttrField& from);
+  void MergeFrom(const AttrField& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AttrField* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.AttrField";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+
+  // int32 type = 2;
+  void clear_type();
+  ::PROTOBUF_NAMESPACE_ID::int32 type() const;
+  void set_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.AttrField)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  ::PROTOBUF_NAMESPACE_ID::int32 type_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// -------------------------------------------------------------------
+
 class TableSchema :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.TableSchema) */ {
  public:
@@ -466,7 +630,7 @@ class TableSchema :
                &_TableSchema_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(TableSchema& a, TableSchema& b) {
     a.Swap(&b);
@@ -537,12 +701,24 @@ class TableSchema :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kAttrFieldArrayFieldNumber = 6,
     kTableNameFieldNumber = 2,
     kStatusFieldNumber = 1,
     kDimensionFieldNumber = 3,
     kIndexFileSizeFieldNumber = 4,
     kMetricTypeFieldNumber = 5,
   };
+  // repeated .milvus.grpc.AttrField attr_field_array = 6;
+  int attr_field_array_size() const;
+  void clear_attr_field_array();
+  ::milvus::grpc::AttrField* mutable_attr_field_array(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrField >*
+      mutable_attr_field_array();
+  const ::milvus::grpc::AttrField& attr_field_array(int index) const;
+  ::milvus::grpc::AttrField* add_attr_field_array();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrField >&
+      attr_field_array() const;
+
   // string table_name = 2;
   void clear_table_name();
   const std::string& table_name() const;
@@ -582,6 +758,7 @@ class TableSchema :
   class _Internal;
 
   ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrField > attr_field_array_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
   ::milvus::grpc::Status* status_;
   ::PROTOBUF_NAMESPACE_ID::int64 dimension_;
@@ -634,7 +811,7 @@ class Range :
                &_Range_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(Range& a, Range& b) {
     a.Swap(&b);
@@ -784,7 +961,7 @@ class RowRecord :
                &_RowRecord_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(RowRecord& a, RowRecord& b) {
     a.Swap(&b);
@@ -881,6 +1058,171 @@ class RowRecord :
 };
 // -------------------------------------------------------------------
 
+class AttrColumn :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.AttrColumn) */ {
+ public:
+  AttrColumn();
+  virtual ~AttrColumn();
+
+  AttrColumn(const AttrColumn& from);
+  AttrColumn(AttrColumn&& from) noexcept
+    : AttrColumn() {
+    *this = ::std::move(from);
+  }
+
+  inline AttrColumn& operator=(const AttrColumn& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AttrColumn& operator=(AttrColumn&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const AttrColumn& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const AttrColumn* internal_default_instance() {
+    return reinterpret_cast<const AttrColumn*>(
+               &_AttrColumn_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(AttrColumn& a, AttrColumn& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AttrColumn* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline AttrColumn* New() const final {
+    return CreateMaybeMessage<AttrColumn>(nullptr);
+  }
+
+  AttrColumn* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<AttrColumn>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const AttrColumn& from);
+  void MergeFrom(const AttrColumn& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AttrColumn* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.AttrColumn";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIntValueArrayFieldNumber = 2,
+    kDoubleValueArrayFieldNumber = 3,
+    kNameFieldNumber = 1,
+  };
+  // repeated int64 int_value_array = 2;
+  int int_value_array_size() const;
+  void clear_int_value_array();
+  ::PROTOBUF_NAMESPACE_ID::int64 int_value_array(int index) const;
+  void set_int_value_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_int_value_array(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      int_value_array() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_int_value_array();
+
+  // repeated double double_value_array = 3;
+  int double_value_array_size() const;
+  void clear_double_value_array();
+  double double_value_array(int index) const;
+  void set_double_value_array(int index, double value);
+  void add_double_value_array(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      double_value_array() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_double_value_array();
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  void set_name(const std::string& value);
+  void set_name(std::string&& value);
+  void set_name(const char* value);
+  void set_name(const char* value, size_t size);
+  std::string* mutable_name();
+  std::string* release_name();
+  void set_allocated_name(std::string* name);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.AttrColumn)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > int_value_array_;
+  mutable std::atomic<int> _int_value_array_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > double_value_array_;
+  mutable std::atomic<int> _double_value_array_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// -------------------------------------------------------------------
+
 class InsertParam :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.InsertParam) */ {
  public:
@@ -923,7 +1265,7 @@ class InsertParam :
                &_InsertParam_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    7;
 
   friend void swap(InsertParam& a, InsertParam& b) {
     a.Swap(&b);
@@ -996,7 +1338,9 @@ class InsertParam :
   enum : int {
     kRowRecordArrayFieldNumber = 2,
     kRowIdArrayFieldNumber = 3,
+    kAttrColumnArrayFieldNumber = 4,
     kTableNameFieldNumber = 1,
+    kPartitionTagFieldNumber = 5,
   };
   // repeated .milvus.grpc.RowRecord row_record_array = 2;
   int row_record_array_size() const;
@@ -1022,6 +1366,17 @@ class InsertParam :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
       mutable_row_id_array();
 
+  // repeated .milvus.grpc.AttrColumn attr_column_array = 4;
+  int attr_column_array_size() const;
+  void clear_attr_column_array();
+  ::milvus::grpc::AttrColumn* mutable_attr_column_array(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrColumn >*
+      mutable_attr_column_array();
+  const ::milvus::grpc::AttrColumn& attr_column_array(int index) const;
+  ::milvus::grpc::AttrColumn* add_attr_column_array();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrColumn >&
+      attr_column_array() const;
+
   // string table_name = 1;
   void clear_table_name();
   const std::string& table_name() const;
@@ -1033,6 +1388,17 @@ class InsertParam :
   std::string* release_table_name();
   void set_allocated_table_name(std::string* table_name);
 
+  // string partition_tag = 5;
+  void clear_partition_tag();
+  const std::string& partition_tag() const;
+  void set_partition_tag(const std::string& value);
+  void set_partition_tag(std::string&& value);
+  void set_partition_tag(const char* value);
+  void set_partition_tag(const char* value, size_t size);
+  std::string* mutable_partition_tag();
+  std::string* release_partition_tag();
+  void set_allocated_partition_tag(std::string* partition_tag);
+
   // @@protoc_insertion_point(class_scope:milvus.grpc.InsertParam)
  private:
   class _Internal;
@@ -1041,7 +1407,9 @@ class InsertParam :
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::RowRecord > row_record_array_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > row_id_array_;
   mutable std::atomic<int> _row_id_array_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrColumn > attr_column_array_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr partition_tag_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_milvus_2eproto;
 };
@@ -1089,7 +1457,7 @@ class VectorIds :
                &_VectorIds_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    8;
 
   friend void swap(VectorIds& a, VectorIds& b) {
     a.Swap(&b);
@@ -1237,7 +1605,7 @@ class SearchParam :
                &_SearchParam_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    9;
 
   friend void swap(SearchParam& a, SearchParam& b) {
     a.Swap(&b);
@@ -1310,7 +1678,9 @@ class SearchParam :
   enum : int {
     kQueryRecordArrayFieldNumber = 2,
     kQueryRangeArrayFieldNumber = 3,
+    kPartitionTagArrayFieldNumber = 7,
     kTableNameFieldNumber = 1,
+    kFilterFieldNumber = 6,
     kTopkFieldNumber = 4,
     kNprobeFieldNumber = 5,
   };
@@ -1336,6 +1706,23 @@ class SearchParam :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::Range >&
       query_range_array() const;
 
+  // repeated string partition_tag_array = 7;
+  int partition_tag_array_size() const;
+  void clear_partition_tag_array();
+  const std::string& partition_tag_array(int index) const;
+  std::string* mutable_partition_tag_array(int index);
+  void set_partition_tag_array(int index, const std::string& value);
+  void set_partition_tag_array(int index, std::string&& value);
+  void set_partition_tag_array(int index, const char* value);
+  void set_partition_tag_array(int index, const char* value, size_t size);
+  std::string* add_partition_tag_array();
+  void add_partition_tag_array(const std::string& value);
+  void add_partition_tag_array(std::string&& value);
+  void add_partition_tag_array(const char* value);
+  void add_partition_tag_array(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& partition_tag_array() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_partition_tag_array();
+
   // string table_name = 1;
   void clear_table_name();
   const std::string& table_name() const;
@@ -1347,6 +1734,17 @@ class SearchParam :
   std::string* release_table_name();
   void set_allocated_table_name(std::string* table_name);
 
+  // string filter = 6;
+  void clear_filter();
+  const std::string& filter() const;
+  void set_filter(const std::string& value);
+  void set_filter(std::string&& value);
+  void set_filter(const char* value);
+  void set_filter(const char* value, size_t size);
+  std::string* mutable_filter();
+  std::string* release_filter();
+  void set_allocated_filter(std::string* filter);
+
   // int64 topk = 4;
   void clear_topk();
   ::PROTOBUF_NAMESPACE_ID::int64 topk() const;
@@ -1364,7 +1762,9 @@ class SearchParam :
   ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::RowRecord > query_record_array_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::Range > query_range_array_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> partition_tag_array_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_;
   ::PROTOBUF_NAMESPACE_ID::int64 topk_;
   ::PROTOBUF_NAMESPACE_ID::int64 nprobe_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
@@ -1414,7 +1814,7 @@ class SearchInFilesParam :
                &_SearchInFilesParam_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    10;
 
   friend void swap(SearchInFilesParam& a, SearchInFilesParam& b) {
     a.Swap(&b);
@@ -1567,7 +1967,7 @@ class TopKQueryResult :
                &_TopKQueryResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    11;
 
   friend void swap(TopKQueryResult& a, TopKQueryResult& b) {
     a.Swap(&b);
@@ -1739,7 +2139,7 @@ class StringReply :
                &_StringReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    12;
 
   friend void swap(StringReply& a, StringReply& b) {
     a.Swap(&b);
@@ -1886,7 +2286,7 @@ class BoolReply :
                &_BoolReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    13;
 
   friend void swap(BoolReply& a, BoolReply& b) {
     a.Swap(&b);
@@ -2027,7 +2427,7 @@ class TableRowCount :
                &_TableRowCount_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    14;
 
   friend void swap(TableRowCount& a, TableRowCount& b) {
     a.Swap(&b);
@@ -2168,7 +2568,7 @@ class Command :
                &_Command_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    15;
 
   friend void swap(Command& a, Command& b) {
     a.Swap(&b);
@@ -2305,7 +2705,7 @@ class Index :
                &_Index_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    16;
 
   friend void swap(Index& a, Index& b) {
     a.Swap(&b);
@@ -2443,7 +2843,7 @@ class IndexParam :
                &_IndexParam_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    17;
 
   friend void swap(IndexParam& a, IndexParam& b) {
     a.Swap(&b);
@@ -2600,7 +3000,7 @@ class DeleteByRangeParam :
                &_DeleteByRangeParam_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    16;
+    18;
 
   friend void swap(DeleteByRangeParam& a, DeleteByRangeParam& b) {
     a.Swap(&b);
@@ -2703,16 +3103,475 @@ class DeleteByRangeParam :
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_milvus_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class VectorIdentity :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.VectorIdentity) */ {
+ public:
+  VectorIdentity();
+  virtual ~VectorIdentity();
 
-// ===================================================================
+  VectorIdentity(const VectorIdentity& from);
+  VectorIdentity(VectorIdentity&& from) noexcept
+    : VectorIdentity() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// TableName
+  inline VectorIdentity& operator=(const VectorIdentity& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VectorIdentity& operator=(VectorIdentity&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const VectorIdentity& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const VectorIdentity* internal_default_instance() {
+    return reinterpret_cast<const VectorIdentity*>(
+               &_VectorIdentity_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(VectorIdentity& a, VectorIdentity& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VectorIdentity* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline VectorIdentity* New() const final {
+    return CreateMaybeMessage<VectorIdentity>(nullptr);
+  }
+
+  VectorIdentity* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<VectorIdentity>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const VectorIdentity& from);
+  void MergeFrom(const VectorIdentity& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VectorIdentity* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.VectorIdentity";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTableNameFieldNumber = 1,
+    kIdFieldNumber = 2,
+  };
+  // string table_name = 1;
+  void clear_table_name();
+  const std::string& table_name() const;
+  void set_table_name(const std::string& value);
+  void set_table_name(std::string&& value);
+  void set_table_name(const char* value);
+  void set_table_name(const char* value, size_t size);
+  std::string* mutable_table_name();
+  std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+
+  // int64 id = 2;
+  void clear_id();
+  ::PROTOBUF_NAMESPACE_ID::int64 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.VectorIdentity)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+  ::PROTOBUF_NAMESPACE_ID::int64 id_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VectorData :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.VectorData) */ {
+ public:
+  VectorData();
+  virtual ~VectorData();
+
+  VectorData(const VectorData& from);
+  VectorData(VectorData&& from) noexcept
+    : VectorData() {
+    *this = ::std::move(from);
+  }
+
+  inline VectorData& operator=(const VectorData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VectorData& operator=(VectorData&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const VectorData& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const VectorData* internal_default_instance() {
+    return reinterpret_cast<const VectorData*>(
+               &_VectorData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(VectorData& a, VectorData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VectorData* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline VectorData* New() const final {
+    return CreateMaybeMessage<VectorData>(nullptr);
+  }
+
+  VectorData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<VectorData>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const VectorData& from);
+  void MergeFrom(const VectorData& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VectorData* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.VectorData";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatusFieldNumber = 1,
+    kVectorDataFieldNumber = 2,
+  };
+  // .milvus.grpc.Status status = 1;
+  bool has_status() const;
+  void clear_status();
+  const ::milvus::grpc::Status& status() const;
+  ::milvus::grpc::Status* release_status();
+  ::milvus::grpc::Status* mutable_status();
+  void set_allocated_status(::milvus::grpc::Status* status);
+
+  // .milvus.grpc.RowRecord vector_data = 2;
+  bool has_vector_data() const;
+  void clear_vector_data();
+  const ::milvus::grpc::RowRecord& vector_data() const;
+  ::milvus::grpc::RowRecord* release_vector_data();
+  ::milvus::grpc::RowRecord* mutable_vector_data();
+  void set_allocated_vector_data(::milvus::grpc::RowRecord* vector_data);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.VectorData)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::milvus::grpc::Status* status_;
+  ::milvus::grpc::RowRecord* vector_data_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SearchByIDParam :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.SearchByIDParam) */ {
+ public:
+  SearchByIDParam();
+  virtual ~SearchByIDParam();
+
+  SearchByIDParam(const SearchByIDParam& from);
+  SearchByIDParam(SearchByIDParam&& from) noexcept
+    : SearchByIDParam() {
+    *this = ::std::move(from);
+  }
+
+  inline SearchByIDParam& operator=(const SearchByIDParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SearchByIDParam& operator=(SearchByIDParam&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SearchByIDParam& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SearchByIDParam* internal_default_instance() {
+    return reinterpret_cast<const SearchByIDParam*>(
+               &_SearchByIDParam_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(SearchByIDParam& a, SearchByIDParam& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SearchByIDParam* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SearchByIDParam* New() const final {
+    return CreateMaybeMessage<SearchByIDParam>(nullptr);
+  }
+
+  SearchByIDParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SearchByIDParam>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SearchByIDParam& from);
+  void MergeFrom(const SearchByIDParam& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SearchByIDParam* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.SearchByIDParam";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueryRangeArrayFieldNumber = 3,
+    kTableNameFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kTopkFieldNumber = 4,
+    kNprobeFieldNumber = 5,
+  };
+  // repeated .milvus.grpc.Range query_range_array = 3;
+  int query_range_array_size() const;
+  void clear_query_range_array();
+  ::milvus::grpc::Range* mutable_query_range_array(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::Range >*
+      mutable_query_range_array();
+  const ::milvus::grpc::Range& query_range_array(int index) const;
+  ::milvus::grpc::Range* add_query_range_array();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::Range >&
+      query_range_array() const;
+
+  // string table_name = 1;
+  void clear_table_name();
+  const std::string& table_name() const;
+  void set_table_name(const std::string& value);
+  void set_table_name(std::string&& value);
+  void set_table_name(const char* value);
+  void set_table_name(const char* value, size_t size);
+  std::string* mutable_table_name();
+  std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+
+  // int64 id = 2;
+  void clear_id();
+  ::PROTOBUF_NAMESPACE_ID::int64 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // int64 topk = 4;
+  void clear_topk();
+  ::PROTOBUF_NAMESPACE_ID::int64 topk() const;
+  void set_topk(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // int64 nprobe = 5;
+  void clear_nprobe();
+  ::PROTOBUF_NAMESPACE_ID::int64 nprobe() const;
+  void set_nprobe(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.SearchByIDParam)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::Range > query_range_array_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+  ::PROTOBUF_NAMESPACE_ID::int64 id_;
+  ::PROTOBUF_NAMESPACE_ID::int64 topk_;
+  ::PROTOBUF_NAMESPACE_ID::int64 nprobe_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TableName
 
 // string table_name = 1;
 inline void TableName::clear_table_name() {
@@ -2881,6 +3740,75 @@ TableNameList::mutable_table_names() {
 
 // -------------------------------------------------------------------
 
+// AttrField
+
+// string name = 1;
+inline void AttrField::clear_name() {
+  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& AttrField::name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.AttrField.name)
+  return name_.GetNoArena();
+}
+inline void AttrField::set_name(const std::string& value) {
+  
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.AttrField.name)
+}
+inline void AttrField::set_name(std::string&& value) {
+  
+  name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.AttrField.name)
+}
+inline void AttrField::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.AttrField.name)
+}
+inline void AttrField::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.AttrField.name)
+}
+inline std::string* AttrField::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.AttrField.name)
+  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* AttrField::release_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.AttrField.name)
+  
+  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void AttrField::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.AttrField.name)
+}
+
+// int32 type = 2;
+inline void AttrField::clear_type() {
+  type_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 AttrField::type() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.AttrField.type)
+  return type_;
+}
+inline void AttrField::set_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  type_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.AttrField.type)
+}
+
+// -------------------------------------------------------------------
+
 // TableSchema
 
 // .milvus.grpc.Status status = 1;
@@ -3021,6 +3949,36 @@ inline void TableSchema::set_metric_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
   // @@protoc_insertion_point(field_set:milvus.grpc.TableSchema.metric_type)
 }
 
+// repeated .milvus.grpc.AttrField attr_field_array = 6;
+inline int TableSchema::attr_field_array_size() const {
+  return attr_field_array_.size();
+}
+inline void TableSchema::clear_attr_field_array() {
+  attr_field_array_.Clear();
+}
+inline ::milvus::grpc::AttrField* TableSchema::mutable_attr_field_array(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.TableSchema.attr_field_array)
+  return attr_field_array_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrField >*
+TableSchema::mutable_attr_field_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.TableSchema.attr_field_array)
+  return &attr_field_array_;
+}
+inline const ::milvus::grpc::AttrField& TableSchema::attr_field_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.TableSchema.attr_field_array)
+  return attr_field_array_.Get(index);
+}
+inline ::milvus::grpc::AttrField* TableSchema::add_attr_field_array() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.TableSchema.attr_field_array)
+  return attr_field_array_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrField >&
+TableSchema::attr_field_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.TableSchema.attr_field_array)
+  return attr_field_array_;
+}
+
 // -------------------------------------------------------------------
 
 // Range
@@ -3168,6 +4126,121 @@ RowRecord::mutable_vector_data() {
 
 // -------------------------------------------------------------------
 
+// AttrColumn
+
+// string name = 1;
+inline void AttrColumn::clear_name() {
+  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& AttrColumn::name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.AttrColumn.name)
+  return name_.GetNoArena();
+}
+inline void AttrColumn::set_name(const std::string& value) {
+  
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.AttrColumn.name)
+}
+inline void AttrColumn::set_name(std::string&& value) {
+  
+  name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.AttrColumn.name)
+}
+inline void AttrColumn::set_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.AttrColumn.name)
+}
+inline void AttrColumn::set_name(const char* value, size_t size) {
+  
+  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.AttrColumn.name)
+}
+inline std::string* AttrColumn::mutable_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.AttrColumn.name)
+  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* AttrColumn::release_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.AttrColumn.name)
+  
+  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void AttrColumn::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.AttrColumn.name)
+}
+
+// repeated int64 int_value_array = 2;
+inline int AttrColumn::int_value_array_size() const {
+  return int_value_array_.size();
+}
+inline void AttrColumn::clear_int_value_array() {
+  int_value_array_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 AttrColumn::int_value_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.AttrColumn.int_value_array)
+  return int_value_array_.Get(index);
+}
+inline void AttrColumn::set_int_value_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  int_value_array_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.AttrColumn.int_value_array)
+}
+inline void AttrColumn::add_int_value_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  int_value_array_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.AttrColumn.int_value_array)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+AttrColumn::int_value_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.AttrColumn.int_value_array)
+  return int_value_array_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+AttrColumn::mutable_int_value_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.AttrColumn.int_value_array)
+  return &int_value_array_;
+}
+
+// repeated double double_value_array = 3;
+inline int AttrColumn::double_value_array_size() const {
+  return double_value_array_.size();
+}
+inline void AttrColumn::clear_double_value_array() {
+  double_value_array_.Clear();
+}
+inline double AttrColumn::double_value_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.AttrColumn.double_value_array)
+  return double_value_array_.Get(index);
+}
+inline void AttrColumn::set_double_value_array(int index, double value) {
+  double_value_array_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.AttrColumn.double_value_array)
+}
+inline void AttrColumn::add_double_value_array(double value) {
+  double_value_array_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.AttrColumn.double_value_array)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+AttrColumn::double_value_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.AttrColumn.double_value_array)
+  return double_value_array_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+AttrColumn::mutable_double_value_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.AttrColumn.double_value_array)
+  return &double_value_array_;
+}
+
+// -------------------------------------------------------------------
+
 // InsertParam
 
 // string table_name = 1;
@@ -3275,15 +4348,96 @@ inline void InsertParam::add_row_id_array(std::vector<::PROTOBUF_NAMESPACE_ID::i
     row_id_array_.Add(begin, end);
     // @@protoc_insertion_point(field_add:milvus.grpc.InsertParam.row_id_array)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
-InsertParam::row_id_array() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.InsertParam.row_id_array)
-  return row_id_array_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+InsertParam::row_id_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.InsertParam.row_id_array)
+  return row_id_array_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+InsertParam::mutable_row_id_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.InsertParam.row_id_array)
+  return &row_id_array_;
+}
+
+// repeated .milvus.grpc.AttrColumn attr_column_array = 4;
+inline int InsertParam::attr_column_array_size() const {
+  return attr_column_array_.size();
+}
+inline void InsertParam::clear_attr_column_array() {
+  attr_column_array_.Clear();
+}
+inline ::milvus::grpc::AttrColumn* InsertParam::mutable_attr_column_array(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertParam.attr_column_array)
+  return attr_column_array_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrColumn >*
+InsertParam::mutable_attr_column_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.InsertParam.attr_column_array)
+  return &attr_column_array_;
+}
+inline const ::milvus::grpc::AttrColumn& InsertParam::attr_column_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertParam.attr_column_array)
+  return attr_column_array_.Get(index);
+}
+inline ::milvus::grpc::AttrColumn* InsertParam::add_attr_column_array() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.InsertParam.attr_column_array)
+  return attr_column_array_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::AttrColumn >&
+InsertParam::attr_column_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.InsertParam.attr_column_array)
+  return attr_column_array_;
+}
+
+// string partition_tag = 5;
+inline void InsertParam::clear_partition_tag() {
+  partition_tag_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& InsertParam::partition_tag() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertParam.partition_tag)
+  return partition_tag_.GetNoArena();
+}
+inline void InsertParam::set_partition_tag(const std::string& value) {
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertParam.partition_tag)
+}
+inline void InsertParam::set_partition_tag(std::string&& value) {
+  
+  partition_tag_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.InsertParam.partition_tag)
+}
+inline void InsertParam::set_partition_tag(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.InsertParam.partition_tag)
+}
+inline void InsertParam::set_partition_tag(const char* value, size_t size) {
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.InsertParam.partition_tag)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
-InsertParam::mutable_row_id_array() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.InsertParam.row_id_array)
-  return &row_id_array_;
+inline std::string* InsertParam::mutable_partition_tag() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertParam.partition_tag)
+  return partition_tag_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* InsertParam::release_partition_tag() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.InsertParam.partition_tag)
+  
+  return partition_tag_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void InsertParam::set_allocated_partition_tag(std::string* partition_tag) {
+  if (partition_tag != nullptr) {
+    
+  } else {
+    
+  }
+  partition_tag_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), partition_tag);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.InsertParam.partition_tag)
 }
 
 // -------------------------------------------------------------------
@@ -3508,6 +4662,122 @@ inline void SearchParam::set_nprobe(::PROTOBUF_NAMESPACE_ID::int64 value) {
   // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.nprobe)
 }
 
+// string filter = 6;
+inline void SearchParam::clear_filter() {
+  filter_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& SearchParam::filter() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchParam.filter)
+  return filter_.GetNoArena();
+}
+inline void SearchParam::set_filter(const std::string& value) {
+  
+  filter_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.filter)
+}
+inline void SearchParam::set_filter(std::string&& value) {
+  
+  filter_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.SearchParam.filter)
+}
+inline void SearchParam::set_filter(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  filter_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.SearchParam.filter)
+}
+inline void SearchParam::set_filter(const char* value, size_t size) {
+  
+  filter_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.SearchParam.filter)
+}
+inline std::string* SearchParam::mutable_filter() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.SearchParam.filter)
+  return filter_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* SearchParam::release_filter() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.SearchParam.filter)
+  
+  return filter_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void SearchParam::set_allocated_filter(std::string* filter) {
+  if (filter != nullptr) {
+    
+  } else {
+    
+  }
+  filter_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), filter);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.SearchParam.filter)
+}
+
+// repeated string partition_tag_array = 7;
+inline int SearchParam::partition_tag_array_size() const {
+  return partition_tag_array_.size();
+}
+inline void SearchParam::clear_partition_tag_array() {
+  partition_tag_array_.Clear();
+}
+inline const std::string& SearchParam::partition_tag_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchParam.partition_tag_array)
+  return partition_tag_array_.Get(index);
+}
+inline std::string* SearchParam::mutable_partition_tag_array(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.SearchParam.partition_tag_array)
+  return partition_tag_array_.Mutable(index);
+}
+inline void SearchParam::set_partition_tag_array(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.partition_tag_array)
+  partition_tag_array_.Mutable(index)->assign(value);
+}
+inline void SearchParam::set_partition_tag_array(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.partition_tag_array)
+  partition_tag_array_.Mutable(index)->assign(std::move(value));
+}
+inline void SearchParam::set_partition_tag_array(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  partition_tag_array_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.SearchParam.partition_tag_array)
+}
+inline void SearchParam::set_partition_tag_array(int index, const char* value, size_t size) {
+  partition_tag_array_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.SearchParam.partition_tag_array)
+}
+inline std::string* SearchParam::add_partition_tag_array() {
+  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.SearchParam.partition_tag_array)
+  return partition_tag_array_.Add();
+}
+inline void SearchParam::add_partition_tag_array(const std::string& value) {
+  partition_tag_array_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.SearchParam.partition_tag_array)
+}
+inline void SearchParam::add_partition_tag_array(std::string&& value) {
+  partition_tag_array_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:milvus.grpc.SearchParam.partition_tag_array)
+}
+inline void SearchParam::add_partition_tag_array(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  partition_tag_array_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:milvus.grpc.SearchParam.partition_tag_array)
+}
+inline void SearchParam::add_partition_tag_array(const char* value, size_t size) {
+  partition_tag_array_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.SearchParam.partition_tag_array)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SearchParam::partition_tag_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.SearchParam.partition_tag_array)
+  return partition_tag_array_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SearchParam::mutable_partition_tag_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.SearchParam.partition_tag_array)
+  return &partition_tag_array_;
+}
+
 // -------------------------------------------------------------------
 
 // SearchInFilesParam
@@ -4330,6 +5600,302 @@ inline void DeleteByRangeParam::set_allocated_table_name(std::string* table_name
   // @@protoc_insertion_point(field_set_allocated:milvus.grpc.DeleteByRangeParam.table_name)
 }
 
+// -------------------------------------------------------------------
+
+// VectorIdentity
+
+// string table_name = 1;
+inline void VectorIdentity::clear_table_name() {
+  table_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& VectorIdentity::table_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.VectorIdentity.table_name)
+  return table_name_.GetNoArena();
+}
+inline void VectorIdentity::set_table_name(const std::string& value) {
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.VectorIdentity.table_name)
+}
+inline void VectorIdentity::set_table_name(std::string&& value) {
+  
+  table_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.VectorIdentity.table_name)
+}
+inline void VectorIdentity::set_table_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.VectorIdentity.table_name)
+}
+inline void VectorIdentity::set_table_name(const char* value, size_t size) {
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.VectorIdentity.table_name)
+}
+inline std::string* VectorIdentity::mutable_table_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.VectorIdentity.table_name)
+  return table_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* VectorIdentity::release_table_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.VectorIdentity.table_name)
+  
+  return table_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void VectorIdentity::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    
+  } else {
+    
+  }
+  table_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), table_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.VectorIdentity.table_name)
+}
+
+// int64 id = 2;
+inline void VectorIdentity::clear_id() {
+  id_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 VectorIdentity::id() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.VectorIdentity.id)
+  return id_;
+}
+inline void VectorIdentity::set_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  id_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.VectorIdentity.id)
+}
+
+// -------------------------------------------------------------------
+
+// VectorData
+
+// .milvus.grpc.Status status = 1;
+inline bool VectorData::has_status() const {
+  return this != internal_default_instance() && status_ != nullptr;
+}
+inline const ::milvus::grpc::Status& VectorData::status() const {
+  const ::milvus::grpc::Status* p = status_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.VectorData.status)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
+      &::milvus::grpc::_Status_default_instance_);
+}
+inline ::milvus::grpc::Status* VectorData::release_status() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.VectorData.status)
+  
+  ::milvus::grpc::Status* temp = status_;
+  status_ = nullptr;
+  return temp;
+}
+inline ::milvus::grpc::Status* VectorData::mutable_status() {
+  
+  if (status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
+    status_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.VectorData.status)
+  return status_;
+}
+inline void VectorData::set_allocated_status(::milvus::grpc::Status* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
+  }
+  if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  status_ = status;
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.VectorData.status)
+}
+
+// .milvus.grpc.RowRecord vector_data = 2;
+inline bool VectorData::has_vector_data() const {
+  return this != internal_default_instance() && vector_data_ != nullptr;
+}
+inline void VectorData::clear_vector_data() {
+  if (GetArenaNoVirtual() == nullptr && vector_data_ != nullptr) {
+    delete vector_data_;
+  }
+  vector_data_ = nullptr;
+}
+inline const ::milvus::grpc::RowRecord& VectorData::vector_data() const {
+  const ::milvus::grpc::RowRecord* p = vector_data_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.VectorData.vector_data)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::RowRecord*>(
+      &::milvus::grpc::_RowRecord_default_instance_);
+}
+inline ::milvus::grpc::RowRecord* VectorData::release_vector_data() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.VectorData.vector_data)
+  
+  ::milvus::grpc::RowRecord* temp = vector_data_;
+  vector_data_ = nullptr;
+  return temp;
+}
+inline ::milvus::grpc::RowRecord* VectorData::mutable_vector_data() {
+  
+  if (vector_data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::RowRecord>(GetArenaNoVirtual());
+    vector_data_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.VectorData.vector_data)
+  return vector_data_;
+}
+inline void VectorData::set_allocated_vector_data(::milvus::grpc::RowRecord* vector_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete vector_data_;
+  }
+  if (vector_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      vector_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, vector_data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  vector_data_ = vector_data;
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.VectorData.vector_data)
+}
+
+// -------------------------------------------------------------------
+
+// SearchByIDParam
+
+// string table_name = 1;
+inline void SearchByIDParam::clear_table_name() {
+  table_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& SearchByIDParam::table_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchByIDParam.table_name)
+  return table_name_.GetNoArena();
+}
+inline void SearchByIDParam::set_table_name(const std::string& value) {
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchByIDParam.table_name)
+}
+inline void SearchByIDParam::set_table_name(std::string&& value) {
+  
+  table_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.SearchByIDParam.table_name)
+}
+inline void SearchByIDParam::set_table_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.SearchByIDParam.table_name)
+}
+inline void SearchByIDParam::set_table_name(const char* value, size_t size) {
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.SearchByIDParam.table_name)
+}
+inline std::string* SearchByIDParam::mutable_table_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.SearchByIDParam.table_name)
+  return table_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* SearchByIDParam::release_table_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.SearchByIDParam.table_name)
+  
+  return table_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void SearchByIDParam::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    
+  } else {
+    
+  }
+  table_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), table_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.SearchByIDParam.table_name)
+}
+
+// int64 id = 2;
+inline void SearchByIDParam::clear_id() {
+  id_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 SearchByIDParam::id() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchByIDParam.id)
+  return id_;
+}
+inline void SearchByIDParam::set_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  id_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchByIDParam.id)
+}
+
+// repeated .milvus.grpc.Range query_range_array = 3;
+inline int SearchByIDParam::query_range_array_size() const {
+  return query_range_array_.size();
+}
+inline void SearchByIDParam::clear_query_range_array() {
+  query_range_array_.Clear();
+}
+inline ::milvus::grpc::Range* SearchByIDParam::mutable_query_range_array(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.SearchByIDParam.query_range_array)
+  return query_range_array_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::Range >*
+SearchByIDParam::mutable_query_range_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.SearchByIDParam.query_range_array)
+  return &query_range_array_;
+}
+inline const ::milvus::grpc::Range& SearchByIDParam::query_range_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchByIDParam.query_range_array)
+  return query_range_array_.Get(index);
+}
+inline ::milvus::grpc::Range* SearchByIDParam::add_query_range_array() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.SearchByIDParam.query_range_array)
+  return query_range_array_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::Range >&
+SearchByIDParam::query_range_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.SearchByIDParam.query_range_array)
+  return query_range_array_;
+}
+
+// int64 topk = 4;
+inline void SearchByIDParam::clear_topk() {
+  topk_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 SearchByIDParam::topk() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchByIDParam.topk)
+  return topk_;
+}
+inline void SearchByIDParam::set_topk(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  topk_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchByIDParam.topk)
+}
+
+// int64 nprobe = 5;
+inline void SearchByIDParam::clear_nprobe() {
+  nprobe_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 SearchByIDParam::nprobe() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchByIDParam.nprobe)
+  return nprobe_;
+}
+inline void SearchByIDParam::set_nprobe(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  nprobe_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchByIDParam.nprobe)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -4365,6 +5931,16 @@ inline void DeleteByRangeParam::set_allocated_table_name(std::string* table_name
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -94,12 +94,13 @@ enum ErrorCode : int {
   ILLEGAL_NLIST = 22,
   ILLEGAL_METRIC_TYPE = 23,
   OUT_OF_MEMORY = 24,
+  QUERY_TIMEOUT = 25,
   ErrorCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
   ErrorCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
 };
 bool ErrorCode_IsValid(int value);
 constexpr ErrorCode ErrorCode_MIN = SUCCESS;
-constexpr ErrorCode ErrorCode_MAX = OUT_OF_MEMORY;
+constexpr ErrorCode ErrorCode_MAX = QUERY_TIMEOUT;
 constexpr int ErrorCode_ARRAYSIZE = ErrorCode_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ErrorCode_descriptor();
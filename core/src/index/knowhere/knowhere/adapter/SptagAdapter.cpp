@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
+#include <limits>
+
 #include "knowhere/adapter/SptagAdapter.h"
 #include "knowhere/adapter/Structure.h"
 #include "knowhere/index/vector_index/helpers/Definitions.h"
@@ -26,13 +29,17 @@ ConvertToMetadataSet(const DatasetPtr& dataset) {
     auto array = dataset->array()[0];
     auto elems = array->length();
 
+    // SPTAG keeps referencing the metadata after BuildIndex, so the ids are copied into buffers it owns.
+    // Offsets hold elems + 1 entries and are released with delete[] by SPTAG::ByteArray.
     auto p_data = array->data()->GetValues<int64_t>(1, 0);
-    auto p_offset = (int64_t*)malloc(sizeof(int64_t) * elems);
-    for (auto i = 0; i <= elems; ++i) p_offset[i] = i * 8;
+    auto p_id = new std::uint8_t[elems * sizeof(int64_t)];
+    memcpy(p_id, p_data, elems * sizeof(int64_t));
+    auto p_offset = new std::uint8_t[(elems + 1) * sizeof(uint64_t)];
+    for (auto i = 0; i <= elems; ++i) reinterpret_cast<uint64_t*>(p_offset)[i] = i * sizeof(int64_t);
 
     std::shared_ptr<SPTAG::MetadataSet> metaset(
-        new SPTAG::MemMetadataSet(SPTAG::ByteArray((std::uint8_t*)p_data, elems * sizeof(int64_t), false),
-                                  SPTAG::ByteArray((std::uint8_t*)p_offset, elems * sizeof(int64_t), true), elems));
+        new SPTAG::MemMetadataSet(SPTAG::ByteArray(p_id, elems * sizeof(int64_t), true),
+                                  SPTAG::ByteArray(p_offset, (elems + 1) * sizeof(uint64_t), true), elems));
 
     return metaset;
 }
@@ -83,7 +90,12 @@ ConvertToDataset(std::vector<SPTAG::QueryResult> query_results) {
         auto results = query_results[i].GetResults();
         auto num_result = query_results[i].GetResultNum();
         for (auto j = 0; j < num_result; ++j) {
-            //            p_id[i * k + j] = results[j].VID;
+            // less than k neighbors found, padded like the faiss indexes do
+            if (results[j].VID < 0) {
+                p_id[i * k + j] = -1;
+                p_dist[i * k + j] = std::numeric_limits<float>::max();
+                continue;
+            }
             p_id[i * k + j] = *(int64_t*)query_results[i].GetMetadata(j).Data();
             p_dist[i * k + j] = results[j].Dist;
         }
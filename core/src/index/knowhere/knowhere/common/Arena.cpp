@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "knowhere/common/Arena.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace knowhere {
+
+namespace {
+
+constexpr size_t SCRATCH_ALIGN = 64;
+constexpr size_t SCRATCH_BLOCK_SIZE = 256 * 1024;
+// memory kept by an idle thread, a rare huge query should not pin its buffers forever
+constexpr size_t SCRATCH_RETAIN_LIMIT = 64 * 1024 * 1024;
+
+}  // namespace
+
+ScratchArena::Block
+ScratchArena::NewBlock(size_t size) {
+    // new[] of uint8_t only guarantees max_align_t, over-allocate to align the start
+    size += SCRATCH_ALIGN;
+    Block block{std::unique_ptr<uint8_t[]>(new uint8_t[size]), size, 0};
+    auto base = reinterpret_cast<uintptr_t>(block.data.get());
+    block.begin = (SCRATCH_ALIGN - base % SCRATCH_ALIGN) % SCRATCH_ALIGN;
+    return block;
+}
+
+ScratchArena&
+ScratchArena::GetInstance() {
+    static thread_local ScratchArena arena;
+    return arena;
+}
+
+void*
+ScratchArena::Allocate(size_t size) {
+    if (depth_ <= 0) {
+        return nullptr;
+    }
+
+    size = (size + SCRATCH_ALIGN - 1) / SCRATCH_ALIGN * SCRATCH_ALIGN;
+    while (block_index_ < blocks_.size()) {
+        auto& block = blocks_[block_index_];
+        if (offset_ + size <= block.size) {
+            void* ptr = block.data.get() + offset_;
+            offset_ += size;
+            return ptr;
+        }
+        if (++block_index_ < blocks_.size()) {
+            offset_ = blocks_[block_index_].begin;
+        }
+    }
+
+    blocks_.emplace_back(NewBlock(std::max(SCRATCH_BLOCK_SIZE, size)));
+    block_index_ = blocks_.size() - 1;
+    offset_ = blocks_.back().begin;
+
+    void* ptr = blocks_.back().data.get() + offset_;
+    offset_ += size;
+    return ptr;
+}
+
+size_t
+ScratchArena::Reserved() const {
+    size_t reserved = 0;
+    for (auto& block : blocks_) {
+        reserved += block.size;
+    }
+    return reserved;
+}
+
+void
+ScratchArena::Enter() {
+    ++depth_;
+}
+
+void
+ScratchArena::Leave() {
+    if (--depth_ > 0) {
+        return;
+    }
+
+    // merge the blocks of a grown arena into one, the next query of the same shape fits a single block
+    size_t reserved = Reserved();
+    if (reserved > SCRATCH_RETAIN_LIMIT) {
+        blocks_.clear();
+    } else if (blocks_.size() > 1) {
+        blocks_.clear();
+        blocks_.emplace_back(NewBlock(reserved));
+    }
+    block_index_ = 0;
+    offset_ = blocks_.empty() ? 0 : blocks_[0].begin;
+}
+
+MutableBufferPtr
+MakeScratchBuffer(size_t size) {
+    auto& arena = ScratchArena::GetInstance();
+    if (arena.Active()) {
+        return MakeMutableBuffer(static_cast<uint8_t*>(arena.Allocate(size)), size);
+    }
+
+    auto data = static_cast<uint8_t*>(malloc(size));
+    if (data == nullptr) {
+        throw std::bad_alloc();
+    }
+    return MakeMutableBufferSmart(data, size);
+}
+
+}  // namespace knowhere
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "knowhere/common/Buffer.h"
+
+namespace knowhere {
+
+// Per-thread bump allocator for query scoped scratch, e.g. the result buffers of one search task.
+// Memory is only handed out inside a ScratchScope; leaving the outermost scope rewinds the arena but keeps
+// its memory, so a search thread stops calling malloc once it has served a few queries.
+class ScratchArena {
+ public:
+    // arena of the calling thread
+    static ScratchArena&
+    GetInstance();
+
+    // nullptr outside of a ScratchScope
+    void*
+    Allocate(size_t size);
+
+    bool
+    Active() const {
+        return depth_ > 0;
+    }
+
+    // bytes held by the arena, in use or not
+    size_t
+    Reserved() const;
+
+ private:
+    friend class ScratchScope;
+
+    void
+    Enter();
+
+    void
+    Leave();
+
+ private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+        size_t begin;  // padding up to the first aligned byte
+    };
+
+    static Block
+    NewBlock(size_t size);
+
+    std::vector<Block> blocks_;
+    size_t block_index_ = 0;  // block the next allocation is cut from
+    size_t offset_ = 0;       // used bytes of that block
+    int64_t depth_ = 0;
+};
+
+class ScratchScope {
+ public:
+    ScratchScope() {
+        ScratchArena::GetInstance().Enter();
+    }
+
+    ~ScratchScope() {
+        ScratchArena::GetInstance().Leave();
+    }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope&
+    operator=(const ScratchScope&) = delete;
+};
+
+// Search result buffer: arena memory inside a ScratchScope, otherwise malloc'd memory owned by the buffer.
+// Inside a scope the buffer must not outlive it
+MutableBufferPtr
+MakeScratchBuffer(size_t size);
+
+}  // namespace knowhere
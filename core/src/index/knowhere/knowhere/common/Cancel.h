@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace knowhere {
+
+// Cancellation of one query, shared by all the threads working on it. The token is cancelled explicitly or
+// once its deadline has passed; search loops poll it and stop early, the results of a cancelled search are
+// incomplete and must be discarded by the caller.
+class CancelToken {
+ public:
+    using Clock = std::chrono::steady_clock;
+
+    // no deadline, only an explicit Cancel stops the query
+    CancelToken() = default;
+
+    explicit CancelToken(Clock::time_point deadline) : has_deadline_(true), deadline_(deadline) {
+    }
+
+    void
+    Cancel() {
+        cancelled_.store(true, std::memory_order_relaxed);
+    }
+
+    bool
+    Cancelled() const {
+        return cancelled_.load(std::memory_order_relaxed) || (has_deadline_ && Clock::now() >= deadline_);
+    }
+
+    bool
+    HasDeadline() const {
+        return has_deadline_;
+    }
+
+    Clock::time_point
+    Deadline() const {
+        return deadline_;
+    }
+
+ private:
+    std::atomic<bool> cancelled_{false};
+    bool has_deadline_ = false;
+    Clock::time_point deadline_;
+};
+
+using CancelTokenPtr = std::shared_ptr<CancelToken>;
+
+// queries searched between two checks of the token, small enough to stop soon and large enough to keep
+// the threads of a batch busy
+constexpr int64_t CANCEL_CHECK_QUERIES = 64;
+
+// Makes token the cancel token of the calling thread until the scope is left. Worker threads started inside
+// the scope, e.g. by openmp, don't see it: take Current() before the parallel region.
+class CancelScope {
+ public:
+    explicit CancelScope(CancelTokenPtr token);
+
+    ~CancelScope();
+
+    CancelScope(const CancelScope&) = delete;
+    CancelScope&
+    operator=(const CancelScope&) = delete;
+
+    // token of the calling thread, nullptr outside of a scope
+    static const CancelTokenPtr&
+    Current();
+
+ private:
+    CancelTokenPtr previous_;
+};
+
+// Runs search(begin, count) over the nq queries in batches of batch_size and stops at the first batch
+// boundary once token is cancelled; without a token the queries are searched in one call.
+template <typename SearchBatch>
+void
+SearchInBatches(const CancelTokenPtr& token, int64_t nq, int64_t batch_size, SearchBatch&& search) {
+    if (token == nullptr) {
+        search(0, nq);
+        return;
+    }
+
+    for (int64_t begin = 0; begin < nq && !token->Cancelled(); begin += batch_size) {
+        search(begin, std::min(batch_size, nq - begin));
+    }
+}
+
+}  // namespace knowhere
@@ -0,0 +1,196 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "knowhere/common/HugePage.h"
+#include "knowhere/common/Log.h"
+
+#include <sys/mman.h>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+namespace knowhere {
+
+namespace {
+
+constexpr size_t HUGE_PAGE_2M = 2UL * 1024 * 1024;
+constexpr size_t HUGE_PAGE_1G = 1024UL * 1024 * 1024;
+
+enum class BlockKind { HUGETLB, MADVISE, FALLBACK };
+
+struct Block {
+    size_t length;  // mapped or allocated length, may exceed the requested size
+    BlockKind kind;
+};
+
+std::atomic<int> g_mode(static_cast<int>(HugePageMode::OFF));
+std::atomic<size_t> g_threshold(4 * 1024 * 1024);
+
+std::atomic<int64_t> g_hugetlb_bytes(0);
+std::atomic<int64_t> g_madvise_bytes(0);
+std::atomic<int64_t> g_fallback_bytes(0);
+std::atomic<int64_t> g_advised_bytes(0);
+
+// only large buffers are registered, a lookup miss in HugePageFree means plain malloc
+std::mutex g_blocks_mutex;
+std::unordered_map<void*, Block> g_blocks;
+
+size_t
+RoundUp(size_t size, size_t align) {
+    return (size + align - 1) / align * align;
+}
+
+std::atomic<int64_t>&
+Counter(BlockKind kind) {
+    switch (kind) {
+        case BlockKind::HUGETLB:
+            return g_hugetlb_bytes;
+        case BlockKind::MADVISE:
+            return g_madvise_bytes;
+        default:
+            return g_fallback_bytes;
+    }
+}
+
+void*
+MapHugeTlb(size_t size, size_t& length) {
+    // 1GB pages only when the buffer fills most of one, the pool of those is usually tiny
+    if (size >= HUGE_PAGE_1G / 2) {
+        length = RoundUp(size, HUGE_PAGE_1G);
+        void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_1GB, -1, 0);
+        if (ptr != MAP_FAILED) {
+            return ptr;
+        }
+    }
+    length = RoundUp(size, HUGE_PAGE_2M);
+    void* ptr =
+        mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_HUGE_2MB, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+}  // namespace
+
+void
+SetHugePageMode(HugePageMode mode, size_t threshold) {
+    g_mode = static_cast<int>(mode);
+    g_threshold = threshold;
+}
+
+HugePageMode
+GetHugePageMode() {
+    return static_cast<HugePageMode>(g_mode.load());
+}
+
+HugePageStats
+GetHugePageStats() {
+    HugePageStats stats;
+    stats.hugetlb_bytes = g_hugetlb_bytes;
+    stats.madvise_bytes = g_madvise_bytes;
+    stats.fallback_bytes = g_fallback_bytes;
+    stats.advised_bytes = g_advised_bytes;
+    return stats;
+}
+
+void*
+HugePageAlloc(size_t size) {
+    size = (size == 0) ? 1 : size;
+    auto mode = GetHugePageMode();
+    if (mode == HugePageMode::OFF || size < g_threshold) {
+        void* ptr = malloc(size);
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    void* ptr = nullptr;
+    Block block{0, BlockKind::FALLBACK};
+    if (mode == HugePageMode::HUGETLB) {
+        ptr = MapHugeTlb(size, block.length);
+        block.kind = BlockKind::HUGETLB;
+    }
+    if (ptr == nullptr) {
+        block.length = RoundUp(size, HUGE_PAGE_2M);
+        if (posix_memalign(&ptr, HUGE_PAGE_2M, block.length) != 0) {
+            throw std::bad_alloc();
+        }
+        // THP may be disabled system wide, the memory is still usable
+        block.kind = (madvise(ptr, block.length, MADV_HUGEPAGE) == 0) ? BlockKind::MADVISE : BlockKind::FALLBACK;
+    }
+
+    Counter(block.kind) += block.length;
+    std::lock_guard<std::mutex> lock(g_blocks_mutex);
+    g_blocks.emplace(ptr, block);
+    return ptr;
+}
+
+void
+HugePageFree(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    Block block;
+    {
+        std::lock_guard<std::mutex> lock(g_blocks_mutex);
+        auto iter = g_blocks.find(ptr);
+        if (iter == g_blocks.end()) {
+            free(ptr);
+            return;
+        }
+        block = iter->second;
+        g_blocks.erase(iter);
+    }
+
+    Counter(block.kind) -= block.length;
+    if (block.kind == BlockKind::HUGETLB) {
+        munmap(ptr, block.length);
+    } else {
+        free(ptr);
+    }
+}
+
+void
+HugePageAdvise(const void* ptr, size_t size) {
+    if (GetHugePageMode() == HugePageMode::OFF || size < g_threshold) {
+        return;
+    }
+    auto begin = RoundUp(reinterpret_cast<uintptr_t>(ptr), HUGE_PAGE_2M);
+    auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / HUGE_PAGE_2M * HUGE_PAGE_2M;
+    if (end <= begin) {
+        return;
+    }
+    if (madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) == 0) {
+        g_advised_bytes += end - begin;
+    } else {
+        KNOWHERE_LOG_DEBUG << "madvise(MADV_HUGEPAGE) failed, transparent huge pages may be disabled";
+    }
+}
+
+}  // namespace knowhere
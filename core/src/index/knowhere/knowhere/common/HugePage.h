@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+namespace knowhere {
+
+enum class HugePageMode {
+    OFF = 0,
+    MADVISE,   // 2MB aligned memory advised for transparent huge pages
+    HUGETLB,   // explicit 2MB/1GB pages from the hugetlbfs pool, falls back to MADVISE when the pool is empty
+};
+
+struct HugePageStats {
+    int64_t hugetlb_bytes = 0;   // live bytes backed by hugetlbfs pages
+    int64_t madvise_bytes = 0;   // live bytes allocated aligned and advised for THP
+    int64_t fallback_bytes = 0;  // live bytes of large buffers that got plain heap memory
+    int64_t advised_bytes = 0;   // cumulative bytes of foreign buffers (e.g. faiss vectors) advised after load
+};
+
+// Buffers below threshold bytes always use malloc, huge pages only pay off for index sized data
+void
+SetHugePageMode(HugePageMode mode, size_t threshold = 4 * 1024 * 1024);
+
+HugePageMode
+GetHugePageMode();
+
+HugePageStats
+GetHugePageStats();
+
+// Never returns nullptr, throws std::bad_alloc. Memory must be released by HugePageFree
+void*
+HugePageAlloc(size_t size);
+
+void
+HugePageFree(void* ptr);
+
+// Advise the 2MB aligned interior of a buffer owned elsewhere for transparent huge pages
+void
+HugePageAdvise(const void* ptr, size_t size);
+
+template <typename T>
+struct HugePageAllocator {
+    using value_type = T;
+
+    HugePageAllocator() = default;
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&) {
+    }
+
+    T*
+    allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(HugePageAlloc(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T* ptr, size_t) {
+        HugePageFree(ptr);
+    }
+};
+
+// typed HugePageAlloc for arrays of trivial types, released by HugePageFree
+template <typename T>
+T*
+HugePageAllocArray(size_t n) {
+    return HugePageAllocator<T>().allocate(n);
+}
+
+template <typename T, typename U>
+bool
+operator==(const HugePageAllocator<T>&, const HugePageAllocator<U>&) {
+    return true;
+}
+
+template <typename T, typename U>
+bool
+operator!=(const HugePageAllocator<T>&, const HugePageAllocator<U>&) {
+    return false;
+}
+
+}  // namespace knowhere
@@ -15,16 +15,47 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <faiss/IndexFlat.h>
+#include <faiss/IndexIVF.h>
+#include <faiss/InvertedLists.h>
+#include <faiss/MetaIndexes.h>
 #include <faiss/index_io.h>
 #include <utility>
 
 #include "knowhere/common/Exception.h"
+#include "knowhere/common/HugePage.h"
 #include "knowhere/index/vector_index/FaissBaseIndex.h"
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/helpers/FaissIO.h"
 
 namespace knowhere {
 
+namespace {
+
+// faiss owns these vectors, so they can't come from HugePageAlloc; advise the big ones in place instead
+void
+AdviseHugePages(const faiss::Index* index) {
+    if (GetHugePageMode() == HugePageMode::OFF) {
+        return;
+    }
+
+    if (auto id_map = dynamic_cast<const faiss::IndexIDMap*>(index)) {
+        index = id_map->index;
+    }
+    if (auto flat = dynamic_cast<const faiss::IndexFlat*>(index)) {
+        HugePageAdvise(flat->xb.data(), flat->xb.size() * sizeof(float));
+        return;
+    }
+    if (auto ivf = dynamic_cast<const faiss::IndexIVF*>(index)) {
+        auto lists = dynamic_cast<const faiss::ArrayInvertedLists*>(ivf->invlists);
+        for (size_t i = 0; lists != nullptr && i < lists->nlist; ++i) {
+            HugePageAdvise(lists->codes[i].data(), lists->codes[i].size());
+        }
+    }
+}
+
+}  // namespace
+
 FaissBaseIndex::FaissBaseIndex(std::shared_ptr<faiss::Index> index) : index_(std::move(index)) {
 }
 
@@ -58,6 +89,7 @@ FaissBaseIndex::LoadImpl(const BinarySet& index_binary) {
     reader.data_ = binary->data.get();
 
     faiss::Index* index = faiss::read_index(&reader);
+    AdviseHugePages(index);
 
     index_.reset(index);
 }
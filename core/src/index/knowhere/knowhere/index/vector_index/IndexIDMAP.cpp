@@ -24,6 +24,8 @@
 #include <vector>
 
 #include "knowhere/adapter/VectorAdapter.h"
+#include "knowhere/common/Arena.h"
+#include "knowhere/common/Cancel.h"
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
 #include "knowhere/index/vector_index/helpers/FaissIO.h"
@@ -60,14 +62,13 @@ IDMAP::Search(const DatasetPtr& dataset, const Config& config) {
     GETTENSOR(dataset)
 
     auto elems = rows * config->k;
-    auto res_ids = (int64_t*)malloc(sizeof(int64_t) * elems);
-    auto res_dis = (float*)malloc(sizeof(float) * elems);
+    auto id_buf = MakeScratchBuffer(sizeof(int64_t) * elems);
+    auto dist_buf = MakeScratchBuffer(sizeof(float) * elems);
+    auto res_ids = reinterpret_cast<int64_t*>(id_buf->mutable_data());
+    auto res_dis = reinterpret_cast<float*>(dist_buf->mutable_data());
 
     search_impl(rows, (float*)p_data, config->k, res_dis, res_ids, Config());
 
-    auto id_buf = MakeMutableBufferSmart((uint8_t*)res_ids, sizeof(int64_t) * elems);
-    auto dist_buf = MakeMutableBufferSmart((uint8_t*)res_dis, sizeof(float) * elems);
-
     std::vector<BufferPtr> id_bufs{nullptr, id_buf};
     std::vector<BufferPtr> dist_bufs{nullptr, dist_buf};
 
@@ -86,7 +87,9 @@ IDMAP::Search(const DatasetPtr& dataset, const Config& config) {
 
 void
 IDMAP::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) {
-    index_->search(n, (float*)data, k, distances, labels);
+    SearchInBatches(CancelScope::Current(), n, CANCEL_CHECK_QUERIES, [&](int64_t begin, int64_t count) {
+        index_->search(count, data + begin * index_->d, k, distances + begin * k, labels + begin * k);
+    });
 }
 
 void
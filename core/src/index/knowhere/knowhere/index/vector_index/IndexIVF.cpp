@@ -19,14 +19,27 @@
 #include <faiss/IndexFlat.h>
 #include <faiss/IndexIVF.h>
 #include <faiss/IndexIVFFlat.h>
+#include <faiss/IndexScalarQuantizer.h>
+#include <faiss/InvertedLists.h>
+#include <faiss/OnDiskInvertedLists.h>
 #include <faiss/gpu/GpuCloner.h>
+#include <faiss/impl/io.h>
+#include <faiss/index_io.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <memory>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
 #include "knowhere/adapter/VectorAdapter.h"
+#include "knowhere/common/Arena.h"
+#include "knowhere/common/Cancel.h"
 #include "knowhere/common/Exception.h"
 #include "knowhere/common/Log.h"
 #include "knowhere/index/vector_index/IndexGPUIVF.h"
@@ -36,6 +49,33 @@ namespace knowhere {
 
 using stdclock = std::chrono::high_resolution_clock;
 
+namespace {
+// copy the lists into a growable in-memory layout, whatever layout they are read from
+void
+LoadListsToMemory(faiss::IndexIVF* ivf) {
+    if (dynamic_cast<faiss::ArrayInvertedLists*>(ivf->invlists) != nullptr) {
+        return;
+    }
+
+    auto lists = new faiss::ArrayInvertedLists(ivf->nlist, ivf->code_size);
+    for (size_t l = 0; l < ivf->nlist; ++l) {
+        auto size = ivf->invlists->list_size(l);
+        if (size > 0) {
+            faiss::InvertedLists::ScopedCodes codes(ivf->invlists, l);
+            faiss::InvertedLists::ScopedIds ids(ivf->invlists, l);
+            lists->add_entries(l, size, ids.get(), codes.get());
+        }
+    }
+    ivf->replace_invlists(lists, true);
+}
+
+const faiss::OnDiskInvertedLists*
+GetMappedLists(const faiss::Index* index) {
+    auto ivf = dynamic_cast<const faiss::IndexIVF*>(index);
+    return ivf != nullptr ? dynamic_cast<const faiss::OnDiskInvertedLists*>(ivf->invlists) : nullptr;
+}
+}  // namespace
+
 IndexModelPtr
 IVF::Train(const DatasetPtr& dataset, const Config& config) {
     auto build_cfg = std::dynamic_pointer_cast<IVFCfg>(config);
@@ -87,6 +127,10 @@ IVF::Serialize() {
     }
 
     std::lock_guard<std::mutex> lk(mutex_);
+    if (GetMappedLists(index_.get()) != nullptr) {
+        // faiss would only write a reference to the mapped file
+        LoadListsToMemory(dynamic_cast<faiss::IndexIVF*>(index_.get()));
+    }
     Seal();
     return SerializeImpl();
 }
@@ -97,6 +141,80 @@ IVF::Load(const BinarySet& index_binary) {
     LoadImpl(index_binary);
 }
 
+void
+IVF::LoadMapped(const std::string& location, int64_t offset) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    try {
+        faiss::FileIOReader reader(location.c_str());
+        if (fseek(reader.f, offset, SEEK_SET) != 0) {
+            KNOWHERE_THROW_MSG("can not seek to offset " + std::to_string(offset) + " of " + location);
+        }
+
+        // flat list layouts come back as OnDiskInvertedLists over a read only mapping of the whole file,
+        // only the quantizer and the per list offsets are read into memory
+        std::unique_ptr<faiss::Index> index(faiss::read_index(&reader, faiss::IO_FLAG_MMAP));
+        auto lists = GetMappedLists(index.get());
+        if (lists == nullptr) {
+            KNOWHERE_THROW_MSG("inverted lists of " + location + " can not be mapped");
+        }
+
+        // a query touches nprobe lists scattered over the file, readahead would only evict hot lists
+        madvise(lists->ptr, lists->totsize, MADV_RANDOM);
+        index_.reset(index.release());
+    } catch (KnowhereException&) {
+        throw;
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+int64_t
+IVF::MappedSize() {
+    auto lists = GetMappedLists(index_.get());
+    if (lists == nullptr) {
+        return 0;
+    }
+
+    int64_t size = 0;
+    for (auto& list : lists->lists) {
+        size += list.capacity * (sizeof(faiss::Index::idx_t) + lists->code_size);
+    }
+    return size;
+}
+
+int64_t
+IVF::ResidentSize() {
+    auto lists = GetMappedLists(index_.get());
+    if (lists == nullptr) {
+        return 0;
+    }
+
+    // the lists are laid out back to back, only their range of the mapping is counted
+    size_t begin = lists->totsize, end = 0;
+    for (auto& list : lists->lists) {
+        if (list.capacity > 0) {
+            begin = std::min(begin, list.offset);
+            end = std::max(end, list.offset + list.capacity * (sizeof(faiss::Index::idx_t) + lists->code_size));
+        }
+    }
+    if (begin >= end) {
+        return 0;
+    }
+
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    begin -= begin % page_size;
+    std::vector<unsigned char> pages((end - begin + page_size - 1) / page_size);
+    if (mincore(lists->ptr + begin, end - begin, pages.data()) != 0) {
+        return 0;
+    }
+
+    int64_t resident = 0;
+    for (auto page : pages) {
+        resident += (page & 1);
+    }
+    return std::min<int64_t>(resident * page_size, end - begin);
+}
+
 DatasetPtr
 IVF::Search(const DatasetPtr& dataset, const Config& config) {
     if (!index_ || !index_->is_trained) {
@@ -111,8 +229,10 @@ IVF::Search(const DatasetPtr& dataset, const Config& config) {
     GETTENSOR(dataset)
 
     auto elems = rows * search_cfg->k;
-    auto res_ids = (int64_t*)malloc(sizeof(int64_t) * elems);
-    auto res_dis = (float*)malloc(sizeof(float) * elems);
+    auto id_buf = MakeScratchBuffer(sizeof(int64_t) * elems);
+    auto dist_buf = MakeScratchBuffer(sizeof(float) * elems);
+    auto res_ids = reinterpret_cast<int64_t*>(id_buf->mutable_data());
+    auto res_dis = reinterpret_cast<float*>(dist_buf->mutable_data());
 
     search_impl(rows, (float*)p_data, search_cfg->k, res_dis, res_ids, config);
 
@@ -129,9 +249,6 @@ IVF::Search(const DatasetPtr& dataset, const Config& config) {
     //    std::cout << ss_res_id.str() << std::endl;
     //    std::cout << ss_res_dist.str() << std::endl << std::endl;
 
-    auto id_buf = MakeMutableBufferSmart((uint8_t*)res_ids, sizeof(int64_t) * elems);
-    auto dist_buf = MakeMutableBufferSmart((uint8_t*)res_dis, sizeof(float) * elems);
-
     std::vector<BufferPtr> id_bufs{nullptr, id_buf};
     std::vector<BufferPtr> dist_bufs{nullptr, dist_buf};
 
@@ -218,7 +335,11 @@ void
 IVF::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) {
     auto params = GenParams(cfg);
     stdclock::time_point before = stdclock::now();
-    faiss::ivflib::search_with_parameters(index_.get(), n, (float*)data, k, distances, labels, params.get());
+    // a cancelled query stops between batches, faiss can't interrupt the inverted list scan of a batch
+    SearchInBatches(CancelScope::Current(), n, CANCEL_CHECK_QUERIES, [&](int64_t begin, int64_t count) {
+        faiss::ivflib::search_with_parameters(index_.get(), count, data + begin * index_->d, k,
+                                              distances + begin * k, labels + begin * k, params.get());
+    });
     stdclock::time_point after = stdclock::now();
     double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
     KNOWHERE_LOG_DEBUG << "K=" << k << " NQ=" << n << " NL=" << faiss::indexIVF_stats.nlist
@@ -258,6 +379,136 @@ IVF::Clone_impl(const std::shared_ptr<faiss::Index>& index) {
     return std::make_shared<IVF>(index);
 }
 
+namespace {
+// codes of one index are valid in the other only with identical centroids and encoding
+bool
+SameEncoding(const faiss::IndexIVF& a, const faiss::IndexIVF& b) {
+    if (typeid(a) != typeid(b) || a.nlist != b.nlist || a.code_size != b.code_size) {
+        return false;
+    }
+
+    auto qa = dynamic_cast<const faiss::IndexFlat*>(a.quantizer);
+    auto qb = dynamic_cast<const faiss::IndexFlat*>(b.quantizer);
+    if (qa == nullptr || qb == nullptr || qa->xb.size() != qb->xb.size() ||
+        memcmp(qa->xb.data(), qb->xb.data(), sizeof(float) * qa->xb.size()) != 0) {
+        return false;
+    }
+
+    if (dynamic_cast<const faiss::IndexIVFFlat*>(&a) != nullptr) {
+        return true;
+    }
+    auto sa = dynamic_cast<const faiss::IndexIVFScalarQuantizer*>(&a);
+    auto sb = dynamic_cast<const faiss::IndexIVFScalarQuantizer*>(&b);
+    if (sa != nullptr && sb != nullptr) {
+        return sa->sq.qtype == sb->sq.qtype && sa->by_residual == sb->by_residual && sa->sq.trained == sb->sq.trained;
+    }
+    return false;  // e.g. PQ codebooks are trained per index
+}
+}  // namespace
+
+void
+IVF::Merge(const IVF& other) {
+    if (&other == this) {
+        KNOWHERE_THROW_MSG("can not merge an index into itself");
+    }
+    std::lock_guard<std::mutex> lk(mutex_);
+
+    auto ivf = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    auto other_ivf = dynamic_cast<const faiss::IndexIVF*>(other.index_.get());
+    if (ivf == nullptr || other_ivf == nullptr || !ivf->is_trained) {
+        KNOWHERE_THROW_MSG("merge needs two trained cpu ivf indexes");
+    }
+    if (ivf->d != other_ivf->d || ivf->metric_type != other_ivf->metric_type) {
+        KNOWHERE_THROW_MSG("merge needs indexes of the same dimension and metric");
+    }
+
+    // sealed or mapped lists are read only, appending needs them in a growable layout again
+    LoadListsToMemory(ivf);
+
+    auto other_lists = other_ivf->invlists;
+    if (SameEncoding(*ivf, *other_ivf)) {
+        for (size_t l = 0; l < other_ivf->nlist; ++l) {
+            auto size = other_lists->list_size(l);
+            if (size > 0) {
+                faiss::InvertedLists::ScopedCodes codes(other_lists, l);
+                faiss::InvertedLists::ScopedIds ids(other_lists, l);
+                ivf->invlists->add_entries(l, size, ids.get(), codes.get());
+            }
+        }
+        ivf->ntotal += other_ivf->ntotal;
+        return;
+    }
+
+    // flat lists hold the original floats, quantized ones would be encoded a second time with this index's
+    // ranges and centroids and lose accuracy silently
+    if (dynamic_cast<const faiss::IndexIVFFlat*>(ivf) == nullptr ||
+        dynamic_cast<const faiss::IndexIVFFlat*>(other_ivf) == nullptr) {
+        KNOWHERE_THROW_MSG("quantized indexes are only merged with the same coarse quantizer and encoding");
+    }
+
+    const size_t batch_size = 4096;
+    std::vector<float> vectors(batch_size * ivf->d);
+    std::vector<faiss::Index::idx_t> ids(batch_size);
+    size_t count = 0;
+    for (size_t l = 0; l < other_ivf->nlist; ++l) {
+        auto size = other_lists->list_size(l);
+        for (size_t offset = 0; offset < size; ++offset) {
+            other_ivf->reconstruct_from_offset(l, offset, vectors.data() + count * ivf->d);
+            ids[count] = other_lists->get_single_id(l, offset);
+            if (++count == batch_size) {
+                ivf->add_with_ids(count, vectors.data(), ids.data());
+                count = 0;
+            }
+        }
+    }
+    if (count > 0) {
+        ivf->add_with_ids(count, vectors.data(), ids.data());
+    }
+}
+
+void
+IVF::GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto ivf = dynamic_cast<const faiss::IndexIVF*>(index_.get());
+    if (ivf == nullptr) {
+        KNOWHERE_THROW_MSG("ids are only kept by cpu ivf indexes");
+    }
+
+    ids.clear();
+    slots.clear();
+    ids.reserve(ivf->ntotal);
+    slots.reserve(ivf->ntotal);
+    for (size_t l = 0; l < ivf->nlist; ++l) {
+        auto size = ivf->invlists->list_size(l);
+        if (size == 0) {
+            continue;
+        }
+        faiss::InvertedLists::ScopedIds list_ids(ivf->invlists, l);
+        for (size_t offset = 0; offset < size; ++offset) {
+            ids.push_back(list_ids[offset]);
+            slots.push_back(static_cast<int64_t>(l) << 32 | static_cast<int64_t>(offset));
+        }
+    }
+}
+
+void
+IVF::Reconstruct(int64_t slot, float* vector) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto ivf = dynamic_cast<const faiss::IndexIVF*>(index_.get());
+    if (ivf == nullptr) {
+        KNOWHERE_THROW_MSG("vectors can only be reconstructed from cpu ivf indexes");
+    }
+
+    auto list_no = slot >> 32;
+    auto offset = slot & 0xffffffff;
+    if (list_no < 0 || list_no >= static_cast<int64_t>(ivf->nlist) ||
+        offset >= static_cast<int64_t>(ivf->invlists->list_size(list_no))) {
+        KNOWHERE_THROW_MSG("slot out of range");
+    }
+    // flat lists copy the stored floats, SQ8/PQ lists decode the code
+    ivf->reconstruct_from_offset(list_no, offset, vector);
+}
+
 void
 IVF::Seal() {
     if (!index_ || !index_->is_trained) {
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -65,6 +66,19 @@ class IVF : public VectorIndex, public FaissBaseIndex {
     void
     Load(const BinarySet& index_binary) override;
 
+    // Open the faiss stream stored at offset of an index file with the inverted lists mapped
+    // instead of read, so that the OS pages in only the lists probed by queries.
+    void
+    LoadMapped(const std::string& location, int64_t offset);
+
+    // bytes of inverted lists left on disk by LoadMapped, 0 for an index held in memory
+    int64_t
+    MappedSize();
+
+    // bytes of the mapped file currently in the page cache
+    int64_t
+    ResidentSize();
+
     int64_t
     Count() override;
 
@@ -77,6 +91,22 @@ class IVF : public VectorIndex, public FaissBaseIndex {
     virtual VectorIndexPtr
     CopyCpuToGpu(const int64_t& device_id, const Config& config);
 
+    // Append every entry of other without retraining. Inverted lists are concatenated when both
+    // Append the entries of other. The inverted lists are concatenated when both indexes share the coarse
+    // quantizer and the encoding; otherwise flat indexes reassign the vectors by this index's quantizer and
+    // quantized ones throw, as encoding them again would lose accuracy.
+    void
+    Merge(const IVF& other);
+
+    // Collect the id of every entry with its position in the inverted lists, packed as
+    // (list_no << 32 | offset), so that a stored vector can be located again without a search.
+    void
+    GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots);
+
+    // Decode the entry at a position returned by GetIds into d floats.
+    void
+    Reconstruct(int64_t slot, float* vector);
+
  protected:
     virtual std::shared_ptr<faiss::IVFSearchParameters>
     GenParams(const Config& config);
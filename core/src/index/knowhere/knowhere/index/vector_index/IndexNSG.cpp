@@ -15,8 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+
 #include "knowhere/index/vector_index/IndexNSG.h"
 #include "knowhere/adapter/VectorAdapter.h"
+#include "knowhere/common/Arena.h"
 #include "knowhere/common/Exception.h"
 #include "knowhere/common/Timer.h"
 #include "knowhere/index/vector_index/IndexGPUIVF.h"
@@ -34,7 +37,11 @@ NSG::Serialize() {
     }
 
     try {
+        // lazily deleted nodes are dropped before the graph is written, as IVF seals before serialize
+        Seal();
+
         algo::NsgIndex* index = index_.get();
+        std::shared_lock<std::shared_timed_mutex> lock(index->rw_mutex);
 
         MemoryIOWriter writer;
         algo::write_index(index, writer);
@@ -42,7 +49,8 @@ NSG::Serialize() {
         data.reset(writer.data_);
 
         BinarySet res_set;
-        res_set.Append("NSG", data, writer.total);
+        // optional trailing fields are detected by the size, so the writer's spare capacity must not be stored
+        res_set.Append("NSG", data, writer.rp);
         return res_set;
     } catch (std::exception& e) {
         KNOWHERE_THROW_MSG(e.what());
@@ -79,16 +87,16 @@ NSG::Search(const DatasetPtr& dataset, const Config& config) {
     GETTENSOR(dataset)
 
     auto elems = rows * build_cfg->k;
-    auto res_ids = (int64_t*)malloc(sizeof(int64_t) * elems);
-    auto res_dis = (float*)malloc(sizeof(float) * elems);
+    auto id_buf = MakeScratchBuffer(sizeof(int64_t) * elems);
+    auto dist_buf = MakeScratchBuffer(sizeof(float) * elems);
+    auto res_ids = reinterpret_cast<int64_t*>(id_buf->mutable_data());
+    auto res_dis = reinterpret_cast<float*>(dist_buf->mutable_data());
 
     algo::SearchParams s_params;
     s_params.search_length = build_cfg->search_length;
+    s_params.allow = build_cfg->allow;
     index_->Search((float*)p_data, rows, dim, build_cfg->k, res_dis, res_ids, s_params);
 
-    auto id_buf = MakeMutableBufferSmart((uint8_t*)res_ids, sizeof(int64_t) * elems);
-    auto dist_buf = MakeMutableBufferSmart((uint8_t*)res_dis, sizeof(float) * elems);
-
     std::vector<BufferPtr> id_bufs{nullptr, id_buf};
     std::vector<BufferPtr> dist_bufs{nullptr, dist_buf};
 
@@ -129,6 +137,8 @@ NSG::Train(const DatasetPtr& dataset, const Config& config) {
     b_params.candidate_pool_size = build_cfg->candidate_pool_size;
     b_params.out_degree = build_cfg->out_degree;
     b_params.search_length = build_cfg->search_length;
+    b_params.reorder = build_cfg->reorder;
+    b_params.memory_cap = build_cfg->build_memory_cap;
 
     GETTENSOR(dataset)
     auto array = dataset->array()[0];
@@ -142,7 +152,80 @@ NSG::Train(const DatasetPtr& dataset, const Config& config) {
 
 void
 NSG::Add(const DatasetPtr& dataset, const Config& config) {
-    // do nothing
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    // without a config the graph keeps the parameters it was built with
+    algo::BuildParams b_params{0, 0, 0};
+    auto build_cfg = std::dynamic_pointer_cast<NSGCfg>(config);
+    if (build_cfg != nullptr) {
+        b_params.search_length = std::max<int64_t>(build_cfg->search_length, 0);
+        b_params.out_degree = std::max<int64_t>(build_cfg->out_degree, 0);
+        b_params.candidate_pool_size = std::max<int64_t>(build_cfg->candidate_pool_size, 0);
+    }
+
+    GETTENSOR(dataset)
+    auto array = dataset->array()[0];
+    auto p_ids = array->data()->GetValues<int64_t>(1, 0);
+
+    index_->Add_with_ids(rows, (float*)p_data, (int64_t*)p_ids, b_params);
+}
+
+int64_t
+NSG::Delete(const int64_t* ids, int64_t n) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+    return index_->Delete_with_ids(ids, n);
+}
+
+void
+NSG::Consolidate() {
+    if (index_) {
+        index_->Consolidate();
+    }
+}
+
+void
+NSG::GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    algo::NsgIndex* index = index_.get();
+    std::shared_lock<std::shared_timed_mutex> lock(index->rw_mutex);
+    ids.clear();
+    slots.clear();
+    ids.reserve(index->ntotal - index->deleted_num);
+    slots.reserve(index->ntotal - index->deleted_num);
+    for (size_t n = 0; n < index->ntotal; ++n) {
+        if (index->IsDeleted(n)) {
+            continue;
+        }
+        ids.push_back(index->ids_[n]);
+        slots.push_back(static_cast<int64_t>(n));
+    }
+}
+
+void
+NSG::Reconstruct(int64_t slot, float* vector) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    algo::NsgIndex* index = index_.get();
+    std::shared_lock<std::shared_timed_mutex> lock(index->rw_mutex);
+    if (slot < 0 || slot >= static_cast<int64_t>(index->ntotal)) {
+        KNOWHERE_THROW_MSG("slot out of range");
+    }
+    const float* data = index->ori_data_ + slot * index->dimension;
+    std::copy(data, data + index->dimension, vector);
+}
+
+int64_t
+NSG::SearchScratchBytes() {
+    return index_ ? index_->SearchScratchBytes() : 0;
 }
 
 int64_t
@@ -162,7 +245,8 @@ NSG::Clone() {
 
 void
 NSG::Seal() {
-    // do nothing
+    // sealing before serialize is the periodic point where lazily deleted nodes are dropped
+    Consolidate();
 }
 
 }  // namespace knowhere
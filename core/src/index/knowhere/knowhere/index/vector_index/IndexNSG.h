@@ -54,6 +54,25 @@ class NSG : public VectorIndex {
     void
     Seal() override;
 
+    // lazy deletion, deleted vectors are filtered from results until Consolidate()
+    int64_t
+    Delete(const int64_t* ids, int64_t n);
+
+    void
+    Consolidate();
+
+    // Collect the id of every node not deleted with its node number, as IVF::GetIds does for list positions.
+    void
+    GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots);
+
+    // Copy the original vector of the node at a position returned by GetIds into d floats.
+    void
+    Reconstruct(int64_t slot, float* vector);
+
+    // Upper bound of the visited lists kept for concurrent searches, not part of the serialized index.
+    int64_t
+    SearchScratchBytes();
+
  private:
     std::shared_ptr<algo::NsgIndex> index_;
     int64_t gpu_;
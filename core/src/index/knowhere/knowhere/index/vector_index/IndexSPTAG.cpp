@@ -0,0 +1,222 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <SPTAG/AnnService/inc/Core/Common.h>
+#include <SPTAG/AnnService/inc/Core/VectorSet.h>
+#include <omp.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#undef mkdir
+
+#include "knowhere/adapter/SptagAdapter.h"
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/IndexSPTAG.h"
+#include "knowhere/index/vector_index/helpers/Definitions.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+#include "knowhere/index/vector_index/helpers/KDTParameterMgr.h"
+
+namespace knowhere {
+
+namespace {
+constexpr const char* SPTAG_CONFIG_BLOB = "config";
+constexpr const char* SPTAG_INDEX_BLOB = "blob_";
+}  // namespace
+
+CPUSPTAGRNG::CPUSPTAGRNG(SPTAG::IndexAlgoType algo) : algo_(algo) {
+    index_ptr_ = SPTAG::VectorIndex::CreateInstance(algo_, SPTAG::VectorValueType::Float);
+    index_ptr_->SetParameter("DistCalcMethod", "L2");
+}
+
+BinarySet
+CPUSPTAGRNG::Serialize() {
+    if (!index_ptr_ || index_ptr_->GetNumSamples() == 0) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    // SPTAG writes into caller-allocated blobs, the sizes come from CalculateBufferSize().
+    // With metadata attached the last two blobs hold the ids and their offsets.
+    auto buffer_size = index_ptr_->CalculateBufferSize();
+    std::vector<SPTAG::ByteArray> index_blobs;
+    index_blobs.reserve(buffer_size->size());
+    for (auto size : *buffer_size) {
+        index_blobs.push_back(SPTAG::ByteArray::Alloc(size));
+    }
+
+    std::string config;
+    if (index_ptr_->SaveIndex(config, index_blobs) != SPTAG::ErrorCode::Success) {
+        KNOWHERE_THROW_MSG("failed to serialize sptag index");
+    }
+
+    BinarySet binary_set;
+    for (size_t i = 0; i < index_blobs.size(); ++i) {
+        binary_set.Append(SPTAG_INDEX_BLOB + std::to_string(i), index_blobs[i].DataHolder(), index_blobs[i].Length());
+    }
+
+    std::shared_ptr<uint8_t> config_data(new uint8_t[config.size()], std::default_delete<uint8_t[]>());
+    memcpy(config_data.get(), config.data(), config.size());
+    binary_set.Append(SPTAG_CONFIG_BLOB, config_data, config.size());
+
+    return binary_set;
+}
+
+void
+CPUSPTAGRNG::Load(const BinarySet& binary_set) {
+    auto config_binary = binary_set.GetByName(SPTAG_CONFIG_BLOB);
+    std::string config(reinterpret_cast<char*>(config_binary->data.get()), config_binary->size);
+
+    std::vector<SPTAG::ByteArray> index_blobs;
+    for (size_t i = 0;; ++i) {
+        auto iter = binary_set.binary_map_.find(SPTAG_INDEX_BLOB + std::to_string(i));
+        if (iter == binary_set.binary_map_.end()) {
+            break;
+        }
+        auto& binary = iter->second;
+        index_blobs.emplace_back(binary->data.get(), binary->size, binary->data);
+    }
+
+    std::shared_ptr<SPTAG::VectorIndex> index_ptr;
+    if (SPTAG::VectorIndex::LoadIndex(config, index_blobs, index_ptr) != SPTAG::ErrorCode::Success) {
+        KNOWHERE_THROW_MSG("failed to load sptag index");
+    }
+
+    index_ptr_ = index_ptr;
+    index_binary_ = binary_set;
+}
+
+IndexModelPtr
+CPUSPTAGRNG::Train(const DatasetPtr& dataset, const Config& train_config) {
+    if (train_config != nullptr && train_config->metric_type == METRICTYPE::IP) {
+        KNOWHERE_THROW_MSG("sptag index only support L2 metric");
+    }
+    SetParameters(train_config);
+
+    auto vectorset = ConvertToVectorSet(dataset);
+    auto metaset = ConvertToMetadataSet(dataset);
+    if (index_ptr_->BuildIndex(vectorset, metaset) != SPTAG::ErrorCode::Success) {
+        KNOWHERE_THROW_MSG("failed to build sptag index");
+    }
+
+    // the tree and graph are built together, there is no separate model
+    return nullptr;
+}
+
+void
+CPUSPTAGRNG::Add(const DatasetPtr& dataset, const Config& add_config) {
+    // do nothing, the graph is built in Train
+}
+
+void
+CPUSPTAGRNG::SetParameter(const std::string& name, int64_t value) {
+    index_ptr_->SetParameter(name, std::to_string(value));
+}
+
+DatasetPtr
+CPUSPTAGRNG::Search(const DatasetPtr& dataset, const Config& config) {
+    if (!index_ptr_ || index_ptr_->GetNumSamples() == 0) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    std::vector<SPTAG::QueryResult> query_results = ConvertToQueryResult(dataset, config);
+
+#pragma omp parallel for
+    for (size_t i = 0; i < query_results.size(); ++i) {
+        index_ptr_->SearchIndex(query_results[i]);
+    }
+
+    return ConvertToDataset(query_results);
+}
+
+int64_t
+CPUSPTAGRNG::Count() {
+    return index_ptr_->GetNumSamples();
+}
+
+int64_t
+CPUSPTAGRNG::Dimension() {
+    return index_ptr_->GetFeatureDim();
+}
+
+VectorIndexPtr
+CPUSPTAGRNG::Clone() {
+    KNOWHERE_THROW_MSG("not support");
+}
+
+void
+CPUSPTAGRNG::Seal() {
+    // do nothing
+}
+
+void
+CPUKDTRNG::SetParameters(const Config& config) {
+    for (auto& para : KDTParameterMgr::GetInstance().GetKDTParameters()) {
+        index_ptr_->SetParameter(para.first, para.second);
+    }
+    SetParameter("NumberOfThreads", omp_get_max_threads());
+
+    auto build_cfg = std::dynamic_pointer_cast<KDTCfg>(config);
+    if (build_cfg == nullptr) {
+        return;
+    }
+    if (build_cfg->kdtnumber > 0) {
+        SetParameter("KDTNumber", build_cfg->kdtnumber);
+    }
+    if (build_cfg->tptnumber > 0) {
+        SetParameter("TPTNumber", build_cfg->tptnumber);
+    }
+    if (build_cfg->neighborhood_size > 0) {
+        SetParameter("NeighborhoodSize", build_cfg->neighborhood_size);
+    }
+    if (build_cfg->max_check > 0) {
+        SetParameter("MaxCheck", build_cfg->max_check);
+    }
+}
+
+void
+CPUBKTRNG::SetParameters(const Config& config) {
+    for (auto& para : KDTParameterMgr::GetInstance().GetBKTParameters()) {
+        index_ptr_->SetParameter(para.first, para.second);
+    }
+    SetParameter("NumberOfThreads", omp_get_max_threads());
+
+    auto build_cfg = std::dynamic_pointer_cast<BKTCfg>(config);
+    if (build_cfg == nullptr) {
+        return;
+    }
+    if (build_cfg->bktnumber > 0) {
+        SetParameter("BKTNumber", build_cfg->bktnumber);
+    }
+    if (build_cfg->bkt_kmeans_k > 0) {
+        SetParameter("BKTKmeansK", build_cfg->bkt_kmeans_k);
+    }
+    if (build_cfg->bkt_leaf_size > 0) {
+        SetParameter("BKTLeafSize", build_cfg->bkt_leaf_size);
+    }
+    if (build_cfg->tptnumber > 0) {
+        SetParameter("TPTNumber", build_cfg->tptnumber);
+    }
+    if (build_cfg->neighborhood_size > 0) {
+        SetParameter("NeighborhoodSize", build_cfg->neighborhood_size);
+    }
+    if (build_cfg->max_check > 0) {
+        SetParameter("MaxCheck", build_cfg->max_check);
+    }
+}
+
+}  // namespace knowhere
@@ -15,22 +15,23 @@
 // specific language governing permissions and limitations
 // under the License.
 
+
 #pragma once
 
 #include <SPTAG/AnnService/inc/Core/VectorIndex.h>
 #include <cstdint>
 #include <memory>
+#include <string>
+
 #include "VectorIndex.h"
-#include "knowhere/index/IndexModel.h"
 
 namespace knowhere {
 
-class CPUKDTRNG : public VectorIndex {
+// Common wrapper of the SPTAG graph indexes, KDT and BKT only differ in the tree
+// used to seed the RNG graph search and in their default build parameters.
+class CPUSPTAGRNG : public VectorIndex {
  public:
-    CPUKDTRNG() {
-        index_ptr_ = SPTAG::VectorIndex::CreateInstance(SPTAG::IndexAlgoType::KDT, SPTAG::VectorValueType::Float);
-        index_ptr_->SetParameter("DistCalcMethod", "L2");
-    }
+    explicit CPUSPTAGRNG(SPTAG::IndexAlgoType algo);
 
  public:
     BinarySet
@@ -41,8 +42,6 @@ class CPUKDTRNG : public VectorIndex {
     Load(const BinarySet& index_array) override;
 
  public:
-    // PreprocessorPtr
-    // BuildPreprocessor(const DatasetPtr &dataset, const Config &config) override;
     int64_t
     Count() override;
     int64_t
@@ -59,29 +58,43 @@ class CPUKDTRNG : public VectorIndex {
     void
     Seal() override;
 
- private:
+ protected:
+    virtual void
+    SetParameters(const Config& config) = 0;
+
     void
-    SetParameters(const Config& config);
+    SetParameter(const std::string& name, int64_t value);
 
- private:
-    PreprocessorPtr preprocessor_;
+ protected:
+    SPTAG::IndexAlgoType algo_;
     std::shared_ptr<SPTAG::VectorIndex> index_ptr_;
-};
 
-using CPUKDTRNGPtr = std::shared_ptr<CPUKDTRNG>;
+    // a loaded index points into the blobs it was loaded from instead of copying them
+    BinarySet index_binary_;
+};
 
-class CPUKDTRNGIndexModel : public IndexModel {
+class CPUKDTRNG : public CPUSPTAGRNG {
  public:
-    BinarySet
-    Serialize() override;
+    CPUKDTRNG() : CPUSPTAGRNG(SPTAG::IndexAlgoType::KDT) {
+    }
 
+ protected:
     void
-    Load(const BinarySet& binary) override;
+    SetParameters(const Config& config) override;
+};
+
+class CPUBKTRNG : public CPUSPTAGRNG {
+ public:
+    CPUBKTRNG() : CPUSPTAGRNG(SPTAG::IndexAlgoType::BKT) {
+    }
 
- private:
-    std::shared_ptr<SPTAG::VectorIndex> index_;
+ protected:
+    void
+    SetParameters(const Config& config) override;
 };
 
-using CPUKDTRNGIndexModelPtr = std::shared_ptr<CPUKDTRNGIndexModel>;
+using CPUSPTAGRNGPtr = std::shared_ptr<CPUSPTAGRNG>;
+using CPUKDTRNGPtr = std::shared_ptr<CPUKDTRNG>;
+using CPUBKTRNGPtr = std::shared_ptr<CPUBKTRNG>;
 
 }  // namespace knowhere
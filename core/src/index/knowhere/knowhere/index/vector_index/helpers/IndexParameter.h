@@ -18,6 +18,7 @@
 #pragma once
 
 #include <faiss/Index.h>
+#include <functional>
 #include <memory>
 
 #include "knowhere/common/Config.h"
@@ -106,6 +107,9 @@ struct NSGCfg : public IVFCfg {
     int64_t search_length = DEFAULT_SEARCH_LENGTH;
     int64_t out_degree = DEFAULT_OUT_DEGREE;
     int64_t candidate_pool_size = DEFAULT_CANDIDATE_SISE;
+    bool reorder = false;         // renumber graph nodes in BFS order for locality
+    int64_t build_memory_cap = 0;  // bytes of transient build buffers, 0 means unlimited
+    std::function<bool(int64_t)> allow;  // search results are limited to the ids it accepts, unset accepts all
 
     NSGCfg(const int64_t& dim, const int64_t& k, const int64_t& gpu_id, const int64_t& nlist, const int64_t& nprobe,
            const int64_t& knng, const int64_t& search_length, const int64_t& out_degree, const int64_t& candidate_size,
@@ -126,8 +130,23 @@ struct NSGCfg : public IVFCfg {
 };
 using NSGConfig = std::shared_ptr<NSGCfg>;
 
+// SPTAG Config, unset fields fall back to the defaults in KDTParameterMgr
 struct KDTCfg : public Cfg {
-    int64_t tptnubmber = -1;
+    int64_t kdtnumber = INVALID_VALUE;
+    int64_t tptnumber = INVALID_VALUE;
+    int64_t neighborhood_size = INVALID_VALUE;
+    int64_t max_check = INVALID_VALUE;
 };
+using KDTConfig = std::shared_ptr<KDTCfg>;
+
+struct BKTCfg : public Cfg {
+    int64_t bktnumber = INVALID_VALUE;
+    int64_t bkt_kmeans_k = INVALID_VALUE;
+    int64_t bkt_leaf_size = INVALID_VALUE;
+    int64_t tptnumber = INVALID_VALUE;
+    int64_t neighborhood_size = INVALID_VALUE;
+    int64_t max_check = INVALID_VALUE;
+};
+using BKTConfig = std::shared_ptr<BKTCfg>;
 
 }  // namespace knowhere
@@ -26,6 +26,11 @@ KDTParameterMgr::GetKDTParameters() {
     return kdt_parameters_;
 }
 
+const std::vector<KDTParameter>&
+KDTParameterMgr::GetBKTParameters() {
+    return bkt_parameters_;
+}
+
 KDTParameterMgr::KDTParameterMgr() {
     kdt_parameters_ = std::vector<KDTParameter>{
         {"KDTNumber", "1"},
@@ -50,6 +55,31 @@ KDTParameterMgr::KDTParameterMgr() {
         {"NumberOfInitialDynamicPivots", "50"},
         {"NumberOfOtherDynamicPivots", "4"},
     };
+
+    bkt_parameters_ = std::vector<KDTParameter>{
+        {"BKTNumber", "1"},
+        {"BKTKmeansK", "32"},
+        {"BKTLeafSize", "8"},
+        {"Samples", "1000"},
+
+        {"TPTNumber", "1"},
+        {"TPTLeafSize", "2000"},
+        {"NumTopDimensionTpTreeSplit", "5"},
+
+        {"NeighborhoodSize", "32"},
+        {"GraphNeighborhoodScale", "2"},
+        {"GraphCEFScale", "2"},
+        {"RefineIterations", "0"},
+        {"CEF", "1000"},
+        {"MaxCheckForRefineGraph", "10000"},
+
+        {"NumberOfThreads", "1"},
+
+        {"MaxCheck", "8192"},
+        {"ThresholdOfNumberOfContinuousNoBetterPropagation", "3"},
+        {"NumberOfInitialDynamicPivots", "50"},
+        {"NumberOfOtherDynamicPivots", "4"},
+    };
 }
 
 }  // namespace knowhere
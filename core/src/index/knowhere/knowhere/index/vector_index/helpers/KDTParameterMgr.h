@@ -31,6 +31,9 @@ class KDTParameterMgr {
     const std::vector<KDTParameter>&
     GetKDTParameters();
 
+    const std::vector<KDTParameter>&
+    GetBKTParameters();
+
  public:
     static KDTParameterMgr&
     GetInstance() {
@@ -47,6 +50,7 @@ class KDTParameterMgr {
 
  private:
     std::vector<KDTParameter> kdt_parameters_;
+    std::vector<KDTParameter> bkt_parameters_;
 };
 
 }  // namespace knowhere
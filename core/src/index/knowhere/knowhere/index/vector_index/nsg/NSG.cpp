@@ -15,15 +15,21 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <omp.h>
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <stack>
+#include <unordered_set>
 #include <utility>
 
+#include "knowhere/common/Cancel.h"
 #include "knowhere/common/Exception.h"
+#include "knowhere/common/HugePage.h"
 #include "knowhere/common/Log.h"
 #include "knowhere/common/Timer.h"
 #include "knowhere/index/vector_index/nsg/NSG.h"
@@ -35,13 +41,15 @@
 namespace knowhere {
 namespace algo {
 
+constexpr size_t NSG_LOCK_STRIPES = 4096;
+
 NsgIndex::NsgIndex(const size_t& dimension, const size_t& n, MetricType metric)
     : dimension(dimension), ntotal(n), metric_type(metric) {
 }
 
 NsgIndex::~NsgIndex() {
-    delete[] ori_data_;
-    delete[] ids_;
+    HugePageFree(ori_data_);
+    HugePageFree(ids_);
 }
 
 // void NsgIndex::Build(size_t nb, const float *data, const BuildParam &parameters) {
@@ -51,17 +59,20 @@ NsgIndex::Build_with_ids(size_t nb, const float* data, const int64_t* ids, const
     TimeRecorder rc("NSG");
 
     ntotal = nb;
-    ori_data_ = new float[ntotal * dimension];
-    ids_ = new int64_t[ntotal];
+    ori_data_ = HugePageAllocArray<float>(ntotal * dimension);
+    ids_ = HugePageAllocArray<int64_t>(ntotal);
     memcpy((void*)ori_data_, (void*)data, sizeof(float) * ntotal * dimension);
     memcpy((void*)ids_, (void*)ids, sizeof(int64_t) * ntotal);
 
     search_length = parameters.search_length;
     out_degree = parameters.out_degree;
     candidate_pool_size = parameters.candidate_pool_size;
+    build_memory_cap = parameters.memory_cap;
+    build_stats = BuildStats();
 
+    visited_pool_ = std::make_shared<VisitedListPool>(ntotal);
     InitNavigationPoint();
-    rc.RecordSection("init");
+    build_stats.init_us = rc.RecordSection("init");
 
     Link();
     rc.RecordSection("Link");
@@ -75,7 +86,7 @@ NsgIndex::Build_with_ids(size_t nb, const float* data, const int64_t* ids, const
     /////
 
     CheckConnectivity();
-    rc.RecordSection("Connect");
+    build_stats.connect_us = rc.RecordSection("Connect");
 
     //>> Debug code
     ///
@@ -88,9 +99,404 @@ NsgIndex::Build_with_ids(size_t nb, const float* data, const int64_t* ids, const
     KNOWHERE_LOG_DEBUG << "Average degree: " << total_degree / ntotal;
     /////
 
+    if (parameters.reorder) {
+        ReorderGraph();
+        build_stats.reorder_us = rc.RecordSection("Reorder");
+    }
+
+    SealGraph();
+    build_stats.seal_us = rc.RecordSection("Seal");
+
+    KNOWHERE_LOG_DEBUG << "NSG build stats: prune " << build_stats.prune_us << "us, inter insert "
+                       << build_stats.inter_insert_us << "us, connect " << build_stats.connect_us << "us, repaired "
+                       << build_stats.repaired_nodes << " nodes, transient "
+                       << build_stats.transient_bytes / 1024 / 1024 << "m"
+                       << (build_stats.recompute_distance ? ", recompute distance" : "");
+
     is_trained = true;
 }
 
+void
+NsgIndex::ReorderGraph() {
+    // nodes expanded one after another by the search get neighbouring offsets,
+    // so a hop mostly lands on vectors and rows that are already cached
+    std::vector<node_t> order;
+    std::vector<node_t> new_offset(ntotal, -1);
+    order.reserve(ntotal);
+
+    auto visit = [&](node_t n) {
+        new_offset[n] = order.size();
+        order.push_back(n);
+    };
+
+    visit(navigation_point);
+    size_t unvisited_cursor = 0;
+    for (size_t head = 0; order.size() < ntotal; ++head) {
+        if (head == order.size()) {
+            // not reachable from the navigation point, continue from the next unvisited node
+            while (new_offset[unvisited_cursor] >= 0) {
+                ++unvisited_cursor;
+            }
+            visit(unvisited_cursor);
+        }
+        for (auto neighbor : nsg[order[head]]) {
+            if (new_offset[neighbor] < 0) {
+                visit(neighbor);
+            }
+        }
+    }
+
+    auto data = HugePageAllocArray<float>(ntotal * dimension);
+    auto ids = HugePageAllocArray<int64_t>(ntotal);
+    Graph graph(ntotal);
+#pragma omp parallel for
+    for (size_t i = 0; i < ntotal; ++i) {
+        auto origin = order[i];
+        memcpy(data + i * dimension, ori_data_ + origin * dimension, sizeof(float) * dimension);
+        ids[i] = ids_[origin];
+        graph[i].reserve(nsg[origin].size());
+        for (auto neighbor : nsg[origin]) {
+            graph[i].push_back(new_offset[neighbor]);
+        }
+    }
+
+    HugePageFree(ori_data_);
+    HugePageFree(ids_);
+    ori_data_ = data;
+    ids_ = ids;
+    nsg.swap(graph);
+    navigation_point = new_offset[navigation_point];
+
+    if (origin_offsets.empty()) {
+        origin_offsets.swap(order);
+    } else {
+        // keep mapping to the insertion order when reordering again
+        for (auto& offset : order) {
+            offset = origin_offsets[offset];
+        }
+        origin_offsets.swap(order);
+    }
+}
+
+void
+NsgIndex::SealGraph() {
+    // a graph loaded in flat layout is already sealed
+    if (!nsg.empty()) {
+        size_t degree = 0;
+        for (size_t i = 0; i < nsg.size(); ++i) {
+            degree = std::max(degree, nsg[i].size());
+        }
+
+        flat_nsg.degree = degree;
+        flat_nsg.data.assign(ntotal * flat_nsg.RowSize(), 0);
+        for (size_t i = 0; i < nsg.size(); ++i) {
+            auto row = flat_nsg.data.data() + i * flat_nsg.RowSize();
+            row[0] = nsg[i].size();
+            std::copy(nsg[i].begin(), nsg[i].end(), row + 1);
+        }
+
+        nsg.clear();
+        nsg.shrink_to_fit();
+    }
+
+    visited_pool_ = std::make_shared<VisitedListPool>(ntotal);
+}
+
+void
+NsgIndex::ResizeFlatGraph(size_t n, size_t degree) {
+    if (degree == flat_nsg.degree) {
+        flat_nsg.data.resize(n * flat_nsg.RowSize(), 0);
+        return;
+    }
+
+    FlatGraph graph;
+    graph.degree = degree;
+    graph.data.assign(n * graph.RowSize(), 0);
+    auto rows = std::min(n, flat_nsg.data.size() / flat_nsg.RowSize());
+    for (size_t i = 0; i < rows; ++i) {
+        auto row = flat_nsg.Row(i);
+        std::copy(row, row + row[0] + 1, graph.Row(i));
+    }
+    flat_nsg = std::move(graph);
+}
+
+void
+NsgIndex::Add_with_ids(size_t nb, const float* data, const int64_t* ids, const BuildParams& parameters) {
+    std::unique_lock<std::shared_timed_mutex> lock(rw_mutex);
+    if (!is_trained || flat_nsg.empty()) {
+        KNOWHERE_THROW_MSG("NSG graph not built, add needs a sealed graph");
+    }
+    if (nb == 0) {
+        return;
+    }
+    TimeRecorder rc("NSG Add");
+
+    // graphs loaded from files written before the parameters were persisted fall back to the row width
+    if (parameters.search_length > 0)
+        search_length = parameters.search_length;
+    if (parameters.out_degree > 0)
+        out_degree = parameters.out_degree;
+    if (parameters.candidate_pool_size > 0)
+        candidate_pool_size = parameters.candidate_pool_size;
+    if (out_degree == 0)
+        out_degree = flat_nsg.degree;
+    if (search_length == 0)
+        search_length = out_degree;
+
+    size_t old_total = ntotal;
+    size_t new_total = ntotal + nb;
+
+    auto new_data = HugePageAllocArray<float>(new_total * dimension);
+    auto new_ids = HugePageAllocArray<int64_t>(new_total);
+    memcpy(new_data, ori_data_, sizeof(float) * old_total * dimension);
+    memcpy(new_data + old_total * dimension, data, sizeof(float) * nb * dimension);
+    memcpy(new_ids, ids_, sizeof(int64_t) * old_total);
+    memcpy(new_ids + old_total, ids, sizeof(int64_t) * nb);
+    HugePageFree(ori_data_);
+    HugePageFree(ids_);
+    ori_data_ = new_data;
+    ids_ = new_ids;
+
+    ResizeFlatGraph(new_total, std::max(flat_nsg.degree, out_degree));
+    if (!origin_offsets.empty()) {
+        for (size_t i = 0; i < nb; ++i) {
+            origin_offsets.push_back(old_total + i);
+        }
+    }
+    if (deleted_num > 0) {
+        deleted.resize(new_total);
+    }
+    visited_pool_ = std::make_shared<VisitedListPool>(new_total);
+
+    // Nodes are inserted one after another, so a batch of close vectors links to each other as well.
+    // The search result stands in for the fullset of build, it is searched as deep as the candidate pool.
+    SearchParams params{std::max(search_length, candidate_pool_size)};
+    std::vector<Neighbor> pool;
+    for (size_t i = 0; i < nb; ++i) {
+        node_t n = old_total + i;
+        GetNeighbors(ori_data_ + n * dimension, pool, flat_nsg, &params);  // ntotal still excludes n
+        ++ntotal;
+        LinkNewNode(n, pool);
+    }
+    rc.RecordSection("insert " + std::to_string(nb) + " nodes");
+}
+
+void
+NsgIndex::LinkNewNode(node_t n, std::vector<Neighbor>& pool) {
+    // deleted nodes stay routable, but new edges must not depend on them
+    pool.erase(std::remove_if(pool.begin(), pool.end(), [&](const Neighbor& p) { return IsDeleted(p.id); }),
+               pool.end());
+    if (pool.empty()) {
+        auto row = flat_nsg.Row(navigation_point);
+        if (static_cast<size_t>(row[0]) < flat_nsg.degree) {
+            row[++row[0]] = n;
+        }
+        return;
+    }
+
+    PruneRow(n, pool);
+
+    auto row = flat_nsg.Row(n);
+    for (node_t i = 0; i < row[0]; ++i) {
+        InsertReverseEdge(row[i + 1], n, pool[i].distance);
+    }
+}
+
+void
+NsgIndex::PruneRow(node_t n, std::vector<Neighbor>& pool) {
+    std::sort(pool.begin(), pool.end());
+    std::vector<Neighbor> result;
+    unsigned cursor = 0;
+    result.push_back(pool[cursor]);
+    SelectEdge(cursor, pool, result);
+
+    auto row = flat_nsg.Row(n);
+    row[0] = result.size();
+    for (size_t i = 0; i < result.size(); ++i) {
+        row[i + 1] = result[i].id;
+    }
+    // callers read the distances of the kept edges from the front of the pool
+    pool.swap(result);
+}
+
+void
+NsgIndex::InsertReverseEdge(node_t m, node_t n, float distance) {
+    auto row = flat_nsg.Row(m);
+    auto neighbor_num = static_cast<size_t>(row[0]);
+    for (size_t i = 0; i < neighbor_num; ++i) {
+        if (row[i + 1] == n)
+            return;
+    }
+
+    if (neighbor_num < flat_nsg.degree) {
+        row[neighbor_num + 1] = n;
+        ++row[0];
+        return;
+    }
+
+    // full row, the new node competes with the old neighbors under the same edge selection as build
+    std::vector<Neighbor> pool;
+    pool.reserve(neighbor_num + 1);
+    for (size_t i = 0; i < neighbor_num; ++i) {
+        auto id = row[i + 1];
+        pool.emplace_back(id, calculate(ori_data_ + dimension * m, ori_data_ + dimension * id, dimension));
+    }
+    pool.emplace_back(n, distance);
+    PruneRow(m, pool);
+}
+
+size_t
+NsgIndex::Delete_with_ids(const int64_t* ids, size_t n) {
+    std::unique_lock<std::shared_timed_mutex> lock(rw_mutex);
+    std::unordered_set<int64_t> to_delete(ids, ids + n);
+    if (deleted.size() != ntotal) {
+        deleted.resize(ntotal);
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < ntotal; ++i) {
+        if (!deleted[i] && to_delete.count(ids_[i])) {
+            deleted[i] = true;
+            ++count;
+        }
+    }
+    deleted_num += count;
+    return count;
+}
+
+void
+NsgIndex::Consolidate() {
+    std::unique_lock<std::shared_timed_mutex> lock(rw_mutex);
+    if (deleted_num == 0) {
+        return;
+    }
+    if (deleted_num >= ntotal) {
+        KNOWHERE_THROW_MSG("NSG consolidate: every node is deleted");
+    }
+    TimeRecorder rc("NSG Consolidate");
+    if (out_degree == 0 || out_degree > flat_nsg.degree) {
+        out_degree = flat_nsg.degree;
+    }
+
+    // a deleted navigation point is replaced by the nearest live node
+    if (deleted[navigation_point]) {
+        auto center = ori_data_ + navigation_point * dimension;
+        float min_dist = std::numeric_limits<float>::max();
+        node_t nearest = navigation_point;
+        for (size_t i = 0; i < ntotal; ++i) {
+            if (deleted[i])
+                continue;
+            float dist = calculate(center, ori_data_ + i * dimension, dimension);
+            if (dist < min_dist) {
+                min_dist = dist;
+                nearest = i;
+            }
+        }
+        navigation_point = nearest;
+    }
+
+    // every thread rewrites only live rows and reads only deleted ones besides its own
+#pragma omp parallel
+    {
+        auto visited = visited_pool_->Get();
+        std::vector<Neighbor> pool;
+#pragma omp for schedule(dynamic, 100)
+        for (size_t n = 0; n < ntotal; ++n) {
+            if (deleted[n])
+                continue;
+            auto row = flat_nsg.Row(n);
+            auto neighbor_num = static_cast<size_t>(row[0]);
+            bool touched = false;
+            for (size_t i = 0; i < neighbor_num && !touched; ++i) {
+                touched = deleted[row[i + 1]];
+            }
+            if (!touched)
+                continue;
+
+            visited->Reset();
+            visited->Set(n);
+            pool.clear();
+            auto add_candidate = [&](node_t id) {
+                if (deleted[id] || visited->Visited(id))
+                    return;
+                visited->Set(id);
+                pool.emplace_back(id, calculate(ori_data_ + dimension * n, ori_data_ + dimension * id, dimension));
+            };
+            for (size_t i = 0; i < neighbor_num; ++i) {
+                auto id = row[i + 1];
+                if (!deleted[id]) {
+                    add_candidate(id);
+                    continue;
+                }
+                auto deleted_row = flat_nsg.Row(id);
+                for (node_t j = 0; j < deleted_row[0]; ++j) {
+                    add_candidate(deleted_row[j + 1]);
+                }
+            }
+
+            if (pool.empty()) {
+                row[0] = 0;
+                continue;
+            }
+            PruneRow(n, pool);
+        }
+    }
+    rc.RecordSection("relink");
+
+    std::vector<node_t> new_offset(ntotal, -1);
+    size_t live = 0;
+    for (size_t i = 0; i < ntotal; ++i) {
+        if (!deleted[i]) {
+            new_offset[i] = live++;
+        }
+    }
+
+    auto data = HugePageAllocArray<float>(live * dimension);
+    auto ids = HugePageAllocArray<int64_t>(live);
+    FlatGraph graph;
+    graph.degree = flat_nsg.degree;
+    graph.data.assign(live * graph.RowSize(), 0);
+#pragma omp parallel for
+    for (size_t i = 0; i < ntotal; ++i) {
+        auto offset = new_offset[i];
+        if (offset < 0)
+            continue;
+        memcpy(data + offset * dimension, ori_data_ + i * dimension, sizeof(float) * dimension);
+        ids[offset] = ids_[i];
+        auto row = flat_nsg.Row(i);
+        auto new_row = graph.Row(offset);
+        for (node_t j = 0; j < row[0]; ++j) {
+            auto neighbor = new_offset[row[j + 1]];
+            if (neighbor >= 0) {
+                new_row[++new_row[0]] = neighbor;
+            }
+        }
+    }
+
+    if (!origin_offsets.empty()) {
+        std::vector<node_t> offsets;
+        offsets.reserve(live);
+        for (size_t i = 0; i < ntotal; ++i) {
+            if (new_offset[i] >= 0) {
+                offsets.push_back(origin_offsets[i]);
+            }
+        }
+        origin_offsets.swap(offsets);
+    }
+
+    HugePageFree(ori_data_);
+    HugePageFree(ids_);
+    ori_data_ = data;
+    ids_ = ids;
+    flat_nsg = std::move(graph);
+    navigation_point = new_offset[navigation_point];
+    ntotal = live;
+    deleted.clear();
+    deleted_num = 0;
+    visited_pool_ = std::make_shared<VisitedListPool>(ntotal);
+    rc.RecordSection("compact");
+}
+
 void
 NsgIndex::InitNavigationPoint() {
     // calculate the center of vectors
@@ -134,12 +540,12 @@ NsgIndex::InitNavigationPoint() {
 // Specify Link
 void
 NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::vector<Neighbor>& fullset,
-                       boost::dynamic_bitset<>& has_calculated_dist) {
+                       VisitedList& has_calculated_dist) {
     auto& graph = knng;
     size_t buffer_size = search_length;
 
     if (buffer_size > ntotal) {
-        // TODO: throw exception here.
+        buffer_size = ntotal;
     }
 
     std::vector<node_t> init_ids;
@@ -153,18 +559,18 @@ NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::v
         // Get all neighbors
         for (size_t i = 0; i < graph[navigation_point].size(); ++i) {
             init_ids.push_back(graph[navigation_point][i]);
-            has_calculated_dist[init_ids[i]] = true;
+            has_calculated_dist.Set(init_ids[i]);
             ++count;
         }
 
         unsigned int seed = 100;
         while (count < buffer_size) {
             node_t id = rand_r(&seed) % ntotal;
-            if (has_calculated_dist[id])
+            if (has_calculated_dist.Visited(id))
                 continue;  // duplicate id
             init_ids.push_back(id);
             ++count;
-            has_calculated_dist[id] = true;
+            has_calculated_dist.Set(id);
         }
     }
 
@@ -201,9 +607,9 @@ NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::v
                 auto& wait_for_search_node_vec = graph[start_pos];
                 for (size_t i = 0; i < wait_for_search_node_vec.size(); ++i) {
                     node_t id = wait_for_search_node_vec[i];
-                    if (has_calculated_dist[id])
+                    if (has_calculated_dist.Visited(id))
                         continue;
-                    has_calculated_dist[id] = true;
+                    has_calculated_dist.Set(id);
 
                     float dist = calculate(query, ori_data_ + dimension * id, dimension);
                     Neighbor nn(id, dist, false);
@@ -230,18 +636,19 @@ NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::v
     }
 }
 
-// FindUnconnectedNode
+// connectivity repair
 void
 NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::vector<Neighbor>& fullset) {
     auto& graph = nsg;
     size_t buffer_size = search_length;
 
     if (buffer_size > ntotal) {
-        // TODO: throw exception here.
+        buffer_size = ntotal;
     }
 
     std::vector<node_t> init_ids;
-    boost::dynamic_bitset<> has_calculated_dist{ntotal, 0};  // TODO: ?
+    auto visited = visited_pool_->Get();
+    auto& has_calculated_dist = *visited;
 
     {
         /*
@@ -252,17 +659,17 @@ NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::v
         // Get all neighbors
         for (size_t i = 0; i < graph[navigation_point].size(); ++i) {
             init_ids.push_back(graph[navigation_point][i]);
-            has_calculated_dist[init_ids[i]] = true;
+            has_calculated_dist.Set(init_ids[i]);
             ++count;
         }
         unsigned int seed = 100;
         while (count < buffer_size) {
             node_t id = rand_r(&seed) % ntotal;
-            if (has_calculated_dist[id])
+            if (has_calculated_dist.Visited(id))
                 continue;  // duplicate id
             init_ids.push_back(id);
             ++count;
-            has_calculated_dist[id] = true;
+            has_calculated_dist.Set(id);
         }
     }
 
@@ -295,9 +702,9 @@ NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::v
                 auto& wait_for_search_node_vec = graph[start_pos];
                 for (size_t i = 0; i < wait_for_search_node_vec.size(); ++i) {
                     node_t id = wait_for_search_node_vec[i];
-                    if (has_calculated_dist[id])
+                    if (has_calculated_dist.Visited(id))
                         continue;
-                    has_calculated_dist[id] = true;
+                    has_calculated_dist.Set(id);
 
                     float dist = calculate(ori_data_ + dimension * id, query, dimension);
                     Neighbor nn(id, dist, false);
@@ -326,10 +733,10 @@ NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::v
 
 void
 NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, Graph& graph, SearchParams* params) {
-    size_t& buffer_size = params ? params->search_length : search_length;
+    size_t buffer_size = params ? params->search_length : search_length;
 
     if (buffer_size > ntotal) {
-        // TODO: throw exception here.
+        buffer_size = ntotal;
     }
 
     std::vector<node_t> init_ids;
@@ -431,70 +838,174 @@ NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, Graph&
     }
 }
 
+void
+NsgIndex::PrefetchVector(node_t id) const {
+    auto addr = reinterpret_cast<const char*>(ori_data_ + dimension * id);
+    for (size_t offset = 0; offset < dimension * sizeof(float); offset += 64) {
+        _mm_prefetch(addr + offset, _MM_HINT_T0);
+    }
+}
+
+void
+NsgIndex::GetNeighbors(const float* query, std::vector<Neighbor>& resset, const FlatGraph& graph,
+                       SearchParams* params) {
+    // local copy, the trick below grows it and params is shared by concurrent queries
+    size_t buffer_size = params ? params->search_length : search_length;
+    if (buffer_size > ntotal) {
+        buffer_size = ntotal;
+    }
+
+    auto visited = visited_pool_->Get();
+    static thread_local std::vector<node_t> init_ids;
+    init_ids.clear();
+
+    {
+        /*
+         * copy navigation-point neighbor,  pick random node if less than buffer size
+         */
+        auto row = graph.Row(navigation_point);
+        auto neighbor_num = static_cast<size_t>(row[0]);
+        for (size_t i = 0; i < neighbor_num; ++i) {
+            init_ids.push_back(row[i + 1]);
+            visited->Set(row[i + 1]);
+        }
+
+        unsigned int seed = 100;
+        while (init_ids.size() < buffer_size) {
+            node_t id = rand_r(&seed) % ntotal;
+            if (visited->Visited(id))
+                continue;  // duplicate id
+            init_ids.push_back(id);
+            visited->Set(id);
+        }
+    }
+
+    resset.resize(init_ids.size());
+
+    // init resset and sort by distance
+    for (size_t i = 0; i < init_ids.size(); ++i) {
+        if (i + 1 < init_ids.size()) {
+            PrefetchVector(init_ids[i + 1]);
+        }
+        node_t id = init_ids[i];
+        float dist = calculate(ori_data_ + id * dimension, query, dimension);
+        resset[i] = Neighbor(id, dist, false);
+    }
+    std::sort(resset.begin(), resset.end());  // sort by distance
+
+    // search nearest neighbor
+    size_t cursor = 0;
+    while (cursor < buffer_size) {
+        size_t nearest_updated_pos = buffer_size;
+
+        if (!resset[cursor].has_explored) {
+            resset[cursor].has_explored = true;
+
+            auto row = graph.Row(resset[cursor].id);
+            auto neighbor_num = static_cast<size_t>(row[0]);
+            auto neighbors = row + 1;
+            if (neighbor_num > 0) {
+                PrefetchVector(neighbors[0]);
+            }
+
+            for (size_t i = 0; i < neighbor_num; ++i) {
+                // hide the memory latency of the next hop behind the current distance
+                if (i + 1 < neighbor_num) {
+                    _mm_prefetch(reinterpret_cast<const char*>(visited->Tag(neighbors[i + 1])), _MM_HINT_T0);
+                    PrefetchVector(neighbors[i + 1]);
+                }
+
+                node_t id = neighbors[i];
+                if (visited->Visited(id))
+                    continue;
+                visited->Set(id);
+
+                float dist = calculate(query, ori_data_ + dimension * id, dimension);
+                if (dist >= resset[buffer_size - 1].distance)
+                    continue;
+
+                Neighbor nn(id, dist, false);
+                size_t pos = InsertIntoPool(resset.data(), buffer_size, nn);  // replace with a closer node
+                if (pos < nearest_updated_pos)
+                    nearest_updated_pos = pos;
+
+                // trick: avoid search query search_length < init_ids.size() ...
+                if (buffer_size + 1 < resset.size())
+                    ++buffer_size;
+            }
+        }
+        if (cursor >= nearest_updated_pos) {
+            cursor = nearest_updated_pos;  // re-search from new pos
+        } else {
+            ++cursor;
+        }
+    }
+}
+
 void
 NsgIndex::Link() {
-    auto cut_graph_dist = new float[ntotal * out_degree];
+    TimeRecorder rc("NSG Link");
+
+    // every prune thread holds a visited list of one byte per node, under a memory cap the threads are
+    // limited to what it fits
+    int threads = omp_get_max_threads();
+    if (build_memory_cap > 0) {
+        threads = static_cast<int>(std::max<size_t>(1, std::min<size_t>(threads, build_memory_cap / ntotal)));
+    }
+    size_t visited_bytes = threads * ntotal * sizeof(uint8_t);
+    build_stats.transient_bytes += visited_bytes;
+
+    // the pruned distances are only a cache, above the memory cap they are recomputed on demand
+    size_t dist_bytes = ntotal * out_degree * sizeof(float);
+    float* cut_graph_dist = nullptr;
+    build_stats.recompute_distance = (build_memory_cap > 0 && visited_bytes + dist_bytes > build_memory_cap);
+    if (!build_stats.recompute_distance) {
+        cut_graph_dist = new float[ntotal * out_degree];
+        build_stats.transient_bytes += dist_bytes;
+    }
+
     nsg.resize(ntotal);
 
-#pragma omp parallel
+#pragma omp parallel num_threads(threads)
     {
         std::vector<Neighbor> fullset;
         std::vector<Neighbor> temp;
-        boost::dynamic_bitset<> flags{ntotal, 0};  // TODO: ?
+        auto flags = visited_pool_->Get();
 #pragma omp for schedule(dynamic, 100)
         for (size_t n = 0; n < ntotal; ++n) {
             fullset.clear();
-            flags.reset();
-            GetNeighbors(ori_data_ + dimension * n, temp, fullset, flags);
-
-            //>> Debug code
-            /////
-            // float r1 = calculate(ori_data_ + n * dimension, ori_data_ + temp[0].id * dimension, dimension);
-            // assert(r1 == temp[0].distance);
-            /////
-            SyncPrune(n, fullset, flags, cut_graph_dist);
+            flags->Reset();
+            GetNeighbors(ori_data_ + dimension * n, temp, fullset, *flags);
+            SyncPrune(n, fullset, *flags, cut_graph_dist);
         }
     }
-
-    //>> Debug code
-    /////
-    // auto bak_nsg = nsg;
-    /////
+    build_stats.prune_us = rc.RecordSection("prune");
 
     knng.clear();
     knng.shrink_to_fit();
+    visited_pool_->Trim();
 
-    std::vector<std::mutex> mutex_vec(ntotal);
+    // lock striping, one mutex per node costs more memory than the graph itself on large segments
+    std::vector<std::mutex> mutex_vec(std::min(ntotal, NSG_LOCK_STRIPES));
 
-#pragma omp for schedule(dynamic, 100)
-    for (unsigned n = 0; n < ntotal; ++n) {
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t n = 0; n < ntotal; ++n) {
         InterInsert(n, mutex_vec, cut_graph_dist);
     }
     delete[] cut_graph_dist;
 
-    //>> Debug code
-    /////
-    // int count = 0;
-    // for (int i = 0; i < ntotal; ++i) {
-    //    if (bak_nsg[i].size() != nsg[i].size()) {
-    //        //count += nsg[i].size() - bak_nsg[i].size();
-    //        count += nsg[i].size();
-    //    }
-    //}
-    /////
-
     for (size_t i = 0; i < ntotal; ++i) {
         nsg[i].shrink_to_fit();
     }
+    build_stats.inter_insert_us = rc.RecordSection("inter insert");
 }
 
 void
-NsgIndex::SyncPrune(size_t n, std::vector<Neighbor>& pool, boost::dynamic_bitset<>& has_calculated,
-                    float* cut_graph_dist) {
+NsgIndex::SyncPrune(size_t n, std::vector<Neighbor>& pool, VisitedList& has_calculated, float* cut_graph_dist) {
     // avoid lose nearest neighbor in knng
     for (size_t i = 0; i < knng[n].size(); ++i) {
         auto id = knng[n][i];
-        if (has_calculated[id])
+        if (has_calculated.Visited(id))
             continue;
         float dist = calculate(ori_data_ + dimension * n, ori_data_ + dimension * id, dimension);
         pool.emplace_back(Neighbor(id, dist, true));
@@ -513,59 +1024,79 @@ NsgIndex::SyncPrune(size_t n, std::vector<Neighbor>& pool, boost::dynamic_bitset
 
     // filling the cut_graph
     auto& des_id_pool = nsg[n];
-    float* des_dist_pool = cut_graph_dist + n * out_degree;
+    des_id_pool.reserve(out_degree);
     for (size_t i = 0; i < result.size(); ++i) {
         des_id_pool.push_back(result[i].id);
-        des_dist_pool[i] = result[i].distance;
     }
-    if (result.size() < out_degree) {
-        des_dist_pool[result.size()] = -1;
+    if (cut_graph_dist != nullptr) {
+        float* des_dist_pool = cut_graph_dist + n * out_degree;
+        for (size_t i = 0; i < result.size(); ++i) {
+            des_dist_pool[i] = result[i].distance;
+        }
     }
-    //>> Optimize: reserve id_pool capacity
 }
 
-//>> Optimize: remove read-lock
 void
-NsgIndex::InterInsert(unsigned n, std::vector<std::mutex>& mutex_vec, float* cut_graph_dist) {
-    auto& current = n;
+NsgIndex::GetPrunedNeighbors(size_t n, const float* cut_graph_dist, std::vector<Neighbor>& pool) {
+    auto& id_pool = nsg[n];
+    pool.clear();
+    pool.reserve(id_pool.size() + 1);
+    for (size_t i = 0; i < id_pool.size(); ++i) {
+        // distance filled in by the caller outside of the lock when recomputing
+        float dist = cut_graph_dist ? cut_graph_dist[n * out_degree + i] : 0;
+        pool.emplace_back(id_pool[i], dist);
+    }
+}
 
-    auto& neighbor_id_pool = nsg[current];
-    float* neighbor_dist_pool = cut_graph_dist + current * out_degree;
-    for (size_t i = 0; i < out_degree; ++i) {
-        if (neighbor_dist_pool[i] == -1)
-            break;
+void
+NsgIndex::InterInsert(size_t n, std::vector<std::mutex>& mutex_vec, float* cut_graph_dist) {
+    auto stripe = [&](size_t node) -> std::mutex& { return mutex_vec[node % mutex_vec.size()]; };
+    auto fill_distance = [&](size_t center, std::vector<Neighbor>& pool) {
+        if (cut_graph_dist == nullptr) {
+            for (auto& neighbor : pool) {
+                neighbor.distance =
+                    calculate(ori_data_ + dimension * center, ori_data_ + dimension * neighbor.id, dimension);
+            }
+        }
+    };
 
-        size_t current_neighbor = neighbor_id_pool[i];  // center's neighbor id
-        auto& nsn_id_pool = nsg[current_neighbor];      // nsn => neighbor's neighbor
-        float* nsn_dist_pool = cut_graph_dist + current_neighbor * out_degree;
+    // other threads append to this node's list, snapshot it before walking
+    std::vector<Neighbor> current_pool;
+    {
+        LockGuard lk(stripe(n));
+        GetPrunedNeighbors(n, cut_graph_dist, current_pool);
+    }
+    fill_distance(n, current_pool);
 
-        std::vector<Neighbor> wait_for_link_pool;  // maintain candidate neighbor of the current neighbor.
-        int duplicate = false;
+    std::vector<Neighbor> wait_for_link_pool;  // maintain candidate neighbor of the current neighbor.
+    for (auto& current : current_pool) {
+        size_t current_neighbor = current.id;  // center's neighbor id
         {
-            LockGuard lk(mutex_vec[current_neighbor]);
-            for (size_t j = 0; j < out_degree; ++j) {
-                if (nsn_dist_pool[j] == -1)
-                    break;
-
-                // 保证至少有一条边能连回来
-                if (n == nsn_id_pool[j]) {
-                    duplicate = true;
-                    break;
-                }
+            LockGuard lk(stripe(current_neighbor));
+            GetPrunedNeighbors(current_neighbor, cut_graph_dist, wait_for_link_pool);
+        }
 
-                Neighbor nsn(nsn_id_pool[j], nsn_dist_pool[j]);
-                wait_for_link_pool.push_back(nsn);
+        // 保证至少有一条边能连回来
+        bool duplicate = false;
+        for (auto& nsn : wait_for_link_pool) {
+            if (nsn.id == static_cast<node_t>(n)) {
+                duplicate = true;
+                break;
             }
         }
         if (duplicate)
             continue;
+        fill_distance(current_neighbor, wait_for_link_pool);
 
         // original: (neighbor) <------- (current)
         // after:    (neighbor) -------> (current)
         // current node as a neighbor of its neighbor
-        Neighbor current_as_neighbor(n, neighbor_dist_pool[i]);
+        Neighbor current_as_neighbor(n, current.distance);
         wait_for_link_pool.push_back(current_as_neighbor);
 
+        auto& nsn_id_pool = nsg[current_neighbor];  // nsn => neighbor's neighbor
+        float* nsn_dist_pool = cut_graph_dist ? cut_graph_dist + current_neighbor * out_degree : nullptr;
+
         // re-selectEdge if candidate neighbor num > out_degree
         if (wait_for_link_pool.size() > out_degree) {
             std::vector<Neighbor> result;
@@ -577,22 +1108,20 @@ NsgIndex::InterInsert(unsigned n, std::vector<std::mutex>& mutex_vec, float* cut
             SelectEdge(start, wait_for_link_pool, result);
 
             {
-                LockGuard lk(mutex_vec[current_neighbor]);
-                for (size_t j = 0; j < result.size(); ++j) {
+                LockGuard lk(stripe(current_neighbor));
+                for (size_t j = 0; j < result.size() && j < nsn_id_pool.size(); ++j) {
                     nsn_id_pool[j] = result[j].id;
-                    nsn_dist_pool[j] = result[j].distance;
+                    if (nsn_dist_pool != nullptr)
+                        nsn_dist_pool[j] = result[j].distance;
                 }
             }
         } else {
-            LockGuard lk(mutex_vec[current_neighbor]);
-            for (size_t j = 0; j < out_degree; ++j) {
-                if (nsn_dist_pool[j] == -1) {
-                    nsn_id_pool.push_back(current_as_neighbor.id);
-                    nsn_dist_pool[j] = current_as_neighbor.distance;
-                    if (j + 1 < out_degree)
-                        nsn_dist_pool[j + 1] = -1;
-                    break;
-                }
+            LockGuard lk(stripe(current_neighbor));
+            // the list may have been filled by another thread since it was copied
+            if (nsn_id_pool.size() < out_degree) {
+                if (nsn_dist_pool != nullptr)
+                    nsn_dist_pool[nsn_id_pool.size()] = current_as_neighbor.distance;
+                nsn_id_pool.push_back(current_as_neighbor.id);
             }
         }
     }
@@ -627,121 +1156,155 @@ NsgIndex::SelectEdge(unsigned& cursor, std::vector<Neighbor>& sort_pool, std::ve
 
 void
 NsgIndex::CheckConnectivity() {
-    auto root = navigation_point;
-    boost::dynamic_bitset<> has_linked{ntotal, 0};
-    int64_t linked_count = 0;
-
-    while (linked_count < static_cast<int64_t>(ntotal)) {
-        DFS(root, has_linked, linked_count);
-        if (linked_count >= static_cast<int64_t>(ntotal)) {
-            break;
-        }
-        FindUnconnectedNode(has_linked, root);
+    TimeRecorder rc("NSG Connectivity");
+    std::vector<std::atomic<bool>> has_linked(ntotal);
+    for (auto& linked : has_linked) {
+        linked.store(false, std::memory_order_relaxed);
     }
-}
 
-void
-NsgIndex::DFS(size_t root, boost::dynamic_bitset<>& has_linked, int64_t& linked_count) {
-    size_t start = root;
-    std::stack<size_t> s;
-    s.push(root);
-    if (!has_linked[root]) {
-        linked_count++;           // not link
-        has_linked[root] = true;  // link start...
+    MarkReachable(navigation_point, has_linked);
+
+    std::vector<node_t> unlinked;
+    for (size_t i = 0; i < ntotal; ++i) {
+        if (!has_linked[i]) {
+            unlinked.push_back(i);
+        }
     }
+    rc.RecordSection("reachable");
+
+    // Search the attach point of unlinked nodes in parallel batches. Attaching one node can pull
+    // in its whole component, so nodes that became reachable are skipped before the next batch.
+    const size_t batch_size = omp_get_max_threads() * 16;
+    size_t cursor = 0;
+    int64_t repaired = 0;
+    while (cursor < unlinked.size()) {
+        std::vector<node_t> batch;
+        for (; cursor < unlinked.size() && batch.size() < batch_size; ++cursor) {
+            if (!has_linked[unlinked[cursor]]) {
+                batch.push_back(unlinked[cursor]);
+            }
+        }
 
-    while (!s.empty()) {
-        size_t next = ntotal + 1;
+        std::vector<node_t> roots(batch.size());
+#pragma omp parallel for schedule(dynamic, 1)
+        for (size_t i = 0; i < batch.size(); ++i) {
+            roots[i] = FindLinkedNeighbor(batch[i], has_linked);
+        }
 
-        for (unsigned i = 0; i < nsg[start].size(); i++) {
-            if (has_linked[nsg[start][i]] == false) {  // if not link
-                next = nsg[start][i];
-                break;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (has_linked[batch[i]]) {
+                continue;  // reached through a node attached earlier in this batch
             }
+            nsg[roots[i]].push_back(batch[i]);
+            MarkReachable(batch[i], has_linked);
+            ++repaired;
         }
-        if (next == (ntotal + 1)) {
-            s.pop();
-            if (s.empty())
-                break;
-            start = s.top();
-            continue;
-        }
-        start = next;
-        has_linked[start] = true;
-        s.push(start);
-        ++linked_count;
     }
+
+    build_stats.repaired_nodes = repaired;
+    rc.RecordSection("repair " + std::to_string(repaired) + " nodes");
 }
 
 void
-NsgIndex::FindUnconnectedNode(boost::dynamic_bitset<>& has_linked, int64_t& root) {
-    // find any of unlinked-node
-    size_t id = ntotal;
-    for (size_t i = 0; i < ntotal; i++) {  // find not link
-        if (has_linked[i] == false) {
-            id = i;
-            break;
-        }
+NsgIndex::MarkReachable(node_t root, std::vector<std::atomic<bool>>& has_linked) {
+    if (has_linked[root].exchange(true)) {
+        return;
     }
 
-    if (id == ntotal)
-        return;  // No Unlinked Node
+    // level synchronous BFS, every level is expanded in parallel
+    std::vector<node_t> frontier{root};
+    while (!frontier.empty()) {
+        std::vector<node_t> next;
+#pragma omp parallel
+        {
+            std::vector<node_t> local;
+#pragma omp for schedule(dynamic, 256) nowait
+            for (size_t i = 0; i < frontier.size(); ++i) {
+                for (auto neighbor : nsg[frontier[i]]) {
+                    if (!has_linked[neighbor].load(std::memory_order_relaxed) && !has_linked[neighbor].exchange(true)) {
+                        local.push_back(neighbor);
+                    }
+                }
+            }
+#pragma omp critical
+            next.insert(next.end(), local.begin(), local.end());
+        }
+        frontier.swap(next);
+    }
+}
 
+node_t
+NsgIndex::FindLinkedNeighbor(node_t id, const std::vector<std::atomic<bool>>& has_linked) {
     // search unlinked-node's neighbor
     std::vector<Neighbor> tmp, pool;
     GetNeighbors(ori_data_ + dimension * id, tmp, pool);
     std::sort(pool.begin(), pool.end());
 
-    size_t found = 0;
-    for (size_t i = 0; i < pool.size(); i++) {  // find nearest neighbor and add unlinked-node as its neighbor
+    // find nearest neighbor and add unlinked-node as its neighbor
+    for (size_t i = 0; i < pool.size(); i++) {
         if (has_linked[pool[i].id]) {
-            root = pool[i].id;
-            found = 1;
-            break;
+            return pool[i].id;
         }
     }
-    if (found == 0) {
-        unsigned int seed = 100;
-        while (true) {  // random a linked-node and add unlinked-node as its neighbor
-            size_t rid = rand_r(&seed) % ntotal;
-            if (has_linked[rid]) {
-                root = rid;
-                break;
-            }
+
+    // random a linked-node and add unlinked-node as its neighbor
+    unsigned int seed = 100 + id;
+    while (true) {
+        size_t rid = rand_r(&seed) % ntotal;
+        if (has_linked[rid]) {
+            return rid;
         }
     }
-    nsg[root].push_back(id);
 }
 
 void
 NsgIndex::Search(const float* query, const unsigned& nq, const unsigned& dim, const unsigned& k, float* dist,
                  int64_t* ids, SearchParams& params) {
-    std::vector<std::vector<Neighbor>> resset(nq);
+    std::shared_lock<std::shared_timed_mutex> lock(rw_mutex);
+
+    // the openmp threads don't see the scope of the caller, every query checks the token itself
+    auto token = CancelScope::Current();
+
+    // candidates of one query are consumed before the next query starts, so every thread reuses its own buffer
+    auto search_one = [&](unsigned int i) {
+        if (token != nullptr && token->Cancelled()) {
+            std::fill(ids + i * k, ids + (i + 1) * k, -1);
+            return;
+        }
+
+        static thread_local std::vector<Neighbor> resset;
+        GetNeighbors(query + i * dim, resset, flat_nsg, &params);
+
+        auto skip = [&](node_t n) { return IsDeleted(n) || (params.allow && !params.allow(ids_[n])); };
+        size_t pos = 0;
+        for (unsigned int j = 0; j < k; ++j) {
+            while (pos < resset.size() && skip(resset[pos].id)) {
+                ++pos;
+            }
+            if (pos >= resset.size()) {
+                ids[i * k + j] = -1;
+                dist[i * k + j] = std::numeric_limits<float>::max();
+                continue;
+            }
+            ids[i * k + j] = ids_[resset[pos].id];
+            dist[i * k + j] = resset[pos].distance;
+            ++pos;
+        }
+    };
 
     TimeRecorder rc("search");
     if (nq == 1) {
-        GetNeighbors(query, resset[0], nsg, &params);
+        search_one(0);
     } else {
 //#pragma omp parallel for schedule(dynamic, 50)
 #pragma omp parallel for
         for (unsigned int i = 0; i < nq; ++i) {
             // TODO(linxj): when to use openmp
-            auto single_query = query + i * dim;
-            GetNeighbors(single_query, resset[i], nsg, &params);
+            search_one(i);
         }
     }
     rc.ElapseFromBegin("cost");
 
-    for (unsigned int i = 0; i < nq; ++i) {
-        for (unsigned int j = 0; j < k; ++j) {
-            // ids[i * k + j] = resset[i][j].id;
-
-            // Fix(linxj): bug, reset[i][j] out of range
-            ids[i * k + j] = ids_[resset[i][j].id];
-            dist[i * k + j] = resset[i][j].distance;
-        }
-    }
-
     //>> Debug: test single insert
     // int x_0 = resset[0].size();
     // for (int l = 0; l < resset[0].size(); ++l) {
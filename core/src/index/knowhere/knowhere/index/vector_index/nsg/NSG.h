@@ -17,12 +17,17 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <functional>
 #include <mutex>
+#include <shared_mutex>
 #include <vector>
 
 #include <boost/dynamic_bitset.hpp>
 #include "Neighbor.h"
+#include "knowhere/common/HugePage.h"
+#include "VisitedList.h"
 
 namespace knowhere {
 namespace algo {
@@ -38,35 +43,92 @@ struct BuildParams {
     size_t search_length;
     size_t out_degree;
     size_t candidate_pool_size;
+    bool reorder = false;   // renumber nodes in BFS order from the navigation point after build
+    size_t memory_cap = 0;  // bytes of transient build buffers, 0 means unlimited
+};
+
+// Collected by Build_with_ids, phase times are in microseconds.
+struct BuildStats {
+    double init_us = 0;
+    double prune_us = 0;
+    double inter_insert_us = 0;
+    double connect_us = 0;
+    double reorder_us = 0;
+    double seal_us = 0;
+    int64_t repaired_nodes = 0;       // unreachable nodes attached by connectivity repair
+    bool recompute_distance = false;  // pruned distances did not fit into memory_cap
+    size_t transient_bytes = 0;       // peak of the buffers released after build
 };
 
 struct SearchParams {
     size_t search_length;
+    std::function<bool(int64_t)> allow;  // by id, the rejected nodes are skipped like the deleted ones
 };
 
 using Graph = std::vector<std::vector<node_t>>;
 
+// Sealed graph used by search. Every node owns a fixed-size row of [neighbor count, neighbors...],
+// padded to the largest out degree, so a hop touches one contiguous row instead of a separate heap block.
+struct FlatGraph {
+    size_t degree = 0;
+    std::vector<node_t, HugePageAllocator<node_t>> data;
+
+    size_t
+    RowSize() const {
+        return degree + 1;
+    }
+
+    const node_t*
+    Row(node_t n) const {
+        return data.data() + n * RowSize();
+    }
+
+    node_t*
+    Row(node_t n) {
+        return data.data() + n * RowSize();
+    }
+
+    bool
+    empty() const {
+        return data.empty();
+    }
+};
+
 class NsgIndex {
  public:
     size_t dimension;
     size_t ntotal;           // totabl nb of indexed vectors
     MetricType metric_type;  // L2 | IP
 
-    float* ori_data_;
-    int64_t* ids_;  // TODO: support different type
-    Graph nsg;      // final graph
-    Graph knng;     // reset after build
+    float* ori_data_ = nullptr;  // allocated by HugePageAlloc
+    int64_t* ids_ = nullptr;     // TODO: support different type
+    Graph nsg;           // final graph, released once sealed
+    Graph knng;          // reset after build
+    FlatGraph flat_nsg;  // sealed graph for search
 
     node_t navigation_point;  // offset of node in origin data
 
+    // insertion offset of every node, empty unless the graph was reordered
+    std::vector<node_t> origin_offsets;
+
+    // lazily deleted nodes, still routable but filtered from results until Consolidate()
+    boost::dynamic_bitset<> deleted;
+    size_t deleted_num = 0;
+
     bool is_trained = false;
 
+    // searches share the sealed graph, Add/Delete/Consolidate replace its buffers and take it exclusively
+    mutable std::shared_timed_mutex rw_mutex;
+
+    BuildStats build_stats;
+
     /*
      * build and search parameter
      */
-    size_t search_length;
-    size_t candidate_pool_size;  // search deepth in fullset
-    size_t out_degree;
+    size_t search_length = 0;
+    size_t candidate_pool_size = 0;  // search deepth in fullset
+    size_t out_degree = 0;
+    size_t build_memory_cap = 0;  // BuildParams::memory_cap of the running build
 
  public:
     explicit NsgIndex(const size_t& dimension, const size_t& n, MetricType metric = MetricType::METRIC_L2);
@@ -78,6 +140,10 @@ class NsgIndex {
     void
     SetKnnGraph(Graph& knng);
 
+    // move nsg into the flat layout, called at the end of build and after load
+    void
+    SealGraph();
+
     virtual void
     Build_with_ids(size_t nb, const float* data, const int64_t* ids, const BuildParams& parameters);
 
@@ -85,11 +151,30 @@ class NsgIndex {
     Search(const float* query, const unsigned& nq, const unsigned& dim, const unsigned& k, float* dist, int64_t* ids,
            SearchParams& params);
 
+    // insert into the sealed graph, zero parameters keep the ones the graph was built with
+    void
+    Add_with_ids(size_t nb, const float* data, const int64_t* ids, const BuildParams& parameters);
+
+    // mark nodes deleted, returns the number of nodes marked
+    size_t
+    Delete_with_ids(const int64_t* ids, size_t n);
+
+    // drop deleted nodes, their in-neighbors are relinked through the deleted nodes' neighbors
+    void
+    Consolidate();
+
+    bool
+    IsDeleted(node_t n) const {
+        return deleted_num > 0 && deleted[n];
+    }
+
+    // bytes of the visited lists kept for concurrent searches, besides the data and the graph
+    size_t
+    SearchScratchBytes() const {
+        return visited_pool_ ? visited_pool_->MaxBytes() : 0;
+    }
+
     // Not support yet.
-    // virtual void Add() = 0;
-    // virtual void Add_with_ids() = 0;
-    // virtual void Delete() = 0;
-    // virtual void Delete_with_ids() = 0;
     // virtual void Rebuild(size_t nb,
     //                     const float *data,
     //                     const int64_t *ids,
@@ -105,9 +190,9 @@ class NsgIndex {
     // link specify
     void
     GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::vector<Neighbor>& fullset,
-                 boost::dynamic_bitset<>& has_calculated_dist);
+                 VisitedList& has_calculated_dist);
 
-    // FindUnconnectedNode
+    // connectivity repair
     void
     GetNeighbors(const float* query, std::vector<Neighbor>& resset, std::vector<Neighbor>& fullset);
 
@@ -115,26 +200,57 @@ class NsgIndex {
     void
     GetNeighbors(const float* query, std::vector<Neighbor>& resset, Graph& graph, SearchParams* param = nullptr);
 
+    // search on sealed graph
+    void
+    GetNeighbors(const float* query, std::vector<Neighbor>& resset, const FlatGraph& graph, SearchParams* param);
+
+    void
+    PrefetchVector(node_t id) const;
+
     void
     Link();
 
     void
-    SyncPrune(size_t q, std::vector<Neighbor>& pool, boost::dynamic_bitset<>& has_calculated, float* cut_graph_dist);
+    SyncPrune(size_t q, std::vector<Neighbor>& pool, VisitedList& has_calculated, float* cut_graph_dist);
 
     void
     SelectEdge(unsigned& cursor, std::vector<Neighbor>& sort_pool, std::vector<Neighbor>& result, bool limit = false);
 
     void
-    InterInsert(unsigned n, std::vector<std::mutex>& mutex_vec, float* dist);
+    InterInsert(size_t n, std::vector<std::mutex>& mutex_vec, float* cut_graph_dist);
+
+    // copy the pruned list of n, distances are left to the caller when cut_graph_dist is null
+    void
+    GetPrunedNeighbors(size_t n, const float* cut_graph_dist, std::vector<Neighbor>& pool);
 
     void
     CheckConnectivity();
 
     void
-    DFS(size_t root, boost::dynamic_bitset<>& flags, int64_t& count);
+    ReorderGraph();
+
+    // grow or widen the sealed rows, new rows are empty
+    void
+    ResizeFlatGraph(size_t n, size_t degree);
 
     void
-    FindUnconnectedNode(boost::dynamic_bitset<>& flags, int64_t& root);
+    LinkNewNode(node_t n, std::vector<Neighbor>& pool);
+
+    void
+    InsertReverseEdge(node_t m, node_t n, float distance);
+
+    // prune candidates of n into its sealed row
+    void
+    PruneRow(node_t n, std::vector<Neighbor>& pool);
+
+    void
+    MarkReachable(node_t root, std::vector<std::atomic<bool>>& has_linked);
+
+    node_t
+    FindLinkedNeighbor(node_t id, const std::vector<std::atomic<bool>>& has_linked);
+
+ protected:
+    VisitedListPoolPtr visited_pool_;
 
     // private:
     //   void GetKnnGraphFromFile();
@@ -16,29 +16,60 @@
 // under the License.
 
 #include <cstring>
+#include <vector>
 
 #include "knowhere/index/vector_index/nsg/NSGIO.h"
 
 namespace knowhere {
 namespace algo {
 
+namespace {
+// files written before the flat layout start straight with ntotal
+constexpr uint32_t NSG_FLAT_MAGIC = 0x4647534e;  // "NSGF"
+}  // namespace
+
 void
 write_index(NsgIndex* index, MemoryIOWriter& writer) {
+    writer(&NSG_FLAT_MAGIC, sizeof(NSG_FLAT_MAGIC), 1);
     writer(&index->ntotal, sizeof(index->ntotal), 1);
     writer(&index->dimension, sizeof(index->dimension), 1);
     writer(&index->navigation_point, sizeof(index->navigation_point), 1);
     writer(index->ori_data_, sizeof(float) * index->ntotal * index->dimension, 1);
     writer(index->ids_, sizeof(int64_t) * index->ntotal, 1);
 
-    for (unsigned i = 0; i < index->ntotal; ++i) {
-        auto neighbor_num = (node_t)index->nsg[i].size();
-        writer(&neighbor_num, sizeof(node_t), 1);
-        writer(index->nsg[i].data(), neighbor_num * sizeof(node_t), 1);
+    auto& graph = index->flat_nsg;
+    writer(&graph.degree, sizeof(graph.degree), 1);
+    writer(graph.data.data(), sizeof(node_t) * graph.data.size(), 1);
+
+    size_t reorder_num = index->origin_offsets.size();
+    writer(&reorder_num, sizeof(reorder_num), 1);
+    writer(index->origin_offsets.data(), sizeof(node_t) * reorder_num, 1);
+
+    // build parameters, reused by later insertions
+    writer(&index->search_length, sizeof(index->search_length), 1);
+    writer(&index->out_degree, sizeof(index->out_degree), 1);
+    writer(&index->candidate_pool_size, sizeof(index->candidate_pool_size), 1);
+
+    std::vector<node_t> deleted;
+    for (size_t i = 0; i < index->ntotal && deleted.size() < index->deleted_num; ++i) {
+        if (index->IsDeleted(i)) {
+            deleted.push_back(i);
+        }
     }
+    size_t deleted_num = deleted.size();
+    writer(&deleted_num, sizeof(deleted_num), 1);
+    writer(deleted.data(), sizeof(node_t) * deleted_num, 1);
 }
 
 NsgIndex*
 read_index(MemoryIOReader& reader) {
+    uint32_t magic;
+    reader(&magic, sizeof(magic), 1);
+    bool flat = (magic == NSG_FLAT_MAGIC);
+    if (!flat) {
+        reader.rp = 0;
+    }
+
     size_t ntotal;
     size_t dimension;
     reader(&ntotal, sizeof(size_t), 1);
@@ -46,20 +77,51 @@ read_index(MemoryIOReader& reader) {
     auto index = new NsgIndex(dimension, ntotal);
     reader(&index->navigation_point, sizeof(index->navigation_point), 1);
 
-    index->ori_data_ = new float[index->ntotal * index->dimension];
-    index->ids_ = new int64_t[index->ntotal];
+    index->ori_data_ = HugePageAllocArray<float>(index->ntotal * index->dimension);
+    index->ids_ = HugePageAllocArray<int64_t>(index->ntotal);
     reader(index->ori_data_, sizeof(float) * index->ntotal * index->dimension, 1);
     reader(index->ids_, sizeof(int64_t) * index->ntotal, 1);
 
-    index->nsg.reserve(index->ntotal);
-    index->nsg.resize(index->ntotal);
-    node_t neighbor_num;
-    for (unsigned i = 0; i < index->ntotal; ++i) {
-        reader(&neighbor_num, sizeof(node_t), 1);
-        index->nsg[i].reserve(neighbor_num);
-        index->nsg[i].resize(neighbor_num);
-        reader(index->nsg[i].data(), neighbor_num * sizeof(node_t), 1);
+    if (flat) {
+        auto& graph = index->flat_nsg;
+        reader(&graph.degree, sizeof(graph.degree), 1);
+        graph.data.resize(index->ntotal * graph.RowSize());
+        reader(graph.data.data(), sizeof(node_t) * graph.data.size(), 1);
+
+        size_t reorder_num = 0;
+        reader(&reorder_num, sizeof(reorder_num), 1);
+        if (reorder_num > 0) {
+            index->origin_offsets.resize(reorder_num);
+            reader(index->origin_offsets.data(), sizeof(node_t) * reorder_num, 1);
+        }
+
+        reader(&index->search_length, sizeof(index->search_length), 1);
+        reader(&index->out_degree, sizeof(index->out_degree), 1);
+        reader(&index->candidate_pool_size, sizeof(index->candidate_pool_size), 1);
+
+        size_t deleted_num = 0;
+        reader(&deleted_num, sizeof(deleted_num), 1);
+        if (deleted_num > 0) {
+            std::vector<node_t> deleted(deleted_num);
+            reader(deleted.data(), sizeof(node_t) * deleted_num, 1);
+            index->deleted.resize(index->ntotal);
+            for (auto offset : deleted) {
+                index->deleted[offset] = true;
+            }
+            index->deleted_num = deleted_num;
+        }
+    } else {
+        index->nsg.reserve(index->ntotal);
+        index->nsg.resize(index->ntotal);
+        node_t neighbor_num;
+        for (unsigned i = 0; i < index->ntotal; ++i) {
+            reader(&neighbor_num, sizeof(node_t), 1);
+            index->nsg[i].reserve(neighbor_num);
+            index->nsg[i].resize(neighbor_num);
+            reader(index->nsg[i].data(), neighbor_num * sizeof(node_t), 1);
+        }
     }
+    index->SealGraph();
 
     index->is_trained = true;
     return index;
@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Neighbor.h"
+
+namespace knowhere {
+namespace algo {
+
+// Visited flags of one search. Instead of clearing a bitset for every query the
+// list bumps an epoch, a node is visited when its tag equals the current epoch.
+// One byte per node, the tags are cleared once every 255 searches when the epoch wraps.
+class VisitedList {
+ public:
+    explicit VisitedList(size_t n) : tags_(n, 0) {
+    }
+
+    void
+    Reset() {
+        if (++epoch_ == 0) {
+            // epoch wrapped around, stale tags could alias the new epoch
+            std::fill(tags_.begin(), tags_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    bool
+    Visited(node_t id) const {
+        return tags_[id] == epoch_;
+    }
+
+    void
+    Set(node_t id) {
+        tags_[id] = epoch_;
+    }
+
+    const uint8_t*
+    Tag(node_t id) const {
+        return tags_.data() + id;
+    }
+
+    size_t
+    Size() const {
+        return tags_.size();
+    }
+
+ private:
+    std::vector<uint8_t> tags_;
+    uint8_t epoch_ = 0;
+};
+
+using VisitedListPtr = std::shared_ptr<VisitedList>;
+
+// Recycles visited lists across queries, a list handed out returns to the pool when released.
+// At most max_free lists are kept, one per hardware thread by default, the others are freed on release.
+class VisitedListPool {
+ public:
+    explicit VisitedListPool(size_t n, size_t max_free = std::max(1u, std::thread::hardware_concurrency()))
+        : n_(n), max_free_(max_free) {
+    }
+
+    VisitedListPtr
+    Get() {
+        VisitedList* list = nullptr;
+        {
+            LockGuard lk(mutex_);
+            if (!free_lists_.empty()) {
+                list = free_lists_.back().release();
+                free_lists_.pop_back();
+            }
+        }
+        if (list == nullptr) {
+            list = new VisitedList(n_);
+            LockGuard lk(mutex_);
+            ++allocated_;
+        }
+        list->Reset();
+
+        return VisitedListPtr(list, [this](VisitedList* released) {
+            LockGuard lk(mutex_);
+            if (free_lists_.size() < max_free_) {
+                free_lists_.emplace_back(released);
+            } else {
+                delete released;
+                --allocated_;
+            }
+        });
+    }
+
+    // free the idle lists, e.g. the ones of every build thread once a build is done
+    void
+    Trim() {
+        LockGuard lk(mutex_);
+        allocated_ -= free_lists_.size();
+        free_lists_.clear();
+    }
+
+    // bytes of the lists handed out or kept
+    size_t
+    Bytes() {
+        LockGuard lk(mutex_);
+        return allocated_ * n_;
+    }
+
+    // bytes the pool keeps at most once searches are done
+    size_t
+    MaxBytes() const {
+        return max_free_ * n_;
+    }
+
+ private:
+    size_t n_;
+    size_t max_free_;
+    size_t allocated_ = 0;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<VisitedList>> free_lists_;
+};
+
+using VisitedListPoolPtr = std::shared_ptr<VisitedListPool>;
+
+}  // namespace algo
+}  // namespace knowhere
@@ -19,7 +19,9 @@
 #include <iostream>
 
 #include "knowhere/adapter/Structure.h"
+#include "knowhere/common/Arena.h"
 #include "knowhere/common/Exception.h"
+#include "knowhere/common/HugePage.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
 #include "knowhere/index/vector_index/helpers/Cloner.h"
 
@@ -175,3 +177,53 @@ TEST_F(IDMAPTest, copy_test) {
         AssertAnns(device_result, nq, k);
     }
 }
+
+TEST_F(IDMAPTest, scratch_and_huge_page) {
+    auto conf = std::make_shared<knowhere::Cfg>();
+    conf->d = dim;
+    conf->k = k;
+    conf->metric_type = knowhere::METRICTYPE::L2;
+
+    index_->Train(conf);
+    index_->Add(base_dataset, conf);
+    auto result = index_->Search(query_dataset, conf);
+    auto ids = result->array()[0]->data()->GetValues<int64_t>(1, 0);
+    std::vector<int64_t> expect(ids, ids + nq * k);
+
+    {
+        // result buffers come from the thread arena and are recycled by the next query
+        knowhere::ScratchScope scope;
+        for (int i = 0; i < 3; ++i) {
+            auto scratch_result = index_->Search(query_dataset, conf);
+            AssertAnns(scratch_result, nq, k);
+            auto scratch_ids = scratch_result->array()[0]->data()->GetValues<int64_t>(1, 0);
+            ASSERT_EQ(std::vector<int64_t>(scratch_ids, scratch_ids + nq * k), expect);
+        }
+        ASSERT_GT(knowhere::ScratchArena::GetInstance().Reserved(), 0);
+    }
+    ASSERT_FALSE(knowhere::ScratchArena::GetInstance().Active());
+    ASSERT_EQ(knowhere::ScratchArena::GetInstance().Allocate(16), nullptr);
+
+    knowhere::SetHugePageMode(knowhere::HugePageMode::MADVISE, 1024 * 1024);
+    auto before = knowhere::GetHugePageStats();
+    size_t size = 4 * 1024 * 1024 + 1;
+    auto buffer = static_cast<uint8_t*>(knowhere::HugePageAlloc(size));
+    memset(buffer, 1, size);
+    auto after = knowhere::GetHugePageStats();
+    ASSERT_GE(after.madvise_bytes + after.fallback_bytes - before.madvise_bytes - before.fallback_bytes, size);
+    knowhere::HugePageFree(buffer);
+    after = knowhere::GetHugePageStats();
+    ASSERT_EQ(after.madvise_bytes, before.madvise_bytes);
+    ASSERT_EQ(after.fallback_bytes, before.fallback_bytes);
+
+    // small buffers stay on the heap
+    auto small = knowhere::HugePageAllocArray<float>(16);
+    knowhere::HugePageFree(small);
+
+    // loading advises the raw vectors in place, searching still works
+    auto binaryset = index_->Serialize();
+    auto new_index = std::make_shared<knowhere::IDMAP>();
+    new_index->Load(binaryset);
+    AssertAnns(new_index->Search(query_dataset, conf), nq, k);
+    knowhere::SetHugePageMode(knowhere::HugePageMode::OFF);
+}
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <set>
 #include <thread>
 
 #include <faiss/gpu/GpuIndexIVFFlat.h>
@@ -91,6 +92,85 @@ TEST_P(IVFTest, ivf_basic) {
     // PrintResult(result, nq, k);
 }
 
+TEST_P(IVFTest, ivf_merge) {
+    if (index_type.find("GPU") != std::string::npos || index_type.find("Hybrid") != std::string::npos) {
+        return;
+    }
+
+    auto half = nb / 2;
+    auto first_half = generate_dataset(half, dim, xb.data(), ids.data());
+    auto second_half = generate_dataset(nb - half, dim, xb.data() + half * dim, ids.data() + half);
+
+    // same model, the inverted lists are concatenated
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(first_half, conf);
+    auto shared = IndexFactory(index_type);
+    shared->set_index_model(model);
+    shared->Add(second_half, conf);
+    index_->Merge(*shared);
+    EXPECT_EQ(index_->Count(), nb);
+    AssertAnns(index_->Search(query_dataset, conf), nq, conf->k);
+
+    // separately trained, flat vectors are assigned again by the target quantizer, codes are not encoded twice
+    auto target = IndexFactory(index_type);
+    target->set_index_model(target->Train(first_half, conf));
+    target->Add(first_half, conf);
+    target->Seal();
+    auto source = IndexFactory(index_type);
+    source->set_index_model(source->Train(second_half, conf));
+    source->Add(second_half, conf);
+    if (index_type != "IVF") {
+        ASSERT_ANY_THROW(target->Merge(*source));
+        return;
+    }
+    target->Merge(*source);
+    EXPECT_EQ(target->Count(), nb);
+    EXPECT_EQ(source->Count(), nb - half);
+    auto result = target->Search(query_dataset, conf);
+    AssertAnns(result, nq, conf->k);
+
+    ASSERT_ANY_THROW(target->Merge(*target));
+}
+
+TEST_P(IVFTest, ivf_merge_recall) {
+    if (index_type != "IVFSQ") {
+        return;
+    }
+
+    auto half = nb / 2;
+    auto first_half = generate_dataset(half, dim, xb.data(), ids.data());
+    auto second_half = generate_dataset(nb - half, dim, xb.data() + half * dim, ids.data() + half);
+
+    // a merged sq8 index answers like one holding every vector, its codes are copied and not encoded again
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+    auto merged = IndexFactory(index_type);
+    merged->set_index_model(model);
+    merged->Add(first_half, conf);
+    auto source = IndexFactory(index_type);
+    source->set_index_model(model);
+    source->Add(second_half, conf);
+    merged->Merge(*source);
+    ASSERT_EQ(merged->Count(), nb);
+
+    auto k = conf->k;
+    auto unmerged_ids = index_->Search(query_dataset, conf)->array()[0];
+    auto merged_ids = merged->Search(query_dataset, conf)->array()[0];
+    int64_t hit = 0;
+    for (int64_t i = 0; i < nq; i++) {
+        std::set<int64_t> expected;
+        for (int64_t j = 0; j < k; j++) {
+            expected.insert(*(unmerged_ids->data()->GetValues<int64_t>(1, i * k + j)));
+        }
+        for (int64_t j = 0; j < k; j++) {
+            hit += expected.count(*(merged_ids->data()->GetValues<int64_t>(1, i * k + j)));
+        }
+    }
+    ASSERT_GE(hit, nq * k * 99 / 100);
+}
+
 TEST_P(IVFTest, ivf_serialize) {
     auto serialize = [](const std::string& filename, knowhere::BinaryPtr& bin, uint8_t* ret) {
         FileIOWriter writer(filename);
@@ -148,6 +228,46 @@ TEST_P(IVFTest, ivf_serialize) {
     }
 }
 
+TEST_P(IVFTest, ivf_mmap) {
+    if (index_type.find("GPU") != std::string::npos || index_type.find("Hybrid") != std::string::npos) {
+        return;
+    }
+
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+    auto binaryset = index_->Serialize();
+    auto bin = binaryset.GetByName("IVF");
+
+    // the faiss stream is mapped from the middle of a file, like in the files written by the engine
+    std::string filename = "/tmp/ivf_test_mmap.bin";
+    std::string head = "index header";
+    {
+        FileIOWriter writer(filename);
+        writer(const_cast<char*>(head.data()), head.size());
+        writer(static_cast<void*>(bin->data.get()), bin->size);
+    }
+
+    auto mapped = IndexFactory(index_type);
+    mapped->LoadMapped(filename, head.size());
+    EXPECT_EQ(mapped->Count(), nb);
+    EXPECT_EQ(mapped->Dimension(), dim);
+    EXPECT_GT(mapped->MappedSize(), 0);
+    EXPECT_LE(mapped->MappedSize(), bin->size);
+    EXPECT_EQ(index_->MappedSize(), 0);
+    auto result = mapped->Search(query_dataset, conf);
+    AssertAnns(result, nq, conf->k);
+    EXPECT_GT(mapped->ResidentSize(), 0);
+
+    // serializing a mapped index writes the lists themselves
+    auto reloaded = IndexFactory(index_type);
+    reloaded->Load(mapped->Serialize());
+    EXPECT_EQ(reloaded->Count(), nb);
+    AssertAnns(reloaded->Search(query_dataset, conf), nq, conf->k);
+
+    ASSERT_ANY_THROW(mapped->LoadMapped(filename, head.size() + bin->size + 1));
+}
+
 TEST_P(IVFTest, clone_test) {
     assert(!xb.empty());
 
@@ -19,12 +19,16 @@
 
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "knowhere/adapter/SptagAdapter.h"
 #include "knowhere/adapter/Structure.h"
 #include "knowhere/common/Exception.h"
-#include "knowhere/index/vector_index/IndexKDT.h"
+#include "knowhere/index/vector_index/IndexSPTAG.h"
 #include "knowhere/index/vector_index/helpers/Definitions.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
 
 #include "unittest/utils.h"
 
@@ -32,28 +36,45 @@ using ::testing::Combine;
 using ::testing::TestWithParam;
 using ::testing::Values;
 
-class KDTTest : public DataGen, public ::testing::Test {
+class SPTAGTest : public DataGen, public TestWithParam<std::string> {
  protected:
     void
     SetUp() override {
         Generate(96, 1000, 10);
-        index_ = std::make_shared<knowhere::CPUKDTRNG>();
-
-        auto tempconf = std::make_shared<knowhere::KDTCfg>();
-        tempconf->tptnubmber = 1;
-        tempconf->k = 10;
-        conf = tempconf;
+        auto index_type = GetParam();
+        if (index_type == "KDT") {
+            index_ = std::make_shared<knowhere::CPUKDTRNG>();
+            auto tempconf = std::make_shared<knowhere::KDTCfg>();
+            tempconf->tptnumber = 1;
+            tempconf->k = 10;
+            conf = tempconf;
+        } else {
+            index_ = std::make_shared<knowhere::CPUBKTRNG>();
+            auto tempconf = std::make_shared<knowhere::BKTCfg>();
+            tempconf->tptnumber = 1;
+            tempconf->k = 10;
+            conf = tempconf;
+        }
 
         Init_with_default();
     }
 
+    std::shared_ptr<knowhere::CPUSPTAGRNG>
+    NewIndex() {
+        if (GetParam() == "KDT") {
+            return std::make_shared<knowhere::CPUKDTRNG>();
+        }
+        return std::make_shared<knowhere::CPUBKTRNG>();
+    }
+
  protected:
     knowhere::Config conf;
-    std::shared_ptr<knowhere::CPUKDTRNG> index_ = nullptr;
+    std::shared_ptr<knowhere::CPUSPTAGRNG> index_ = nullptr;
 };
 
-// TODO(lxj): add test about count() and dimension()
-TEST_F(KDTTest, kdt_basic) {
+INSTANTIATE_TEST_CASE_P(SPTAGParameters, SPTAGTest, Values("KDT", "BKT"));
+
+TEST_P(SPTAGTest, sptag_basic) {
     assert(!xb.empty());
 
     auto preprocessor = index_->BuildPreprocessor(base_dataset, conf);
@@ -62,79 +83,68 @@ TEST_F(KDTTest, kdt_basic) {
     auto model = index_->Train(base_dataset, conf);
     index_->set_index_model(model);
     index_->Add(base_dataset, conf);
+    ASSERT_EQ(index_->Count(), nb);
+    ASSERT_EQ(index_->Dimension(), dim);
+
     auto result = index_->Search(query_dataset, conf);
     AssertAnns(result, nq, k);
+}
+
+TEST_P(SPTAGTest, sptag_serialize) {
+    assert(!xb.empty());
 
+    index_->Train(base_dataset, conf);
+    auto binaryset = index_->Serialize();
     {
-        auto ids = result->array()[0];
-        auto dists = result->array()[1];
-
-        std::stringstream ss_id;
-        std::stringstream ss_dist;
-        for (auto i = 0; i < nq; i++) {
-            for (auto j = 0; j < k; ++j) {
-                ss_id << *ids->data()->GetValues<int64_t>(1, i * k + j) << " ";
-                ss_dist << *dists->data()->GetValues<float>(1, i * k + j) << " ";
-            }
-            ss_id << std::endl;
-            ss_dist << std::endl;
+        auto new_index = NewIndex();
+        new_index->Load(binaryset);
+        auto result = new_index->Search(query_dataset, conf);
+        AssertAnns(result, nq, k);
+        ASSERT_EQ(new_index->Count(), nb);
+        ASSERT_EQ(new_index->Dimension(), dim);
+        ASSERT_THROW({ new_index->Clone(); }, knowhere::KnowhereException);
+        ASSERT_NO_THROW({ new_index->Seal(); });
+    }
+
+    {
+        int fileno = 0;
+        const std::string& base_name = "/tmp/sptag_serialize_test_bin_";
+        std::vector<std::string> filename_list;
+        std::vector<std::pair<std::string, size_t>> meta_list;
+        for (auto& iter : binaryset.binary_map_) {
+            const std::string& filename = base_name + std::to_string(fileno);
+            FileIOWriter writer(filename);
+            writer(iter.second->data.get(), iter.second->size);
+
+            meta_list.emplace_back(std::make_pair(iter.first, iter.second->size));
+            filename_list.push_back(filename);
+            ++fileno;
         }
-        std::cout << "id\n" << ss_id.str() << std::endl;
-        std::cout << "dist\n" << ss_dist.str() << std::endl;
+
+        knowhere::BinarySet load_data_list;
+        for (int i = 0; i < filename_list.size() && i < meta_list.size(); ++i) {
+            auto bin_size = meta_list[i].second;
+            FileIOReader reader(filename_list[i]);
+
+            auto load_data = new uint8_t[bin_size];
+            reader(load_data, bin_size);
+            std::shared_ptr<uint8_t> data(load_data, std::default_delete<uint8_t[]>());
+            load_data_list.Append(meta_list[i].first, data, bin_size);
+        }
+
+        // drop the original blobs so the loaded index can only rely on its own copy
+        binaryset.clear();
+        index_ = nullptr;
+
+        auto new_index = NewIndex();
+        new_index->Load(load_data_list);
+        load_data_list.clear();
+        auto result = new_index->Search(query_dataset, conf);
+        AssertAnns(result, nq, k);
     }
 }
 
-// TODO(zirui): enable test
-// TEST_F(KDTTest, kdt_serialize) {
-//    assert(!xb.empty());
-//
-//    auto preprocessor = index_->BuildPreprocessor(base_dataset, conf);
-//    index_->set_preprocessor(preprocessor);
-//
-//    auto model = index_->Train(base_dataset, conf);
-//    // index_->Add(base_dataset, conf);
-//    auto binaryset = index_->Serialize();
-//    auto new_index = std::make_shared<knowhere::CPUKDTRNG>();
-//    new_index->Load(binaryset);
-//    auto result = new_index->Search(query_dataset, conf);
-//    AssertAnns(result, nq, k);
-//    PrintResult(result, nq, k);
-//    ASSERT_EQ(new_index->Count(), nb);
-//    ASSERT_EQ(new_index->Dimension(), dim);
-//    ASSERT_THROW({ new_index->Clone(); }, knowhere::KnowhereException);
-//    ASSERT_NO_THROW({ new_index->Seal(); });
-//
-//    {
-//        int fileno = 0;
-//        const std::string& base_name = "/tmp/kdt_serialize_test_bin_";
-//        std::vector<std::string> filename_list;
-//        std::vector<std::pair<std::string, size_t>> meta_list;
-//        for (auto& iter : binaryset.binary_map_) {
-//            const std::string& filename = base_name + std::to_string(fileno);
-//            FileIOWriter writer(filename);
-//            writer(iter.second->data.get(), iter.second->size);
-//
-//            meta_list.emplace_back(std::make_pair(iter.first, iter.second->size));
-//            filename_list.push_back(filename);
-//            ++fileno;
-//        }
-//
-//        knowhere::BinarySet load_data_list;
-//        for (int i = 0; i < filename_list.size() && i < meta_list.size(); ++i) {
-//            auto bin_size = meta_list[i].second;
-//            FileIOReader reader(filename_list[i]);
-//
-//            auto load_data = new uint8_t[bin_size];
-//            reader(load_data, bin_size);
-//            auto data = std::make_shared<uint8_t>();
-//            data.reset(load_data);
-//            load_data_list.Append(meta_list[i].first, data, bin_size);
-//        }
-//
-//        auto new_index = std::make_shared<knowhere::CPUKDTRNG>();
-//        new_index->Load(load_data_list);
-//        auto result = new_index->Search(query_dataset, conf);
-//        AssertAnns(result, nq, k);
-//        PrintResult(result, nq, k);
-//    }
-//}
+TEST_P(SPTAGTest, sptag_ip_not_support) {
+    conf->metric_type = knowhere::METRICTYPE::IP;
+    ASSERT_THROW({ index_->Train(base_dataset, conf); }, knowhere::KnowhereException);
+}
@@ -16,13 +16,23 @@
 // under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <random>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/FaissBaseIndex.h"
 #include "knowhere/index/vector_index/IndexNSG.h"
 #include "knowhere/index/vector_index/helpers/FaissGpuResourceMgr.h"
+#include "knowhere/index/vector_index/nsg/NSG.h"
 #include "knowhere/index/vector_index/nsg/NSGIO.h"
+#include "knowhere/index/vector_index/nsg/VisitedList.h"
 
 #include "unittest/utils.h"
 
@@ -106,3 +116,368 @@ TEST_F(NSGInterfaceTest, basic_test) {
         // new_index->Search(GenQuery(500), Config::object{{"k", 5}});
     }
 }
+
+TEST(NSGHelperTest, visited_list_test) {
+    knowhere::algo::VisitedListPool pool(100);
+    {
+        auto visited = pool.Get();
+        ASSERT_FALSE(visited->Visited(10));
+        visited->Set(10);
+        ASSERT_TRUE(visited->Visited(10));
+    }
+
+    // released list is recycled with a new epoch, old marks no longer count
+    auto visited = pool.Get();
+    ASSERT_EQ(visited->Size(), 100);
+    ASSERT_FALSE(visited->Visited(10));
+
+    for (int i = 0; i < 70000; ++i) {
+        visited->Set(i % 100);
+        visited->Reset();
+    }
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_FALSE(visited->Visited(i));
+    }
+
+    // lists beyond max_free are freed on release, the kept ones when trimmed
+    knowhere::algo::VisitedListPool capped(100, 1);
+    {
+        auto first = capped.Get();
+        auto second = capped.Get();
+        ASSERT_EQ(capped.Bytes(), 200);
+    }
+    ASSERT_EQ(capped.Bytes(), 100);
+    ASSERT_EQ(capped.MaxBytes(), 100);
+    capped.Trim();
+    ASSERT_EQ(capped.Bytes(), 0);
+}
+
+namespace {
+float
+L2Sqr(const float* a, const float* b, int64_t dim) {
+    float dist = 0;
+    for (int64_t i = 0; i < dim; ++i) {
+        dist += (a[i] - b[i]) * (a[i] - b[i]);
+    }
+    return dist;
+}
+
+// exact top-k of every query against base, offsets into base
+std::vector<std::vector<int64_t>>
+BruteForce(const std::vector<float>& base, const float* queries, int64_t nq, int64_t dim, int64_t k, bool skip_self) {
+    int64_t nb = base.size() / dim;
+    std::vector<std::vector<int64_t>> result(nq);
+#pragma omp parallel for
+    for (int64_t i = 0; i < nq; ++i) {
+        std::vector<std::pair<float, int64_t>> dists(nb);
+        for (int64_t j = 0; j < nb; ++j) {
+            dists[j] = {L2Sqr(queries + i * dim, base.data() + j * dim, dim), j};
+        }
+        int64_t topk = std::min(nb, k + (skip_self ? 1 : 0));
+        std::partial_sort(dists.begin(), dists.begin() + topk, dists.end());
+        for (int64_t j = skip_self ? 1 : 0; j < topk; ++j) {
+            result[i].push_back(dists[j].second);
+        }
+    }
+    return result;
+}
+}  // namespace
+
+// CPU only: knng from brute force, the BFS reordered graph only renumbers nodes, its recall must not change
+TEST(NSGBenchmark, reorder_recall) {
+    const int64_t nb = 10000, nq = 1000, dim = 64, k = 10, knng_k = 20;
+    std::mt19937 rng(7);
+    std::normal_distribution<float> distribution;
+    std::vector<float> xb(nb * dim), xq(nq * dim);
+    for (auto& x : xb) x = distribution(rng);
+    for (auto& x : xq) x = distribution(rng);
+    std::vector<int64_t> ids(nb);
+    for (int64_t i = 0; i < nb; ++i) ids[i] = i;
+
+    auto knng = BruteForce(xb, xb.data(), nb, dim, knng_k, true);
+    auto ground_truth = BruteForce(xb, xq.data(), nq, dim, k, false);
+
+    const std::vector<size_t> search_lengths{20, 40, 80};
+    std::vector<std::vector<double>> recalls;
+    for (bool reorder : {false, true}) {
+        knowhere::algo::NsgIndex index(dim, nb);
+        knowhere::algo::Graph graph = knng;
+        index.SetKnnGraph(graph);
+
+        knowhere::algo::BuildParams build_params;
+        build_params.search_length = 40;
+        build_params.out_degree = 30;
+        build_params.candidate_pool_size = 100;
+        build_params.reorder = reorder;
+        index.Build_with_ids(nb, xb.data(), ids.data(), build_params);
+        ASSERT_EQ(index.origin_offsets.size(), reorder ? nb : 0);
+
+        recalls.emplace_back();
+        for (auto search_length : search_lengths) {
+            knowhere::algo::SearchParams search_params;
+            search_params.search_length = search_length;
+            std::vector<float> dist(nq * k);
+            std::vector<int64_t> result(nq * k);
+
+            auto start = std::chrono::steady_clock::now();
+            index.Search(xq.data(), nq, dim, k, dist.data(), result.data(), search_params);
+            std::chrono::duration<double> cost = std::chrono::steady_clock::now() - start;
+
+            int64_t hit = 0;
+            for (int64_t i = 0; i < nq; ++i) {
+                std::set<int64_t> truth(ground_truth[i].begin(), ground_truth[i].end());
+                for (int64_t j = 0; j < k; ++j) hit += truth.count(result[i * k + j]);
+            }
+            recalls.back().push_back(hit / double(nq * k));
+            printf("reorder=%d search_length=%zu recall@%ld=%.4f qps=%.0f\n", reorder, search_length, k,
+                   recalls.back().back(), nq / cost.count());
+        }
+    }
+
+    for (size_t i = 0; i < search_lengths.size(); ++i) {
+        ASSERT_NEAR(recalls[0][i], recalls[1][i], 0.01);
+        if (i > 0) {
+            ASSERT_GE(recalls[1][i], recalls[1][i - 1]);
+        }
+    }
+    ASSERT_GT(recalls[1].back(), 0.8);
+}
+
+// capped build recomputes pruned distances instead of caching them, the graph quality must not change
+TEST(NSGBenchmark, memory_cap_build) {
+    const int64_t nb = 5000, nq = 500, dim = 64, k = 10, knng_k = 20;
+    std::mt19937 rng(7);
+    std::normal_distribution<float> distribution;
+    std::vector<float> xb(nb * dim), xq(nq * dim);
+    for (auto& x : xb) x = distribution(rng);
+    for (auto& x : xq) x = distribution(rng);
+    std::vector<int64_t> ids(nb);
+    for (int64_t i = 0; i < nb; ++i) ids[i] = i;
+
+    auto knng = BruteForce(xb, xb.data(), nb, dim, knng_k, true);
+    auto ground_truth = BruteForce(xb, xq.data(), nq, dim, k, false);
+
+    std::vector<double> recalls;
+    std::vector<size_t> transient_bytes;
+    for (size_t memory_cap : {0, 1}) {
+        knowhere::algo::NsgIndex index(dim, nb);
+        knowhere::algo::Graph graph = knng;
+        index.SetKnnGraph(graph);
+
+        knowhere::algo::BuildParams build_params;
+        build_params.search_length = 40;
+        build_params.out_degree = 30;
+        build_params.candidate_pool_size = 100;
+        build_params.memory_cap = memory_cap;
+        index.Build_with_ids(nb, xb.data(), ids.data(), build_params);
+
+        auto& stats = index.build_stats;
+        ASSERT_EQ(stats.recompute_distance, memory_cap != 0);
+        ASSERT_GE(stats.repaired_nodes, 0);
+        printf("memory_cap=%zu prune=%.0fus inter_insert=%.0fus connect=%.0fus repaired=%ld transient=%zu\n",
+               memory_cap, stats.prune_us, stats.inter_insert_us, stats.connect_us, stats.repaired_nodes,
+               stats.transient_bytes);
+        transient_bytes.push_back(stats.transient_bytes);
+
+        knowhere::algo::SearchParams search_params;
+        search_params.search_length = 40;
+        std::vector<float> dist(nq * k);
+        std::vector<int64_t> result(nq * k);
+        index.Search(xq.data(), nq, dim, k, dist.data(), result.data(), search_params);
+
+        int64_t hit = 0;
+        for (int64_t i = 0; i < nq; ++i) {
+            std::set<int64_t> truth(ground_truth[i].begin(), ground_truth[i].end());
+            for (int64_t j = 0; j < k; ++j) hit += truth.count(result[i * k + j]);
+        }
+        recalls.push_back(hit / double(nq * k));
+    }
+    ASSERT_LT(transient_bytes[1], transient_bytes[0]);
+    ASSERT_EQ(transient_bytes[1], nb);  // a single prune thread, one visited byte per node
+    ASSERT_NEAR(recalls[0], recalls[1], 0.02);
+}
+
+// grow a sealed graph by insertion, then delete lazily and consolidate
+TEST(NSGDynamicTest, add_delete_consolidate) {
+    const int64_t nb = 4000, nb_build = 3000, nq = 200, dim = 64, k = 10, knng_k = 20;
+    std::mt19937 rng(7);
+    std::normal_distribution<float> distribution;
+    std::vector<float> xb(nb * dim), xq(nq * dim);
+    for (auto& x : xb) x = distribution(rng);
+    for (auto& x : xq) x = distribution(rng);
+    std::vector<int64_t> ids(nb);
+    for (int64_t i = 0; i < nb; ++i) ids[i] = i;
+
+    std::vector<float> xb_build(xb.begin(), xb.begin() + nb_build * dim);
+    auto knng = BruteForce(xb_build, xb_build.data(), nb_build, dim, knng_k, true);
+    auto ground_truth = BruteForce(xb, xq.data(), nq, dim, k, false);
+
+    knowhere::algo::NsgIndex index(dim, nb_build);
+    index.SetKnnGraph(knng);
+    knowhere::algo::BuildParams build_params;
+    build_params.search_length = 40;
+    build_params.out_degree = 30;
+    build_params.candidate_pool_size = 100;
+    index.Build_with_ids(nb_build, xb.data(), ids.data(), build_params);
+
+    knowhere::algo::BuildParams keep_params{0, 0, 0};
+    index.Add_with_ids(nb - nb_build, xb.data() + nb_build * dim, ids.data() + nb_build, keep_params);
+    ASSERT_EQ(index.ntotal, nb);
+
+    knowhere::algo::SearchParams search_params;
+    search_params.search_length = 40;
+    std::vector<float> dist(nq * k);
+    std::vector<int64_t> result(nq * k);
+    auto recall = [&](const std::set<int64_t>& removed) {
+        index.Search(xq.data(), nq, dim, k, dist.data(), result.data(), search_params);
+        int64_t hit = 0;
+        for (int64_t i = 0; i < nq; ++i) {
+            std::set<int64_t> truth(ground_truth[i].begin(), ground_truth[i].end());
+            for (int64_t j = 0; j < k; ++j) {
+                EXPECT_EQ(removed.count(result[i * k + j]), 0);
+                hit += truth.count(result[i * k + j]);
+            }
+        }
+        return hit / double(nq * k);
+    };
+    std::set<int64_t> removed;
+    auto added_recall = recall(removed);
+    printf("recall after add %.4f\n", added_recall);
+    ASSERT_GT(added_recall, 0.5);
+
+    // removed vectors are never returned, neither when marked nor after consolidation
+    std::vector<int64_t> to_delete;
+    for (int64_t i = 0; i < nb; i += 5) to_delete.push_back(i);
+    removed.insert(to_delete.begin(), to_delete.end());
+    ASSERT_EQ(index.Delete_with_ids(to_delete.data(), to_delete.size()), to_delete.size());
+    recall(removed);
+
+    index.Consolidate();
+    ASSERT_EQ(index.ntotal, nb - to_delete.size());
+    ASSERT_EQ(index.deleted_num, 0);
+    recall(removed);
+}
+
+TEST(NSGDynamicTest, search_during_add) {
+    const int64_t nb = 3000, nb_build = 1000, nq = 10, dim = 32, k = 10, knng_k = 20;
+    std::mt19937 rng(11);
+    std::normal_distribution<float> distribution;
+    std::vector<float> xb(nb * dim), xq(nq * dim);
+    for (auto& x : xb) x = distribution(rng);
+    for (auto& x : xq) x = distribution(rng);
+    std::vector<int64_t> ids(nb);
+    for (int64_t i = 0; i < nb; ++i) ids[i] = i;
+
+    std::vector<float> xb_build(xb.begin(), xb.begin() + nb_build * dim);
+    auto knng = BruteForce(xb_build, xb_build.data(), nb_build, dim, knng_k, true);
+    knowhere::algo::NsgIndex index(dim, nb_build);
+    index.SetKnnGraph(knng);
+    knowhere::algo::BuildParams build_params;
+    build_params.search_length = 40;
+    build_params.out_degree = 30;
+    build_params.candidate_pool_size = 100;
+    index.Build_with_ids(nb_build, xb.data(), ids.data(), build_params);
+
+    // searches keep reading the graph while inserts and deletes replace its buffers
+    std::atomic<bool> done{false};
+    std::thread searcher([&] {
+        knowhere::algo::SearchParams search_params;
+        search_params.search_length = 40;
+        std::vector<float> dist(nq * k);
+        std::vector<int64_t> result(nq * k);
+        while (!done) {
+            index.Search(xq.data(), nq, dim, k, dist.data(), result.data(), search_params);
+            for (auto id : result) {
+                EXPECT_LT(id, nb);
+            }
+        }
+    });
+
+    knowhere::algo::BuildParams keep_params{0, 0, 0};
+    const int64_t batch = 100;
+    for (int64_t begin = nb_build; begin < nb; begin += batch) {
+        index.Add_with_ids(batch, xb.data() + begin * dim, ids.data() + begin, keep_params);
+        index.Delete_with_ids(ids.data() + begin, 1);
+    }
+    index.Consolidate();
+    done = true;
+    searcher.join();
+    ASSERT_EQ(index.ntotal, nb - (nb - nb_build) / batch);
+}
+
+TEST(NSGDynamicTest, search_with_allow) {
+    const int64_t nb = 2000, nq = 10, dim = 32, k = 10, knng_k = 20;
+    std::mt19937 rng(13);
+    std::normal_distribution<float> distribution;
+    std::vector<float> xb(nb * dim), xq(nq * dim);
+    for (auto& x : xb) x = distribution(rng);
+    for (auto& x : xq) x = distribution(rng);
+    std::vector<int64_t> ids(nb);
+    for (int64_t i = 0; i < nb; ++i) ids[i] = 100 + i;
+
+    auto knng = BruteForce(xb, xb.data(), nb, dim, knng_k, true);
+    knowhere::algo::NsgIndex index(dim, nb);
+    index.SetKnnGraph(knng);
+    knowhere::algo::BuildParams build_params;
+    build_params.search_length = 40;
+    build_params.out_degree = 30;
+    build_params.candidate_pool_size = 100;
+    index.Build_with_ids(nb, xb.data(), ids.data(), build_params);
+
+    // only the even ids are allowed, rejected nodes are skipped but still routed through
+    knowhere::algo::SearchParams search_params;
+    search_params.search_length = 100;
+    search_params.allow = [](int64_t id) { return id % 2 == 0; };
+    std::vector<float> dist(nq * k);
+    std::vector<int64_t> result(nq * k);
+    index.Search(xq.data(), nq, dim, k, dist.data(), result.data(), search_params);
+    for (auto id : result) {
+        ASSERT_GE(id, 100);
+        ASSERT_EQ(id % 2, 0);
+    }
+}
+
+TEST(NSGDynamicTest, get_ids_and_reconstruct) {
+    const int64_t nb = 1000, dim = 16, knng_k = 20;
+    std::mt19937 rng(17);
+    std::normal_distribution<float> distribution;
+    std::vector<float> xb(nb * dim);
+    for (auto& x : xb) x = distribution(rng);
+    std::vector<int64_t> ids(nb);
+    for (int64_t i = 0; i < nb; ++i) ids[i] = 100 + i;
+
+    auto knng = BruteForce(xb, xb.data(), nb, dim, knng_k, true);
+    knowhere::algo::NsgIndex algo_index(dim, nb);
+    algo_index.SetKnnGraph(knng);
+    knowhere::algo::BuildParams build_params;
+    build_params.search_length = 40;
+    build_params.out_degree = 30;
+    build_params.candidate_pool_size = 100;
+    algo_index.Build_with_ids(nb, xb.data(), ids.data(), build_params);
+
+    knowhere::MemoryIOWriter writer;
+    knowhere::algo::write_index(&algo_index, writer);
+    std::shared_ptr<uint8_t> data(writer.data_);
+    knowhere::BinarySet binary_set;
+    binary_set.Append("NSG", data, writer.rp);
+    knowhere::NSG index;
+    index.Load(binary_set);
+
+    // lazily deleted nodes are left out, every other id leads back to its original vector
+    std::vector<int64_t> to_delete{100, 101, 500};
+    index.Delete(to_delete.data(), to_delete.size());
+    std::vector<int64_t> found_ids, slots;
+    index.GetIds(found_ids, slots);
+    ASSERT_EQ(found_ids.size(), nb - to_delete.size());
+    ASSERT_EQ(slots.size(), found_ids.size());
+    std::vector<float> vector(dim);
+    for (size_t i = 0; i < found_ids.size(); ++i) {
+        ASSERT_EQ(std::count(to_delete.begin(), to_delete.end(), found_ids[i]), 0);
+        index.Reconstruct(slots[i], vector.data());
+        int64_t offset = found_ids[i] - 100;
+        for (int64_t j = 0; j < dim; ++j) {
+            ASSERT_FLOAT_EQ(vector[j], xb[offset * dim + j]);
+        }
+    }
+    ASSERT_THROW(index.Reconstruct(nb, vector.data()), knowhere::KnowhereException);
+}
@@ -203,6 +203,46 @@ class MetricsBase {
     virtual void
     CPUTemperature() {
     }
+
+    // phase: queue_wait, load, execute or reduce
+    virtual void
+    SearchPhaseDurationSecondsHistogramObserve(const std::string& phase, const std::string& table_id, int engine_type,
+                                               const std::string& resource, double value) {
+    }
+
+    virtual void
+    TableCacheAccessIncrement(const std::string& table_id, const std::string& cache, bool hit) {
+    }
+
+    virtual void
+    TableDiskLoadBytesIncrement(const std::string& table_id, double value) {
+    }
+
+    virtual void
+    SearchNqHistogramObserve(const std::string& table_id, double value) {
+    }
+
+    virtual void
+    SearchTopkHistogramObserve(const std::string& table_id, double value) {
+    }
+
+    // stage: grpc_queue or scheduler
+    virtual void
+    SearchCancelledIncrement(const std::string& stage) {
+    }
+
+    // stage: load, execute or search
+    virtual void
+    SearchTaskDroppedIncrement(const std::string& stage) {
+    }
+
+    virtual void
+    HugePageBytesGaugeSet(const std::string& type, double value) {
+    }
+
+    virtual void
+    PreloadFilesGaugeSet(const std::string& state, double value) {
+    }
 };
 
 }  // namespace server
@@ -18,6 +18,7 @@
 #include "metrics/PrometheusMetrics.h"
 #include "SystemInfo.h"
 #include "cache/GpuCacheMgr.h"
+#include "db/engine/ExecutionEngine.h"
 #include "server/Config.h"
 #include "utils/Log.h"
 
@@ -27,6 +28,32 @@
 namespace milvus {
 namespace server {
 
+namespace {
+constexpr const char* OTHER_TABLE_LABEL = "__other__";
+
+std::string
+EngineTypeLabel(int engine_type) {
+    switch (static_cast<engine::EngineType>(engine_type)) {
+        case engine::EngineType::FAISS_IDMAP:
+            return "IDMAP";
+        case engine::EngineType::FAISS_IVFFLAT:
+            return "IVFFLAT";
+        case engine::EngineType::FAISS_IVFSQ8:
+            return "IVFSQ8";
+        case engine::EngineType::NSG_MIX:
+            return "NSG";
+        case engine::EngineType::FAISS_IVFSQ8H:
+            return "IVFSQ8H";
+        case engine::EngineType::SPTAG_KDT:
+            return "SPTAG_KDT";
+        case engine::EngineType::SPTAG_BKT:
+            return "SPTAG_BKT";
+        default:
+            return "INVALID";
+    }
+}
+}  // namespace
+
 ErrorCode
 PrometheusMetrics::Init() {
     try {
@@ -35,6 +62,12 @@ PrometheusMetrics::Init() {
         if (!s.ok()) {
             return s.code();
         }
+
+        s = config.GetMetricConfigTableLabelLimit(table_label_limit_);
+        if (!s.ok()) {
+            return s.code();
+        }
+
         if (!startup_) {
             return SERVER_SUCCESS;
         }
@@ -237,6 +270,90 @@ PrometheusMetrics::CPUTemperature() {
     //    }
 }
 
+std::string
+PrometheusMetrics::TableLabel(const std::string& table_id) {
+    std::lock_guard<std::mutex> lock(table_label_mutex_);
+    if (table_labels_.find(table_id) != table_labels_.end()) {
+        return table_id;
+    }
+    if (static_cast<int64_t>(table_labels_.size()) < table_label_limit_) {
+        table_labels_.insert(table_id);
+        return table_id;
+    }
+    return OTHER_TABLE_LABEL;
+}
+
+void
+PrometheusMetrics::SearchPhaseDurationSecondsHistogramObserve(const std::string& phase, const std::string& table_id,
+                                                              int engine_type, const std::string& resource,
+                                                              double value) {
+    if (!startup_) {
+        return;
+    }
+
+    prometheus::Histogram& histogram = search_phase_duration_seconds_.Add(
+        {{"phase", phase}, {"table", TableLabel(table_id)}, {"engine", EngineTypeLabel(engine_type)},
+         {"resource", resource}},
+        search_phase_duration_buckets_);
+    histogram.Observe(value);
+}
+
+void
+PrometheusMetrics::TableCacheAccessIncrement(const std::string& table_id, const std::string& cache, bool hit) {
+    if (!startup_) {
+        return;
+    }
+
+    prometheus::Counter& counter = table_cache_access_.Add(
+        {{"table", TableLabel(table_id)}, {"cache", cache}, {"outcome", hit ? "hit" : "miss"}});
+    counter.Increment();
+}
+
+void
+PrometheusMetrics::TableDiskLoadBytesIncrement(const std::string& table_id, double value) {
+    if (!startup_) {
+        return;
+    }
+
+    table_disk_load_bytes_.Add({{"table", TableLabel(table_id)}}).Increment(value);
+}
+
+void
+PrometheusMetrics::SearchNqHistogramObserve(const std::string& table_id, double value) {
+    if (!startup_) {
+        return;
+    }
+
+    search_nq_.Add({{"table", TableLabel(table_id)}}, search_nq_buckets_).Observe(value);
+}
+
+void
+PrometheusMetrics::SearchTopkHistogramObserve(const std::string& table_id, double value) {
+    if (!startup_) {
+        return;
+    }
+
+    search_topk_.Add({{"table", TableLabel(table_id)}}, search_topk_buckets_).Observe(value);
+}
+
+void
+PrometheusMetrics::SearchCancelledIncrement(const std::string& stage) {
+    if (!startup_) {
+        return;
+    }
+
+    search_cancelled_.Add({{"stage", stage}}).Increment();
+}
+
+void
+PrometheusMetrics::SearchTaskDroppedIncrement(const std::string& stage) {
+    if (!startup_) {
+        return;
+    }
+
+    search_task_dropped_.Add({{"stage", stage}}).Increment();
+}
+
 void
 PrometheusMetrics::GpuCacheUsageGaugeSet() {
     //    std::vector<uint64_t > gpu_ids = {0};
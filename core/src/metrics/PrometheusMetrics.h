@@ -21,7 +21,9 @@
 #include <prometheus/registry.h>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "MetricBase.h"
@@ -293,6 +295,42 @@ class PrometheusMetrics : public MetricsBase {
     void
     CPUTemperature() override;
 
+    void
+    SearchPhaseDurationSecondsHistogramObserve(const std::string& phase, const std::string& table_id, int engine_type,
+                                               const std::string& resource, double value) override;
+
+    void
+    TableCacheAccessIncrement(const std::string& table_id, const std::string& cache, bool hit) override;
+
+    void
+    TableDiskLoadBytesIncrement(const std::string& table_id, double value) override;
+
+    void
+    SearchNqHistogramObserve(const std::string& table_id, double value) override;
+
+    void
+    SearchTopkHistogramObserve(const std::string& table_id, double value) override;
+
+    void
+    SearchCancelledIncrement(const std::string& stage) override;
+
+    void
+    SearchTaskDroppedIncrement(const std::string& stage) override;
+
+    void
+    HugePageBytesGaugeSet(const std::string& type, double value) override {
+        if (startup_) {
+            huge_page_bytes_.Add({{"type", type}}).Set(value);
+        }
+    }
+
+    void
+    PreloadFilesGaugeSet(const std::string& state, double value) override {
+        if (startup_) {
+            preload_files_.Add({{"state", state}}).Set(value);
+        }
+    }
+
     std::shared_ptr<prometheus::Exposer>&
     exposer_ptr() {
         return exposer_ptr_;
@@ -304,6 +342,15 @@ class PrometheusMetrics : public MetricsBase {
         return registry_;
     }
 
+ private:
+    // table label of the metric, tables beyond table_label_limit_ share one label to bound cardinality
+    std::string
+    TableLabel(const std::string& table_id);
+
+    std::mutex table_label_mutex_;
+    std::unordered_set<std::string> table_labels_;
+    int64_t table_label_limit_ = 0;
+
     // .....
  private:
     ////all from db_connection.cpp
@@ -543,6 +590,18 @@ class PrometheusMetrics : public MetricsBase {
         prometheus::BuildGauge().Name("cache_usage_bytes").Help("current cache usage by bytes").Register(*registry_);
     prometheus::Gauge& cpu_cache_usage_gauge_ = cpu_cache_usage_.Add({});
 
+    // record index memory by backing page type
+    prometheus::Family<prometheus::Gauge>& huge_page_bytes_ = prometheus::BuildGauge()
+                                                                  .Name("huge_page_bytes")
+                                                                  .Help("index memory backed by huge pages by bytes")
+                                                                  .Register(*registry_);
+
+    // record progress of the startup preload, state "ready" is 1 once it finished
+    prometheus::Family<prometheus::Gauge>& preload_files_ = prometheus::BuildGauge()
+                                                                .Name("preload_files")
+                                                                .Help("index files of the startup preload by state")
+                                                                .Register(*registry_);
+
     // record GPU cache usage and %
     prometheus::Family<prometheus::Gauge>& gpu_cache_usage_ = prometheus::BuildGauge()
                                                                   .Name("gpu_cache_usage_bytes")
@@ -649,6 +708,50 @@ class PrometheusMetrics : public MetricsBase {
 
     prometheus::Family<prometheus::Gauge>& CPU_temperature_ =
         prometheus::BuildGauge().Name("CPU_temperature").Help("CPU temperature").Register(*registry_);
+
+    // labeled by table, engine type and resource
+    const BucketBoundaries search_phase_duration_buckets_{0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05,
+                                                          0.1,    0.25,   0.5,   1.0,   2.5,  5.0};
+    prometheus::Family<prometheus::Histogram>& search_phase_duration_seconds_ =
+        prometheus::BuildHistogram()
+            .Name("search_phase_duration_seconds")
+            .Help("histogram of search task phase (queue_wait, load, execute, reduce) duration by seconds")
+            .Register(*registry_);
+
+    prometheus::Family<prometheus::Counter>& table_cache_access_ = prometheus::BuildCounter()
+                                                                       .Name("table_cache_access_total")
+                                                                       .Help("cache hit and miss of index files")
+                                                                       .Register(*registry_);
+
+    prometheus::Family<prometheus::Counter>& table_disk_load_bytes_ =
+        prometheus::BuildCounter()
+            .Name("table_disk_load_bytes_total")
+            .Help("bytes of index files loaded from disk")
+            .Register(*registry_);
+
+    const BucketBoundaries search_nq_buckets_{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+    prometheus::Family<prometheus::Histogram>& search_nq_ = prometheus::BuildHistogram()
+                                                                .Name("search_nq")
+                                                                .Help("histogram of query vector number per search")
+                                                                .Register(*registry_);
+
+    const BucketBoundaries search_topk_buckets_{1, 10, 20, 50, 100, 200, 500, 1000, 2048};
+    prometheus::Family<prometheus::Histogram>& search_topk_ = prometheus::BuildHistogram()
+                                                                  .Name("search_topk")
+                                                                  .Help("histogram of topk per search")
+                                                                  .Register(*registry_);
+
+    prometheus::Family<prometheus::Counter>& search_cancelled_ =
+        prometheus::BuildCounter()
+            .Name("search_cancelled_total")
+            .Help("searches stopped by their deadline, by the stage they were in")
+            .Register(*registry_);
+
+    prometheus::Family<prometheus::Counter>& search_task_dropped_ =
+        prometheus::BuildCounter()
+            .Name("search_task_dropped_total")
+            .Help("index file tasks of cancelled searches, by the stage they were dropped at")
+            .Register(*registry_);
 };
 
 }  // namespace server
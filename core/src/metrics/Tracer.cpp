@@ -0,0 +1,352 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "metrics/Tracer.h"
+#include "server/Config.h"
+#include "utils/CommonUtil.h"
+#include "utils/Log.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <utility>
+
+namespace milvus {
+namespace server {
+
+namespace {
+
+thread_local TraceContextPtr thread_trace_context = nullptr;
+
+std::string
+ToHex(uint64_t value) {
+    char buf[17];
+    snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(value));
+    return std::string(buf);
+}
+
+json
+OtlpAttributes(const std::map<std::string, std::string>& attributes) {
+    json ret = json::array();
+    for (auto& kv : attributes) {
+        ret.push_back({{"key", kv.first}, {"value", {{"stringValue", kv.second}}}});
+    }
+    return ret;
+}
+
+json
+OtlpSpan(const TraceSpan& span, const std::string& trace_id, const std::string& span_id,
+         const std::string& parent_span_id) {
+    json ret{
+        {"traceId", trace_id},
+        {"spanId", span_id},
+        {"name", span.name_},
+        {"kind", 1},
+        {"startTimeUnixNano", std::to_string(span.start_us_ * 1000)},
+        {"endTimeUnixNano", std::to_string(span.end_us_ * 1000)},
+        {"attributes", OtlpAttributes(span.attributes_)},
+    };
+    if (!parent_span_id.empty()) {
+        ret["parentSpanId"] = parent_span_id;
+    }
+    return ret;
+}
+
+json
+DumpSpan(const TraceSpan& span, int64_t origin_us) {
+    json ret{
+        {"name", span.name_},
+        {"start_us", span.start_us_ - origin_us},
+        {"duration_us", span.end_us_ - span.start_us_},
+    };
+    if (!span.attributes_.empty()) {
+        ret["attributes"] = span.attributes_;
+    }
+    return ret;
+}
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+TraceContext::TraceContext(std::string trace_id, std::string name) : trace_id_(std::move(trace_id)) {
+    root_.name_ = std::move(name);
+    root_.start_us_ = NowMicros();
+}
+
+int64_t
+TraceContext::NowMicros() {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+
+void
+TraceContext::AddSpan(const std::string& name, int64_t start_us, int64_t end_us,
+                      const std::map<std::string, std::string>& attributes) {
+    TraceSpan span;
+    span.name_ = name;
+    span.start_us_ = start_us;
+    span.end_us_ = end_us;
+    span.attributes_ = attributes;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    spans_.emplace_back(std::move(span));
+}
+
+void
+TraceContext::SetAttribute(const std::string& key, const std::string& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    root_.attributes_[key] = value;
+}
+
+void
+TraceContext::Finish(const Status& status) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        root_.end_us_ = NowMicros();
+        status_code_ = status.code();
+        status_msg_ = status.message();
+    }
+    Tracer::GetInstance().Commit(shared_from_this());
+}
+
+json
+TraceContext::Dump() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    json spans = json::array();
+    for (auto& span : spans_) {
+        spans.push_back(DumpSpan(span, root_.start_us_));
+    }
+    json ret{
+        {"trace_id", trace_id_},
+        {"name", root_.name_},
+        {"start_us", root_.start_us_},
+        {"duration_us", root_.end_us_ - root_.start_us_},
+        {"status", status_code_},
+        {"spans", spans},
+    };
+    if (!status_msg_.empty()) {
+        ret["message"] = status_msg_;
+    }
+    if (!root_.attributes_.empty()) {
+        ret["attributes"] = root_.attributes_;
+    }
+    return ret;
+}
+
+json
+TraceContext::DumpOtlpSpans() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // trace id is 128 bits hex, reuse its lower half as root span id and derive child span ids from it
+    std::string root_span_id = trace_id_.substr(16);
+    uint64_t base = std::stoull(root_span_id, nullptr, 16);
+
+    json ret = json::array();
+    json root = OtlpSpan(root_, trace_id_, root_span_id, "");
+    root["status"] = {{"code", status_code_ == 0 ? 1 : 2}, {"message", status_msg_}};
+    ret.push_back(root);
+    for (size_t i = 0; i < spans_.size(); ++i) {
+        ret.push_back(OtlpSpan(spans_[i], trace_id_, ToHex(base + i + 1), root_span_id));
+    }
+    return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+ScopedTraceSpan::ScopedTraceSpan(TraceContextPtr context, std::string name)
+    : context_(std::move(context)), name_(std::move(name)), start_us_(0) {
+    if (context_ != nullptr) {
+        start_us_ = TraceContext::NowMicros();
+    }
+}
+
+ScopedTraceSpan::~ScopedTraceSpan() {
+    if (context_ != nullptr) {
+        context_->AddSpan(name_, start_us_, TraceContext::NowMicros(), attributes_);
+    }
+}
+
+void
+ScopedTraceSpan::SetAttribute(const std::string& key, const std::string& value) {
+    if (context_ != nullptr) {
+        attributes_[key] = value;
+    }
+}
+
+TraceContextPtr
+GetThreadTraceContext() {
+    return thread_trace_context;
+}
+
+ScopedThreadTraceContext::ScopedThreadTraceContext(const TraceContextPtr& context) {
+    previous_ = thread_trace_context;
+    thread_trace_context = context;
+}
+
+ScopedThreadTraceContext::~ScopedThreadTraceContext() {
+    thread_trace_context = previous_;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+Tracer::Tracer() : random_(std::random_device{}()) {
+    Config& config = Config::GetInstance();
+    Status s;
+
+    float sample_rate;
+    s = config.GetMetricConfigTraceSampleRate(sample_rate);
+    if (!s.ok()) {
+        SERVER_LOG_ERROR << s.message();
+        sample_rate = std::stof(CONFIG_METRIC_TRACE_SAMPLE_RATE_DEFAULT);
+    }
+    SetSampleRate(sample_rate);
+
+    int64_t capacity;
+    s = config.GetMetricConfigTraceBufferSize(capacity);
+    if (!s.ok()) {
+        SERVER_LOG_ERROR << s.message();
+        capacity = std::stol(CONFIG_METRIC_TRACE_BUFFER_SIZE_DEFAULT);
+    }
+    SetCapacity(capacity);
+}
+
+Tracer&
+Tracer::GetInstance() {
+    static Tracer instance;
+    return instance;
+}
+
+std::string
+Tracer::NewTraceId() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t high = random_();
+    uint64_t low = random_();
+    return ToHex(high) + ToHex(low);
+}
+
+TraceContextPtr
+Tracer::StartTrace(const std::string& name) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (sample_rate_ <= 0.0) {
+            return nullptr;
+        }
+        if (sample_rate_ < 1.0 && std::generate_canonical<double, 32>(random_) >= sample_rate_) {
+            return nullptr;
+        }
+    }
+    return std::make_shared<TraceContext>(NewTraceId(), name);
+}
+
+void
+Tracer::Commit(const TraceContextPtr& context) {
+    if (context == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (static_cast<int64_t>(buffer_.size()) < capacity_) {
+        buffer_.push_back(context);
+    } else {
+        buffer_[next_] = context;
+    }
+    next_ = (next_ + 1) % capacity_;
+}
+
+json
+Tracer::Dump(int64_t limit) const {
+    std::vector<TraceContextPtr> traces;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        int64_t size = buffer_.size();
+        for (int64_t i = 1; i <= size && static_cast<int64_t>(traces.size()) < limit; ++i) {
+            traces.push_back(buffer_[(next_ - i + size) % size]);
+        }
+    }
+
+    json ret = json::array();
+    for (auto& trace : traces) {
+        ret.push_back(trace->Dump());
+    }
+    return ret;
+}
+
+Status
+Tracer::Export(const std::string& path) const {
+    std::vector<TraceContextPtr> traces;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        traces = buffer_;
+    }
+
+    json spans = json::array();
+    for (auto& trace : traces) {
+        for (auto& span : trace->DumpOtlpSpans()) {
+            spans.push_back(span);
+        }
+    }
+
+    json resource_attributes = json::array();
+    resource_attributes.push_back({{"key", "service.name"}, {"value", {{"stringValue", "milvus"}}}});
+    json otlp{
+        {"resourceSpans",
+         {{{"resource", {{"attributes", resource_attributes}}},
+           {"scopeSpans", {{{"scope", {{"name", "milvus"}}}, {"spans", spans}}}}}}},
+    };
+
+    std::string dir = path.substr(0, path.find_last_of('/'));
+    if (!dir.empty() && dir != path) {
+        Status s = CommonUtil::CreateDirectory(dir);
+        if (!s.ok()) {
+            return s;
+        }
+    }
+
+    std::ofstream out(path, std::ios::out | std::ios::trunc);
+    if (!out.is_open()) {
+        return Status(SERVER_CANNOT_CREATE_FILE, "Failed to open trace export file: " + path);
+    }
+    out << otlp.dump();
+    out.close();
+
+    SERVER_LOG_DEBUG << "Export " << traces.size() << " traces to " << path;
+    return Status::OK();
+}
+
+void
+Tracer::SetSampleRate(float sample_rate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sample_rate_ = sample_rate;
+}
+
+void
+Tracer::SetCapacity(int64_t capacity) {
+    if (capacity <= 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // keep the latest traces in chronological order
+    std::vector<TraceContextPtr> traces;
+    int64_t size = buffer_.size();
+    for (int64_t i = std::max<int64_t>(size - capacity, 0); i < size; ++i) {
+        traces.push_back(buffer_[(next_ + i) % size]);
+    }
+    buffer_.swap(traces);
+    capacity_ = capacity;
+    next_ = buffer_.size() % capacity_;
+}
+
+}  // namespace server
+}  // namespace milvus
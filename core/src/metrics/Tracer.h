@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "utils/Json.h"
+#include "utils/Status.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace server {
+
+struct TraceSpan {
+    std::string name_;
+    int64_t start_us_ = 0;
+    int64_t end_us_ = 0;
+    std::map<std::string, std::string> attributes_;
+};
+
+/*
+ * Spans of one request. The context is created by the grpc handler, attached to the SearchJob and
+ * shared by every XSearchTask of the job, so AddSpan() may be called from loader and executor threads.
+ */
+class TraceContext : public std::enable_shared_from_this<TraceContext> {
+ public:
+    TraceContext(std::string trace_id, std::string name);
+
+    static int64_t
+    NowMicros();
+
+    const std::string&
+    trace_id() const {
+        return trace_id_;
+    }
+
+    int64_t
+    start_us() const {
+        return root_.start_us_;
+    }
+
+    void
+    AddSpan(const std::string& name, int64_t start_us, int64_t end_us,
+            const std::map<std::string, std::string>& attributes = {});
+
+    void
+    SetAttribute(const std::string& key, const std::string& value);
+
+    // close the root span and hand the trace over to the Tracer ring buffer
+    void
+    Finish(const Status& status);
+
+    json
+    Dump() const;
+
+    json
+    DumpOtlpSpans() const;
+
+ private:
+    std::string trace_id_;
+    TraceSpan root_;
+    std::vector<TraceSpan> spans_;
+    int32_t status_code_ = 0;
+    std::string status_msg_;
+    mutable std::mutex mutex_;
+};
+
+using TraceContextPtr = std::shared_ptr<TraceContext>;
+
+/*
+ * RAII span, does nothing if the request is not sampled (context is nullptr)
+ */
+class ScopedTraceSpan {
+ public:
+    ScopedTraceSpan(TraceContextPtr context, std::string name);
+
+    ~ScopedTraceSpan();
+
+    void
+    SetAttribute(const std::string& key, const std::string& value);
+
+ private:
+    TraceContextPtr context_;
+    std::string name_;
+    int64_t start_us_;
+    std::map<std::string, std::string> attributes_;
+};
+
+/*
+ * Trace context of the request being executed by current thread, used to pass the context
+ * through DB::Query() without changing the interface
+ */
+TraceContextPtr
+GetThreadTraceContext();
+
+class ScopedThreadTraceContext {
+ public:
+    explicit ScopedThreadTraceContext(const TraceContextPtr& context);
+
+    ~ScopedThreadTraceContext();
+
+ private:
+    TraceContextPtr previous_;
+};
+
+class Tracer {
+ public:
+    static Tracer&
+    GetInstance();
+
+    // return nullptr if the request is not sampled
+    TraceContextPtr
+    StartTrace(const std::string& name);
+
+    void
+    Commit(const TraceContextPtr& context);
+
+    // latest traces first, at most 'limit' traces
+    json
+    Dump(int64_t limit) const;
+
+    Status
+    Export(const std::string& path) const;
+
+    void
+    SetSampleRate(float sample_rate);
+
+    void
+    SetCapacity(int64_t capacity);
+
+ private:
+    Tracer();
+
+    std::string
+    NewTraceId();
+
+ private:
+    float sample_rate_ = 0.0;
+    int64_t capacity_ = 0;
+    std::vector<TraceContextPtr> buffer_;
+    int64_t next_ = 0;
+    std::mt19937_64 random_;
+    mutable std::mutex mutex_;
+};
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "knowhere/common/Cancel.h"
+
+namespace milvus {
+namespace scheduler {
+
+// bounds the search work in flight, work is estimated as queries x index files of a job
+class AdmissionMgr {
+ public:
+    // capacity 0 admits every job at once
+    explicit AdmissionMgr(int64_t capacity) : capacity_(capacity) {
+    }
+
+ public:
+    // queues the job until its work fits or the deadline of token passes, false once the deadline passed;
+    // a job is always admitted while nothing else runs, so work beyond the capacity is not refused forever.
+    // Jobs are admitted in arrival order, a large job at the head blocks the smaller ones behind it
+    // instead of starving while they keep filling the capacity.
+    bool
+    Admit(int64_t work, const knowhere::CancelTokenPtr& token) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto ticket = waiters_.insert(waiters_.end(), next_ticket_++);
+        auto fits = [&] {
+            return waiters_.front() == *ticket &&
+                   (capacity_ == 0 || running_ == 0 || in_flight_ + work <= capacity_);
+        };
+        bool admitted = true;
+        if (token != nullptr && token->HasDeadline()) {
+            admitted = cv_.wait_until(lock, token->Deadline(), fits);
+        } else {
+            cv_.wait(lock, fits);
+        }
+        waiters_.erase(ticket);
+        if (admitted) {
+            ++running_;
+            in_flight_ += work;
+        }
+        lock.unlock();
+
+        // the next waiter is at the head now, it may fit as well
+        cv_.notify_all();
+        return admitted;
+    }
+
+    void
+    Release(int64_t work) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --running_;
+            in_flight_ -= work;
+        }
+        cv_.notify_all();
+    }
+
+    // admitted jobs not released yet
+    int64_t
+    Running() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return running_;
+    }
+
+ private:
+    int64_t capacity_;
+    int64_t in_flight_ = 0;
+    int64_t running_ = 0;
+    uint64_t next_ticket_ = 0;
+    std::list<uint64_t> waiters_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+using AdmissionMgrPtr = std::shared_ptr<AdmissionMgr>;
+
+}  // namespace scheduler
+}  // namespace milvus
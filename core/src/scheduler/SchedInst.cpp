@@ -19,7 +19,9 @@
 #include "ResourceFactory.h"
 #include "Utils.h"
 #include "knowhere/index/vector_index/IndexGPUIVF.h"
+#include "resource/CpuResource.h"
 #include "server/Config.h"
+#include "utils/Log.h"
 
 #include <set>
 #include <string>
@@ -44,6 +46,9 @@ std::mutex OptimizerInst::mutex_;
 BuildMgrPtr BuildMgrInst::instance = nullptr;
 std::mutex BuildMgrInst::mutex_;
 
+AdmissionMgrPtr AdmissionMgrInst::instance = nullptr;
+std::mutex AdmissionMgrInst::mutex_;
+
 void
 load_simple_config() {
     server::Config& config = server::Config::GetInstance();
@@ -65,6 +70,19 @@ load_simple_config() {
     ResMgrInst::GetInstance()->Add(ResourceFactory::Create("cpu", "CPU", 0, true, true));
     ResMgrInst::GetInstance()->Connect("disk", "cpu", io);
 
+    // "cpu" stays unpinned for index building and gpu staging, searches are routed to one resource per numa node
+    int64_t numa_node_num = get_numa_node_num();
+    for (int64_t node = 0; numa_node_num > 1 && node < numa_node_num; ++node) {
+        auto name = get_numa_cpu_resource_name(node);
+        auto cpu_node = std::make_shared<CpuResource>(name, node, true, true);
+        cpu_node->BindNumaNode(node);
+        ResMgrInst::GetInstance()->Add(std::move(cpu_node));
+        ResMgrInst::GetInstance()->Connect("disk", name, io);
+    }
+    if (numa_node_num > 1) {
+        SERVER_LOG_INFO << "Search threads pinned to " << numa_node_num << " numa nodes";
+    }
+
     auto pcie = Connection("pcie", 12000);
     bool find_build_gpu_id = false;
     for (auto& gpu_id : gpu_ids) {
@@ -17,12 +17,14 @@
 
 #pragma once
 
+#include "AdmissionMgr.h"
 #include "BuildMgr.h"
 #include "JobMgr.h"
 #include "ResourceMgr.h"
 #include "Scheduler.h"
 #include "optimizer/HybridPass.h"
 #include "optimizer/LargeSQ8HPass.h"
+#include "optimizer/NumaPass.h"
 #include "optimizer/OnlyCPUPass.h"
 #include "optimizer/OnlyGPUPass.h"
 #include "optimizer/Optimizer.h"
@@ -111,6 +113,7 @@ class OptimizerInst {
                 pass_list.push_back(std::make_shared<HybridPass>());
                 pass_list.push_back(std::make_shared<OnlyCPUPass>());
                 pass_list.push_back(std::make_shared<OnlyGPUPass>(has_cpu));
+                pass_list.push_back(std::make_shared<NumaPass>());
                 instance = std::make_shared<Optimizer>(pass_list);
             }
         }
@@ -140,6 +143,27 @@ class BuildMgrInst {
     static std::mutex mutex_;
 };
 
+class AdmissionMgrInst {
+ public:
+    static AdmissionMgrPtr
+    GetInstance() {
+        if (instance == nullptr) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (instance == nullptr) {
+                server::Config& config = server::Config::GetInstance();
+                int64_t search_capacity = 0;
+                config.GetEngineConfigSearchCapacity(search_capacity);
+                instance = std::make_shared<AdmissionMgr>(search_capacity);
+            }
+        }
+        return instance;
+    }
+
+ private:
+    static AdmissionMgrPtr instance;
+    static std::mutex mutex_;
+};
+
 void
 StartSchedulerService();
 
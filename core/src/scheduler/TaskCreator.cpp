@@ -50,6 +50,8 @@ TaskCreator::Create(const SearchJobPtr& job) {
         auto label = std::make_shared<DefaultLabel>();
         auto task = std::make_shared<XSearchTask>(index_file.second, label);
         task->job_ = job;
+        task->priority_ = job->priority();
+        task->trace_context_ = job->trace_context();
         tasks.emplace_back(task);
     }
 
@@ -84,6 +86,7 @@ TaskCreator::Create(const BuildIndexJobPtr& job) {
         auto label = std::make_shared<SpecResLabel>(std::weak_ptr<Resource>(res_ptr));
         auto task = std::make_shared<XBuildIndexTask>(to_index_file.second, label);
         task->job_ = job;
+        task->priority_ = job->priority();
         tasks.emplace_back(task);
     }
     return tasks;
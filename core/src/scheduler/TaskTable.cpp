@@ -22,13 +22,59 @@
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
+#include <algorithm>
 #include <ctime>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 namespace milvus {
 namespace scheduler {
 
+namespace {
+
+// loading pauses once more than this many tasks wait for the executor
+constexpr uint64_t MAX_LOADED_TASK_NUM = 2;
+
+// a task climbs one priority class for every interval it waits, so a steady search load cannot starve builds
+constexpr uint64_t TASK_AGING_INTERVAL_MS = 2000;
+
+uint64_t
+EffectivePriority(const TaskTableItemPtr& item, uint64_t now) {
+    auto& task = item->task;
+    auto priority = static_cast<uint64_t>(task->priority_);
+    // nobody waits for the results of an expired search job anymore
+    if (task->Type() == TaskType::SearchTask && task->job_.expired()) {
+        priority = static_cast<uint64_t>(JobPriority::COMPACTION);
+    }
+    auto start = item->timestamp.start;
+    return priority + (now > start ? (now - start) / TASK_AGING_INTERVAL_MS : 0);
+}
+
+// highest effective priority first, tasks of the same priority keep their fifo order
+std::vector<uint64_t>
+OrderByPriority(CircleQueue<TaskTableItemPtr>& table, const std::vector<uint64_t>& indexes) {
+    auto now = get_current_timestamp();
+    std::vector<std::pair<uint64_t, uint64_t>> candidates;
+    candidates.reserve(indexes.size());
+    for (auto index : indexes) {
+        candidates.emplace_back(EffectivePriority(table[index], now), index);
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const std::pair<uint64_t, uint64_t>& a, const std::pair<uint64_t, uint64_t>& b) {
+                         return a.first > b.first;
+                     });
+
+    std::vector<uint64_t> ordered;
+    ordered.reserve(candidates.size());
+    for (auto& candidate : candidates) {
+        ordered.push_back(candidate.second);
+    }
+    return ordered;
+}
+
+}  // namespace
+
 std::string
 ToString(TaskTableItemState state) {
     switch (state) {
@@ -153,14 +199,17 @@ TaskTableItem::Dump() const {
 }
 
 std::vector<uint64_t>
-TaskTable::PickToLoad(uint64_t limit) {
+TaskTable::PickToLoad(uint64_t limit, uint64_t memory_budget) {
 #if 1
     TimeRecorder rc("");
-    std::vector<uint64_t> indexes;
     bool cross = false;
+    uint64_t loaded_count = 0;
+    uint64_t resident_count = 0;
+    uint64_t resident_size = 0;
+    std::vector<uint64_t> to_load;
 
     uint64_t available_begin = table_.front() + 1;
-    for (uint64_t i = 0, loaded_count = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
+    for (uint64_t i = 0; i < table_.size(); ++i) {
         auto index = available_begin + i;
         if (not table_[index])
             break;
@@ -171,21 +220,48 @@ TaskTable::PickToLoad(uint64_t limit) {
         } else if (table_[index]->state == TaskTableItemState::LOADED) {
             cross = true;
             ++loaded_count;
-            if (loaded_count > 2)
-                return std::vector<uint64_t>();
+            ++resident_count;
+            resident_size += table_[index]->task->EstimatedLoadSize();
+        } else if (table_[index]->state == TaskTableItemState::LOADING) {
+            cross = true;
+            ++resident_count;
+            resident_size += table_[index]->task->EstimatedLoadSize();
         } else if (table_[index]->state == TaskTableItemState::START) {
-            auto task = table_[index]->task;
+            cross = true;
+            to_load.push_back(index);
+        }
+    }
 
-            // if task is a build index task, limit it
-            if (task->Type() == TaskType::BuildIndexTask && task->path().Current() == "cpu") {
-                if (not BuildMgrInst::GetInstance()->Take()) {
-                    continue;
-                }
+    // without a budget, stall once a few tasks are waiting for the executor
+    if (memory_budget == 0 && loaded_count > MAX_LOADED_TASK_NUM) {
+        return std::vector<uint64_t>();
+    }
+
+    std::vector<uint64_t> indexes;
+    for (auto index : OrderByPriority(table_, to_load)) {
+        if (indexes.size() >= limit) {
+            break;
+        }
+
+        auto& task = table_[index]->task;
+        // loading and loaded files both hold memory until they are executed,
+        // one file is always allowed, otherwise a file larger than the budget would never be loaded
+        auto size = memory_budget > 0 ? task->EstimatedLoadSize() : 0;
+        if (memory_budget > 0 && resident_count > 0 && resident_size + size > memory_budget) {
+            continue;
+        }
+
+        // if task is a build index task, limit it
+        if (task->Type() == TaskType::BuildIndexTask && task->path().Current() == "cpu") {
+            if (not BuildMgrInst::GetInstance()->Take()) {
+                continue;
             }
-            cross = true;
-            indexes.push_back(index);
-            ++pick_count;
         }
+
+        // charge the budget only for tasks actually picked
+        ++resident_count;
+        resident_size += size;
+        indexes.push_back(index);
     }
     rc.ElapseFromBegin("PickToLoad ");
     return indexes;
@@ -242,7 +318,7 @@ TaskTable::PickToExecute(uint64_t limit) {
     std::vector<uint64_t> indexes;
     bool cross = false;
     uint64_t available_begin = table_.front() + 1;
-    for (uint64_t i = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
+    for (uint64_t i = 0; i < table_.size(); ++i) {
         uint64_t index = available_begin + i;
         if (not table_[index]) {
             break;
@@ -256,9 +332,13 @@ TaskTable::PickToExecute(uint64_t limit) {
         } else if (table_[index]->state == TaskTableItemState::LOADED) {
             cross = true;
             indexes.push_back(index);
-            ++pick_count;
         }
     }
+
+    indexes = OrderByPriority(table_, indexes);
+    if (indexes.size() > limit) {
+        indexes.resize(limit);
+    }
     rc.ElapseFromBegin("PickToExecute ");
     return indexes;
 }
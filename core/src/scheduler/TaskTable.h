@@ -128,9 +128,17 @@ class TaskTable : public interface::dumpable {
     size_t
     TaskToExecute();
 
+    /*
+     * Pick tasks to load, by job priority and then start time, waiting tasks age into higher priorities;
+     * memory_budget limits the bytes of files loading or loaded but not executed yet, cached or not;
+     * without a budget (0), loading stops while too many tasks are loaded but not executed;
+     */
     std::vector<uint64_t>
-    PickToLoad(uint64_t limit);
+    PickToLoad(uint64_t limit, uint64_t memory_budget = 0);
 
+    /*
+     * Pick loaded tasks to execute, in the same order as PickToLoad;
+     */
     std::vector<uint64_t>
     PickToExecute(uint64_t limit);
 
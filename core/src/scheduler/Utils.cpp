@@ -18,6 +18,7 @@
 #include "scheduler/Utils.h"
 #include "server/Config.h"
 #include "utils/Log.h"
+#include "utils/NumaUtil.h"
 
 #include <cuda_runtime.h>
 #include <chrono>
@@ -79,5 +80,30 @@ get_gpu_pool() {
     return gpu_pool;
 }
 
+int64_t
+get_numa_node_num() {
+    bool numa_aware = false;
+    server::Config& config = server::Config::GetInstance();
+    Status s = config.GetResourceConfigNumaAware(numa_aware);
+    if (!s.ok()) {
+        SERVER_LOG_ERROR << s.message();
+    }
+    return numa_aware ? server::NumaUtil::NodeCount() : 1;
+}
+
+std::string
+get_numa_cpu_resource_name(int64_t node) {
+    return "cpu_node" + std::to_string(node);
+}
+
+std::string
+get_search_cpu_resource(const std::string& location) {
+    int64_t node_num = get_numa_node_num();
+    if (node_num <= 1) {
+        return "cpu";
+    }
+    return get_numa_cpu_resource_name(server::NumaUtil::HomeNode(location, node_num));
+}
+
 }  // namespace scheduler
 }  // namespace milvus
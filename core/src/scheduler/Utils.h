@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 namespace milvus {
@@ -30,5 +31,16 @@ get_num_gpu();
 std::vector<uint64_t>
 get_gpu_pool();
 
+// numa nodes cpu searches are spread over, 1 when resource_config.numa_aware is off
+int64_t
+get_numa_node_num();
+
+std::string
+get_numa_cpu_resource_name(int64_t node);
+
+// cpu resource searching the file: the file's home numa node when numa aware, otherwise "cpu"
+std::string
+get_search_cpu_resource(const std::string& location);
+
 }  // namespace scheduler
 }  // namespace milvus
@@ -25,7 +25,8 @@ std::mutex unique_job_mutex;
 uint64_t unique_job_id = 0;
 }  // namespace
 
-Job::Job(JobType type) : type_(type) {
+Job::Job(JobType type)
+    : type_(type), priority_(type == JobType::BUILD ? JobPriority::BUILD : JobPriority::INTERACTIVE) {
     std::lock_guard<std::mutex> lock(unique_job_mutex);
     id_ = unique_job_id++;
 }
@@ -35,6 +36,7 @@ Job::Dump() const {
     json ret{
         {"id", id_},
         {"type", type_},
+        {"priority", priority_},
     };
     return ret;
 }
@@ -39,6 +39,14 @@ enum class JobType {
     BUILD,
 };
 
+// higher priorities are loaded and executed first, TaskTable ages waiting tasks so nothing starves
+enum class JobPriority {
+    COMPACTION = 0,
+    BUILD = 1,
+    BATCH = 2,
+    INTERACTIVE = 3,
+};
+
 using JobId = std::uint64_t;
 
 class Job : public interface::dumpable {
@@ -53,6 +61,16 @@ class Job : public interface::dumpable {
         return type_;
     }
 
+    inline JobPriority
+    priority() const {
+        return priority_;
+    }
+
+    inline void
+    set_priority(JobPriority priority) {
+        priority_ = priority;
+    }
+
     json
     Dump() const override;
 
@@ -62,6 +80,7 @@ class Job : public interface::dumpable {
  private:
     JobId id_ = 0;
     JobType type_;
+    JobPriority priority_;
 };
 
 using JobPtr = std::shared_ptr<Job>;
@@ -16,6 +16,7 @@
 // under the License.
 
 #include "scheduler/job/SearchJob.h"
+#include "metrics/Metrics.h"
 #include "utils/Log.h"
 
 namespace milvus {
@@ -23,6 +24,9 @@ namespace scheduler {
 
 SearchJob::SearchJob(uint64_t topk, uint64_t nq, uint64_t nprobe, const float* vectors)
     : Job(JobType::SEARCH), topk_(topk), nq_(nq), nprobe_(nprobe), vectors_(vectors) {
+    if (nq_ > BATCH_SEARCH_NQ) {
+        set_priority(JobPriority::BATCH);
+    }
 }
 
 bool
@@ -38,10 +42,36 @@ SearchJob::AddIndexFile(const TableFileSchemaPtr& index_file) {
     return true;
 }
 
+void
+SearchJob::AddAllowList(size_t file_id, const engine::AttrAllowListPtr& allow_list) {
+    allow_lists_[file_id] = allow_list;
+}
+
+engine::AttrAllowListPtr
+SearchJob::AllowList(size_t file_id) const {
+    auto iter = allow_lists_.find(file_id);
+    return (iter != allow_lists_.end()) ? iter->second : nullptr;
+}
+
 void
 SearchJob::WaitResult() {
     std::unique_lock<std::mutex> lock(mutex_);
-    cv_.wait(lock, [this] { return index_files_.empty(); });
+    auto all_done = [this] { return index_files_.empty(); };
+    if (cancel_token_ != nullptr && cancel_token_->HasDeadline() &&
+        !cv_.wait_until(lock, cancel_token_->Deadline(), all_done)) {
+        cancel_token_->Cancel();
+    }
+
+    // running tasks still read the query vectors, they stop at their next check of the token
+    cv_.wait(lock, all_done);
+    if (Cancelled()) {
+        SERVER_LOG_WARNING << "SearchJob " << id() << " cancelled, deadline exceeded";
+        server::Metrics::GetInstance().SearchCancelledIncrement("scheduler");
+        if (status_.ok()) {
+            status_ = Status(DB_TIMEOUT, "Search deadline exceeded");
+        }
+        return;
+    }
     SERVER_LOG_DEBUG << "SearchJob " << id() << " all done";
 }
 
@@ -30,7 +30,10 @@
 
 #include "Job.h"
 #include "db/Types.h"
+#include "db/engine/AttrFilter.h"
 #include "db/meta/MetaTypes.h"
+#include "knowhere/common/Cancel.h"
+#include "metrics/Tracer.h"
 
 namespace milvus {
 namespace scheduler {
@@ -39,6 +42,9 @@ using engine::meta::TableFileSchemaPtr;
 
 using Id2IndexMap = std::unordered_map<size_t, TableFileSchemaPtr>;
 
+// searches with more queries are batch jobs, scheduled after interactive ones
+constexpr uint64_t BATCH_SEARCH_NQ = 64;
+
 using ResultIds = engine::ResultIds;
 using ResultDistances = engine::ResultDistances;
 
@@ -50,9 +56,25 @@ class SearchJob : public Job {
     bool
     AddIndexFile(const TableFileSchemaPtr& index_file);
 
+    // restrict the results from a file to the rows of allow_list, set before the job is scheduled
+    void
+    AddAllowList(size_t file_id, const engine::AttrAllowListPtr& allow_list);
+
+    // nullptr when every row of the file may be returned
+    engine::AttrAllowListPtr
+    AllowList(size_t file_id) const;
+
+    // waits until every index file is searched or the deadline of the cancel token has passed, the tasks
+    // still running are cancelled then and the job fails with DB_TIMEOUT once they have stopped
     void
     WaitResult();
 
+    // true once the cancel token has expired, the tasks of the job drop their work
+    bool
+    Cancelled() const {
+        return cancel_token_ != nullptr && cancel_token_->Cancelled();
+    }
+
     void
     SearchDone(size_t index_id);
 
@@ -99,6 +121,26 @@ class SearchJob : public Job {
         return mutex_;
     }
 
+    const server::TraceContextPtr&
+    trace_context() const {
+        return trace_context_;
+    }
+
+    void
+    set_trace_context(const server::TraceContextPtr& trace_context) {
+        trace_context_ = trace_context;
+    }
+
+    const knowhere::CancelTokenPtr&
+    cancel_token() const {
+        return cancel_token_;
+    }
+
+    void
+    set_cancel_token(const knowhere::CancelTokenPtr& cancel_token) {
+        cancel_token_ = cancel_token;
+    }
+
  private:
     uint64_t topk_ = 0;
     uint64_t nq_ = 0;
@@ -107,10 +149,13 @@ class SearchJob : public Job {
     const float* vectors_ = nullptr;
 
     Id2IndexMap index_files_;
+    std::unordered_map<size_t, engine::AttrAllowListPtr> allow_lists_;
     // TODO: column-base better ?
     ResultIds result_ids_;
     ResultDistances result_distances_;
     Status status_;
+    server::TraceContextPtr trace_context_ = nullptr;
+    knowhere::CancelTokenPtr cancel_token_ = nullptr;
 
     std::mutex mutex_;
     std::condition_variable cv_;
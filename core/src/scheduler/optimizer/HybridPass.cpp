@@ -17,6 +17,7 @@
 
 #include "scheduler/optimizer/HybridPass.h"
 #include "scheduler/SchedInst.h"
+#include "scheduler/Utils.h"
 #include "scheduler/task/SearchTask.h"
 #include "scheduler/tasklabel/SpecResLabel.h"
 
@@ -30,8 +31,8 @@ HybridPass::Run(const TaskPtr& task) {
         return false;
     auto search_task = std::static_pointer_cast<XSearchTask>(task);
     if (search_task->file_->engine_type_ == (int)engine::EngineType::FAISS_IVFSQ8H) {
-        // TODO: remove "cpu" hardcode
-        ResourcePtr res_ptr = ResMgrInst::GetInstance()->GetResource("cpu");
+        auto res_name = get_search_cpu_resource(search_task->file_->location_);
+        ResourcePtr res_ptr = ResMgrInst::GetInstance()->GetResource(res_name);
         auto label = std::make_shared<SpecResLabel>(std::weak_ptr<Resource>(res_ptr));
         task->label() = label;
         return true;
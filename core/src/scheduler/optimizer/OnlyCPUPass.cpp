@@ -29,16 +29,23 @@ OnlyCPUPass::Run(const TaskPtr& task) {
     if (task->Type() != TaskType::SearchTask)
         return false;
     auto search_task = std::static_pointer_cast<XSearchTask>(task);
-    if (search_task->file_->engine_type_ != (int)engine::EngineType::FAISS_IVFSQ8 &&
-        search_task->file_->engine_type_ != (int)engine::EngineType::FAISS_IVFFLAT) {
-        return false;
-    }
+    auto engine_type = search_task->file_->engine_type_;
+    // sptag indexes have no gpu implementation, always search them on cpu
+    bool cpu_only = engine_type == (int)engine::EngineType::SPTAG_KDT ||
+                    engine_type == (int)engine::EngineType::SPTAG_BKT;
+    if (!cpu_only) {
+        if (engine_type != (int)engine::EngineType::FAISS_IVFSQ8 &&
+            engine_type != (int)engine::EngineType::FAISS_IVFFLAT) {
+            return false;
+        }
 
-    auto gpu_id = get_gpu_pool();
-    if (not gpu_id.empty())
-        return false;
+        auto gpu_id = get_gpu_pool();
+        if (not gpu_id.empty())
+            return false;
+    }
 
-    ResourcePtr res_ptr = ResMgrInst::GetInstance()->GetResource("cpu");
+    auto res_name = get_search_cpu_resource(search_task->file_->location_);
+    ResourcePtr res_ptr = ResMgrInst::GetInstance()->GetResource(res_name);
     auto label = std::make_shared<SpecResLabel>(std::weak_ptr<Resource>(res_ptr));
     task->label() = label;
     return true;
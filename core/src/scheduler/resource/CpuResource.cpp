@@ -16,7 +16,13 @@
 // under the License.
 
 #include "scheduler/resource/CpuResource.h"
+#include "cache/CpuCacheMgr.h"
+#include "server/Config.h"
+#include "utils/Log.h"
+#include "utils/NumaUtil.h"
 
+#include <omp.h>
+#include <algorithm>
 #include <utility>
 
 namespace milvus {
@@ -30,6 +36,23 @@ operator<<(std::ostream& out, const CpuResource& resource) {
 
 CpuResource::CpuResource(std::string name, uint64_t device_id, bool enable_loader, bool enable_executor)
     : Resource(std::move(name), ResourceType::CPU, device_id, enable_loader, enable_executor) {
+    int32_t load_thread_num = 1;
+    server::Config& config = server::Config::GetInstance();
+    Status s = config.GetEngineConfigLoadThreadNum(load_thread_num);
+    if (!s.ok()) {
+        SERVER_LOG_ERROR << s.message();
+    }
+    loader_num_ = load_thread_num;
+
+    s = config.GetEngineConfigBuildCpuShare(build_cpu_share_);
+    if (!s.ok()) {
+        SERVER_LOG_ERROR << s.message();
+    }
+}
+
+void
+CpuResource::BindNumaNode(int64_t node) {
+    numa_node_ = node;
 }
 
 void
@@ -42,5 +65,37 @@ CpuResource::Process(TaskPtr task) {
     task->Execute();
 }
 
+uint64_t
+CpuResource::LoadMemoryBudget() {
+    // loaded files go to cpu cache, prefetch no more than the cache can still hold
+    auto cache = cache::CpuCacheMgr::GetInstance();
+    int64_t free_capacity = cache->CacheCapacity() - cache->CacheUsage();
+    if (numa_node_ >= 0) {
+        // every node resource gets an equal share of the cache, files are spread evenly over their home nodes
+        free_capacity /= server::NumaUtil::NodeCount();
+    }
+    return free_capacity > 0 ? free_capacity : 1;
+}
+
+void
+CpuResource::InitThread() {
+    if (numa_node_ < 0) {
+        return;
+    }
+    // loaded indexes are first touched by bound loader threads, so their pages land on this node.
+    // openmp keeps one thread pool per master thread and the pool threads inherit the affinity,
+    // so searches issued by the executor run on this node only
+    if (server::NumaUtil::BindCurrentThread(numa_node_).ok()) {
+        omp_set_num_threads(server::NumaUtil::NodeCpus(numa_node_).size());
+    }
+}
+
+void
+CpuResource::InitBackgroundThread() {
+    InitThread();
+    // builds parallelize with openmp on this thread's pool, shrink the pool so searches keep the remaining cpus
+    omp_set_num_threads(std::max(1, omp_get_max_threads() * build_cpu_share_ / 100));
+}
+
 }  // namespace scheduler
 }  // namespace milvus
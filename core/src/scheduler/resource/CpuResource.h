@@ -31,12 +31,31 @@ class CpuResource : public Resource {
     friend std::ostream&
     operator<<(std::ostream& out, const CpuResource& resource);
 
+    // pin loader and executor threads to the node, call before Start()
+    void
+    BindNumaNode(int64_t node);
+
  protected:
     void
     LoadFile(TaskPtr task) override;
 
     void
     Process(TaskPtr task) override;
+
+    uint64_t
+    LoadMemoryBudget() override;
+
+    void
+    InitThread() override;
+
+    void
+    InitBackgroundThread() override;
+
+ private:
+    // -1 means threads float over all cpus
+    int64_t numa_node_ = -1;
+    // percentage of the cpus given to index builds
+    int32_t build_cpu_share_ = 100;
 };
 
 }  // namespace scheduler
@@ -16,9 +16,12 @@
 // under the License.
 
 #include "scheduler/resource/Resource.h"
+#include "metrics/Metrics.h"
 #include "scheduler/SchedInst.h"
 #include "scheduler/Utils.h"
+#include "scheduler/task/SearchTask.h"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -53,7 +56,8 @@ Resource::Resource(std::string name, ResourceType type, uint64_t device_id, bool
       type_(type),
       device_id_(device_id),
       enable_loader_(enable_loader),
-      enable_executor_(enable_executor) {
+      enable_executor_(enable_executor),
+      background_executor_(enable_executor && type == ResourceType::CPU) {
     // register subscriber in tasktable
     task_table_.RegisterSubscriber([&] {
         if (subscriber_) {
@@ -67,10 +71,15 @@ void
 Resource::Start() {
     running_ = true;
     if (enable_loader_) {
-        loader_thread_ = std::thread(&Resource::loader_function, this);
+        for (uint64_t i = 0; i < std::max<uint64_t>(loader_num_, 1); ++i) {
+            loader_threads_.emplace_back(&Resource::loader_function, this);
+        }
     }
     if (enable_executor_) {
-        executor_thread_ = std::thread(&Resource::executor_function, this);
+        executor_thread_ = std::thread(&Resource::executor_function, this, false);
+    }
+    if (background_executor_) {
+        background_executor_thread_ = std::thread(&Resource::executor_function, this, true);
     }
 }
 
@@ -78,13 +87,23 @@ void
 Resource::Stop() {
     running_ = false;
     if (enable_loader_) {
-        WakeupLoader();
-        loader_thread_.join();
+        {
+            std::lock_guard<std::mutex> lock(load_mutex_);
+            load_flag_ = true;
+        }
+        load_cv_.notify_all();
+        for (auto& loader_thread : loader_threads_) {
+            loader_thread.join();
+        }
+        loader_threads_.clear();
     }
     if (enable_executor_) {
         WakeupExecutor();
         executor_thread_.join();
     }
+    if (background_executor_) {
+        background_executor_thread_.join();
+    }
 }
 
 void
@@ -101,8 +120,10 @@ Resource::WakeupExecutor() {
     {
         std::lock_guard<std::mutex> lock(exec_mutex_);
         exec_flag_ = true;
+        background_exec_flag_ = true;
     }
     exec_cv_.notify_one();
+    background_exec_cv_.notify_one();
 }
 
 json
@@ -112,10 +133,11 @@ Resource::Dump() const {
         {"name", name_},
         {"type", ToString(type_)},
         {"task_average_cost", TaskAvgCost()},
-        {"task_total_cost", total_cost_},
-        {"total_tasks", total_task_},
+        {"task_total_cost", total_cost_.load()},
+        {"total_tasks", total_task_.load()},
         {"running", running_},
         {"enable_loader", enable_loader_},
+        {"loader_num", loader_num_},
         {"enable_executor", enable_executor_},
     };
     return ret;
@@ -128,7 +150,7 @@ Resource::NumOfTaskToExec() {
 
 TaskTableItemPtr
 Resource::pick_task_load() {
-    auto indexes = task_table_.PickToLoad(10);
+    auto indexes = task_table_.PickToLoad(10, LoadMemoryBudget());
     for (auto index : indexes) {
         // try to set one task loading, then return
         if (task_table_.Load(index))
@@ -139,9 +161,13 @@ Resource::pick_task_load() {
 }
 
 TaskTableItemPtr
-Resource::pick_task_execute() {
+Resource::pick_task_execute(bool background) {
     auto indexes = task_table_.PickToExecute(std::numeric_limits<uint64_t>::max());
     for (auto index : indexes) {
+        if (background_executor_ && task_table_[index]->task->IsBackground() != background) {
+            continue;
+        }
+
         // try to set one task executing, then return
         if (task_table_[index]->task->label()->Type() == TaskLabelType::SPECIFIED_RESOURCE) {
             if (task_table_[index]->task->path().Last() != name()) {
@@ -168,16 +194,35 @@ Resource::pick_task_execute() {
 
 void
 Resource::loader_function() {
+    InitThread();
     while (running_) {
         std::unique_lock<std::mutex> lock(load_mutex_);
         load_cv_.wait(lock, [&] { return load_flag_; });
-        load_flag_ = false;
+        if (running_) {
+            load_flag_ = false;
+        }
         lock.unlock();
         while (true) {
             auto task_item = pick_task_load();
             if (task_item == nullptr) {
                 break;
             }
+            // let an idle loader pick the next task while this one is loading
+            if (loader_num_ > 1) {
+                WakeupLoader();
+            }
+            auto& trace_context = task_item->task->trace_context_;
+            if (trace_context != nullptr) {
+                trace_context->AddSpan(name() + " queue wait", task_item->timestamp.start * 1000,
+                                       task_item->timestamp.load * 1000);
+            }
+            if (task_item->task->Type() == TaskType::SearchTask) {
+                auto search_task = std::static_pointer_cast<XSearchTask>(task_item->task);
+                double queue_wait = (task_item->timestamp.load - task_item->timestamp.start) * 0.001;
+                server::Metrics::GetInstance().SearchPhaseDurationSecondsHistogramObserve(
+                    "queue_wait", search_task->file_->table_id_, search_task->file_->engine_type_, name(), queue_wait);
+            }
+
             LoadFile(task_item->task);
             task_item->Loaded();
             if (task_item->from) {
@@ -193,23 +238,36 @@ Resource::loader_function() {
 }
 
 void
-Resource::executor_function() {
-    if (subscriber_) {
-        auto event = std::make_shared<StartUpEvent>(shared_from_this());
-        subscriber_(std::static_pointer_cast<Event>(event));
+Resource::executor_function(bool background) {
+    auto& exec_flag = background ? background_exec_flag_ : exec_flag_;
+    auto& exec_cv = background ? background_exec_cv_ : exec_cv_;
+    if (background) {
+        InitBackgroundThread();
+    } else {
+        InitThread();
+        if (subscriber_) {
+            auto event = std::make_shared<StartUpEvent>(shared_from_this());
+            subscriber_(std::static_pointer_cast<Event>(event));
+        }
     }
     while (running_) {
         std::unique_lock<std::mutex> lock(exec_mutex_);
-        exec_cv_.wait(lock, [&] { return exec_flag_; });
-        exec_flag_ = false;
+        exec_cv.wait(lock, [&] { return exec_flag; });
+        exec_flag = false;
         lock.unlock();
         while (true) {
-            auto task_item = pick_task_execute();
+            auto task_item = pick_task_execute(background);
             if (task_item == nullptr) {
                 break;
             }
 
             auto start = get_current_timestamp();
+            auto& trace_context = task_item->task->trace_context_;
+            if (trace_context != nullptr) {
+                trace_context->AddSpan(name() + " execute wait", task_item->timestamp.loaded * 1000,
+                                       task_item->timestamp.execute * 1000);
+            }
+
             Process(task_item->task);
             auto finish = get_current_timestamp();
             ++total_task_;
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -50,6 +51,8 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
  public:
     /*
      * Start loader and executor if enable;
+     * on cpu, background tasks (index build) get an executor thread of their own, so they never hold up searches;
+     * other resources run them on their only executor;
      */
     void
     Start();
@@ -150,6 +153,35 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     virtual void
     Process(TaskPtr task) = 0;
 
+    /*
+     * Bytes allowed to be loading at the same time;
+     * 0 means no memory budget;
+     */
+    virtual uint64_t
+    LoadMemoryBudget() {
+        return 0;
+    }
+
+    /*
+     * Called once by every loader and executor thread before it picks tasks;
+     * e.g. pin the thread to a numa node;
+     */
+    virtual void
+    InitThread() {
+    }
+
+    /*
+     * Called once by the background executor thread, e.g. limit the cpus an index build may use;
+     */
+    virtual void
+    InitBackgroundThread() {
+        InitThread();
+    }
+
+ protected:
+    // number of loader threads, set by inherit class before Start()
+    uint64_t loader_num_ = 1;
+
  private:
     /*
      * Pick one task to load;
@@ -159,11 +191,11 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     pick_task_load();
 
     /*
-     * Pick one task to execute;
-     * Pick by start time and priority;
+     * Pick one foreground or background task to execute, any task without a background executor;
+     * Pick by priority and start time;
      */
     TaskTableItemPtr
-    pick_task_execute();
+    pick_task_execute(bool background);
 
  private:
     /*
@@ -173,10 +205,10 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     loader_function();
 
     /*
-     * Only called by worker thread;
+     * Only called by worker threads;
      */
     void
-    executor_function();
+    executor_function(bool background);
 
  protected:
     uint64_t device_id_;
@@ -187,23 +219,27 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
 
     TaskTable task_table_;
 
-    uint64_t total_cost_ = 0;
-    uint64_t total_task_ = 0;
+    std::atomic<uint64_t> total_cost_{0};
+    std::atomic<uint64_t> total_task_{0};
 
     std::function<void(EventPtr)> subscriber_ = nullptr;
 
     bool running_ = false;
     bool enable_loader_ = true;
     bool enable_executor_ = true;
-    std::thread loader_thread_;
+    bool background_executor_ = false;
+    std::vector<std::thread> loader_threads_;
     std::thread executor_thread_;
+    std::thread background_executor_thread_;
 
     bool load_flag_ = false;
     bool exec_flag_ = false;
+    bool background_exec_flag_ = false;
     std::mutex load_mutex_;
     std::mutex exec_mutex_;
     std::condition_variable load_cv_;
     std::condition_variable exec_cv_;
+    std::condition_variable background_exec_cv_;
 };
 
 using ResourcePtr = std::shared_ptr<Resource>;
@@ -17,12 +17,15 @@
 
 #include "scheduler/task/BuildIndexTask.h"
 #include "db/engine/EngineFactory.h"
+#include "db/engine/SegmentAttrs.h"
+#include "db/engine/SegmentTombstones.h"
 #include "metrics/Metrics.h"
 #include "scheduler/job/BuildIndexJob.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <utility>
@@ -95,6 +98,12 @@ XBuildIndexTask::Load(milvus::scheduler::LoadType type, uint8_t device_id) {
     }
 }
 
+uint64_t
+XBuildIndexTask::EstimatedLoadSize() const {
+    // a cached file is charged too, the task holds it in memory until it is executed
+    return file_ == nullptr ? 0 : file_->file_size_;
+}
+
 void
 XBuildIndexTask::Execute() {
     if (to_index_engine_ == nullptr) {
@@ -113,6 +122,7 @@ XBuildIndexTask::Execute() {
         engine::meta::TableFileSchema table_file;
         table_file.table_id_ = file_->table_id_;
         table_file.date_ = file_->date_;
+        table_file.partition_tag_ = file_->partition_tag_;
         table_file.file_type_ = engine::meta::TableFileSchema::NEW_INDEX;
 
         engine::meta::MetaPtr meta_ptr = build_index_job->meta();
@@ -196,7 +206,16 @@ XBuildIndexTask::Execute() {
         origin_file.file_type_ = engine::meta::TableFileSchema::BACKUP;
 
         engine::meta::TableFilesSchema update_files = {table_file, origin_file};
-        status = meta_ptr->UpdateTableFiles(update_files);
+        status = engine::SegmentAttrs::Copy(file_->location_, table_file.location_);
+        if (status.ok()) {
+            // vectors deleted from the raw file are still in the index, its tombstones go with it
+            std::lock_guard<std::mutex> lock(engine::SegmentTombstones::WriteMutex());
+            auto tombstones = engine::SegmentTombstones::Get(file_->location_);
+            status = engine::SegmentTombstones::Append(table_file.location_, tombstones->Ids());
+            if (status.ok()) {
+                status = meta_ptr->UpdateTableFiles(update_files);
+            }
+        }
         if (status.ok()) {
             ENGINE_LOG_DEBUG << "New index file " << table_file.file_id_ << " of size " << index->PhysicalSize()
                              << " bytes"
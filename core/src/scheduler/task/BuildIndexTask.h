@@ -34,6 +34,9 @@ class XBuildIndexTask : public Task {
     void
     Execute() override;
 
+    uint64_t
+    EstimatedLoadSize() const override;
+
  public:
     TableFileSchemaPtr file_;
     TableFileSchema table_file_;
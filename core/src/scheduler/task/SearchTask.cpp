@@ -16,7 +16,12 @@
 // under the License.
 
 #include "scheduler/task/SearchTask.h"
+#include "cache/CpuCacheMgr.h"
 #include "db/engine/EngineFactory.h"
+#include "db/engine/SegmentTombstones.h"
+#include "db/tier/TierManager.h"
+#include "knowhere/common/Arena.h"
+#include "knowhere/common/Cancel.h"
 #include "metrics/Metrics.h"
 #include "scheduler/job/SearchJob.h"
 #include "utils/Log.h"
@@ -24,6 +29,7 @@
 
 #include <src/scheduler/SchedInst.h>
 #include <algorithm>
+#include <limits>
 #include <string>
 #include <thread>
 #include <utility>
@@ -33,6 +39,10 @@ namespace scheduler {
 
 static constexpr size_t PARALLEL_REDUCE_THRESHOLD = 10000;
 static constexpr size_t PARALLEL_REDUCE_BATCH = 1000;
+// per-thread search scratch above this many results is released after use
+static constexpr size_t SCRATCH_RETAIN_ELEMENTS = 1024 * 1024;
+// largest k the gpu indexes accept, files with more deleted vectors may return fewer than topk results
+static constexpr uint64_t MAX_SEARCH_K = 2048;
 
 // TODO(wxyu): remove unused code
 // bool
@@ -77,6 +87,20 @@ static constexpr size_t PARALLEL_REDUCE_BATCH = 1000;
 //    }
 //}
 
+std::string
+LoadSpanName(LoadType type) {
+    switch (type) {
+        case LoadType::DISK2CPU:
+            return "disk load";
+        case LoadType::CPU2GPU:
+            return "copy cpu to gpu";
+        case LoadType::GPU2CPU:
+            return "copy gpu to cpu";
+        default:
+            return "load";
+    }
+}
+
 void
 CollectFileMetrics(int file_type, size_t file_size) {
     server::MetricsBase& inst = server::Metrics::GetInstance();
@@ -110,14 +134,44 @@ XSearchTask::XSearchTask(TableFileSchemaPtr file, TaskLabelPtr label)
 
 void
 XSearchTask::Load(LoadType type, uint8_t device_id) {
+    if (index_engine_ == nullptr) {
+        return;  // dropped at an earlier load
+    }
+
+    // the task of a cancelled search is dropped before it reads the disk or copies to gpu
+    if (auto job = job_.lock()) {
+        auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
+        if (search_job->Cancelled()) {
+            server::Metrics::GetInstance().SearchTaskDroppedIncrement("load");
+            index_engine_ = nullptr;
+            search_job->SearchDone(file_->id_);
+            return;
+        }
+    }
+
     TimeRecorder rc("");
     Status stat = Status::OK();
     std::string error_msg;
     std::string type_str;
 
+    server::ScopedTraceSpan trace_span(trace_context_, LoadSpanName(type));
+    trace_span.SetAttribute("file_id", std::to_string(file_->id_));
+
+    // index file will be read from disk if it is not in cpu cache
+    bool cache_hit = false;
+    if (type == LoadType::DISK2CPU) {
+        cache_hit = cache::CpuCacheMgr::GetInstance()->ItemExists(file_->location_);
+    }
+
     try {
         if (type == LoadType::DISK2CPU) {
-            stat = index_engine_->Load();
+            // cold index file may only exist in secondary tier
+            if (!cache_hit) {
+                stat = engine::TierManager::GetInstance().Fetch(*file_);
+            }
+            if (stat.ok()) {
+                stat = index_engine_->Load();
+            }
             type_str = "DISK2CPU";
         } else if (type == LoadType::CPU2GPU) {
             bool hybrid = false;
@@ -159,6 +213,7 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
     }
 
     size_t file_size = index_engine_->PhysicalSize();
+    trace_span.SetAttribute("size", std::to_string(file_size));
 
     std::string info = "Load file id:" + std::to_string(file_->id_) +
                        " file type:" + std::to_string(file_->file_type_) + " size:" + std::to_string(file_size) +
@@ -170,12 +225,28 @@ XSearchTask::Load(LoadType type, uint8_t device_id) {
 
     CollectFileMetrics(file_->file_type_, file_size);
 
+    server::MetricsBase& metrics = server::Metrics::GetInstance();
+    metrics.SearchPhaseDurationSecondsHistogramObserve("load", file_->table_id_, file_->engine_type_, path().Current(),
+                                                       span * 0.000001);
+    if (type == LoadType::DISK2CPU) {
+        metrics.TableCacheAccessIncrement(file_->table_id_, "cpu", cache_hit);
+        if (!cache_hit) {
+            metrics.TableDiskLoadBytesIncrement(file_->table_id_, file_size);
+        }
+    }
+
     // step 2: return search task for later execution
     index_id_ = file_->id_;
     index_type_ = file_->file_type_;
     //    search_contexts_.swap(search_contexts_);
 }
 
+uint64_t
+XSearchTask::EstimatedLoadSize() const {
+    // a cached file is charged too, the task holds it in memory until it is executed
+    return file_ == nullptr ? 0 : file_->file_size_;
+}
+
 void
 XSearchTask::Execute() {
     if (index_engine_ == nullptr) {
@@ -189,19 +260,39 @@ XSearchTask::Execute() {
 
     server::CollectDurationMetrics metrics(index_type_);
 
-    std::vector<int64_t> output_ids;
-    std::vector<float> output_distance;
+    // query scoped scratch of this executor thread, reused by the next task instead of reallocated;
+    // knowhere takes its result buffers from the thread arena inside the scope
+    static thread_local std::vector<int64_t> output_ids;
+    static thread_local std::vector<float> output_distance;
+    knowhere::ScratchScope scratch_scope;
 
     if (auto job = job_.lock()) {
         auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
+        if (search_job->Cancelled()) {
+            server::Metrics::GetInstance().SearchTaskDroppedIncrement("execute");
+            search_job->SearchDone(index_id_);
+            index_engine_ = nullptr;
+            return;
+        }
+
         // step 1: allocate memory
         uint64_t nq = search_job->nq();
         uint64_t topk = search_job->topk();
         uint64_t nprobe = search_job->nprobe();
         const float* vectors = search_job->vectors();
 
-        output_ids.resize(topk * nq);
-        output_distance.resize(topk * nq);
+        // vectors replaced by an upsert are still in the file, ask for enough extra results to drop them;
+        // an attribute filter has left them out of its allow list already
+        auto allow_list = search_job->AllowList(file_->id_);
+        auto tombstones = engine::SegmentTombstones::Get(file_->location_);
+        uint64_t search_k = topk;
+        if (allow_list == nullptr && !tombstones->Empty()) {
+            search_k = std::min<uint64_t>(topk + tombstones->Count(), index_engine_->Count());
+            search_k = std::max(std::min(search_k, MAX_SEARCH_K), topk);
+        }
+
+        output_ids.assign(search_k * nq, 0);
+        output_distance.assign(search_k * nq, 0);
         std::string hdr =
             "job " + std::to_string(search_job->id()) + " nq " + std::to_string(nq) + " topk " + std::to_string(topk);
 
@@ -212,21 +303,50 @@ XSearchTask::Execute() {
                 ResMgrInst::GetInstance()->GetResource(path().Last())->type() == ResourceType::CPU) {
                 hybrid = true;
             }
-            index_engine_->Search(nq, vectors, topk, nprobe, output_distance.data(), output_ids.data(), hybrid);
-
-            double span = rc.RecordSection(hdr + ", do search");
-            //            search_job->AccumSearchCost(span);
-
-            // step 3: pick up topk result
-            auto spec_k = index_engine_->Count() < topk ? index_engine_->Count() : topk;
             {
-                std::unique_lock<std::mutex> lock(search_job->mutex());
-                XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, metric_l2,
-                                                  search_job->GetResultIds(), search_job->GetResultDistances());
+                // knowhere checks the token between query batches
+                knowhere::CancelScope cancel_scope(search_job->cancel_token());
+                server::ScopedTraceSpan trace_span(trace_context_, "search");
+                trace_span.SetAttribute("file_id", std::to_string(index_id_));
+                trace_span.SetAttribute("resource", path().Last());
+                if (allow_list != nullptr) {
+                    index_engine_->Search(nq, vectors, search_k, nprobe, *allow_list, output_distance.data(),
+                                          output_ids.data(), hybrid);
+                } else {
+                    index_engine_->Search(nq, vectors, search_k, nprobe, output_distance.data(), output_ids.data(),
+                                          hybrid);
+                }
             }
+            if (search_job->Cancelled()) {
+                // the search may have stopped early, the results are incomplete and the job fails anyway
+                server::Metrics::GetInstance().SearchTaskDroppedIncrement("search");
+            } else {
+                if (allow_list == nullptr && !tombstones->Empty()) {
+                    DropDeleted(*tombstones, nq, search_k, topk, metric_l2, output_ids, output_distance);
+                }
+
+                double span = rc.RecordSection(hdr + ", do search");
+                server::Metrics::GetInstance().SearchPhaseDurationSecondsHistogramObserve(
+                    "execute", file_->table_id_, file_->engine_type_, path().Last(), span * 0.000001);
+                //            search_job->AccumSearchCost(span);
+
+                // step 3: pick up topk result
+                int64_t live_count = (allow_list != nullptr)
+                                         ? allow_list->Count()
+                                         : static_cast<int64_t>(index_engine_->Count()) - tombstones->Count();
+                uint64_t spec_k = std::min<uint64_t>(std::max<int64_t>(live_count, 0), topk);
+                {
+                    server::ScopedTraceSpan trace_span(trace_context_, "reduce topk");
+                    std::unique_lock<std::mutex> lock(search_job->mutex());
+                    XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, metric_l2,
+                                                      search_job->GetResultIds(), search_job->GetResultDistances());
+                }
 
-            span = rc.RecordSection(hdr + ", reduce topk");
-            //            search_job->AccumReduceCost(span);
+                span = rc.RecordSection(hdr + ", reduce topk");
+                server::Metrics::GetInstance().SearchPhaseDurationSecondsHistogramObserve(
+                    "reduce", file_->table_id_, file_->engine_type_, path().Last(), span * 0.000001);
+                //            search_job->AccumReduceCost(span);
+            }
         } catch (std::exception& ex) {
             ENGINE_LOG_ERROR << "SearchTask encounter exception: " << ex.what();
             //            search_job->IndexSearchDone(index_id_);//mark as done avoid dead lock, even search failed
@@ -234,6 +354,12 @@ XSearchTask::Execute() {
 
         // step 4: notify to send result to client
         search_job->SearchDone(index_id_);
+
+        // a rare huge query should not pin its buffers on this thread
+        if (output_ids.capacity() > SCRATCH_RETAIN_ELEMENTS) {
+            std::vector<int64_t>().swap(output_ids);
+            std::vector<float>().swap(output_distance);
+        }
     }
 
     rc.ElapseFromBegin("totally cost");
@@ -242,6 +368,32 @@ XSearchTask::Execute() {
     index_engine_ = nullptr;
 }
 
+void
+XSearchTask::DropDeleted(const engine::SegmentTombstones& tombstones, size_t nq, size_t search_k, size_t topk,
+                         bool ascending, scheduler::ResultIds& ids, scheduler::ResultDistances& distances) {
+    // rows are compacted in place to a stride of topk, a row never writes ahead of where it reads
+    float missing = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    for (size_t i = 0; i < nq; i++) {
+        size_t src = i * search_k;
+        size_t tar = i * topk;
+        size_t kept = 0;
+        for (size_t j = 0; j < search_k && kept < topk; j++) {
+            if (ids[src + j] >= 0 && tombstones.Contains(ids[src + j])) {
+                continue;
+            }
+            ids[tar + kept] = ids[src + j];
+            distances[tar + kept] = distances[src + j];
+            kept++;
+        }
+        for (; kept < topk; kept++) {
+            ids[tar + kept] = -1;
+            distances[tar + kept] = missing;
+        }
+    }
+    ids.resize(nq * topk);
+    distances.resize(nq * topk);
+}
+
 void
 XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
                                   size_t src_k, size_t nq, size_t topk, bool ascending, scheduler::ResultIds& tar_ids,
@@ -253,8 +405,11 @@ XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const sch
     size_t tar_k = tar_ids.size() / nq;
     size_t buf_k = std::min(topk, src_k + tar_k);
 
-    scheduler::ResultIds buf_ids(nq * buf_k, -1);
-    scheduler::ResultDistances buf_distances(nq * buf_k, 0.0);
+    // swapped into the target below, the storage of the old target is kept for the next merge on this thread
+    static thread_local scheduler::ResultIds buf_ids;
+    static thread_local scheduler::ResultDistances buf_distances;
+    buf_ids.assign(nq * buf_k, -1);
+    buf_distances.assign(nq * buf_k, 0.0);
 
     for (uint64_t i = 0; i < nq; i++) {
         size_t buf_k_j = 0, src_k_j = 0, tar_k_j = 0;
@@ -306,6 +461,10 @@ XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const sch
     }
     tar_ids.swap(buf_ids);
     tar_distances.swap(buf_distances);
+    if (buf_ids.capacity() > SCRATCH_RETAIN_ELEMENTS) {
+        scheduler::ResultIds().swap(buf_ids);
+        scheduler::ResultDistances().swap(buf_distances);
+    }
 }
 
 // void
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "Task.h"
+#include "db/engine/SegmentTombstones.h"
 #include "scheduler/Definition.h"
 #include "scheduler/job/SearchJob.h"
 
@@ -37,12 +38,20 @@ class XSearchTask : public Task {
     void
     Execute() override;
 
+    uint64_t
+    EstimatedLoadSize() const override;
+
  public:
     static void
     MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
                          size_t src_k, size_t nq, size_t topk, bool ascending, scheduler::ResultIds& tar_ids,
                          scheduler::ResultDistances& tar_distances);
 
+    // drop the results of deleted vectors from rows of search_k results, leaving rows of topk
+    static void
+    DropDeleted(const engine::SegmentTombstones& tombstones, size_t nq, size_t search_k, size_t topk, bool ascending,
+                scheduler::ResultIds& ids, scheduler::ResultDistances& distances);
+
     //    static void
     //    MergeTopkArray(std::vector<int64_t>& tar_ids, std::vector<float>& tar_distance, uint64_t& tar_input_k,
     //                   const std::vector<int64_t>& src_ids, const std::vector<float>& src_distance, uint64_t
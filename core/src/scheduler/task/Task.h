@@ -18,6 +18,7 @@
 #pragma once
 
 #include "Path.h"
+#include "metrics/Tracer.h"
 #include "scheduler/job/Job.h"
 #include "scheduler/tasklabel/TaskLabel.h"
 #include "utils/Status.h"
@@ -84,11 +85,29 @@ class Task {
     virtual void
     Execute() = 0;
 
+    /*
+     * Bytes the task holds in memory from loading until it is executed, used to budget prefetching;
+     */
+    virtual uint64_t
+    EstimatedLoadSize() const {
+        return 0;
+    }
+
+    /*
+     * Background tasks run on their own executor thread with a limited cpu share;
+     */
+    inline bool
+    IsBackground() const {
+        return priority_ <= JobPriority::BUILD;
+    }
+
  public:
     Path task_path_;
     scheduler::JobWPtr job_;
     TaskType type_;
+    JobPriority priority_ = JobPriority::INTERACTIVE;
     TaskLabelPtr label_ = nullptr;
+    server::TraceContextPtr trace_context_ = nullptr;
 };
 
 }  // namespace scheduler
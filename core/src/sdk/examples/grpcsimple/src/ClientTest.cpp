@@ -336,6 +336,22 @@ ClientTest::Test(const std::string& address, const std::string& port) {
         //        std::cout << conn->DumpTaskTables() << std::endl;
     }
 
+    {  // fetch a vector by id and search with it
+        auto vector_id = search_record_array[0].first;
+        milvus::RowRecord vector_data;
+        milvus::Status stat = conn->GetVectorByID(TABLE_NAME, vector_id, vector_data);
+        std::cout << "GetVectorByID function call status: " << stat.message() << std::endl;
+        std::cout << "Vector " << vector_id << " dimension: " << vector_data.data.size() << std::endl;
+
+        std::vector<milvus::Range> query_range_array;
+        milvus::TopKQueryResult topk_query_result;
+        stat = conn->SearchByID(TABLE_NAME, vector_id, query_range_array, TOP_K, 32, topk_query_result);
+        std::cout << "SearchByID function call status: " << stat.message() << std::endl;
+        if (!topk_query_result.ids.empty()) {
+            std::cout << "Nearest id: " << topk_query_result.ids[0] << std::endl;
+        }
+    }
+
     {  // delete index
         milvus::Status stat = conn->DropIndex(TABLE_NAME);
         std::cout << "DropIndex function call status: " << stat.message() << std::endl;
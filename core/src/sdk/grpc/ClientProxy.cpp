@@ -97,6 +97,11 @@ ClientProxy::CreateTable(const TableSchema& param) {
         schema.set_dimension(param.dimension);
         schema.set_index_file_size(param.index_file_size);
         schema.set_metric_type(static_cast<int32_t>(param.metric_type));
+        for (auto& attr : param.attr_fields) {
+            ::milvus::grpc::AttrField* field = schema.add_attr_field_array();
+            field->set_name(attr.name);
+            field->set_type(static_cast<int32_t>(attr.type));
+        }
 
         return client_ptr_->CreateTable(schema);
     } catch (std::exception& ex) {
@@ -214,40 +219,7 @@ Status
 ClientProxy::Search(const std::string& table_name, const std::vector<RowRecord>& query_record_array,
                     const std::vector<Range>& query_range_array, int64_t topk, int64_t nprobe,
                     TopKQueryResult& topk_query_result) {
-    try {
-        // step 1: convert vectors data
-        ::milvus::grpc::SearchParam search_param;
-        search_param.set_table_name(table_name);
-        search_param.set_topk(topk);
-        search_param.set_nprobe(nprobe);
-        for (auto& record : query_record_array) {
-            ::milvus::grpc::RowRecord* row_record = search_param.add_query_record_array();
-            row_record->add_vector_data(record.data.begin(), record.data.end());
-        }
-
-        // step 2: convert range array
-        for (auto& range : query_range_array) {
-            ::milvus::grpc::Range* grpc_range = search_param.add_query_range_array();
-            grpc_range->set_start_value(range.start_value);
-            grpc_range->set_end_value(range.end_value);
-        }
-
-        // step 3: search vectors
-        ::milvus::grpc::TopKQueryResult result;
-        Status status = client_ptr_->Search(result, search_param);
-
-        // step 4: convert result array
-        topk_query_result.row_num = result.row_num();
-        topk_query_result.ids.resize(result.ids().size());
-        memcpy(topk_query_result.ids.data(), result.ids().data(), result.ids().size() * sizeof(int64_t));
-        topk_query_result.distances.resize(result.distances().size());
-        memcpy(topk_query_result.distances.data(), result.distances().data(),
-               result.distances().size() * sizeof(float));
-
-        return status;
-    } catch (std::exception& ex) {
-        return Status(StatusCode::UnknownError, "fail to search vectors: " + std::string(ex.what()));
-    }
+    return Search(table_name, query_record_array, query_range_array, "", topk, nprobe, topk_query_result);
 }
 
 Status
@@ -261,6 +233,13 @@ ClientProxy::DescribeTable(const std::string& table_name, TableSchema& table_sch
         table_schema.dimension = grpc_schema.dimension();
         table_schema.index_file_size = grpc_schema.index_file_size();
         table_schema.metric_type = static_cast<MetricType>(grpc_schema.metric_type());
+        table_schema.attr_fields.clear();
+        for (auto& field : grpc_schema.attr_field_array()) {
+            AttrField attr;
+            attr.name = field.name();
+            attr.type = static_cast<AttrType>(field.type());
+            table_schema.attr_fields.emplace_back(attr);
+        }
 
         return status;
     } catch (std::exception& ex) {
@@ -391,4 +370,168 @@ ClientProxy::DropIndex(const std::string& table_name) const {
     }
 }
 
+Status
+ClientProxy::GetVectorByID(const std::string& table_name, int64_t vector_id, RowRecord& vector_data) {
+    try {
+        ::milvus::grpc::VectorIdentity vector_identity;
+        vector_identity.set_table_name(table_name);
+        vector_identity.set_id(vector_id);
+
+        ::milvus::grpc::VectorData grpc_data;
+        Status status = client_ptr_->GetVectorByID(vector_identity, grpc_data);
+        vector_data.data.assign(grpc_data.vector_data().vector_data().begin(),
+                                grpc_data.vector_data().vector_data().end());
+        return status;
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "fail to get vector by id: " + std::string(ex.what()));
+    }
+}
+
+Status
+ClientProxy::SearchByID(const std::string& table_name, int64_t vector_id, const std::vector<Range>& query_range_array,
+                        int64_t topk, int64_t nprobe, TopKQueryResult& topk_query_result) {
+    try {
+        // step 1: convert search param
+        ::milvus::grpc::SearchByIDParam search_param;
+        search_param.set_table_name(table_name);
+        search_param.set_id(vector_id);
+        search_param.set_topk(topk);
+        search_param.set_nprobe(nprobe);
+        for (auto& range : query_range_array) {
+            ::milvus::grpc::Range* grpc_range = search_param.add_query_range_array();
+            grpc_range->set_start_value(range.start_value);
+            grpc_range->set_end_value(range.end_value);
+        }
+
+        // step 2: search vectors
+        ::milvus::grpc::TopKQueryResult result;
+        Status status = client_ptr_->SearchByID(result, search_param);
+
+        // step 3: convert result array
+        topk_query_result.row_num = result.row_num();
+        topk_query_result.ids.assign(result.ids().begin(), result.ids().end());
+        topk_query_result.distances.assign(result.distances().begin(), result.distances().end());
+
+        return status;
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "fail to search by id: " + std::string(ex.what()));
+    }
+}
+
+Status
+ClientProxy::Upsert(const std::string& table_name, const std::vector<RowRecord>& record_array,
+                    const std::vector<int64_t>& id_array) {
+    try {
+        ::milvus::grpc::InsertParam insert_param;
+        insert_param.set_table_name(table_name);
+        for (auto& record : record_array) {
+            ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
+            grpc_record->add_vector_data(record.data.begin(), record.data.end());
+        }
+        insert_param.add_row_id_array(id_array.begin(), id_array.end());
+
+        ::milvus::grpc::VectorIds vector_ids;
+        return client_ptr_->Upsert(vector_ids, insert_param);
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "fail to upsert vector: " + std::string(ex.what()));
+    }
+}
+
+Status
+ClientProxy::Search(const std::string& table_name, const std::vector<RowRecord>& query_record_array,
+                    const std::vector<Range>& query_range_array, const std::string& filter, int64_t topk,
+                    int64_t nprobe, TopKQueryResult& topk_query_result) {
+    return Search(table_name, std::vector<std::string>(), query_record_array, query_range_array, filter, topk, nprobe,
+                  topk_query_result);
+}
+
+Status
+ClientProxy::Insert(const std::string& table_name, const std::vector<RowRecord>& record_array,
+                    const std::vector<AttrColumn>& attr_columns, std::vector<int64_t>& id_array) {
+    return Insert(table_name, "", record_array, attr_columns, id_array);
+}
+
+Status
+ClientProxy::Search(const std::string& table_name, const std::vector<std::string>& partition_tags,
+                    const std::vector<RowRecord>& query_record_array, const std::vector<Range>& query_range_array,
+                    const std::string& filter, int64_t topk, int64_t nprobe, TopKQueryResult& topk_query_result) {
+    try {
+        // step 1: convert vectors data
+        ::milvus::grpc::SearchParam search_param;
+        search_param.set_table_name(table_name);
+        search_param.set_topk(topk);
+        search_param.set_nprobe(nprobe);
+        search_param.set_filter(filter);
+        for (auto& tag : partition_tags) {
+            search_param.add_partition_tag_array(tag);
+        }
+        for (auto& record : query_record_array) {
+            ::milvus::grpc::RowRecord* row_record = search_param.add_query_record_array();
+            row_record->add_vector_data(record.data.begin(), record.data.end());
+        }
+
+        // step 2: convert range array
+        for (auto& range : query_range_array) {
+            ::milvus::grpc::Range* grpc_range = search_param.add_query_range_array();
+            grpc_range->set_start_value(range.start_value);
+            grpc_range->set_end_value(range.end_value);
+        }
+
+        // step 3: search vectors
+        ::milvus::grpc::TopKQueryResult result;
+        Status status = client_ptr_->Search(result, search_param);
+
+        // step 4: convert result array
+        topk_query_result.row_num = result.row_num();
+        topk_query_result.ids.resize(result.ids().size());
+        memcpy(topk_query_result.ids.data(), result.ids().data(), result.ids().size() * sizeof(int64_t));
+        topk_query_result.distances.resize(result.distances().size());
+        memcpy(topk_query_result.distances.data(), result.distances().data(),
+               result.distances().size() * sizeof(float));
+
+        return status;
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "fail to search vectors: " + std::string(ex.what()));
+    }
+}
+
+Status
+ClientProxy::Insert(const std::string& table_name, const std::string& partition_tag,
+                    const std::vector<RowRecord>& record_array, const std::vector<AttrColumn>& attr_columns,
+                    std::vector<int64_t>& id_array) {
+    Status status = Status::OK();
+    try {
+        ::milvus::grpc::InsertParam insert_param;
+        insert_param.set_table_name(table_name);
+        insert_param.set_partition_tag(partition_tag);
+        for (auto& record : record_array) {
+            ::milvus::grpc::RowRecord* grpc_record = insert_param.add_row_record_array();
+            grpc_record->add_vector_data(record.data.begin(), record.data.end());
+        }
+        for (auto& column : attr_columns) {
+            ::milvus::grpc::AttrColumn* grpc_column = insert_param.add_attr_column_array();
+            grpc_column->set_name(column.name);
+            for (auto value : column.int_values) {
+                grpc_column->add_int_value_array(value);
+            }
+            for (auto value : column.double_values) {
+                grpc_column->add_double_value_array(value);
+            }
+        }
+
+        ::milvus::grpc::VectorIds vector_ids;
+        if (!id_array.empty()) {
+            insert_param.add_row_id_array(id_array.begin(), id_array.end());
+            client_ptr_->Insert(vector_ids, insert_param, status);
+        } else {
+            client_ptr_->Insert(vector_ids, insert_param, status);
+            id_array.insert(id_array.end(), vector_ids.vector_id_array().begin(), vector_ids.vector_id_array().end());
+        }
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "fail to add vector: " + std::string(ex.what()));
+    }
+
+    return status;
+}
+
 }  // namespace milvus
@@ -95,6 +95,35 @@ class ClientProxy : public Connection {
     Status
     DropIndex(const std::string& table_name) const override;
 
+    Status
+    GetVectorByID(const std::string& table_name, int64_t vector_id, RowRecord& vector_data) override;
+
+    Status
+    SearchByID(const std::string& table_name, int64_t vector_id, const std::vector<Range>& query_range_array,
+               int64_t topk, int64_t nprobe, TopKQueryResult& topk_query_result) override;
+
+    Status
+    Upsert(const std::string& table_name, const std::vector<RowRecord>& record_array,
+           const std::vector<int64_t>& id_array) override;
+
+    Status
+    Insert(const std::string& table_name, const std::vector<RowRecord>& record_array,
+           const std::vector<AttrColumn>& attr_columns, std::vector<int64_t>& id_array) override;
+
+    Status
+    Search(const std::string& table_name, const std::vector<RowRecord>& query_record_array,
+           const std::vector<Range>& query_range_array, const std::string& filter, int64_t topk, int64_t nprobe,
+           TopKQueryResult& topk_query_result) override;
+
+    Status
+    Insert(const std::string& table_name, const std::string& partition_tag, const std::vector<RowRecord>& record_array,
+           const std::vector<AttrColumn>& attr_columns, std::vector<int64_t>& id_array) override;
+
+    Status
+    Search(const std::string& table_name, const std::vector<std::string>& partition_tags,
+           const std::vector<RowRecord>& query_record_array, const std::vector<Range>& query_range_array,
+           const std::string& filter, int64_t topk, int64_t nprobe, TopKQueryResult& topk_query_result) override;
+
  private:
     std::shared_ptr<::grpc::Channel> channel_;
 
@@ -317,4 +317,57 @@ GrpcClient::DropIndex(grpc::TableName& table_name) {
     return Status::OK();
 }
 
+Status
+GrpcClient::GetVectorByID(const grpc::VectorIdentity& vector_identity, grpc::VectorData& vector_data) {
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->GetVectorByID(&context, vector_identity, &vector_data);
+
+    if (!grpc_status.ok()) {
+        std::cerr << "GetVectorByID gRPC failed!" << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+
+    if (vector_data.status().error_code() != grpc::SUCCESS) {
+        std::cerr << vector_data.status().reason() << std::endl;
+        return Status(StatusCode::ServerFailed, vector_data.status().reason());
+    }
+    return Status::OK();
+}
+
+Status
+GrpcClient::SearchByID(::milvus::grpc::TopKQueryResult& topk_query_result,
+                       const ::milvus::grpc::SearchByIDParam& search_param) {
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->SearchByID(&context, search_param, &topk_query_result);
+
+    if (!grpc_status.ok()) {
+        std::cerr << "SearchByID rpc failed!" << std::endl;
+        std::cerr << grpc_status.error_message() << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+    if (topk_query_result.status().error_code() != grpc::SUCCESS) {
+        std::cerr << topk_query_result.status().reason() << std::endl;
+        return Status(StatusCode::ServerFailed, topk_query_result.status().reason());
+    }
+
+    return Status::OK();
+}
+
+Status
+GrpcClient::Upsert(::milvus::grpc::VectorIds& vector_ids, const ::milvus::grpc::InsertParam& insert_param) {
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->Upsert(&context, insert_param, &vector_ids);
+
+    if (!grpc_status.ok()) {
+        std::cerr << "Upsert rpc failed!" << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+    if (vector_ids.status().error_code() != grpc::SUCCESS) {
+        std::cerr << vector_ids.status().reason() << std::endl;
+        return Status(StatusCode::ServerFailed, vector_ids.status().reason());
+    }
+
+    return Status::OK();
+}
+
 }  // namespace milvus
@@ -83,6 +83,15 @@ class GrpcClient {
     Status
     DropIndex(grpc::TableName& table_name);
 
+    Status
+    GetVectorByID(const grpc::VectorIdentity& vector_identity, grpc::VectorData& vector_data);
+
+    Status
+    SearchByID(::milvus::grpc::TopKQueryResult& topk_query_result, const grpc::SearchByIDParam& search_param);
+
+    Status
+    Upsert(grpc::VectorIds& vector_ids, const grpc::InsertParam& insert_param);
+
     Status
     Disconnect();
 
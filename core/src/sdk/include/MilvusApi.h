@@ -37,6 +37,8 @@ enum class IndexType {
     gpu_ivfsq8,
     mix_nsg,
     ivfsq8h,
+    sptag_kdt,
+    sptag_bkt,
 };
 
 enum class MetricType {
@@ -44,6 +46,22 @@ enum class MetricType {
     IP = 2,
 };
 
+/**
+ * @brief Scalar attribute type
+ */
+enum class AttrType {
+    INT64 = 1,
+    DOUBLE = 2,
+};
+
+/**
+ * @brief Scalar attribute stored with each vector of a table
+ */
+struct AttrField {
+    std::string name;                 ///< Attribute name, letters, digits and '_', not starting with a digit
+    AttrType type = AttrType::INT64;  ///< Attribute type
+};
+
 /**
  * @brief Connect API parameter
  */
@@ -60,6 +78,7 @@ struct TableSchema {
     int64_t dimension = 0;                    ///< Vector dimension, must be a positive value
     int64_t index_file_size = 0;              ///< Index file size, must be a positive value
     MetricType metric_type = MetricType::L2;  ///< Index metric type
+    std::vector<AttrField> attr_fields;       ///< Scalar attributes, optional
 };
 
 /**
@@ -78,6 +97,16 @@ struct RowRecord {
     std::vector<float> data;  ///< Vector raw data
 };
 
+/**
+ * @brief Attribute values of inserted records
+ * only the values of the attribute type are given, one per record
+ */
+struct AttrColumn {
+    std::string name;                   ///< Attribute name
+    std::vector<int64_t> int_values;    ///< Values of an int64 attribute
+    std::vector<double> double_values;  ///< Values of a double attribute
+};
+
 /**
  * @brief TopK query result
  */
@@ -376,6 +405,128 @@ class Connection {
      */
     virtual Status
     DropIndex(const std::string& table_name) const = 0;
+
+    /**
+     * @brief Get vector by id
+     *
+     * This method is used to fetch the vector stored under an id
+     *
+     * @param table_name, table the vector was inserted into.
+     * @param vector_id, id returned by Insert.
+     * @param vector_data, the stored vector.
+     *
+     * @return Indicate if the vector is found.
+     */
+    virtual Status
+    GetVectorByID(const std::string& table_name, int64_t vector_id, RowRecord& vector_data) = 0;
+
+    /**
+     * @brief Search by vector id
+     *
+     * This method is used to query a table with a vector already stored in it.
+     *
+     * @param table_name, table_name is queried.
+     * @param vector_id, id of the stored vector used as query.
+     * @param query_range_array, time ranges, if not specified, will search in whole table
+     * @param topk, how many similarity vectors will be searched.
+     * @param nprobe, the number of buckets to probe.
+     * @param topk_query_result, result array.
+     *
+     * @return Indicate if query is successful.
+     */
+    virtual Status
+    SearchByID(const std::string& table_name, int64_t vector_id, const std::vector<Range>& query_range_array,
+               int64_t topk, int64_t nprobe, TopKQueryResult& topk_query_result) = 0;
+
+    /**
+     * @brief Upsert vector to table
+     *
+     * This method is used to add vectors with user ids, the vectors previously
+     * added with the same ids are deleted.
+     *
+     * @param table_name, table_name is inserted.
+     * @param record_array, vector array is inserted.
+     * @param id_array, one unique id for every vector.
+     *
+     * @return Indicate if vector array are upserted successfully
+     */
+    virtual Status
+    Upsert(const std::string& table_name, const std::vector<RowRecord>& record_array,
+           const std::vector<int64_t>& id_array) = 0;
+
+    /**
+     * @brief Add vector with attributes to table
+     *
+     * This method is used to add vector array to a table created with attributes.
+     *
+     * @param table_name, table_name is inserted.
+     * @param record_array, vector array is inserted.
+     * @param attr_columns, values of every attribute of the table for the vectors.
+     * @param id_array, after inserted every vector is given a id.
+     *
+     * @return Indicate if vector array are inserted successfully
+     */
+    virtual Status
+    Insert(const std::string& table_name, const std::vector<RowRecord>& record_array,
+           const std::vector<AttrColumn>& attr_columns, std::vector<int64_t>& id_array) = 0;
+
+    /**
+     * @brief Search vector with attribute filter
+     *
+     * This method is used to query the vectors whose attributes match a filter.
+     *
+     * @param table_name, table_name is queried.
+     * @param query_record_array, all vector are going to be queried.
+     * @param query_range_array, time ranges, if not specified, will search in whole table
+     * @param filter, comparisons of attributes with constants joined by &&, e.g. "price < 9.5 && category == 3"
+     * @param topk, how many similarity vectors will be searched.
+     * @param nprobe, the number of buckets to probe.
+     * @param topk_query_result, result array.
+     *
+     * @return Indicate if query is successful.
+     */
+    virtual Status
+    Search(const std::string& table_name, const std::vector<RowRecord>& query_record_array,
+           const std::vector<Range>& query_range_array, const std::string& filter, int64_t topk, int64_t nprobe,
+           TopKQueryResult& topk_query_result) = 0;
+
+    /**
+     * @brief Add vector to a partition of table
+     *
+     * This method is used to add vector array to one partition of a table.
+     *
+     * @param table_name, table_name is inserted.
+     * @param partition_tag, letters, digits, '-' and '_', the default partition if empty.
+     * @param record_array, vector array is inserted.
+     * @param attr_columns, values of every attribute of the table for the vectors.
+     * @param id_array, after inserted every vector is given a id.
+     *
+     * @return Indicate if vector array are inserted successfully
+     */
+    virtual Status
+    Insert(const std::string& table_name, const std::string& partition_tag, const std::vector<RowRecord>& record_array,
+           const std::vector<AttrColumn>& attr_columns, std::vector<int64_t>& id_array) = 0;
+
+    /**
+     * @brief Search vector in partitions
+     *
+     * This method is used to query vector in some partitions of a table.
+     *
+     * @param table_name, table_name is queried.
+     * @param partition_tags, partitions to search, whole table if empty.
+     * @param query_record_array, all vector are going to be queried.
+     * @param query_range_array, time ranges, if not specified, will search in whole table
+     * @param filter, attribute filter, no filter if empty.
+     * @param topk, how many similarity vectors will be searched.
+     * @param nprobe, the number of buckets to probe.
+     * @param topk_query_result, result array.
+     *
+     * @return Indicate if query is successful.
+     */
+    virtual Status
+    Search(const std::string& table_name, const std::vector<std::string>& partition_tags,
+           const std::vector<RowRecord>& query_record_array, const std::vector<Range>& query_range_array,
+           const std::string& filter, int64_t topk, int64_t nprobe, TopKQueryResult& topk_query_result) = 0;
 };
 
 }  // namespace milvus
@@ -145,4 +145,51 @@ ConnectionImpl::DropIndex(const std::string& table_name) const {
     return client_proxy_->DropIndex(table_name);
 }
 
+Status
+ConnectionImpl::GetVectorByID(const std::string& table_name, int64_t vector_id, RowRecord& vector_data) {
+    return client_proxy_->GetVectorByID(table_name, vector_id, vector_data);
+}
+
+Status
+ConnectionImpl::SearchByID(const std::string& table_name, int64_t vector_id,
+                           const std::vector<Range>& query_range_array, int64_t topk, int64_t nprobe,
+                           TopKQueryResult& topk_query_result) {
+    return client_proxy_->SearchByID(table_name, vector_id, query_range_array, topk, nprobe, topk_query_result);
+}
+
+Status
+ConnectionImpl::Upsert(const std::string& table_name, const std::vector<RowRecord>& record_array,
+                       const std::vector<int64_t>& id_array) {
+    return client_proxy_->Upsert(table_name, record_array, id_array);
+}
+
+Status
+ConnectionImpl::Insert(const std::string& table_name, const std::vector<RowRecord>& record_array,
+                       const std::vector<AttrColumn>& attr_columns, std::vector<int64_t>& id_array) {
+    return client_proxy_->Insert(table_name, record_array, attr_columns, id_array);
+}
+
+Status
+ConnectionImpl::Search(const std::string& table_name, const std::vector<RowRecord>& query_record_array,
+                       const std::vector<Range>& query_range_array, const std::string& filter, int64_t topk,
+                       int64_t nprobe, TopKQueryResult& topk_query_result) {
+    return client_proxy_->Search(table_name, query_record_array, query_range_array, filter, topk, nprobe,
+                                 topk_query_result);
+}
+
+Status
+ConnectionImpl::Insert(const std::string& table_name, const std::string& partition_tag,
+                       const std::vector<RowRecord>& record_array, const std::vector<AttrColumn>& attr_columns,
+                       std::vector<int64_t>& id_array) {
+    return client_proxy_->Insert(table_name, partition_tag, record_array, attr_columns, id_array);
+}
+
+Status
+ConnectionImpl::Search(const std::string& table_name, const std::vector<std::string>& partition_tags,
+                       const std::vector<RowRecord>& query_record_array, const std::vector<Range>& query_range_array,
+                       const std::string& filter, int64_t topk, int64_t nprobe, TopKQueryResult& topk_query_result) {
+    return client_proxy_->Search(table_name, partition_tags, query_record_array, query_range_array, filter, topk,
+                                 nprobe, topk_query_result);
+}
+
 }  // namespace milvus
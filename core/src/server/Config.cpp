@@ -94,6 +94,24 @@ Config::ValidateConfig() {
         return s;
     }
 
+    std::vector<std::vector<std::string>> server_shards;
+    s = GetServerConfigShards(server_shards);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t server_shard_timeout;
+    s = GetServerConfigShardTimeout(server_shard_timeout);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t server_hedge_delay;
+    s = GetServerConfigHedgeDelay(server_hedge_delay);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* db config */
     std::string db_primary_path;
     s = GetDBConfigPrimaryPath(db_primary_path);
@@ -131,6 +149,24 @@ Config::ValidateConfig() {
         return s;
     }
 
+    std::string db_tier_path;
+    s = GetDBConfigTierPath(db_tier_path);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int32_t db_tier_cold_days;
+    s = GetDBConfigTierColdDays(db_tier_cold_days);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t db_tier_local_capacity;
+    s = GetDBConfigTierLocalCapacity(db_tier_local_capacity);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* metric config */
     bool metric_enable_monitor;
     s = GetMetricConfigEnableMonitor(metric_enable_monitor);
@@ -150,6 +186,30 @@ Config::ValidateConfig() {
         return s;
     }
 
+    float metric_trace_sample_rate;
+    s = GetMetricConfigTraceSampleRate(metric_trace_sample_rate);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t metric_trace_buffer_size;
+    s = GetMetricConfigTraceBufferSize(metric_trace_buffer_size);
+    if (!s.ok()) {
+        return s;
+    }
+
+    std::string metric_trace_export_path;
+    s = GetMetricConfigTraceExportPath(metric_trace_export_path);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t metric_table_label_limit;
+    s = GetMetricConfigTableLabelLimit(metric_table_label_limit);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* cache config */
     int64_t cache_cpu_cache_capacity;
     s = GetCacheConfigCpuCacheCapacity(cache_cpu_cache_capacity);
@@ -181,6 +241,18 @@ Config::ValidateConfig() {
         return s;
     }
 
+    bool cache_warm_restart;
+    s = GetCacheConfigWarmRestart(cache_warm_restart);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t cache_warm_up_io_rate;
+    s = GetCacheConfigWarmUpIoRate(cache_warm_up_io_rate);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* engine config */
     int32_t engine_use_blas_threshold;
     s = GetEngineConfigUseBlasThreshold(engine_use_blas_threshold);
@@ -200,6 +272,60 @@ Config::ValidateConfig() {
         return s;
     }
 
+    int32_t engine_load_thread_num;
+    s = GetEngineConfigLoadThreadNum(engine_load_thread_num);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int32_t engine_io_thread_num;
+    s = GetEngineConfigIoThreadNum(engine_io_thread_num);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t engine_io_chunk_size;
+    s = GetEngineConfigIoChunkSize(engine_io_chunk_size);
+    if (!s.ok()) {
+        return s;
+    }
+
+    bool engine_use_direct_io;
+    s = GetEngineConfigUseDirectIo(engine_use_direct_io);
+    if (!s.ok()) {
+        return s;
+    }
+
+    std::string engine_huge_page;
+    s = GetEngineConfigHugePage(engine_huge_page);
+    if (!s.ok()) {
+        return s;
+    }
+
+    bool engine_use_mmap;
+    s = GetEngineConfigUseMmap(engine_use_mmap);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int32_t engine_build_cpu_share;
+    s = GetEngineConfigBuildCpuShare(engine_build_cpu_share);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t engine_search_capacity;
+    s = GetEngineConfigSearchCapacity(engine_search_capacity);
+    if (!s.ok()) {
+        return s;
+    }
+
+    int64_t engine_nsg_build_memory_cap;
+    s = GetEngineConfigNsgBuildMemoryCap(engine_nsg_build_memory_cap);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* resource config */
     std::string resource_mode;
     s = GetResourceConfigMode(resource_mode);
@@ -219,6 +345,12 @@ Config::ValidateConfig() {
         return s;
     }
 
+    bool resource_numa_aware;
+    s = GetResourceConfigNumaAware(resource_numa_aware);
+    if (!s.ok()) {
+        return s;
+    }
+
     return Status::OK();
 }
 
@@ -247,6 +379,21 @@ Config::ResetDefaultConfig() {
         return s;
     }
 
+    s = SetServerConfigShards(CONFIG_SERVER_SHARDS_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetServerConfigShardTimeout(CONFIG_SERVER_SHARD_TIMEOUT_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetServerConfigHedgeDelay(CONFIG_SERVER_HEDGE_DELAY_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* db config */
     s = SetDBConfigPrimaryPath(CONFIG_DB_PRIMARY_PATH_DEFAULT);
     if (!s.ok()) {
@@ -278,6 +425,21 @@ Config::ResetDefaultConfig() {
         return s;
     }
 
+    s = SetDBConfigTierPath(CONFIG_DB_TIER_PATH_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetDBConfigTierColdDays(CONFIG_DB_TIER_COLD_DAYS_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetDBConfigTierLocalCapacity(CONFIG_DB_TIER_LOCAL_CAPACITY_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* metric config */
     s = SetMetricConfigEnableMonitor(CONFIG_METRIC_ENABLE_MONITOR_DEFAULT);
     if (!s.ok()) {
@@ -294,6 +456,26 @@ Config::ResetDefaultConfig() {
         return s;
     }
 
+    s = SetMetricConfigTraceSampleRate(CONFIG_METRIC_TRACE_SAMPLE_RATE_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetMetricConfigTraceBufferSize(CONFIG_METRIC_TRACE_BUFFER_SIZE_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetMetricConfigTraceExportPath(CONFIG_METRIC_TRACE_EXPORT_PATH_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetMetricConfigTableLabelLimit(CONFIG_METRIC_TABLE_LABEL_LIMIT_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* cache config */
     s = SetCacheConfigCpuCacheCapacity(CONFIG_CACHE_CPU_CACHE_CAPACITY_DEFAULT);
     if (!s.ok()) {
@@ -320,6 +502,16 @@ Config::ResetDefaultConfig() {
         return s;
     }
 
+    s = SetCacheConfigWarmRestart(CONFIG_CACHE_WARM_RESTART_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetCacheConfigWarmUpIoRate(CONFIG_CACHE_WARM_UP_IO_RATE_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* engine config */
     s = SetEngineConfigUseBlasThreshold(CONFIG_ENGINE_USE_BLAS_THRESHOLD_DEFAULT);
     if (!s.ok()) {
@@ -336,6 +528,51 @@ Config::ResetDefaultConfig() {
         return s;
     }
 
+    s = SetEngineConfigLoadThreadNum(CONFIG_ENGINE_LOAD_THREAD_NUM_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetEngineConfigIoThreadNum(CONFIG_ENGINE_IO_THREAD_NUM_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetEngineConfigIoChunkSize(CONFIG_ENGINE_IO_CHUNK_SIZE_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetEngineConfigUseDirectIo(CONFIG_ENGINE_USE_DIRECT_IO_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetEngineConfigHugePage(CONFIG_ENGINE_HUGE_PAGE_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetEngineConfigUseMmap(CONFIG_ENGINE_USE_MMAP_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetEngineConfigBuildCpuShare(CONFIG_ENGINE_BUILD_CPU_SHARE_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetEngineConfigSearchCapacity(CONFIG_ENGINE_SEARCH_CAPACITY_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
+    s = SetEngineConfigNsgBuildMemoryCap(CONFIG_ENGINE_NSG_BUILD_MEMORY_CAP_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
     /* resource config */
     s = SetResourceConfigMode(CONFIG_RESOURCE_MODE_DEFAULT);
     if (!s.ok()) {
@@ -352,6 +589,11 @@ Config::ResetDefaultConfig() {
         return s;
     }
 
+    s = SetResourceConfigNumaAware(CONFIG_RESOURCE_NUMA_AWARE_DEFAULT);
+    if (!s.ok()) {
+        return s;
+    }
+
     return Status::OK();
 }
 
@@ -430,6 +672,49 @@ Config::CheckServerConfigTimeZone(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckServerConfigShards(const std::string& value) {
+    if (value.empty()) {
+        return Status::OK();
+    }
+
+    std::vector<std::string> shards;
+    StringHelpFunctions::SplitStringByDelimeter(value, CONFIG_SERVER_SHARDS_DELIMITER, shards);
+    for (auto& shard : shards) {
+        std::vector<std::string> replicas;
+        StringHelpFunctions::SplitStringByDelimeter(shard, CONFIG_SERVER_SHARD_REPLICA_DELIMITER, replicas);
+        for (auto& replica : replicas) {
+            auto pos = replica.rfind(':');
+            if (pos == std::string::npos || pos == 0 || !CheckServerConfigPort(replica.substr(pos + 1)).ok()) {
+                std::string msg = "Invalid shard address: " + replica +
+                                  ". Possible reason: server_config.shards is not a list of host:port.";
+                return Status(SERVER_INVALID_ARGUMENT, msg);
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckServerConfigShardTimeout(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid shard timeout: " + value +
+                          ". Possible reason: server_config.shard_timeout is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckServerConfigHedgeDelay(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid hedge delay: " + value +
+                          ". Possible reason: server_config.hedge_delay is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckDBConfigPrimaryPath(const std::string& value) {
     if (value.empty()) {
@@ -499,6 +784,45 @@ Config::CheckDBConfigInsertBufferSize(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckDBConfigTierPath(const std::string& value) {
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigTierColdDays(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid tier cold days: " + value +
+                          ". Possible reason: db_config.tier_cold_days is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int32_t tier_cold_days = std::stoi(value);
+        if (tier_cold_days <= 0) {
+            std::string msg = "Invalid tier cold days: " + value +
+                              ". Possible reason: db_config.tier_cold_days is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigTierLocalCapacity(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid tier local capacity: " + value +
+                          ". Possible reason: db_config.tier_local_capacity is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t tier_local_capacity = std::stol(value);
+        if (tier_local_capacity <= 0) {
+            std::string msg = "Invalid tier local capacity: " + value +
+                              ". Possible reason: db_config.tier_local_capacity is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckMetricConfigEnableMonitor(const std::string& value) {
     if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
@@ -530,34 +854,93 @@ Config::CheckMetricConfigPrometheusPort(const std::string& value) {
 }
 
 Status
-Config::CheckCacheConfigCpuCacheCapacity(const std::string& value) {
-    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
-        std::string msg = "Invalid cpu cache capacity: " + value +
-                          ". Possible reason: cache_config.cpu_cache_capacity is not a positive integer.";
+Config::CheckMetricConfigTraceSampleRate(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsFloat(value).ok()) {
+        std::string msg = "Invalid trace sample rate: " + value +
+                          ". Possible reason: metric_config.trace_sample_rate is not in range [0.0, 1.0].";
         return Status(SERVER_INVALID_ARGUMENT, msg);
     } else {
-        int64_t cpu_cache_capacity = std::stoi(value) * GB;
-        if (cpu_cache_capacity <= 0) {
-            std::string msg = "Invalid cpu cache capacity: " + value +
-                              ". Possible reason: cache_config.cpu_cache_capacity is not a positive integer.";
+        float sample_rate = std::stof(value);
+        if (sample_rate < 0.0 || sample_rate > 1.0) {
+            std::string msg = "Invalid trace sample rate: " + value +
+                              ". Possible reason: metric_config.trace_sample_rate is not in range [0.0, 1.0].";
             return Status(SERVER_INVALID_ARGUMENT, msg);
         }
+    }
+    return Status::OK();
+}
 
-        uint64_t total_mem = 0, free_mem = 0;
-        CommonUtil::GetSystemMemInfo(total_mem, free_mem);
-        if (static_cast<uint64_t>(cpu_cache_capacity) >= total_mem) {
-            std::string msg = "Invalid cpu cache capacity: " + value +
-                              ". Possible reason: cache_config.cpu_cache_capacity exceeds system memory.";
+Status
+Config::CheckMetricConfigTraceBufferSize(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid trace buffer size: " + value +
+                          ". Possible reason: metric_config.trace_buffer_size is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t buffer_size = std::stol(value);
+        if (buffer_size <= 0) {
+            std::string msg = "Invalid trace buffer size: " + value +
+                              ". Possible reason: metric_config.trace_buffer_size is not a positive integer.";
             return Status(SERVER_INVALID_ARGUMENT, msg);
-        } else if (static_cast<double>(cpu_cache_capacity) > static_cast<double>(total_mem * 0.9)) {
-            std::cerr << "WARNING: cpu cache capacity value is too big" << std::endl;
         }
+    }
+    return Status::OK();
+}
 
-        int32_t buffer_value;
-        Status s = GetDBConfigInsertBufferSize(buffer_value);
-        if (!s.ok()) {
-            return s;
-        }
+Status
+Config::CheckMetricConfigTraceExportPath(const std::string& value) {
+    if (value.empty()) {
+        return Status(SERVER_INVALID_ARGUMENT, "metric_config.trace_export_path is empty.");
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckMetricConfigTableLabelLimit(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid table label limit: " + value +
+                          ". Possible reason: metric_config.table_label_limit is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t table_label_limit = std::stol(value);
+        if (table_label_limit <= 0) {
+            std::string msg = "Invalid table label limit: " + value +
+                              ". Possible reason: metric_config.table_label_limit is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckCacheConfigCpuCacheCapacity(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid cpu cache capacity: " + value +
+                          ". Possible reason: cache_config.cpu_cache_capacity is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    } else {
+        int64_t cpu_cache_capacity = std::stoi(value) * GB;
+        if (cpu_cache_capacity <= 0) {
+            std::string msg = "Invalid cpu cache capacity: " + value +
+                              ". Possible reason: cache_config.cpu_cache_capacity is not a positive integer.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+
+        uint64_t total_mem = 0, free_mem = 0;
+        CommonUtil::GetSystemMemInfo(total_mem, free_mem);
+        if (static_cast<uint64_t>(cpu_cache_capacity) >= total_mem) {
+            std::string msg = "Invalid cpu cache capacity: " + value +
+                              ". Possible reason: cache_config.cpu_cache_capacity exceeds system memory.";
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        } else if (static_cast<double>(cpu_cache_capacity) > static_cast<double>(total_mem * 0.9)) {
+            std::cerr << "WARNING: cpu cache capacity value is too big" << std::endl;
+        }
+
+        int32_t buffer_value;
+        Status s = GetDBConfigInsertBufferSize(buffer_value);
+        if (!s.ok()) {
+            return s;
+        }
 
         int64_t insert_buffer_size = buffer_value * GB;
         if (insert_buffer_size + cpu_cache_capacity >= total_mem) {
@@ -646,6 +1029,26 @@ Config::CheckCacheConfigCacheInsertData(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckCacheConfigWarmRestart(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid warm restart config: " + value +
+                          ". Possible reason: cache_config.warm_restart is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckCacheConfigWarmUpIoRate(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid warm up io rate: " + value +
+                          ". Possible reason: cache_config.warm_up_io_rate is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckEngineConfigUseBlasThreshold(const std::string& value) {
     if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
@@ -685,6 +1088,96 @@ Config::CheckEngineConfigGpuSearchThreshold(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckEngineConfigLoadThreadNum(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoi(value) <= 0) {
+        std::string msg = "Invalid load thread num: " + value +
+                          ". Possible reason: engine_config.load_thread_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigIoThreadNum(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoi(value) <= 0) {
+        std::string msg = "Invalid io thread num: " + value +
+                          ". Possible reason: engine_config.io_thread_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigIoChunkSize(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid io chunk size: " + value +
+                          ". Possible reason: engine_config.io_chunk_size is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigUseDirectIo(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid direct io config: " + value +
+                          ". Possible reason: engine_config.use_direct_io is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigHugePage(const std::string& value) {
+    if (value != "off" && value != "madvise" && value != "hugetlb") {
+        std::string msg = "Invalid huge page config: " + value +
+                          ". Possible reason: engine_config.huge_page is not one of off, madvise and hugetlb.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigUseMmap(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid mmap config: " + value +
+                          ". Possible reason: engine_config.use_mmap is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigBuildCpuShare(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoi(value) <= 0 || std::stoi(value) > 100) {
+        std::string msg = "Invalid build cpu share: " + value +
+                          ". Possible reason: engine_config.build_cpu_share is not in range (0, 100].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigSearchCapacity(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid search capacity: " + value +
+                          ". Possible reason: engine_config.search_capacity is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigNsgBuildMemoryCap(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid nsg build memory cap: " + value +
+                          ". Possible reason: engine_config.nsg_build_memory_cap is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckResourceConfigMode(const std::string& value) {
     if (value != "simple") {
@@ -747,9 +1240,9 @@ Config::CheckResourceConfigSearchResources(const std::vector<std::string>& value
 
 Status
 Config::CheckResourceConfigIndexBuildDevice(const std::string& value) {
-    // if (value == "cpu") {
-    //     return Status::OK();
-    // }
+    if (value == "cpu") {
+        return Status::OK();
+    }
     if (!CheckGpuDevice(value).ok()) {
         std::string msg = "Invalid index build device: " + value +
                           ". Possible reason: resource_config.index_build_device does not match your hardware.";
@@ -758,6 +1251,16 @@ Config::CheckResourceConfigIndexBuildDevice(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckResourceConfigNumaAware(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid numa aware config: " + value +
+                          ". Possible reason: resource_config.numa_aware is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ConfigNode&
 Config::GetConfigNode(const std::string& name) {
@@ -834,6 +1337,53 @@ Config::GetServerConfigTimeZone(std::string& value) {
     return CheckServerConfigTimeZone(value);
 }
 
+Status
+Config::GetServerConfigShards(std::vector<std::vector<std::string>>& value) {
+    std::string str = GetConfigStr(CONFIG_SERVER, CONFIG_SERVER_SHARDS, CONFIG_SERVER_SHARDS_DEFAULT);
+    Status s = CheckServerConfigShards(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value.clear();
+    if (str.empty()) {
+        return Status::OK();
+    }
+
+    std::vector<std::string> shards;
+    server::StringHelpFunctions::SplitStringByDelimeter(str, CONFIG_SERVER_SHARDS_DELIMITER, shards);
+    for (auto& shard : shards) {
+        std::vector<std::string> replicas;
+        server::StringHelpFunctions::SplitStringByDelimeter(shard, CONFIG_SERVER_SHARD_REPLICA_DELIMITER, replicas);
+        value.emplace_back(std::move(replicas));
+    }
+    return Status::OK();
+}
+
+Status
+Config::GetServerConfigShardTimeout(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_SERVER, CONFIG_SERVER_SHARD_TIMEOUT, CONFIG_SERVER_SHARD_TIMEOUT_DEFAULT);
+    Status s = CheckServerConfigShardTimeout(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stol(str);
+    return Status::OK();
+}
+
+Status
+Config::GetServerConfigHedgeDelay(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_SERVER, CONFIG_SERVER_HEDGE_DELAY, CONFIG_SERVER_HEDGE_DELAY_DEFAULT);
+    Status s = CheckServerConfigHedgeDelay(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stol(str);
+    return Status::OK();
+}
+
 Status
 Config::GetDBConfigPrimaryPath(std::string& value) {
     value = GetConfigStr(CONFIG_DB, CONFIG_DB_PRIMARY_PATH, CONFIG_DB_PRIMARY_PATH_DEFAULT);
@@ -896,6 +1446,36 @@ Config::GetDBConfigPreloadTable(std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::GetDBConfigTierPath(std::string& value) {
+    value = GetConfigStr(CONFIG_DB, CONFIG_DB_TIER_PATH, CONFIG_DB_TIER_PATH_DEFAULT);
+    return CheckDBConfigTierPath(value);
+}
+
+Status
+Config::GetDBConfigTierColdDays(int32_t& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_TIER_COLD_DAYS, CONFIG_DB_TIER_COLD_DAYS_DEFAULT);
+    Status s = CheckDBConfigTierColdDays(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stoi(str);
+    return Status::OK();
+}
+
+Status
+Config::GetDBConfigTierLocalCapacity(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_TIER_LOCAL_CAPACITY, CONFIG_DB_TIER_LOCAL_CAPACITY_DEFAULT);
+    Status s = CheckDBConfigTierLocalCapacity(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stol(str);
+    return Status::OK();
+}
+
 Status
 Config::GetMetricConfigEnableMonitor(bool& value) {
     std::string str = GetConfigStr(CONFIG_METRIC, CONFIG_METRIC_ENABLE_MONITOR, CONFIG_METRIC_ENABLE_MONITOR_DEFAULT);
@@ -921,6 +1501,51 @@ Config::GetMetricConfigPrometheusPort(std::string& value) {
     return CheckMetricConfigPrometheusPort(value);
 }
 
+Status
+Config::GetMetricConfigTraceSampleRate(float& value) {
+    std::string str =
+        GetConfigStr(CONFIG_METRIC, CONFIG_METRIC_TRACE_SAMPLE_RATE, CONFIG_METRIC_TRACE_SAMPLE_RATE_DEFAULT);
+    Status s = CheckMetricConfigTraceSampleRate(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stof(str);
+    return Status::OK();
+}
+
+Status
+Config::GetMetricConfigTraceBufferSize(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_METRIC, CONFIG_METRIC_TRACE_BUFFER_SIZE, CONFIG_METRIC_TRACE_BUFFER_SIZE_DEFAULT);
+    Status s = CheckMetricConfigTraceBufferSize(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stol(str);
+    return Status::OK();
+}
+
+Status
+Config::GetMetricConfigTraceExportPath(std::string& value) {
+    value = GetConfigStr(CONFIG_METRIC, CONFIG_METRIC_TRACE_EXPORT_PATH, CONFIG_METRIC_TRACE_EXPORT_PATH_DEFAULT);
+    return CheckMetricConfigTraceExportPath(value);
+}
+
+Status
+Config::GetMetricConfigTableLabelLimit(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_METRIC, CONFIG_METRIC_TABLE_LABEL_LIMIT, CONFIG_METRIC_TABLE_LABEL_LIMIT_DEFAULT);
+    Status s = CheckMetricConfigTableLabelLimit(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stol(str);
+    return Status::OK();
+}
+
 Status
 Config::GetCacheConfigCpuCacheCapacity(int64_t& value) {
     std::string str =
@@ -987,6 +1612,31 @@ Config::GetCacheConfigCacheInsertData(bool& value) {
     return Status::OK();
 }
 
+Status
+Config::GetCacheConfigWarmRestart(bool& value) {
+    std::string str = GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_WARM_RESTART, CONFIG_CACHE_WARM_RESTART_DEFAULT);
+    Status s = CheckCacheConfigWarmRestart(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
+Status
+Config::GetCacheConfigWarmUpIoRate(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_WARM_UP_IO_RATE, CONFIG_CACHE_WARM_UP_IO_RATE_DEFAULT);
+    Status s = CheckCacheConfigWarmUpIoRate(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stol(str);
+    return Status::OK();
+}
+
 Status
 Config::GetEngineConfigUseBlasThreshold(int32_t& value) {
     std::string str =
@@ -1025,6 +1675,111 @@ Config::GetEngineConfigGpuSearchThreshold(int32_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetEngineConfigLoadThreadNum(int32_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_LOAD_THREAD_NUM, CONFIG_ENGINE_LOAD_THREAD_NUM_DEFAULT);
+    Status s = CheckEngineConfigLoadThreadNum(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stoi(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigIoThreadNum(int32_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_IO_THREAD_NUM, CONFIG_ENGINE_IO_THREAD_NUM_DEFAULT);
+    Status s = CheckEngineConfigIoThreadNum(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stoi(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigIoChunkSize(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_IO_CHUNK_SIZE, CONFIG_ENGINE_IO_CHUNK_SIZE_DEFAULT);
+    Status s = CheckEngineConfigIoChunkSize(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stol(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigUseDirectIo(bool& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_USE_DIRECT_IO, CONFIG_ENGINE_USE_DIRECT_IO_DEFAULT);
+    Status s = CheckEngineConfigUseDirectIo(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigHugePage(std::string& value) {
+    value = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_HUGE_PAGE, CONFIG_ENGINE_HUGE_PAGE_DEFAULT);
+    return CheckEngineConfigHugePage(value);
+}
+
+Status
+Config::GetEngineConfigUseMmap(bool& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_USE_MMAP, CONFIG_ENGINE_USE_MMAP_DEFAULT);
+    Status s = CheckEngineConfigUseMmap(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigBuildCpuShare(int32_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_BUILD_CPU_SHARE, CONFIG_ENGINE_BUILD_CPU_SHARE_DEFAULT);
+    Status s = CheckEngineConfigBuildCpuShare(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stoi(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSearchCapacity(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_CAPACITY, CONFIG_ENGINE_SEARCH_CAPACITY_DEFAULT);
+    Status s = CheckEngineConfigSearchCapacity(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigNsgBuildMemoryCap(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_NSG_BUILD_MEMORY_CAP, CONFIG_ENGINE_NSG_BUILD_MEMORY_CAP_DEFAULT);
+    Status s = CheckEngineConfigNsgBuildMemoryCap(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 Status
 Config::GetResourceConfigMode(std::string& value) {
     value = GetConfigStr(CONFIG_RESOURCE, CONFIG_RESOURCE_MODE, CONFIG_RESOURCE_MODE_DEFAULT);
@@ -1058,6 +1813,19 @@ Config::GetResourceConfigIndexBuildDevice(int32_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetResourceConfigNumaAware(bool& value) {
+    std::string str = GetConfigStr(CONFIG_RESOURCE, CONFIG_RESOURCE_NUMA_AWARE, CONFIG_RESOURCE_NUMA_AWARE_DEFAULT);
+    Status s = CheckResourceConfigNumaAware(str);
+    if (!s.ok()) {
+        return s;
+    }
+
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /* server config */
 Status
@@ -1104,6 +1872,39 @@ Config::SetServerConfigTimeZone(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::SetServerConfigShards(const std::string& value) {
+    Status s = CheckServerConfigShards(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_SERVER, CONFIG_SERVER_SHARDS, value);
+    return Status::OK();
+}
+
+Status
+Config::SetServerConfigShardTimeout(const std::string& value) {
+    Status s = CheckServerConfigShardTimeout(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_SERVER, CONFIG_SERVER_SHARD_TIMEOUT, value);
+    return Status::OK();
+}
+
+Status
+Config::SetServerConfigHedgeDelay(const std::string& value) {
+    Status s = CheckServerConfigHedgeDelay(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_SERVER, CONFIG_SERVER_HEDGE_DELAY, value);
+    return Status::OK();
+}
+
 /* db config */
 Status
 Config::SetDBConfigPrimaryPath(const std::string& value) {
@@ -1171,6 +1972,39 @@ Config::SetDBConfigInsertBufferSize(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::SetDBConfigTierPath(const std::string& value) {
+    Status s = CheckDBConfigTierPath(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_DB, CONFIG_DB_TIER_PATH, value);
+    return Status::OK();
+}
+
+Status
+Config::SetDBConfigTierColdDays(const std::string& value) {
+    Status s = CheckDBConfigTierColdDays(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_DB, CONFIG_DB_TIER_COLD_DAYS, value);
+    return Status::OK();
+}
+
+Status
+Config::SetDBConfigTierLocalCapacity(const std::string& value) {
+    Status s = CheckDBConfigTierLocalCapacity(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_DB, CONFIG_DB_TIER_LOCAL_CAPACITY, value);
+    return Status::OK();
+}
+
 /* metric config */
 Status
 Config::SetMetricConfigEnableMonitor(const std::string& value) {
@@ -1205,6 +2039,50 @@ Config::SetMetricConfigPrometheusPort(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::SetMetricConfigTraceSampleRate(const std::string& value) {
+    Status s = CheckMetricConfigTraceSampleRate(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_METRIC, CONFIG_METRIC_TRACE_SAMPLE_RATE, value);
+    return Status::OK();
+}
+
+Status
+Config::SetMetricConfigTraceBufferSize(const std::string& value) {
+    Status s = CheckMetricConfigTraceBufferSize(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_METRIC, CONFIG_METRIC_TRACE_BUFFER_SIZE, value);
+    return Status::OK();
+}
+
+Status
+Config::SetMetricConfigTraceExportPath(const std::string& value) {
+    Status s = CheckMetricConfigTraceExportPath(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_METRIC, CONFIG_METRIC_TRACE_EXPORT_PATH, value);
+    return Status::OK();
+}
+
+Status
+Config::SetMetricConfigTableLabelLimit(const std::string& value) {
+    Status s = CheckMetricConfigTableLabelLimit(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_METRIC, CONFIG_METRIC_TABLE_LABEL_LIMIT, value);
+    return Status::OK();
+}
+
 /* cache config */
 Status
 Config::SetCacheConfigCpuCacheCapacity(const std::string& value) {
@@ -1261,6 +2139,28 @@ Config::SetCacheConfigCacheInsertData(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::SetCacheConfigWarmRestart(const std::string& value) {
+    Status s = CheckCacheConfigWarmRestart(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_WARM_RESTART, value);
+    return Status::OK();
+}
+
+Status
+Config::SetCacheConfigWarmUpIoRate(const std::string& value) {
+    Status s = CheckCacheConfigWarmUpIoRate(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_WARM_UP_IO_RATE, value);
+    return Status::OK();
+}
+
 /* engine config */
 Status
 Config::SetEngineConfigUseBlasThreshold(const std::string& value) {
@@ -1295,6 +2195,105 @@ Config::SetEngineConfigGpuSearchThreshold(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::SetEngineConfigLoadThreadNum(const std::string& value) {
+    Status s = CheckEngineConfigLoadThreadNum(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_LOAD_THREAD_NUM, value);
+    return Status::OK();
+}
+
+Status
+Config::SetEngineConfigIoThreadNum(const std::string& value) {
+    Status s = CheckEngineConfigIoThreadNum(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_IO_THREAD_NUM, value);
+    return Status::OK();
+}
+
+Status
+Config::SetEngineConfigIoChunkSize(const std::string& value) {
+    Status s = CheckEngineConfigIoChunkSize(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_IO_CHUNK_SIZE, value);
+    return Status::OK();
+}
+
+Status
+Config::SetEngineConfigUseDirectIo(const std::string& value) {
+    Status s = CheckEngineConfigUseDirectIo(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_USE_DIRECT_IO, value);
+    return Status::OK();
+}
+
+Status
+Config::SetEngineConfigHugePage(const std::string& value) {
+    Status s = CheckEngineConfigHugePage(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_HUGE_PAGE, value);
+    return Status::OK();
+}
+
+Status
+Config::SetEngineConfigUseMmap(const std::string& value) {
+    Status s = CheckEngineConfigUseMmap(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_USE_MMAP, value);
+    return Status::OK();
+}
+
+Status
+Config::SetEngineConfigBuildCpuShare(const std::string& value) {
+    Status s = CheckEngineConfigBuildCpuShare(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_BUILD_CPU_SHARE, value);
+    return Status::OK();
+}
+
+Status
+Config::SetEngineConfigSearchCapacity(const std::string& value) {
+    Status s = CheckEngineConfigSearchCapacity(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_CAPACITY, value);
+    return Status::OK();
+}
+
+Status
+Config::SetEngineConfigNsgBuildMemoryCap(const std::string& value) {
+    Status s = CheckEngineConfigNsgBuildMemoryCap(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_NSG_BUILD_MEMORY_CAP, value);
+    return Status::OK();
+}
+
 /* resource config */
 Status
 Config::SetResourceConfigMode(const std::string& value) {
@@ -1332,5 +2331,16 @@ Config::SetResourceConfigIndexBuildDevice(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::SetResourceConfigNumaAware(const std::string& value) {
+    Status s = CheckResourceConfigNumaAware(value);
+    if (!s.ok()) {
+        return s;
+    }
+
+    SetConfigValueInMem(CONFIG_RESOURCE, CONFIG_RESOURCE_NUMA_AWARE, value);
+    return Status::OK();
+}
+
 }  // namespace server
 }  // namespace milvus
@@ -38,6 +38,14 @@ static const char* CONFIG_SERVER_DEPLOY_MODE = "deploy_mode";
 static const char* CONFIG_SERVER_DEPLOY_MODE_DEFAULT = "single";
 static const char* CONFIG_SERVER_TIME_ZONE = "time_zone";
 static const char* CONFIG_SERVER_TIME_ZONE_DEFAULT = "UTC+8";
+static const char* CONFIG_SERVER_SHARDS = "shards";
+static const char* CONFIG_SERVER_SHARDS_DEFAULT = "";
+static const char* CONFIG_SERVER_SHARDS_DELIMITER = ",";
+static const char* CONFIG_SERVER_SHARD_REPLICA_DELIMITER = "|";
+static const char* CONFIG_SERVER_SHARD_TIMEOUT = "shard_timeout";
+static const char* CONFIG_SERVER_SHARD_TIMEOUT_DEFAULT = "3000";
+static const char* CONFIG_SERVER_HEDGE_DELAY = "hedge_delay";
+static const char* CONFIG_SERVER_HEDGE_DELAY_DEFAULT = "50";
 
 /* db config */
 static const char* CONFIG_DB = "db_config";
@@ -54,6 +62,12 @@ static const char* CONFIG_DB_ARCHIVE_DAYS_THRESHOLD_DEFAULT = "0";
 static const char* CONFIG_DB_INSERT_BUFFER_SIZE = "insert_buffer_size";
 static const char* CONFIG_DB_INSERT_BUFFER_SIZE_DEFAULT = "4";
 static const char* CONFIG_DB_PRELOAD_TABLE = "preload_table";
+static const char* CONFIG_DB_TIER_PATH = "tier_path";
+static const char* CONFIG_DB_TIER_PATH_DEFAULT = "";
+static const char* CONFIG_DB_TIER_COLD_DAYS = "tier_cold_days";
+static const char* CONFIG_DB_TIER_COLD_DAYS_DEFAULT = "30";
+static const char* CONFIG_DB_TIER_LOCAL_CAPACITY = "tier_local_capacity";
+static const char* CONFIG_DB_TIER_LOCAL_CAPACITY_DEFAULT = "16";
 
 /* cache config */
 static const char* CONFIG_CACHE = "cache_config";
@@ -67,6 +81,10 @@ static const char* CONFIG_CACHE_GPU_CACHE_THRESHOLD = "gpu_mem_threshold";
 static const char* CONFIG_CACHE_GPU_CACHE_THRESHOLD_DEFAULT = "0.85";
 static const char* CONFIG_CACHE_CACHE_INSERT_DATA = "cache_insert_data";
 static const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT = "false";
+static const char* CONFIG_CACHE_WARM_RESTART = "warm_restart";
+static const char* CONFIG_CACHE_WARM_RESTART_DEFAULT = "false";
+static const char* CONFIG_CACHE_WARM_UP_IO_RATE = "warm_up_io_rate";
+static const char* CONFIG_CACHE_WARM_UP_IO_RATE_DEFAULT = "200";
 
 /* metric config */
 static const char* CONFIG_METRIC = "metric_config";
@@ -77,6 +95,14 @@ static const char* CONFIG_METRIC_COLLECTOR_DEFAULT = "prometheus";
 static const char* CONFIG_METRIC_PROMETHEUS = "prometheus_config";
 static const char* CONFIG_METRIC_PROMETHEUS_PORT = "port";
 static const char* CONFIG_METRIC_PROMETHEUS_PORT_DEFAULT = "8080";
+static const char* CONFIG_METRIC_TRACE_SAMPLE_RATE = "trace_sample_rate";
+static const char* CONFIG_METRIC_TRACE_SAMPLE_RATE_DEFAULT = "0.01";
+static const char* CONFIG_METRIC_TRACE_BUFFER_SIZE = "trace_buffer_size";
+static const char* CONFIG_METRIC_TRACE_BUFFER_SIZE_DEFAULT = "1000";
+static const char* CONFIG_METRIC_TRACE_EXPORT_PATH = "trace_export_path";
+static const char* CONFIG_METRIC_TRACE_EXPORT_PATH_DEFAULT = "/tmp/milvus/trace.json";
+static const char* CONFIG_METRIC_TABLE_LABEL_LIMIT = "table_label_limit";
+static const char* CONFIG_METRIC_TABLE_LABEL_LIMIT_DEFAULT = "256";
 
 /* engine config */
 static const char* CONFIG_ENGINE = "engine_config";
@@ -86,6 +112,24 @@ static const char* CONFIG_ENGINE_OMP_THREAD_NUM = "omp_thread_num";
 static const char* CONFIG_ENGINE_OMP_THREAD_NUM_DEFAULT = "0";
 static const char* CONFIG_ENGINE_GPU_SEARCH_THRESHOLD = "gpu_search_threshold";
 static const char* CONFIG_ENGINE_GPU_SEARCH_THRESHOLD_DEFAULT = "1000";
+static const char* CONFIG_ENGINE_LOAD_THREAD_NUM = "load_thread_num";
+static const char* CONFIG_ENGINE_LOAD_THREAD_NUM_DEFAULT = "2";
+static const char* CONFIG_ENGINE_IO_THREAD_NUM = "io_thread_num";
+static const char* CONFIG_ENGINE_IO_THREAD_NUM_DEFAULT = "4";
+static const char* CONFIG_ENGINE_IO_CHUNK_SIZE = "io_chunk_size";
+static const char* CONFIG_ENGINE_IO_CHUNK_SIZE_DEFAULT = "16";
+static const char* CONFIG_ENGINE_USE_DIRECT_IO = "use_direct_io";
+static const char* CONFIG_ENGINE_USE_DIRECT_IO_DEFAULT = "false";
+static const char* CONFIG_ENGINE_HUGE_PAGE = "huge_page";
+static const char* CONFIG_ENGINE_HUGE_PAGE_DEFAULT = "off";
+static const char* CONFIG_ENGINE_USE_MMAP = "use_mmap";
+static const char* CONFIG_ENGINE_USE_MMAP_DEFAULT = "false";
+static const char* CONFIG_ENGINE_BUILD_CPU_SHARE = "build_cpu_share";
+static const char* CONFIG_ENGINE_BUILD_CPU_SHARE_DEFAULT = "50";
+static const char* CONFIG_ENGINE_SEARCH_CAPACITY = "search_capacity";
+static const char* CONFIG_ENGINE_SEARCH_CAPACITY_DEFAULT = "0";
+static const char* CONFIG_ENGINE_NSG_BUILD_MEMORY_CAP = "nsg_build_memory_cap";
+static const char* CONFIG_ENGINE_NSG_BUILD_MEMORY_CAP_DEFAULT = "0";
 
 /* resource config */
 static const char* CONFIG_RESOURCE = "resource_config";
@@ -96,6 +140,8 @@ static const char* CONFIG_RESOURCE_SEARCH_RESOURCES_DELIMITER = ",";
 static const char* CONFIG_RESOURCE_SEARCH_RESOURCES_DEFAULT = "cpu,gpu0";
 static const char* CONFIG_RESOURCE_INDEX_BUILD_DEVICE = "index_build_device";
 static const char* CONFIG_RESOURCE_INDEX_BUILD_DEVICE_DEFAULT = "gpu0";
+static const char* CONFIG_RESOURCE_NUMA_AWARE = "numa_aware";
+static const char* CONFIG_RESOURCE_NUMA_AWARE_DEFAULT = "false";
 
 const int32_t CPU_DEVICE_ID = -1;
 
@@ -132,6 +178,12 @@ class Config {
     CheckServerConfigDeployMode(const std::string& value);
     Status
     CheckServerConfigTimeZone(const std::string& value);
+    Status
+    CheckServerConfigShards(const std::string& value);
+    Status
+    CheckServerConfigShardTimeout(const std::string& value);
+    Status
+    CheckServerConfigHedgeDelay(const std::string& value);
 
     /* db config */
     Status
@@ -146,6 +198,12 @@ class Config {
     CheckDBConfigArchiveDaysThreshold(const std::string& value);
     Status
     CheckDBConfigInsertBufferSize(const std::string& value);
+    Status
+    CheckDBConfigTierPath(const std::string& value);
+    Status
+    CheckDBConfigTierColdDays(const std::string& value);
+    Status
+    CheckDBConfigTierLocalCapacity(const std::string& value);
 
     /* metric config */
     Status
@@ -154,6 +212,14 @@ class Config {
     CheckMetricConfigCollector(const std::string& value);
     Status
     CheckMetricConfigPrometheusPort(const std::string& value);
+    Status
+    CheckMetricConfigTraceSampleRate(const std::string& value);
+    Status
+    CheckMetricConfigTraceBufferSize(const std::string& value);
+    Status
+    CheckMetricConfigTraceExportPath(const std::string& value);
+    Status
+    CheckMetricConfigTableLabelLimit(const std::string& value);
 
     /* cache config */
     Status
@@ -166,6 +232,10 @@ class Config {
     CheckCacheConfigGpuCacheThreshold(const std::string& value);
     Status
     CheckCacheConfigCacheInsertData(const std::string& value);
+    Status
+    CheckCacheConfigWarmRestart(const std::string& value);
+    Status
+    CheckCacheConfigWarmUpIoRate(const std::string& value);
 
     /* engine config */
     Status
@@ -174,6 +244,24 @@ class Config {
     CheckEngineConfigOmpThreadNum(const std::string& value);
     Status
     CheckEngineConfigGpuSearchThreshold(const std::string& value);
+    Status
+    CheckEngineConfigLoadThreadNum(const std::string& value);
+    Status
+    CheckEngineConfigIoThreadNum(const std::string& value);
+    Status
+    CheckEngineConfigIoChunkSize(const std::string& value);
+    Status
+    CheckEngineConfigUseDirectIo(const std::string& value);
+    Status
+    CheckEngineConfigHugePage(const std::string& value);
+    Status
+    CheckEngineConfigUseMmap(const std::string& value);
+    Status
+    CheckEngineConfigBuildCpuShare(const std::string& value);
+    Status
+    CheckEngineConfigSearchCapacity(const std::string& value);
+    Status
+    CheckEngineConfigNsgBuildMemoryCap(const std::string& value);
 
     /* resource config */
     Status
@@ -182,6 +270,8 @@ class Config {
     CheckResourceConfigSearchResources(const std::vector<std::string>& value);
     Status
     CheckResourceConfigIndexBuildDevice(const std::string& value);
+    Status
+    CheckResourceConfigNumaAware(const std::string& value);
 
     std::string
     GetConfigStr(const std::string& parent_key, const std::string& child_key, const std::string& default_value = "");
@@ -199,6 +289,12 @@ class Config {
     GetServerConfigDeployMode(std::string& value);
     Status
     GetServerConfigTimeZone(std::string& value);
+    Status
+    GetServerConfigShards(std::vector<std::vector<std::string>>& value);
+    Status
+    GetServerConfigShardTimeout(int64_t& value);
+    Status
+    GetServerConfigHedgeDelay(int64_t& value);
 
     /* db config */
     Status
@@ -215,6 +311,12 @@ class Config {
     GetDBConfigInsertBufferSize(int32_t& value);
     Status
     GetDBConfigPreloadTable(std::string& value);
+    Status
+    GetDBConfigTierPath(std::string& value);
+    Status
+    GetDBConfigTierColdDays(int32_t& value);
+    Status
+    GetDBConfigTierLocalCapacity(int64_t& value);
 
     /* metric config */
     Status
@@ -223,6 +325,14 @@ class Config {
     GetMetricConfigCollector(std::string& value);
     Status
     GetMetricConfigPrometheusPort(std::string& value);
+    Status
+    GetMetricConfigTraceSampleRate(float& value);
+    Status
+    GetMetricConfigTraceBufferSize(int64_t& value);
+    Status
+    GetMetricConfigTraceExportPath(std::string& value);
+    Status
+    GetMetricConfigTableLabelLimit(int64_t& value);
 
     /* cache config */
     Status
@@ -235,6 +345,10 @@ class Config {
     GetCacheConfigGpuCacheThreshold(float& value);
     Status
     GetCacheConfigCacheInsertData(bool& value);
+    Status
+    GetCacheConfigWarmRestart(bool& value);
+    Status
+    GetCacheConfigWarmUpIoRate(int64_t& value);
 
     /* engine config */
     Status
@@ -243,6 +357,24 @@ class Config {
     GetEngineConfigOmpThreadNum(int32_t& value);
     Status
     GetEngineConfigGpuSearchThreshold(int32_t& value);
+    Status
+    GetEngineConfigLoadThreadNum(int32_t& value);
+    Status
+    GetEngineConfigIoThreadNum(int32_t& value);
+    Status
+    GetEngineConfigIoChunkSize(int64_t& value);
+    Status
+    GetEngineConfigUseDirectIo(bool& value);
+    Status
+    GetEngineConfigHugePage(std::string& value);
+    Status
+    GetEngineConfigUseMmap(bool& value);
+    Status
+    GetEngineConfigBuildCpuShare(int32_t& value);
+    Status
+    GetEngineConfigSearchCapacity(int64_t& value);
+    Status
+    GetEngineConfigNsgBuildMemoryCap(int64_t& value);
 
     /* resource config */
     Status
@@ -251,6 +383,8 @@ class Config {
     GetResourceConfigSearchResources(std::vector<std::string>& value);
     Status
     GetResourceConfigIndexBuildDevice(int32_t& value);
+    Status
+    GetResourceConfigNumaAware(bool& value);
 
  public:
     /* server config */
@@ -262,6 +396,12 @@ class Config {
     SetServerConfigDeployMode(const std::string& value);
     Status
     SetServerConfigTimeZone(const std::string& value);
+    Status
+    SetServerConfigShards(const std::string& value);
+    Status
+    SetServerConfigShardTimeout(const std::string& value);
+    Status
+    SetServerConfigHedgeDelay(const std::string& value);
 
     /* db config */
     Status
@@ -276,6 +416,12 @@ class Config {
     SetDBConfigArchiveDaysThreshold(const std::string& value);
     Status
     SetDBConfigInsertBufferSize(const std::string& value);
+    Status
+    SetDBConfigTierPath(const std::string& value);
+    Status
+    SetDBConfigTierColdDays(const std::string& value);
+    Status
+    SetDBConfigTierLocalCapacity(const std::string& value);
 
     /* metric config */
     Status
@@ -284,6 +430,14 @@ class Config {
     SetMetricConfigCollector(const std::string& value);
     Status
     SetMetricConfigPrometheusPort(const std::string& value);
+    Status
+    SetMetricConfigTraceSampleRate(const std::string& value);
+    Status
+    SetMetricConfigTraceBufferSize(const std::string& value);
+    Status
+    SetMetricConfigTraceExportPath(const std::string& value);
+    Status
+    SetMetricConfigTableLabelLimit(const std::string& value);
 
     /* cache config */
     Status
@@ -296,6 +450,10 @@ class Config {
     SetCacheConfigGpuCacheThreshold(const std::string& value);
     Status
     SetCacheConfigCacheInsertData(const std::string& value);
+    Status
+    SetCacheConfigWarmRestart(const std::string& value);
+    Status
+    SetCacheConfigWarmUpIoRate(const std::string& value);
 
     /* engine config */
     Status
@@ -304,6 +462,24 @@ class Config {
     SetEngineConfigOmpThreadNum(const std::string& value);
     Status
     SetEngineConfigGpuSearchThreshold(const std::string& value);
+    Status
+    SetEngineConfigLoadThreadNum(const std::string& value);
+    Status
+    SetEngineConfigIoThreadNum(const std::string& value);
+    Status
+    SetEngineConfigIoChunkSize(const std::string& value);
+    Status
+    SetEngineConfigUseDirectIo(const std::string& value);
+    Status
+    SetEngineConfigHugePage(const std::string& value);
+    Status
+    SetEngineConfigUseMmap(const std::string& value);
+    Status
+    SetEngineConfigBuildCpuShare(const std::string& value);
+    Status
+    SetEngineConfigSearchCapacity(const std::string& value);
+    Status
+    SetEngineConfigNsgBuildMemoryCap(const std::string& value);
 
     /* resource config */
     Status
@@ -312,6 +488,8 @@ class Config {
     SetResourceConfigSearchResources(const std::string& value);
     Status
     SetResourceConfigIndexBuildDevice(const std::string& value);
+    Status
+    SetResourceConfigNumaAware(const std::string& value);
 
  private:
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> config_map_;
@@ -17,14 +17,18 @@
 
 #include <faiss/utils/distances.h>
 #include <omp.h>
+#include <algorithm>
 #include <cmath>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "db/DBFactory.h"
+#include "metrics/Metrics.h"
 #include "server/Config.h"
 #include "server/DBWrapper.h"
 #include "utils/CommonUtil.h"
+#include "utils/Json.h"
 #include "utils/Log.h"
 #include "utils/StringHelpFunctions.h"
 
@@ -69,6 +73,26 @@ DBWrapper::StartService() {
         return s;
     }
 
+    s = config.GetEngineConfigLoadThreadNum(opt.preload_thread_num_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetCacheConfigWarmRestart(opt.warm_restart_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    int64_t warm_up_io_rate;
+    s = config.GetCacheConfigWarmUpIoRate(warm_up_io_rate);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+    opt.warm_up_io_rate_ = warm_up_io_rate * engine::ONE_MB;
+
     std::string mode;
     s = config.GetServerConfigDeployMode(mode);
     if (!s.ok()) {
@@ -141,6 +165,27 @@ DBWrapper::StartService() {
     }
     opt.meta_.archive_conf_.SetCriterias(criterial);
 
+    // set tier config
+    s = config.GetDBConfigTierPath(opt.tier_conf_.path_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetDBConfigTierColdDays(opt.tier_conf_.cold_days_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    int64_t tier_local_capacity;
+    s = config.GetDBConfigTierLocalCapacity(tier_local_capacity);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+    opt.tier_conf_.local_capacity_ = tier_local_capacity * engine::ONE_GB;
+
     // create db root folder
     s = CommonUtil::CreateDirectory(opt.meta_.path_);
     if (!s.ok()) {
@@ -179,12 +224,22 @@ DBWrapper::StartService() {
         return s;
     }
 
-    s = PreloadTables(preload_tables);
-    if (!s.ok()) {
-        std::cerr << "ERROR! Failed to preload tables: " << preload_tables << std::endl;
-        std::cerr << s.ToString() << std::endl;
-        kill(0, SIGUSR1);
-    }
+    // the port opens while tables are loading, readiness is reported by cmd "ready" and the preload metrics
+    preload_thread_ = std::thread([this, preload_tables]() {
+        auto status = PreloadTables(preload_tables);
+        if (!status.ok()) {
+            SERVER_LOG_ERROR << "Failed to preload tables: " << preload_tables << ", " << status.message();
+        }
+        preload_ready_ = true;
+        ReportPreloadProgress();
+        SERVER_LOG_INFO << "Preload finished: " << DumpPreloadProgress();
+
+        // whatever was cached before the restart and is still missing fills the rest of the cache
+        status = db_->WarmUpCache(&warm_up_progress_);
+        if (!status.ok()) {
+            SERVER_LOG_ERROR << "Failed to warm up cache: " << status.message();
+        }
+    });
 
     return Status::OK();
 }
@@ -194,34 +249,95 @@ DBWrapper::StopService() {
     if (db_) {
         db_->Stop();
     }
+    if (preload_thread_.joinable()) {
+        preload_thread_.join();
+    }
 
     return Status::OK();
 }
 
+std::string
+DBWrapper::DumpPreloadProgress() {
+    json ret{
+        {"ready", preload_ready_.load()},
+        {"tables_total", preload_tables_total_.load()},
+        {"tables_loaded", preload_tables_loaded_.load()},
+        {"files_total", preload_progress_.files_total.load()},
+        {"files_loaded", preload_progress_.files_loaded.load()},
+        {"files_failed", preload_progress_.files_failed.load()},
+        {"bytes_loaded", preload_progress_.bytes_loaded.load()},
+        {"warm_up",
+         {
+             {"files_total", warm_up_progress_.files_total.load()},
+             {"files_loaded", warm_up_progress_.files_loaded.load()},
+             {"files_failed", warm_up_progress_.files_failed.load()},
+             {"bytes_loaded", warm_up_progress_.bytes_loaded.load()},
+         }},
+    };
+    std::lock_guard<std::mutex> lock(preload_mutex_);
+    ret["errors"] = preload_errors_;
+    return ret.dump();
+}
+
+void
+DBWrapper::ReportPreloadProgress() {
+    auto& metrics = Metrics::GetInstance();
+    metrics.PreloadFilesGaugeSet("total", preload_progress_.files_total);
+    metrics.PreloadFilesGaugeSet("loaded", preload_progress_.files_loaded);
+    metrics.PreloadFilesGaugeSet("failed", preload_progress_.files_failed);
+    metrics.PreloadFilesGaugeSet("ready", preload_ready_ ? 1 : 0);
+}
+
 Status
 DBWrapper::PreloadTables(const std::string& preload_tables) {
+    std::vector<std::string> table_names;
     if (preload_tables.empty()) {
         // do nothing
     } else if (preload_tables == "*") {
         // load all tables
         std::vector<engine::meta::TableSchema> table_schema_array;
-        db_->AllTables(table_schema_array);
-
+        auto status = db_->AllTables(table_schema_array);
+        if (!status.ok()) {
+            return status;
+        }
         for (auto& schema : table_schema_array) {
-            auto status = db_->PreloadTable(schema.table_id_);
-            if (!status.ok()) {
-                return status;
-            }
+            table_names.push_back(schema.table_id_);
         }
     } else {
-        std::vector<std::string> table_names;
         StringHelpFunctions::SplitStringByDelimeter(preload_tables, ",", table_names);
-        for (auto& name : table_names) {
-            auto status = db_->PreloadTable(name);
-            if (!status.ok()) {
-                return status;
-            }
+    }
+
+    // hottest tables first, so the cache holds what was searched most before the restart
+    std::vector<std::string> ranking;
+    db_->TablesByAccess(ranking);
+    std::unordered_map<std::string, size_t> rank;
+    for (size_t i = 0; i < ranking.size(); ++i) {
+        rank.emplace(ranking[i], i);
+    }
+    std::stable_sort(table_names.begin(), table_names.end(), [&](const std::string& a, const std::string& b) {
+        auto rank_a = rank.find(a), rank_b = rank.find(b);
+        return rank_a != rank.end() && (rank_b == rank.end() || rank_a->second < rank_b->second);
+    });
+
+    preload_tables_total_ = table_names.size();
+    ReportPreloadProgress();
+    for (auto& name : table_names) {
+        auto status = db_->PreloadTable(name, &preload_progress_);
+        ReportPreloadProgress();
+        if (status.ok()) {
+            preload_tables_loaded_++;
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(preload_mutex_);
+            preload_errors_.push_back(name + ": " + status.message());
+        }
+        // the remaining tables are colder, they would not fit either
+        if (status.code() == SERVER_CACHE_FULL) {
+            return status;
         }
+        SERVER_LOG_ERROR << "Failed to preload table " << name << ": " << status.message();
     }
 
     return Status::OK();
@@ -17,7 +17,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "db/DB.h"
 #include "utils/Status.h"
@@ -52,12 +56,33 @@ class DBWrapper {
         return db_;
     }
 
+    // true once the background preload of db_config.preload_table finished, whether or not every table fit
+    bool
+    PreloadReady() const {
+        return preload_ready_;
+    }
+
+    std::string
+    DumpPreloadProgress();
+
  private:
     Status
     PreloadTables(const std::string& preload_tables);
 
+    void
+    ReportPreloadProgress();
+
  private:
     engine::DBPtr db_;
+
+    std::thread preload_thread_;
+    std::atomic<bool> preload_ready_{false};
+    engine::PreloadProgress preload_progress_;
+    engine::PreloadProgress warm_up_progress_;
+    std::atomic<int64_t> preload_tables_total_{0};
+    std::atomic<int64_t> preload_tables_loaded_{0};
+    std::mutex preload_mutex_;
+    std::vector<std::string> preload_errors_;
 };
 
 }  // namespace server
@@ -16,15 +16,35 @@
 // under the License.
 
 #include "server/grpc_impl/GrpcRequestHandler.h"
+#include "metrics/Tracer.h"
 #include "server/grpc_impl/GrpcRequestTask.h"
 #include "utils/TimeRecorder.h"
 
+#include <chrono>
+#include <memory>
 #include <vector>
 
 namespace milvus {
 namespace server {
 namespace grpc {
 
+namespace {
+
+// a search expires at the deadline the client has set on the call, nullptr when there is none
+knowhere::CancelTokenPtr
+SearchCancelToken(const ::grpc::ServerContext* context) {
+    auto deadline = context->deadline();
+    if (deadline == std::chrono::system_clock::time_point::max()) {
+        return nullptr;
+    }
+
+    auto remaining = std::chrono::duration_cast<knowhere::CancelToken::Clock::duration>(
+        deadline - std::chrono::system_clock::now());
+    return std::make_shared<knowhere::CancelToken>(knowhere::CancelToken::Clock::now() + remaining);
+}
+
+}  // namespace
+
 ::grpc::Status
 GrpcRequestHandler::CreateTable(::grpc::ServerContext* context, const ::milvus::grpc::TableSchema* request,
                                 ::milvus::grpc::Status* response) {
@@ -73,13 +93,29 @@ GrpcRequestHandler::Insert(::grpc::ServerContext* context, const ::milvus::grpc:
     return ::grpc::Status::OK;
 }
 
+::grpc::Status
+GrpcRequestHandler::Upsert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+                           ::milvus::grpc::VectorIds* response) {
+    BaseTaskPtr task_ptr = InsertTask::Create(request, response, true);
+    ::milvus::grpc::Status grpc_status;
+    GrpcRequestScheduler::ExecTask(task_ptr, &grpc_status);
+    response->mutable_status()->set_reason(grpc_status.reason());
+    response->mutable_status()->set_error_code(grpc_status.error_code());
+    return ::grpc::Status::OK;
+}
+
 ::grpc::Status
 GrpcRequestHandler::Search(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
                            ::milvus::grpc::TopKQueryResult* response) {
     std::vector<std::string> file_id_array;
-    BaseTaskPtr task_ptr = SearchTask::Create(request, file_id_array, response);
+    TraceContextPtr trace_context = Tracer::GetInstance().StartTrace("Search");
+    BaseTaskPtr task_ptr =
+        SearchTask::Create(request, file_id_array, response, trace_context, SearchCancelToken(context));
     ::milvus::grpc::Status grpc_status;
     GrpcRequestScheduler::ExecTask(task_ptr, &grpc_status);
+    if (trace_context != nullptr && task_ptr != nullptr) {
+        trace_context->Finish(task_ptr->status());
+    }
     response->mutable_status()->set_error_code(grpc_status.error_code());
     response->mutable_status()->set_reason(grpc_status.reason());
     return ::grpc::Status::OK;
@@ -93,9 +129,14 @@ GrpcRequestHandler::SearchInFiles(::grpc::ServerContext* context, const ::milvus
         file_id_array.push_back(request->file_id_array(i));
     }
     ::milvus::grpc::SearchInFilesParam* request_mutable = const_cast<::milvus::grpc::SearchInFilesParam*>(request);
-    BaseTaskPtr task_ptr = SearchTask::Create(request_mutable->mutable_search_param(), file_id_array, response);
+    TraceContextPtr trace_context = Tracer::GetInstance().StartTrace("SearchInFiles");
+    BaseTaskPtr task_ptr = SearchTask::Create(request_mutable->mutable_search_param(), file_id_array, response,
+                                              trace_context, SearchCancelToken(context));
     ::milvus::grpc::Status grpc_status;
     GrpcRequestScheduler::ExecTask(task_ptr, &grpc_status);
+    if (trace_context != nullptr && task_ptr != nullptr) {
+        trace_context->Finish(task_ptr->status());
+    }
     response->mutable_status()->set_error_code(grpc_status.error_code());
     response->mutable_status()->set_reason(grpc_status.reason());
     return ::grpc::Status::OK;
@@ -193,6 +234,28 @@ GrpcRequestHandler::DropIndex(::grpc::ServerContext* context, const ::milvus::gr
     return ::grpc::Status::OK;
 }
 
+::grpc::Status
+GrpcRequestHandler::GetVectorByID(::grpc::ServerContext* context, const ::milvus::grpc::VectorIdentity* request,
+                                  ::milvus::grpc::VectorData* response) {
+    BaseTaskPtr task_ptr = GetVectorByIDTask::Create(request, response);
+    ::milvus::grpc::Status grpc_status;
+    GrpcRequestScheduler::ExecTask(task_ptr, &grpc_status);
+    response->mutable_status()->set_reason(grpc_status.reason());
+    response->mutable_status()->set_error_code(grpc_status.error_code());
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRequestHandler::SearchByID(::grpc::ServerContext* context, const ::milvus::grpc::SearchByIDParam* request,
+                               ::milvus::grpc::TopKQueryResult* response) {
+    BaseTaskPtr task_ptr = SearchByIDTask::Create(request, response);
+    ::milvus::grpc::Status grpc_status;
+    GrpcRequestScheduler::ExecTask(task_ptr, &grpc_status);
+    response->mutable_status()->set_error_code(grpc_status.error_code());
+    response->mutable_status()->set_reason(grpc_status.reason());
+    return ::grpc::Status::OK;
+}
+
 }  // namespace grpc
 }  // namespace server
 }  // namespace milvus
@@ -26,7 +26,7 @@
 namespace milvus {
 namespace server {
 namespace grpc {
-class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service {
+class GrpcRequestHandler : public ::milvus::grpc::MilvusService::Service {
  public:
     /**
      * @brief Create table method
@@ -123,6 +123,22 @@ class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service {
     Insert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
            ::milvus::grpc::VectorIds* response) override;
 
+    /**
+     * @brief Upsert vector array to table
+     *
+     * This method is used to insert vectors with user ids, the vectors previously
+     * inserted with the same ids are deleted.
+     *
+     * @param context, add context for every RPC
+     * @param request, table name, vectors and their ids
+     * @param response, ids of the inserted vectors
+     *
+     * @return status
+     */
+    ::grpc::Status
+    Upsert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+           ::milvus::grpc::VectorIds* response) override;
+
     /**
      * @brief Query vector
      *
@@ -318,6 +334,34 @@ class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service {
     ::grpc::Status
     DropIndex(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
               ::milvus::grpc::Status* response) override;
+
+    /**
+     * @brief Get vector by id
+     *
+     * This method is used to fetch the vector stored under an id.
+     * @param context, add context for every RPC
+     * @param request, table name and vector id
+     * @param response, status and vector data
+     *
+     * @return status
+     */
+    ::grpc::Status
+    GetVectorByID(::grpc::ServerContext* context, const ::milvus::grpc::VectorIdentity* request,
+                  ::milvus::grpc::VectorData* response) override;
+
+    /**
+     * @brief Search by vector id
+     *
+     * This method is used to query a table with a vector already stored in it.
+     * @param context, add context for every RPC
+     * @param request, table name, vector id and search parameters
+     * @param response, topk query result
+     *
+     * @return status
+     */
+    ::grpc::Status
+    SearchByID(::grpc::ServerContext* context, const ::milvus::grpc::SearchByIDParam* request,
+               ::milvus::grpc::TopKQueryResult* response) override;
 };
 
 }  // namespace grpc
@@ -18,6 +18,7 @@
 #include "server/grpc_impl/GrpcRequestTask.h"
 
 #include <string.h>
+#include <algorithm>
 #include <map>
 #include <string>
 #include <utility>
@@ -26,7 +27,10 @@
 
 #include "GrpcServer.h"
 #include "db/Utils.h"
+#include "db/engine/AttrFilter.h"
+#include "metrics/Metrics.h"
 #include "scheduler/SchedInst.h"
+#include "server/Config.h"
 #include "server/DBWrapper.h"
 #include "server/Server.h"
 #include "src/version.h"
@@ -44,11 +48,23 @@ static const char* DDL_DML_TASK_GROUP = "ddl_dml";
 static const char* INFO_TASK_GROUP = "info";
 
 constexpr int64_t DAY_SECONDS = 24 * 60 * 60;
+constexpr int64_t TRACE_DUMP_LIMIT = 100;
+constexpr size_t MAX_ATTR_SCHEMA_LENGTH = 4096;  // width of the attributes column in the meta
 
 using DB_META = milvus::engine::meta::Meta;
 using DB_DATE = milvus::engine::meta::DateT;
 
 namespace {
+void
+RecordTraceSpan(const TraceContextPtr& trace_context, const std::string& name, int64_t& span_start) {
+    if (trace_context == nullptr) {
+        return;
+    }
+    int64_t now = TraceContext::NowMicros();
+    trace_context->AddSpan(name, span_start, now);
+    span_start = now;
+}
+
 engine::EngineType
 EngineType(int type) {
     static std::map<int, engine::EngineType> map_type = {
@@ -56,6 +72,8 @@ EngineType(int type) {
         {1, engine::EngineType::FAISS_IDMAP},
         {2, engine::EngineType::FAISS_IVFFLAT},
         {3, engine::EngineType::FAISS_IVFSQ8},
+        {6, engine::EngineType::SPTAG_KDT},
+        {7, engine::EngineType::SPTAG_BKT},
     };
 
     if (map_type.find(type) == map_type.end()) {
@@ -72,6 +90,8 @@ IndexType(engine::EngineType type) {
         {engine::EngineType::FAISS_IDMAP, 1},
         {engine::EngineType::FAISS_IVFFLAT, 2},
         {engine::EngineType::FAISS_IVFSQ8, 3},
+        {engine::EngineType::SPTAG_KDT, 6},
+        {engine::EngineType::SPTAG_BKT, 7},
     };
 
     if (map_type.find(type) == map_type.end()) {
@@ -115,6 +135,71 @@ ConvertTimeRangeToDBDates(const std::vector<::milvus::grpc::Range>& range_array,
     return Status::OK();
 }
 
+Status
+ConvertAttrFields(const ::google::protobuf::RepeatedPtrField<::milvus::grpc::AttrField>& fields,
+                  std::string& attributes) {
+    engine::AttrSchema schema;
+    for (auto& field : fields) {
+        if (field.type() != static_cast<int32_t>(engine::AttrType::INT64) &&
+            field.type() != static_cast<int32_t>(engine::AttrType::DOUBLE)) {
+            return Status(SERVER_INVALID_ATTRIBUTE, "Invalid type " + std::to_string(field.type()) +
+                                                        " of attribute " + field.name() + ", expect 1 or 2");
+        }
+        engine::AttrField attr;
+        attr.name_ = field.name();
+        attr.type_ = static_cast<engine::AttrType>(field.type());
+        schema.push_back(attr);
+    }
+
+    // names are checked by parsing the form the meta keeps them in
+    attributes = engine::FormatAttrSchema(schema);
+    engine::AttrSchema parsed;
+    auto status = engine::ParseAttrSchema(attributes, parsed);
+    if (!status.ok() || parsed.size() != schema.size()) {
+        return Status(SERVER_INVALID_ATTRIBUTE, status.ok() ? "Invalid attribute names" : status.message());
+    }
+    if (attributes.size() > MAX_ATTR_SCHEMA_LENGTH) {
+        return Status(SERVER_INVALID_ATTRIBUTE, "Too many attributes");
+    }
+    return Status::OK();
+}
+
+// the values of each attribute of schema, in the array of its type
+Status
+ConvertAttrColumns(const ::google::protobuf::RepeatedPtrField<::milvus::grpc::AttrColumn>& columns,
+                   const engine::AttrSchema& schema, size_t count, engine::AttrColumns& attrs) {
+    attrs.clear();
+    for (auto& column : columns) {
+        auto field = std::find_if(schema.begin(), schema.end(),
+                                  [&](const engine::AttrField& f) { return f.name_ == column.name(); });
+        if (field == schema.end()) {
+            return Status(SERVER_INVALID_ATTRIBUTE, "The table has no attribute " + column.name());
+        }
+
+        engine::AttrColumn attr;
+        attr.name_ = column.name();
+        attr.type_ = field->type_;
+        if (field->type_ == engine::AttrType::INT64) {
+            if (!column.double_value_array().empty()) {
+                return Status(SERVER_INVALID_ATTRIBUTE, "Attribute " + column.name() + " takes int64 values");
+            }
+            attr.int_data_.assign(column.int_value_array().begin(), column.int_value_array().end());
+        } else {
+            if (!column.int_value_array().empty()) {
+                return Status(SERVER_INVALID_ATTRIBUTE, "Attribute " + column.name() + " takes double values");
+            }
+            attr.double_data_.assign(column.double_value_array().begin(), column.double_value_array().end());
+        }
+        attrs.emplace_back(std::move(attr));
+    }
+
+    auto status = engine::ValidateAttrColumns(schema, attrs, count);
+    if (!status.ok()) {
+        return Status(SERVER_INVALID_ATTRIBUTE, status.message());
+    }
+    return Status::OK();
+}
+
 std::string
 TableNotExistMsg(const std::string& table_name) {
     return "Table " + table_name +
@@ -170,6 +255,10 @@ CreateTableTask::OnExecute() {
         table_info.dimension_ = static_cast<uint16_t>(schema_->dimension());
         table_info.index_file_size_ = schema_->index_file_size();
         table_info.metric_type_ = schema_->metric_type();
+        status = ConvertAttrFields(schema_->attr_field_array(), table_info.attributes_);
+        if (!status.ok()) {
+            return status;
+        }
 
         // step 3: create table
         status = DBWrapper::DB()->CreateTable(table_info);
@@ -222,6 +311,14 @@ DescribeTableTask::OnExecute() {
         schema_->set_dimension(table_info.dimension_);
         schema_->set_index_file_size(table_info.index_file_size_);
         schema_->set_metric_type(table_info.metric_type_);
+
+        engine::AttrSchema attr_schema;
+        engine::ParseAttrSchema(table_info.attributes_, attr_schema);
+        for (auto& attr : attr_schema) {
+            auto field = schema_->add_attr_field_array();
+            field->set_name(attr.name_);
+            field->set_type(static_cast<int32_t>(attr.type_));
+        }
     } catch (std::exception& ex) {
         return Status(SERVER_UNEXPECTED_ERROR, ex.what());
     }
@@ -278,6 +375,18 @@ CreateIndexTask::OnExecute() {
             return status;
         }
 
+        engine::meta::TableSchema table_info;
+        table_info.table_id_ = table_name_;
+        status = DBWrapper::DB()->DescribeTable(table_info);
+        if (!status.ok()) {
+            return status;
+        }
+
+        status = ValidationUtil::ValidateIndexMetricType(grpc_index.index_type(), table_info.metric_type_);
+        if (!status.ok()) {
+            return status;
+        }
+
         // step 2: check table existence
         engine::TableIndex index;
         index.engine_type_ = grpc_index.index_type();
@@ -405,17 +514,19 @@ ShowTablesTask::OnExecute() {
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-InsertTask::InsertTask(const ::milvus::grpc::InsertParam* insert_param, ::milvus::grpc::VectorIds* record_ids)
-    : GrpcBaseTask(DDL_DML_TASK_GROUP), insert_param_(insert_param), record_ids_(record_ids) {
+InsertTask::InsertTask(const ::milvus::grpc::InsertParam* insert_param, ::milvus::grpc::VectorIds* record_ids,
+                       bool upsert)
+    : GrpcBaseTask(DDL_DML_TASK_GROUP), insert_param_(insert_param), record_ids_(record_ids), upsert_(upsert) {
 }
 
 BaseTaskPtr
-InsertTask::Create(const ::milvus::grpc::InsertParam* insert_param, ::milvus::grpc::VectorIds* record_ids) {
+InsertTask::Create(const ::milvus::grpc::InsertParam* insert_param, ::milvus::grpc::VectorIds* record_ids,
+                   bool upsert) {
     if (insert_param == nullptr) {
         SERVER_LOG_ERROR << "grpc input is null!";
         return nullptr;
     }
-    return std::shared_ptr<GrpcBaseTask>(new InsertTask(insert_param, record_ids));
+    return std::shared_ptr<GrpcBaseTask>(new InsertTask(insert_param, record_ids, upsert));
 }
 
 Status
@@ -428,6 +539,10 @@ InsertTask::OnExecute() {
         if (!status.ok()) {
             return status;
         }
+        status = ValidationUtil::ValidatePartitionTag(insert_param_->partition_tag());
+        if (!status.ok()) {
+            return status;
+        }
         if (insert_param_->row_record_array().empty()) {
             return Status(SERVER_INVALID_ROWRECORD_ARRAY,
                           "The vector array is empty. Make sure you have entered vector records.");
@@ -461,6 +576,11 @@ InsertTask::OnExecute() {
                           "Table vector IDs are user-defined. Please provide IDs for all vectors of this table.");
         }
 
+        // only a user id can identify the vector to replace
+        if (upsert_ && !user_provide_ids) {
+            return Status(SERVER_ILLEGAL_VECTOR_ID, "Upsert requires an ID for every vector.");
+        }
+
         // user didn't provided id before, no need to provide user id
         if ((table_info.flag_ & engine::meta::FLAG_MASK_NO_USERID) != 0 && user_provide_ids) {
             return Status(
@@ -468,6 +588,18 @@ InsertTask::OnExecute() {
                 "Table vector IDs are auto-generated. All vectors of this table must use auto-generated IDs.");
         }
 
+        // a table with attributes takes a value of each of them for every vector
+        engine::AttrSchema attr_schema;
+        engine::AttrColumns attrs;
+        status = engine::ParseAttrSchema(table_info.attributes_, attr_schema);
+        if (status.ok()) {
+            status = ConvertAttrColumns(insert_param_->attr_column_array(), attr_schema,
+                                        insert_param_->row_record_array_size(), attrs);
+        }
+        if (!status.ok()) {
+            return status;
+        }
+
         rc.RecordSection("check validation");
 
 #ifdef MILVUS_ENABLE_PROFILING
@@ -506,7 +638,18 @@ InsertTask::OnExecute() {
             memcpy(target_data, src_data, static_cast<size_t>(sizeof(int64_t) * insert_param_->row_id_array_size()));
         }
 
-        status = DBWrapper::DB()->InsertVectors(insert_param_->table_name(), vec_count, vec_f.data(), vec_ids);
+        if (upsert_) {
+            std::vector<int64_t> sorted_ids = vec_ids;
+            std::sort(sorted_ids.begin(), sorted_ids.end());
+            if (std::adjacent_find(sorted_ids.begin(), sorted_ids.end()) != sorted_ids.end()) {
+                return Status(SERVER_ILLEGAL_VECTOR_ID, "The vector IDs of an upsert must be unique.");
+            }
+            status = DBWrapper::DB()->UpsertVectors(insert_param_->table_name(), vec_count, vec_f.data(), vec_ids,
+                                                    attrs, insert_param_->partition_tag());
+        } else {
+            status = DBWrapper::DB()->InsertVectors(insert_param_->table_name(), vec_count, vec_f.data(), vec_ids,
+                                                    attrs, insert_param_->partition_tag());
+        }
         rc.ElapseFromBegin("add vectors to engine");
         if (!status.ok()) {
             return status;
@@ -542,25 +685,36 @@ InsertTask::OnExecute() {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 SearchTask::SearchTask(const ::milvus::grpc::SearchParam* search_vector_infos,
-                       const std::vector<std::string>& file_id_array, ::milvus::grpc::TopKQueryResult* response)
+                       const std::vector<std::string>& file_id_array, ::milvus::grpc::TopKQueryResult* response,
+                       const TraceContextPtr& trace_context, const knowhere::CancelTokenPtr& cancel_token)
     : GrpcBaseTask(DQL_TASK_GROUP),
       search_param_(search_vector_infos),
       file_id_array_(file_id_array),
-      topk_result_(response) {
+      topk_result_(response),
+      trace_context_(trace_context),
+      cancel_token_(cancel_token) {
 }
 
 BaseTaskPtr
 SearchTask::Create(const ::milvus::grpc::SearchParam* search_vector_infos,
-                   const std::vector<std::string>& file_id_array, ::milvus::grpc::TopKQueryResult* response) {
+                   const std::vector<std::string>& file_id_array, ::milvus::grpc::TopKQueryResult* response,
+                   const TraceContextPtr& trace_context, const knowhere::CancelTokenPtr& cancel_token) {
     if (search_vector_infos == nullptr) {
         SERVER_LOG_ERROR << "grpc input is null!";
         return nullptr;
     }
-    return std::shared_ptr<GrpcBaseTask>(new SearchTask(search_vector_infos, file_id_array, response));
+    return std::shared_ptr<GrpcBaseTask>(
+        new SearchTask(search_vector_infos, file_id_array, response, trace_context, cancel_token));
 }
 
 Status
 SearchTask::OnExecute() {
+    // the client has given up while the request was queued
+    if (cancel_token_ != nullptr && cancel_token_->Cancelled()) {
+        Metrics::GetInstance().SearchCancelledIncrement("grpc_queue");
+        return Status(SERVER_QUERY_TIMEOUT, "Search deadline exceeded before the search started");
+    }
+
     try {
         int64_t top_k = search_param_->topk();
         int64_t nprobe = search_param_->nprobe();
@@ -568,17 +722,32 @@ SearchTask::OnExecute() {
         std::string hdr = "SearchTask(k=" + std::to_string(top_k) + ", nprob=" + std::to_string(nprobe) + ")";
         TimeRecorder rc(hdr);
 
+        // spans recorded by DBImpl and scheduler tasks are attached to this trace context, the deadline
+        // reaches them through the cancel token of this thread
+        ScopedThreadTraceContext thread_trace_context(trace_context_);
+        knowhere::CancelScope cancel_scope(cancel_token_);
+        int64_t span_start = TraceContext::NowMicros();
+        if (trace_context_ != nullptr) {
+            trace_context_->AddSpan("grpc queue wait", trace_context_->start_us(), span_start);
+            trace_context_->SetAttribute("table", search_param_->table_name());
+            trace_context_->SetAttribute("topk", std::to_string(top_k));
+            trace_context_->SetAttribute("nprobe", std::to_string(nprobe));
+            trace_context_->SetAttribute("nq", std::to_string(search_param_->query_record_array_size()));
+        }
+
         // step 1: check table name
         std::string table_name_ = search_param_->table_name();
         auto status = ValidationUtil::ValidateTableName(table_name_);
         if (!status.ok()) {
             return status;
         }
+        RecordTraceSpan(trace_context_, "validate table name", span_start);
 
         // step 2: check table existence
         engine::meta::TableSchema table_info;
         table_info.table_id_ = table_name_;
         status = DBWrapper::DB()->DescribeTable(table_info);
+        RecordTraceSpan(trace_context_, "meta lookup", span_start);
         if (!status.ok()) {
             if (status.code() == DB_NOT_FOUND) {
                 return Status(SERVER_TABLE_NOT_EXIST, TableNotExistMsg(table_name_));
@@ -615,7 +784,29 @@ SearchTask::OnExecute() {
             return status;
         }
 
+        engine::AttrFilterPtr filter;
+        if (!search_param_->filter().empty()) {
+            engine::AttrSchema attr_schema;
+            status = engine::ParseAttrSchema(table_info.attributes_, attr_schema);
+            if (status.ok()) {
+                status = engine::AttrFilter::Parse(search_param_->filter(), attr_schema, filter);
+            }
+            if (!status.ok()) {
+                return Status(SERVER_INVALID_FILTER, status.message());
+            }
+        }
+
+        engine::meta::PartitionTags partition_tags;
+        for (auto& tag : search_param_->partition_tag_array()) {
+            status = ValidationUtil::ValidatePartitionTag(tag);
+            if (!status.ok()) {
+                return status;
+            }
+            partition_tags.push_back(tag);
+        }
+
         rc.RecordSection("check validation");
+        RecordTraceSpan(trace_context_, "validation", span_start);
 
         // step 5: prepare float data
         auto record_array_size = search_param_->query_record_array_size();
@@ -636,6 +827,7 @@ SearchTask::OnExecute() {
                    table_info.dimension_ * sizeof(float));
         }
         rc.RecordSection("prepare vector data");
+        RecordTraceSpan(trace_context_, "prepare vector data", span_start);
 
         // step 6: search vectors
         engine::ResultIds result_ids;
@@ -650,10 +842,10 @@ SearchTask::OnExecute() {
 
         if (file_id_array_.empty()) {
             status = DBWrapper::DB()->Query(table_name_, (size_t)top_k, record_count, nprobe, vec_f.data(), dates,
-                                            result_ids, result_distances);
+                                            result_ids, result_distances, filter, partition_tags);
         } else {
             status = DBWrapper::DB()->Query(table_name_, file_id_array_, (size_t)top_k, record_count, nprobe,
-                                            vec_f.data(), dates, result_ids, result_distances);
+                                            vec_f.data(), dates, result_ids, result_distances, filter);
         }
 
 #ifdef MILVUS_ENABLE_PROFILING
@@ -661,6 +853,7 @@ SearchTask::OnExecute() {
 #endif
 
         rc.RecordSection("search vectors from engine");
+        RecordTraceSpan(trace_context_, "query", span_start);
         if (!status.ok()) {
             return status;
         }
@@ -676,6 +869,7 @@ SearchTask::OnExecute() {
 
         // step 8: print time cost percent
         rc.RecordSection("construct result and send");
+        RecordTraceSpan(trace_context_, "construct result", span_start);
         rc.ElapseFromBegin("totally cost");
     } catch (std::exception& ex) {
         return Status(SERVER_UNEXPECTED_ERROR, ex.what());
@@ -740,8 +934,25 @@ Status
 CmdTask::OnExecute() {
     if (cmd_ == "version") {
         result_ = MILVUS_VERSION;
+    } else if (cmd_ == "ready") {
+        result_ = DBWrapper::GetInstance().PreloadReady() ? "true" : "false";
+    } else if (cmd_ == "preload") {
+        result_ = DBWrapper::GetInstance().DumpPreloadProgress();
     } else if (cmd_ == "tasktable") {
         result_ = scheduler::ResMgrInst::GetInstance()->DumpTaskTables();
+    } else if (cmd_ == "trace") {
+        result_ = Tracer::GetInstance().Dump(TRACE_DUMP_LIMIT).dump();
+    } else if (cmd_ == "trace_export") {
+        std::string export_path;
+        Status s = Config::GetInstance().GetMetricConfigTraceExportPath(export_path);
+        if (!s.ok()) {
+            return s;
+        }
+        s = Tracer::GetInstance().Export(export_path);
+        if (!s.ok()) {
+            return s;
+        }
+        result_ = export_path;
     } else {
         result_ = "OK";
     }
@@ -937,6 +1148,156 @@ DropIndexTask::OnExecute() {
     return Status::OK();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+GetVectorByIDTask::GetVectorByIDTask(const ::milvus::grpc::VectorIdentity* vector_identity,
+                                     ::milvus::grpc::VectorData* vector_data)
+    : GrpcBaseTask(DQL_TASK_GROUP), vector_identity_(vector_identity), vector_data_(vector_data) {
+}
+
+BaseTaskPtr
+GetVectorByIDTask::Create(const ::milvus::grpc::VectorIdentity* vector_identity,
+                          ::milvus::grpc::VectorData* vector_data) {
+    if (vector_identity == nullptr) {
+        SERVER_LOG_ERROR << "grpc input is null!";
+        return nullptr;
+    }
+    return std::shared_ptr<GrpcBaseTask>(new GetVectorByIDTask(vector_identity, vector_data));
+}
+
+Status
+GetVectorByIDTask::OnExecute() {
+    try {
+        TimeRecorder rc("GetVectorByIDTask");
+
+        // step 1: check arguments
+        std::string table_name = vector_identity_->table_name();
+        auto status = ValidationUtil::ValidateTableName(table_name);
+        if (!status.ok()) {
+            return status;
+        }
+
+        bool has_table = false;
+        status = DBWrapper::DB()->HasTable(table_name, has_table);
+        if (!status.ok()) {
+            return status;
+        }
+
+        if (!has_table) {
+            return Status(SERVER_TABLE_NOT_EXIST, TableNotExistMsg(table_name));
+        }
+
+        // step 2: fetch vector
+        std::vector<float> vector;
+        status = DBWrapper::DB()->GetVectorByID(table_name, vector_identity_->id(), vector);
+        if (!status.ok()) {
+            return status;
+        }
+
+        vector_data_->mutable_vector_data()->mutable_vector_data()->Add(vector.begin(), vector.end());
+
+        rc.ElapseFromBegin("totally cost");
+    } catch (std::exception& ex) {
+        return Status(SERVER_UNEXPECTED_ERROR, ex.what());
+    }
+
+    return Status::OK();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+SearchByIDTask::SearchByIDTask(const ::milvus::grpc::SearchByIDParam* search_param,
+                               ::milvus::grpc::TopKQueryResult* response)
+    : GrpcBaseTask(DQL_TASK_GROUP), search_param_(search_param), topk_result_(response) {
+}
+
+BaseTaskPtr
+SearchByIDTask::Create(const ::milvus::grpc::SearchByIDParam* search_param, ::milvus::grpc::TopKQueryResult* response) {
+    if (search_param == nullptr) {
+        SERVER_LOG_ERROR << "grpc input is null!";
+        return nullptr;
+    }
+    return std::shared_ptr<GrpcBaseTask>(new SearchByIDTask(search_param, response));
+}
+
+Status
+SearchByIDTask::OnExecute() {
+    try {
+        int64_t top_k = search_param_->topk();
+        int64_t nprobe = search_param_->nprobe();
+
+        std::string hdr = "SearchByIDTask(k=" + std::to_string(top_k) + ", nprob=" + std::to_string(nprobe) + ")";
+        TimeRecorder rc(hdr);
+
+        // step 1: check table name
+        std::string table_name = search_param_->table_name();
+        auto status = ValidationUtil::ValidateTableName(table_name);
+        if (!status.ok()) {
+            return status;
+        }
+
+        // step 2: check table existence
+        engine::meta::TableSchema table_info;
+        table_info.table_id_ = table_name;
+        status = DBWrapper::DB()->DescribeTable(table_info);
+        if (!status.ok()) {
+            if (status.code() == DB_NOT_FOUND) {
+                return Status(SERVER_TABLE_NOT_EXIST, TableNotExistMsg(table_name));
+            } else {
+                return status;
+            }
+        }
+
+        // step 3: check search parameter
+        status = ValidationUtil::ValidateSearchTopk(top_k, table_info);
+        if (!status.ok()) {
+            return status;
+        }
+
+        status = ValidationUtil::ValidateSearchNprobe(nprobe, table_info);
+        if (!status.ok()) {
+            return status;
+        }
+
+        // step 4: check date range, and convert to db dates
+        std::vector<DB_DATE> dates;
+        std::vector<::milvus::grpc::Range> range_array;
+        for (size_t i = 0; i < search_param_->query_range_array_size(); i++) {
+            range_array.emplace_back(search_param_->query_range_array(i));
+        }
+
+        status = ConvertTimeRangeToDBDates(range_array, dates);
+        if (!status.ok()) {
+            return status;
+        }
+
+        rc.RecordSection("check validation");
+
+        // step 5: search with the stored vector
+        engine::ResultIds result_ids;
+        engine::ResultDistances result_distances;
+        status = DBWrapper::DB()->QueryByID(table_name, (size_t)top_k, nprobe, search_param_->id(), dates, result_ids,
+                                            result_distances);
+        rc.RecordSection("search vectors from engine");
+        if (!status.ok()) {
+            return status;
+        }
+
+        if (result_ids.empty()) {
+            return Status::OK();  // empty table
+        }
+
+        // step 6: construct result array
+        topk_result_->set_row_num(1);
+        topk_result_->add_ids(result_ids.begin(), result_ids.end());
+        topk_result_->add_distances(result_distances.begin(), result_distances.end());
+
+        rc.ElapseFromBegin("totally cost");
+    } catch (std::exception& ex) {
+        return Status(SERVER_UNEXPECTED_ERROR, ex.what());
+    }
+
+    return Status::OK();
+}
+
 }  // namespace grpc
 }  // namespace server
 }  // namespace milvus
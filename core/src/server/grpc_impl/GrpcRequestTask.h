@@ -18,6 +18,8 @@
 #pragma once
 
 #include "db/Types.h"
+#include "knowhere/common/Cancel.h"
+#include "metrics/Tracer.h"
 #include "server/grpc_impl/GrpcRequestScheduler.h"
 #include "utils/Status.h"
 
@@ -134,11 +136,13 @@ class ShowTablesTask : public GrpcBaseTask {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class InsertTask : public GrpcBaseTask {
  public:
+    // an upsert deletes the vectors inserted before with the same user ids
     static BaseTaskPtr
-    Create(const ::milvus::grpc::InsertParam* insert_param, ::milvus::grpc::VectorIds* record_ids);
+    Create(const ::milvus::grpc::InsertParam* insert_param, ::milvus::grpc::VectorIds* record_ids,
+           bool upsert = false);
 
  protected:
-    InsertTask(const ::milvus::grpc::InsertParam* insert_param, ::milvus::grpc::VectorIds* record_ids);
+    InsertTask(const ::milvus::grpc::InsertParam* insert_param, ::milvus::grpc::VectorIds* record_ids, bool upsert);
 
     Status
     OnExecute() override;
@@ -146,18 +150,22 @@ class InsertTask : public GrpcBaseTask {
  private:
     const ::milvus::grpc::InsertParam* insert_param_;
     ::milvus::grpc::VectorIds* record_ids_;
+    bool upsert_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class SearchTask : public GrpcBaseTask {
  public:
+    // the search is given up with SERVER_QUERY_TIMEOUT or DB_TIMEOUT once cancel_token expires
     static BaseTaskPtr
     Create(const ::milvus::grpc::SearchParam* search_param, const std::vector<std::string>& file_id_array,
-           ::milvus::grpc::TopKQueryResult* response);
+           ::milvus::grpc::TopKQueryResult* response, const TraceContextPtr& trace_context = nullptr,
+           const knowhere::CancelTokenPtr& cancel_token = nullptr);
 
  protected:
     SearchTask(const ::milvus::grpc::SearchParam* search_param, const std::vector<std::string>& file_id_array,
-               ::milvus::grpc::TopKQueryResult* response);
+               ::milvus::grpc::TopKQueryResult* response, const TraceContextPtr& trace_context,
+               const knowhere::CancelTokenPtr& cancel_token);
 
     Status
     OnExecute() override;
@@ -166,6 +174,8 @@ class SearchTask : public GrpcBaseTask {
     const ::milvus::grpc::SearchParam* search_param_;
     std::vector<std::string> file_id_array_;
     ::milvus::grpc::TopKQueryResult* topk_result_;
+    TraceContextPtr trace_context_;
+    knowhere::CancelTokenPtr cancel_token_;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,6 +277,40 @@ class DropIndexTask : public GrpcBaseTask {
     std::string table_name_;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class GetVectorByIDTask : public GrpcBaseTask {
+ public:
+    static BaseTaskPtr
+    Create(const ::milvus::grpc::VectorIdentity* vector_identity, ::milvus::grpc::VectorData* vector_data);
+
+ protected:
+    GetVectorByIDTask(const ::milvus::grpc::VectorIdentity* vector_identity, ::milvus::grpc::VectorData* vector_data);
+
+    Status
+    OnExecute() override;
+
+ private:
+    const ::milvus::grpc::VectorIdentity* vector_identity_;
+    ::milvus::grpc::VectorData* vector_data_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class SearchByIDTask : public GrpcBaseTask {
+ public:
+    static BaseTaskPtr
+    Create(const ::milvus::grpc::SearchByIDParam* search_param, ::milvus::grpc::TopKQueryResult* response);
+
+ protected:
+    SearchByIDTask(const ::milvus::grpc::SearchByIDParam* search_param, ::milvus::grpc::TopKQueryResult* response);
+
+    Status
+    OnExecute() override;
+
+ private:
+    const ::milvus::grpc::SearchByIDParam* search_param_;
+    ::milvus::grpc::TopKQueryResult* topk_result_;
+};
+
 }  // namespace grpc
 }  // namespace server
 }  // namespace milvus
@@ -0,0 +1,643 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "server/grpc_impl/GrpcRouterHandler.h"
+#include "db/IDGenerator.h"
+#include "scheduler/task/SearchTask.h"
+#include "utils/Log.h"
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <limits>
+#include <thread>
+#include <utility>
+
+namespace milvus {
+namespace server {
+namespace grpc {
+
+namespace {
+
+std::unique_ptr<ShardStub>
+CreateShardStub(const std::string& address) {
+    ::grpc::ChannelArguments args;
+    args.SetMaxSendMessageSize(-1);
+    args.SetMaxReceiveMessageSize(-1);
+    auto channel = ::grpc::CreateCustomChannel(address, ::grpc::InsecureChannelCredentials(), args);
+    return ::milvus::grpc::MilvusService::NewStub(channel);
+}
+
+void
+SetShardError(const ::grpc::Status& grpc_status, ::milvus::grpc::Status* status) {
+    status->set_error_code(::milvus::grpc::ErrorCode::CONNECT_FAILED);
+    status->set_reason(grpc_status.error_message());
+}
+
+void
+SetError(::milvus::grpc::ErrorCode code, const std::string& reason, ::milvus::grpc::Status* status) {
+    status->set_error_code(code);
+    status->set_reason(reason);
+}
+
+}  // namespace
+
+GrpcRouterHandler::GrpcRouterHandler(const ShardMap& shards, int64_t shard_timeout_ms, int64_t hedge_delay_ms)
+    : shard_timeout_ms_(shard_timeout_ms), hedge_delay_ms_(hedge_delay_ms) {
+    for (auto& replicas : shards) {
+        std::vector<std::unique_ptr<ShardStub>> stubs;
+        for (auto& address : replicas) {
+            stubs.emplace_back(CreateShardStub(address));
+        }
+        shards_.emplace_back(std::move(stubs));
+    }
+}
+
+std::chrono::system_clock::time_point
+GrpcRouterHandler::ShardDeadline(const ::grpc::ServerContext* context) const {
+    auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds(shard_timeout_ms_);
+    return std::min(deadline, context->deadline());
+}
+
+size_t
+GrpcRouterHandler::ShardOf(int64_t id, size_t shard_count) {
+    // mix the bits first, generated ids are sequential and share their low digits
+    uint64_t x = static_cast<uint64_t>(id);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    x = x ^ (x >> 31);
+    return static_cast<size_t>(x % shard_count);
+}
+
+template <typename Reply>
+::grpc::Status
+GrpcRouterHandler::CallShard(const ::grpc::ServerContext* context, size_t shard, bool read,
+                             const ShardCall<Reply>& call, Reply& reply) {
+    auto& replicas = shards_[shard];
+    auto deadline = ShardDeadline(context);
+
+    // a read starts at a rotating replica, it is resent to the next replica when an attempt fails or
+    // has not answered after hedge_delay; the first answer wins and the other attempts are cancelled.
+    // Every replica is tried at most once, a shard with a single replica is not hedged
+    size_t first = read ? next_replica_++ % replicas.size() : 0;
+    size_t max_attempts = read ? replicas.size() : 1;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::shared_ptr<::grpc::ClientContext>> contexts;
+    std::vector<std::thread> threads;
+    size_t running = 0;
+    bool done = false;
+    ::grpc::Status result;
+
+    auto launch = [&](size_t attempt) {
+        auto context = std::make_shared<::grpc::ClientContext>();
+        context->set_deadline(deadline);
+        contexts.push_back(context);
+        ShardStub* stub = replicas[(first + attempt) % replicas.size()].get();
+        running++;
+        threads.emplace_back([&, context, stub]() {
+            Reply attempt_reply;
+            ::grpc::Status status = call(*stub, *context, attempt_reply);
+            std::lock_guard<std::mutex> lock(mutex);
+            running--;
+            if (!done) {
+                result = status;
+                if (status.ok()) {
+                    reply.Swap(&attempt_reply);
+                    done = true;
+                }
+            }
+            cv.notify_all();
+        });
+    };
+
+    auto finished = [&] { return done || running == 0; };
+
+    std::unique_lock<std::mutex> lock(mutex);
+    launch(0);
+    size_t attempts = 1;
+    while (!done) {
+        if (attempts < max_attempts) {
+            if (hedge_delay_ms_ > 0) {
+                cv.wait_for(lock, std::chrono::milliseconds(hedge_delay_ms_), finished);
+            } else {
+                cv.wait(lock, finished);
+            }
+            if (!done) {
+                launch(attempts++);
+            }
+        } else {
+            cv.wait(lock, finished);
+            done = true;
+        }
+    }
+
+    for (auto& context : contexts) {
+        context->TryCancel();
+    }
+    lock.unlock();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (!result.ok()) {
+        SERVER_LOG_WARNING << "Shard " << shard << " failed after " << attempts
+                           << " attempts: " << result.error_message();
+        return ::grpc::Status(result.error_code(), "shard " + std::to_string(shard) + ": " + result.error_message());
+    }
+    return result;
+}
+
+template <typename Reply>
+::grpc::Status
+GrpcRouterHandler::CallShards(const ::grpc::ServerContext* context, bool read, const ShardCall<Reply>& call,
+                              std::vector<Reply>& replies) {
+    replies.clear();
+    replies.resize(shards_.size());
+
+    // shard 0 is called on this thread
+    std::vector<std::future<::grpc::Status>> futures;
+    for (size_t i = 1; i < shards_.size(); ++i) {
+        futures.emplace_back(
+            std::async(std::launch::async, [&, i]() { return CallShard<Reply>(context, i, read, call, replies[i]); }));
+    }
+    ::grpc::Status result = CallShard<Reply>(context, 0, read, call, replies[0]);
+    for (auto& future : futures) {
+        ::grpc::Status status = future.get();
+        if (result.ok()) {
+            result = status;
+        }
+    }
+    return result;
+}
+
+::grpc::Status
+GrpcRouterHandler::Broadcast(const ::grpc::ServerContext* context, bool all_replicas,
+                             const ShardCall<::milvus::grpc::Status>& call, ::milvus::grpc::Status* response) {
+    std::vector<ShardStub*> stubs;
+    for (auto& replicas : shards_) {
+        for (size_t i = 0; i < (all_replicas ? replicas.size() : 1); ++i) {
+            stubs.push_back(replicas[i].get());
+        }
+    }
+
+    auto deadline = ShardDeadline(context);
+    std::vector<::milvus::grpc::Status> replies(stubs.size());
+    std::vector<std::future<::grpc::Status>> futures;
+    for (size_t i = 0; i < stubs.size(); ++i) {
+        futures.emplace_back(std::async(std::launch::async, [&, i]() {
+            ::grpc::ClientContext client_context;
+            client_context.set_deadline(deadline);
+            return call(*stubs[i], client_context, replies[i]);
+        }));
+    }
+
+    for (size_t i = 0; i < stubs.size(); ++i) {
+        ::grpc::Status grpc_status = futures[i].get();
+        if (response->error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+            continue;
+        }
+        if (!grpc_status.ok()) {
+            SetShardError(grpc_status, response);
+        } else if (replies[i].error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+            response->CopyFrom(replies[i]);
+        }
+    }
+    return ::grpc::Status::OK;
+}
+
+::milvus::grpc::Status
+GrpcRouterHandler::GetTableAscending(const ::grpc::ServerContext* context, const std::string& table_name,
+                                     bool& ascending) {
+    ::milvus::grpc::Status status;
+    {
+        std::lock_guard<std::mutex> lock(ascending_mutex_);
+        auto iter = table_ascending_.find(table_name);
+        if (iter != table_ascending_.end()) {
+            ascending = iter->second;
+            return status;
+        }
+    }
+
+    ::milvus::grpc::TableName request;
+    request.set_table_name(table_name);
+    ::milvus::grpc::TableSchema schema;
+    ::grpc::Status grpc_status = CallShard<::milvus::grpc::TableSchema>(
+        context, 0, true,
+        [&request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::TableSchema& reply) {
+            return stub.DescribeTable(&context, request, &reply);
+        },
+        schema);
+    if (!grpc_status.ok()) {
+        SetShardError(grpc_status, &status);
+        return status;
+    }
+    if (schema.status().error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+        return schema.status();
+    }
+
+    // 1-L2, 2-IP
+    ascending = (schema.metric_type() != 2);
+    std::lock_guard<std::mutex> lock(ascending_mutex_);
+    table_ascending_[table_name] = ascending;
+    return status;
+}
+
+::grpc::Status
+GrpcRouterHandler::CreateTable(::grpc::ServerContext* context, const ::milvus::grpc::TableSchema* request,
+                               ::milvus::grpc::Status* response) {
+    return Broadcast(context, false,
+                     [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::Status& reply) {
+                         return stub.CreateTable(&context, *request, &reply);
+                     },
+                     response);
+}
+
+::grpc::Status
+GrpcRouterHandler::HasTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                            ::milvus::grpc::BoolReply* response) {
+    ::grpc::Status grpc_status = CallShard<::milvus::grpc::BoolReply>(
+        context, 0, true,
+        [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::BoolReply& reply) {
+            return stub.HasTable(&context, *request, &reply);
+        },
+        *response);
+    if (!grpc_status.ok()) {
+        SetShardError(grpc_status, response->mutable_status());
+    }
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::DropTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                             ::milvus::grpc::Status* response) {
+    {
+        std::lock_guard<std::mutex> lock(ascending_mutex_);
+        table_ascending_.erase(request->table_name());
+    }
+    return Broadcast(context, false,
+                     [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::Status& reply) {
+                         return stub.DropTable(&context, *request, &reply);
+                     },
+                     response);
+}
+
+::grpc::Status
+GrpcRouterHandler::CreateIndex(::grpc::ServerContext* context, const ::milvus::grpc::IndexParam* request,
+                               ::milvus::grpc::Status* response) {
+    return Broadcast(context, false,
+                     [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::Status& reply) {
+                         return stub.CreateIndex(&context, *request, &reply);
+                     },
+                     response);
+}
+
+::grpc::Status
+GrpcRouterHandler::Insert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+                          ::milvus::grpc::VectorIds* response) {
+    return InsertToShards(context, request, response, false);
+}
+
+::grpc::Status
+GrpcRouterHandler::Upsert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+                          ::milvus::grpc::VectorIds* response) {
+    if (request->row_id_array().empty()) {
+        SetError(::milvus::grpc::ErrorCode::ILLEGAL_VECTOR_ID, "Upsert requires an ID for every vector.",
+                 response->mutable_status());
+        return ::grpc::Status::OK;
+    }
+    return InsertToShards(context, request, response, true);
+}
+
+::grpc::Status
+GrpcRouterHandler::InsertToShards(const ::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+                                  ::milvus::grpc::VectorIds* response, bool upsert) {
+    auto vec_count = static_cast<size_t>(request->row_record_array_size());
+    if (vec_count == 0) {
+        SetError(::milvus::grpc::ErrorCode::ILLEGAL_ROWRECORD,
+                 "The vector array is empty. Make sure you have entered vector records.", response->mutable_status());
+        return ::grpc::Status::OK;
+    }
+    if (!request->row_id_array().empty() && request->row_id_array_size() != request->row_record_array_size()) {
+        SetError(::milvus::grpc::ErrorCode::ILLEGAL_VECTOR_ID,
+                 "The size of vector ID array must be equal to the size of the vector.", response->mutable_status());
+        return ::grpc::Status::OK;
+    }
+    for (auto& column : request->attr_column_array()) {
+        auto int_count = static_cast<size_t>(column.int_value_array_size());
+        auto double_count = static_cast<size_t>(column.double_value_array_size());
+        if (!(int_count == vec_count && double_count == 0) && !(double_count == vec_count && int_count == 0)) {
+            SetError(::milvus::grpc::ErrorCode::ILLEGAL_ARGUMENT,
+                     "Attribute " + column.name() + " must have one value of its type for every vector",
+                     response->mutable_status());
+            return ::grpc::Status::OK;
+        }
+    }
+
+    // the router assigns the ids itself, they decide the shard of every vector; the old copy of an upserted
+    // vector is on the same shard as the new one
+    engine::IDNumbers vec_ids;
+    if (request->row_id_array().empty()) {
+        engine::SimpleIDGenerator id_generator;
+        id_generator.GetNextIDNumbers(vec_count, vec_ids);
+    } else {
+        vec_ids.assign(request->row_id_array().begin(), request->row_id_array().end());
+    }
+
+    std::vector<::milvus::grpc::InsertParam> params(shards_.size());
+    for (auto& param : params) {
+        param.set_table_name(request->table_name());
+        param.set_partition_tag(request->partition_tag());
+        for (auto& column : request->attr_column_array()) {
+            param.add_attr_column_array()->set_name(column.name());
+        }
+    }
+    for (size_t i = 0; i < vec_count; ++i) {
+        auto& param = params[ShardOf(vec_ids[i], shards_.size())];
+        *param.add_row_record_array() = request->row_record_array(i);
+        param.mutable_row_id_array()->Add(vec_ids[i]);
+        for (int c = 0; c < request->attr_column_array_size(); ++c) {
+            auto& column = request->attr_column_array(c);
+            auto shard_column = param.mutable_attr_column_array(c);
+            if (column.int_value_array_size() > 0) {
+                shard_column->add_int_value_array(column.int_value_array(i));
+            } else {
+                shard_column->add_double_value_array(column.double_value_array(i));
+            }
+        }
+    }
+
+    auto insert = [upsert](const ::milvus::grpc::InsertParam& param) {
+        return [&param, upsert](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::VectorIds& reply) {
+            return upsert ? stub.Upsert(&context, param, &reply) : stub.Insert(&context, param, &reply);
+        };
+    };
+    std::vector<::milvus::grpc::VectorIds> replies(shards_.size());
+    std::vector<std::future<::grpc::Status>> futures;
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        if (params[i].row_record_array().empty()) {
+            continue;
+        }
+        futures.emplace_back(std::async(std::launch::async, [&, i]() {
+            return CallShard<::milvus::grpc::VectorIds>(context, i, false, insert(params[i]), replies[i]);
+        }));
+    }
+    for (auto& future : futures) {
+        ::grpc::Status grpc_status = future.get();
+        if (!grpc_status.ok() && response->status().error_code() == ::milvus::grpc::ErrorCode::SUCCESS) {
+            SetShardError(grpc_status, response->mutable_status());
+        }
+    }
+    if (response->status().error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+        return ::grpc::Status::OK;
+    }
+    for (auto& reply : replies) {
+        if (reply.status().error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+            response->mutable_status()->CopyFrom(reply.status());
+            return ::grpc::Status::OK;
+        }
+    }
+
+    for (int64_t id : vec_ids) {
+        response->add_vector_id_array(id);
+    }
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::Search(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+                          ::milvus::grpc::TopKQueryResult* response) {
+    bool ascending = true;
+    ::milvus::grpc::Status status = GetTableAscending(context, request->table_name(), ascending);
+    if (status.error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+        response->mutable_status()->CopyFrom(status);
+        return ::grpc::Status::OK;
+    }
+
+    std::vector<::milvus::grpc::TopKQueryResult> replies;
+    ::grpc::Status grpc_status = CallShards<::milvus::grpc::TopKQueryResult>(
+        context, true,
+        [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::TopKQueryResult& reply) {
+            return stub.Search(&context, *request, &reply);
+        },
+        replies);
+    if (!grpc_status.ok()) {
+        SetShardError(grpc_status, response->mutable_status());
+        return ::grpc::Status::OK;
+    }
+
+    // merge the topk of every shard the way the search tasks of one server merge the topk of their files
+    auto nq = static_cast<size_t>(request->query_record_array_size());
+    auto topk = static_cast<size_t>(request->topk());
+    float pad_distance = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+    engine::ResultIds result_ids, src_ids;
+    engine::ResultDistances result_distances, src_distances;
+    for (auto& reply : replies) {
+        if (reply.status().error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+            response->mutable_status()->CopyFrom(reply.status());
+            return ::grpc::Status::OK;
+        }
+        if (reply.ids_size() == 0) {
+            continue;  // empty shard
+        }
+
+        auto src_k = static_cast<size_t>(reply.ids_size()) / nq;
+        if (reply.row_num() != nq || src_k * nq != reply.ids_size() || reply.distances_size() != reply.ids_size() ||
+            src_k > topk) {
+            SetError(::milvus::grpc::ErrorCode::ILLEGAL_SEARCH_RESULT, "Shard returned a malformed search result",
+                     response->mutable_status());
+            return ::grpc::Status::OK;
+        }
+
+        src_ids.assign(nq * topk, -1);
+        src_distances.assign(nq * topk, pad_distance);
+        for (size_t i = 0; i < nq; ++i) {
+            std::copy_n(reply.ids().begin() + i * src_k, src_k, src_ids.begin() + i * topk);
+            std::copy_n(reply.distances().begin() + i * src_k, src_k, src_distances.begin() + i * topk);
+        }
+        scheduler::XSearchTask::MergeTopkToResultSet(src_ids, src_distances, src_k, nq, topk, ascending, result_ids,
+                                                     result_distances);
+    }
+
+    if (result_ids.empty()) {
+        return ::grpc::Status::OK;  // empty table
+    }
+
+    response->set_row_num(nq);
+    response->add_ids(result_ids.begin(), result_ids.end());
+    response->add_distances(result_distances.begin(), result_distances.end());
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::SearchInFiles(::grpc::ServerContext* context, const ::milvus::grpc::SearchInFilesParam* request,
+                                 ::milvus::grpc::TopKQueryResult* response) {
+    SetError(::milvus::grpc::ErrorCode::UNEXPECTED_ERROR, "SearchInFiles is not supported by the router",
+             response->mutable_status());
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::DescribeTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                                 ::milvus::grpc::TableSchema* response) {
+    ::grpc::Status grpc_status = CallShard<::milvus::grpc::TableSchema>(
+        context, 0, true,
+        [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::TableSchema& reply) {
+            return stub.DescribeTable(&context, *request, &reply);
+        },
+        *response);
+    if (!grpc_status.ok()) {
+        SetShardError(grpc_status, response->mutable_status());
+    }
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::CountTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                              ::milvus::grpc::TableRowCount* response) {
+    std::vector<::milvus::grpc::TableRowCount> replies;
+    ::grpc::Status grpc_status = CallShards<::milvus::grpc::TableRowCount>(
+        context, true,
+        [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::TableRowCount& reply) {
+            return stub.CountTable(&context, *request, &reply);
+        },
+        replies);
+    if (!grpc_status.ok()) {
+        SetShardError(grpc_status, response->mutable_status());
+        return ::grpc::Status::OK;
+    }
+
+    int64_t row_count = 0;
+    for (auto& reply : replies) {
+        if (reply.status().error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+            response->mutable_status()->CopyFrom(reply.status());
+            return ::grpc::Status::OK;
+        }
+        row_count += reply.table_row_count();
+    }
+    response->set_table_row_count(row_count);
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::ShowTables(::grpc::ServerContext* context, const ::milvus::grpc::Command* request,
+                              ::milvus::grpc::TableNameList* response) {
+    ::grpc::Status grpc_status = CallShard<::milvus::grpc::TableNameList>(
+        context, 0, true,
+        [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::TableNameList& reply) {
+            return stub.ShowTables(&context, *request, &reply);
+        },
+        *response);
+    if (!grpc_status.ok()) {
+        SetShardError(grpc_status, response->mutable_status());
+    }
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::DeleteByRange(::grpc::ServerContext* context, const ::milvus::grpc::DeleteByRangeParam* request,
+                                 ::milvus::grpc::Status* response) {
+    return Broadcast(context, false,
+                     [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::Status& reply) {
+                         return stub.DeleteByRange(&context, *request, &reply);
+                     },
+                     response);
+}
+
+::grpc::Status
+GrpcRouterHandler::PreloadTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                                ::milvus::grpc::Status* response) {
+    // every replica serves searches, so every replica loads the table
+    return Broadcast(context, true,
+                     [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::Status& reply) {
+                         return stub.PreloadTable(&context, *request, &reply);
+                     },
+                     response);
+}
+
+::grpc::Status
+GrpcRouterHandler::DescribeIndex(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                                 ::milvus::grpc::IndexParam* response) {
+    ::grpc::Status grpc_status = CallShard<::milvus::grpc::IndexParam>(
+        context, 0, true,
+        [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::IndexParam& reply) {
+            return stub.DescribeIndex(&context, *request, &reply);
+        },
+        *response);
+    if (!grpc_status.ok()) {
+        SetShardError(grpc_status, response->mutable_status());
+    }
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::DropIndex(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                             ::milvus::grpc::Status* response) {
+    return Broadcast(context, false,
+                     [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::Status& reply) {
+                         return stub.DropIndex(&context, *request, &reply);
+                     },
+                     response);
+}
+
+::grpc::Status
+GrpcRouterHandler::GetVectorByID(::grpc::ServerContext* context, const ::milvus::grpc::VectorIdentity* request,
+                                 ::milvus::grpc::VectorData* response) {
+    ::grpc::Status grpc_status = CallShard<::milvus::grpc::VectorData>(
+        context, ShardOf(request->id(), shards_.size()), true,
+        [request](ShardStub& stub, ::grpc::ClientContext& context, ::milvus::grpc::VectorData& reply) {
+            return stub.GetVectorByID(&context, *request, &reply);
+        },
+        *response);
+    if (!grpc_status.ok()) {
+        SetShardError(grpc_status, response->mutable_status());
+    }
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRouterHandler::SearchByID(::grpc::ServerContext* context, const ::milvus::grpc::SearchByIDParam* request,
+                              ::milvus::grpc::TopKQueryResult* response) {
+    ::milvus::grpc::VectorIdentity identity;
+    identity.set_table_name(request->table_name());
+    identity.set_id(request->id());
+    ::milvus::grpc::VectorData vector_data;
+    GetVectorByID(context, &identity, &vector_data);
+    if (vector_data.status().error_code() != ::milvus::grpc::ErrorCode::SUCCESS) {
+        response->mutable_status()->CopyFrom(vector_data.status());
+        return ::grpc::Status::OK;
+    }
+
+    ::milvus::grpc::SearchParam search_param;
+    search_param.set_table_name(request->table_name());
+    search_param.add_query_record_array()->Swap(vector_data.mutable_vector_data());
+    search_param.mutable_query_range_array()->CopyFrom(request->query_range_array());
+    search_param.set_topk(request->topk());
+    search_param.set_nprobe(request->nprobe());
+    return Search(context, &search_param, response);
+}
+
+}  // namespace grpc
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "server/grpc_impl/GrpcRequestHandler.h"
+#include "utils/Status.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace milvus {
+namespace server {
+namespace grpc {
+
+using ShardStub = ::milvus::grpc::MilvusService::Stub;
+
+// Serves the milvus rpc by routing every request to a set of shards, each shard is another milvus process
+// (or several processes sharing one storage: the first replica is writable, the others are readonly).
+// Vectors are hash-partitioned to shards by ID, searches are scattered to every shard in parallel and the topk
+// results are merged. A shard read that has not answered after hedge_delay is resent to the next replica of the
+// shard, every shard request has a deadline of shard_timeout, or the earlier deadline of the client.
+class GrpcRouterHandler : public GrpcRequestHandler {
+ public:
+    using ShardMap = std::vector<std::vector<std::string>>;
+
+    GrpcRouterHandler(const ShardMap& shards, int64_t shard_timeout_ms, int64_t hedge_delay_ms);
+
+    // index of the shard owning a vector id
+    static size_t
+    ShardOf(int64_t id, size_t shard_count);
+
+    ::grpc::Status
+    CreateTable(::grpc::ServerContext* context, const ::milvus::grpc::TableSchema* request,
+                ::milvus::grpc::Status* response) override;
+
+    ::grpc::Status
+    HasTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+             ::milvus::grpc::BoolReply* response) override;
+
+    ::grpc::Status
+    DropTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+              ::milvus::grpc::Status* response) override;
+
+    ::grpc::Status
+    CreateIndex(::grpc::ServerContext* context, const ::milvus::grpc::IndexParam* request,
+                ::milvus::grpc::Status* response) override;
+
+    ::grpc::Status
+    Insert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+           ::milvus::grpc::VectorIds* response) override;
+
+    ::grpc::Status
+    Upsert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+           ::milvus::grpc::VectorIds* response) override;
+
+    ::grpc::Status
+    Search(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+           ::milvus::grpc::TopKQueryResult* response) override;
+
+    // file ids are local to a shard, not supported by the router
+    ::grpc::Status
+    SearchInFiles(::grpc::ServerContext* context, const ::milvus::grpc::SearchInFilesParam* request,
+                  ::milvus::grpc::TopKQueryResult* response) override;
+
+    ::grpc::Status
+    DescribeTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                  ::milvus::grpc::TableSchema* response) override;
+
+    ::grpc::Status
+    CountTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+               ::milvus::grpc::TableRowCount* response) override;
+
+    ::grpc::Status
+    ShowTables(::grpc::ServerContext* context, const ::milvus::grpc::Command* request,
+               ::milvus::grpc::TableNameList* response) override;
+
+    ::grpc::Status
+    DeleteByRange(::grpc::ServerContext* context, const ::milvus::grpc::DeleteByRangeParam* request,
+                  ::milvus::grpc::Status* response) override;
+
+    ::grpc::Status
+    PreloadTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                 ::milvus::grpc::Status* response) override;
+
+    ::grpc::Status
+    DescribeIndex(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                  ::milvus::grpc::IndexParam* response) override;
+
+    ::grpc::Status
+    DropIndex(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+              ::milvus::grpc::Status* response) override;
+
+    // read from the shard owning the id
+    ::grpc::Status
+    GetVectorByID(::grpc::ServerContext* context, const ::milvus::grpc::VectorIdentity* request,
+                  ::milvus::grpc::VectorData* response) override;
+
+    // fetch the vector from its shard, then scatter a search with it to every shard
+    ::grpc::Status
+    SearchByID(::grpc::ServerContext* context, const ::milvus::grpc::SearchByIDParam* request,
+               ::milvus::grpc::TopKQueryResult* response) override;
+
+ private:
+    ::grpc::Status
+    InsertToShards(const ::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+                   ::milvus::grpc::VectorIds* response, bool upsert);
+
+    template <typename Reply>
+    using ShardCall = std::function<::grpc::Status(ShardStub&, ::grpc::ClientContext&, Reply&)>;
+
+    // call one shard, a read is hedged and retried over the replicas, a write only goes to the first replica
+    template <typename Reply>
+    ::grpc::Status
+    CallShard(const ::grpc::ServerContext* context, size_t shard, bool read, const ShardCall<Reply>& call,
+              Reply& reply);
+
+    // call every shard in parallel, replies[i] is the reply of shard i
+    template <typename Reply>
+    ::grpc::Status
+    CallShards(const ::grpc::ServerContext* context, bool read, const ShardCall<Reply>& call,
+               std::vector<Reply>& replies);
+
+    // send a ddl request to the writable replica of every shard, or to every replica if all_replicas is set
+    ::grpc::Status
+    Broadcast(const ::grpc::ServerContext* context, bool all_replicas, const ShardCall<::milvus::grpc::Status>& call,
+              ::milvus::grpc::Status* response);
+
+    ::milvus::grpc::Status
+    GetTableAscending(const ::grpc::ServerContext* context, const std::string& table_name, bool& ascending);
+
+    // deadline of a shard request made for the client request of context
+    std::chrono::system_clock::time_point
+    ShardDeadline(const ::grpc::ServerContext* context) const;
+
+ private:
+    std::vector<std::vector<std::unique_ptr<ShardStub>>> shards_;
+    int64_t shard_timeout_ms_;
+    int64_t hedge_delay_ms_;
+    std::atomic<uint64_t> next_replica_{0};
+
+    // whether a smaller distance is a better result, cached per table to save a DescribeTable per search
+    std::mutex ascending_mutex_;
+    std::unordered_map<std::string, bool> table_ascending_;
+};
+
+}  // namespace grpc
+}  // namespace server
+}  // namespace milvus
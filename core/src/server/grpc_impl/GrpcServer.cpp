@@ -17,6 +17,7 @@
 
 #include "server/grpc_impl/GrpcServer.h"
 #include "GrpcRequestHandler.h"
+#include "GrpcRouterHandler.h"
 #include "grpc/gen-milvus/milvus.grpc.pb.h"
 #include "server/Config.h"
 #include "server/DBWrapper.h"
@@ -95,10 +96,32 @@ GrpcServer::StartService() {
     builder.SetDefaultCompressionAlgorithm(GRPC_COMPRESS_STREAM_GZIP);
     builder.SetDefaultCompressionLevel(GRPC_COMPRESS_LEVEL_NONE);
 
-    GrpcRequestHandler service;
+    // with a shard map the server routes every request to the shards instead of serving the local db
+    GrpcRouterHandler::ShardMap shards;
+    s = config.GetServerConfigShards(shards);
+    if (!s.ok()) {
+        return s;
+    }
+
+    std::unique_ptr<GrpcRequestHandler> service;
+    if (shards.empty()) {
+        service = std::make_unique<GrpcRequestHandler>();
+    } else {
+        int64_t shard_timeout, hedge_delay;
+        s = config.GetServerConfigShardTimeout(shard_timeout);
+        if (!s.ok()) {
+            return s;
+        }
+        s = config.GetServerConfigHedgeDelay(hedge_delay);
+        if (!s.ok()) {
+            return s;
+        }
+        SERVER_LOG_INFO << "Routing requests to " << shards.size() << " shards";
+        service = std::make_unique<GrpcRouterHandler>(shards, shard_timeout, hedge_delay);
+    }
 
     builder.AddListeningPort(server_address, ::grpc::InsecureServerCredentials());
-    builder.RegisterService(&service);
+    builder.RegisterService(service.get());
 
     server_ptr_ = builder.BuildAndStart();
     server_ptr_->Wait();
@@ -0,0 +1,251 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "utils/FileIO.h"
+#include "server/Config.h"
+#include "utils/Error.h"
+#include "utils/Log.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <list>
+
+namespace milvus {
+namespace server {
+
+namespace {
+
+constexpr uint64_t IO_ALIGNMENT = 4096;
+constexpr uint64_t MB = 1024 * 1024;
+
+// buffers smaller than this are copied together and written as one request
+constexpr uint64_t SMALL_BUFFER_SIZE = 64 * 1024;
+
+uint64_t
+AlignUp(uint64_t value) {
+    return (value + IO_ALIGNMENT - 1) / IO_ALIGNMENT * IO_ALIGNMENT;
+}
+
+Status
+ErrnoStatus(ErrorCode code, const std::string& action, const std::string& path) {
+    return Status(code, action + " " + path + " failed: " + strerror(errno));
+}
+
+// required bytes must be transferred, a read may stop early at end of file after that
+Status
+TransferChunk(int fd, void* data, uint64_t size, uint64_t offset, uint64_t required, bool write) {
+    uint64_t done = 0;
+    while (done < required) {
+        ssize_t ret = write ? pwrite(fd, static_cast<char*>(data) + done, size - done, offset + done)
+                            : pread(fd, static_cast<char*>(data) + done, size - done, offset + done);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return Status(write ? SERVER_WRITE_ERROR : SERVER_UNEXPECTED_ERROR, strerror(errno));
+        }
+        if (ret == 0) {
+            return Status(SERVER_UNEXPECTED_ERROR, "Unexpected end of file");
+        }
+        done += ret;
+    }
+    return Status::OK();
+}
+
+}  // namespace
+
+FileIO&
+FileIO::GetInstance() {
+    static std::unique_ptr<FileIO> instance = [] {
+        int32_t thread_num = 4;
+        int64_t chunk_size = 16;
+        bool direct_io = false;
+        Config& config = Config::GetInstance();
+        Status s = config.GetEngineConfigIoThreadNum(thread_num);
+        if (!s.ok()) {
+            SERVER_LOG_ERROR << s.message();
+        }
+        s = config.GetEngineConfigIoChunkSize(chunk_size);
+        if (!s.ok()) {
+            SERVER_LOG_ERROR << s.message();
+        }
+        s = config.GetEngineConfigUseDirectIo(direct_io);
+        if (!s.ok()) {
+            SERVER_LOG_ERROR << s.message();
+        }
+        return std::unique_ptr<FileIO>(new FileIO(thread_num, chunk_size * MB, direct_io));
+    }();
+    return *instance;
+}
+
+FileIO::FileIO(int32_t thread_num, uint64_t chunk_size, bool direct_io)
+    : chunk_size_(std::max(AlignUp(chunk_size), IO_ALIGNMENT)),
+      direct_io_(direct_io),
+      io_pool_(std::min(std::max(thread_num, 1), MAX_THREADS_NUM)) {
+}
+
+Status
+FileIO::RunChunks(int fd, const std::vector<Chunk>& chunks, bool write) {
+    std::vector<std::future<Status>> futures;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        auto& chunk = chunks[i];
+        futures.emplace_back(
+            io_pool_.enqueue(TransferChunk, fd, chunk.data_, chunk.size_, chunk.offset_, chunk.required_, write));
+    }
+
+    Status status;
+    if (!chunks.empty()) {
+        auto& chunk = chunks[0];
+        status = TransferChunk(fd, chunk.data_, chunk.size_, chunk.offset_, chunk.required_, write);
+    }
+
+    for (auto& future : futures) {
+        auto s = future.get();
+        if (!s.ok() && status.ok()) {
+            status = s;
+        }
+    }
+    return status;
+}
+
+Status
+FileIO::Read(const std::string& path, void* buffer, uint64_t size, uint64_t offset) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return ErrnoStatus(SERVER_FILE_NOT_FOUND, "Open", path);
+    }
+
+    std::vector<Chunk> chunks;
+    for (uint64_t pos = 0; pos < size; pos += chunk_size_) {
+        uint64_t length = std::min(chunk_size_, size - pos);
+        chunks.push_back(Chunk{static_cast<char*>(buffer) + pos, length, offset + pos, length});
+    }
+
+    auto status = RunChunks(fd, chunks, false);
+    close(fd);
+    if (!status.ok()) {
+        return Status(status.code(), "Read " + path + " failed: " + status.message());
+    }
+    return Status::OK();
+}
+
+Status
+FileIO::ReadFile(const std::string& path, std::shared_ptr<uint8_t>& buffer, uint64_t& size) {
+    bool direct_io = direct_io_;
+    int fd = open(path.c_str(), direct_io ? (O_RDONLY | O_DIRECT) : O_RDONLY);
+    if (fd < 0 && direct_io) {
+        // some file systems, tmpfs for example, do not support O_DIRECT
+        direct_io = false;
+        fd = open(path.c_str(), O_RDONLY);
+    }
+    if (fd < 0) {
+        return ErrnoStatus(SERVER_FILE_NOT_FOUND, "Open", path);
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        auto status = ErrnoStatus(SERVER_UNEXPECTED_ERROR, "Stat", path);
+        close(fd);
+        return status;
+    }
+    size = static_cast<uint64_t>(file_stat.st_size);
+
+    // O_DIRECT needs aligned buffer, offset and length, so the last chunk is read with an aligned length
+    void* data = nullptr;
+    if (posix_memalign(&data, IO_ALIGNMENT, std::max(AlignUp(size), IO_ALIGNMENT)) != 0) {
+        close(fd);
+        return Status(SERVER_UNEXPECTED_ERROR, "Failed to allocate " + std::to_string(size) + " bytes for " + path);
+    }
+    buffer = std::shared_ptr<uint8_t>(static_cast<uint8_t*>(data), free);
+
+    std::vector<Chunk> chunks;
+    for (uint64_t pos = 0; pos < size; pos += chunk_size_) {
+        uint64_t length = std::min(chunk_size_, size - pos);
+        chunks.push_back(Chunk{buffer.get() + pos, direct_io ? AlignUp(length) : length, pos, length});
+    }
+
+    auto status = RunChunks(fd, chunks, false);
+    close(fd);
+    if (!status.ok() && direct_io) {
+        SERVER_LOG_WARNING << "Direct read " << path << " failed: " << status.message() << ", retry buffered read";
+        return Read(path, buffer.get(), size, 0);
+    }
+    if (!status.ok()) {
+        return Status(status.code(), "Read " + path + " failed: " + status.message());
+    }
+    return Status::OK();
+}
+
+Status
+FileIO::WriteFile(const std::string& path, const std::vector<IOBuffer>& buffers, bool sync) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        return ErrnoStatus(SERVER_CANNOT_CREATE_FILE, "Create", path);
+    }
+
+    std::list<std::vector<uint8_t>> staging;
+    std::vector<Chunk> chunks;
+    uint64_t offset = 0;
+    uint64_t staging_offset = 0;
+    auto flush_staging = [&]() {
+        if (!staging.empty() && !staging.back().empty()) {
+            auto& staged = staging.back();
+            chunks.push_back(Chunk{staged.data(), staged.size(), staging_offset, staged.size()});
+            staging.emplace_back();
+        }
+    };
+
+    staging.emplace_back();
+    for (auto& buffer : buffers) {
+        auto data = static_cast<const uint8_t*>(buffer.data_);
+        if (buffer.size_ < SMALL_BUFFER_SIZE) {
+            auto& staged = staging.back();
+            if (staged.empty()) {
+                staging_offset = offset;
+            }
+            staged.insert(staged.end(), data, data + buffer.size_);
+        } else {
+            flush_staging();
+            for (uint64_t pos = 0; pos < buffer.size_; pos += chunk_size_) {
+                uint64_t length = std::min(chunk_size_, buffer.size_ - pos);
+                chunks.push_back(Chunk{const_cast<uint8_t*>(data) + pos, length, offset + pos, length});
+            }
+        }
+        offset += buffer.size_;
+    }
+    flush_staging();
+
+    auto status = RunChunks(fd, chunks, true);
+    if (status.ok() && sync && fdatasync(fd) != 0) {
+        status = Status(SERVER_WRITE_ERROR, strerror(errno));
+    }
+    close(fd);
+
+    if (!status.ok()) {
+        return Status(status.code(), "Write " + path + " failed: " + status.message());
+    }
+    return Status::OK();
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "utils/Status.h"
+#include "utils/ThreadPool.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace server {
+
+struct IOBuffer {
+    const void* data_ = nullptr;
+    uint64_t size_ = 0;
+};
+
+// Reads and writes a single file with several pread/pwrite requests in flight,
+// so one large index file can use the full bandwidth of the disk
+class FileIO {
+ public:
+    static FileIO&
+    GetInstance();
+
+    FileIO(int32_t thread_num, uint64_t chunk_size, bool direct_io);
+
+    // read [offset, offset + size) of the file into buffer
+    Status
+    Read(const std::string& path, void* buffer, uint64_t size, uint64_t offset = 0);
+
+    // read the whole file into a page aligned buffer, O_DIRECT is used when enabled
+    Status
+    ReadFile(const std::string& path, std::shared_ptr<uint8_t>& buffer, uint64_t& size);
+
+    // write buffers back to back into the file, sync issues one fdatasync after all chunks are written
+    Status
+    WriteFile(const std::string& path, const std::vector<IOBuffer>& buffers, bool sync = false);
+
+    uint64_t
+    chunk_size() const {
+        return chunk_size_;
+    }
+
+ private:
+    struct Chunk {
+        void* data_;
+        uint64_t size_;
+        uint64_t offset_;
+        uint64_t required_;
+    };
+
+    // run chunks on the io pool, the calling thread takes the first chunk
+    Status
+    RunChunks(int fd, const std::vector<Chunk>& chunks, bool write);
+
+ private:
+    uint64_t chunk_size_;
+    bool direct_io_;
+    ThreadPool io_pool_;
+};
+
+}  // namespace server
+}  // namespace milvus
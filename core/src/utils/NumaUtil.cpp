@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "utils/NumaUtil.h"
+#include "utils/Log.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+
+namespace milvus {
+namespace server {
+
+namespace {
+
+constexpr const char* NUMA_NODE_PATH = "/sys/devices/system/node/node";
+
+std::vector<std::vector<int64_t>>
+LoadTopology() {
+    std::vector<std::vector<int64_t>> topology;
+    for (int64_t node = 0;; ++node) {
+        std::ifstream file(NUMA_NODE_PATH + std::to_string(node) + "/cpulist");
+        if (!file.is_open()) {
+            break;
+        }
+        std::string cpu_list;
+        std::getline(file, cpu_list);
+        topology.push_back(NumaUtil::ParseCpuList(cpu_list));
+    }
+
+    if (topology.empty()) {
+        std::vector<int64_t> cpus;
+        int64_t cpu_num = sysconf(_SC_NPROCESSORS_ONLN);
+        for (int64_t i = 0; i < cpu_num; ++i) {
+            cpus.push_back(i);
+        }
+        topology.emplace_back(std::move(cpus));
+    }
+    return topology;
+}
+
+const std::vector<std::vector<int64_t>>&
+Topology() {
+    static const std::vector<std::vector<int64_t>> topology = LoadTopology();
+    return topology;
+}
+
+}  // namespace
+
+int64_t
+NumaUtil::NodeCount() {
+    return Topology().size();
+}
+
+const std::vector<int64_t>&
+NumaUtil::NodeCpus(int64_t node) {
+    auto& topology = Topology();
+    return topology[node % topology.size()];
+}
+
+Status
+NumaUtil::BindCurrentThread(int64_t node) {
+    auto& cpus = NodeCpus(node);
+    if (cpus.empty()) {
+        return Status(SERVER_UNEXPECTED_ERROR, "numa node " + std::to_string(node) + " has no cpu");
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto cpu : cpus) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret != 0) {
+        std::string msg = "Failed to bind thread to numa node " + std::to_string(node) + ", errno " +
+                          std::to_string(ret);
+        SERVER_LOG_WARNING << msg;
+        return Status(SERVER_UNEXPECTED_ERROR, msg);
+    }
+    return Status::OK();
+}
+
+int64_t
+NumaUtil::HomeNode(const std::string& key, int64_t node_count) {
+    if (node_count <= 1) {
+        return 0;
+    }
+    // FNV-1a, std::hash is not guaranteed to be stable across builds
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash % node_count;
+}
+
+std::vector<int64_t>
+NumaUtil::ParseCpuList(const std::string& cpu_list) {
+    std::vector<int64_t> cpus;
+    std::stringstream stream(cpu_list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty()) {
+            continue;
+        }
+        try {
+            auto dash = range.find('-');
+            int64_t first = std::stol(range.substr(0, dash));
+            int64_t last = (dash == std::string::npos) ? first : std::stol(range.substr(dash + 1));
+            for (int64_t cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        } catch (std::exception& ex) {
+            SERVER_LOG_WARNING << "Invalid cpu list: " << cpu_list;
+            break;
+        }
+    }
+    return cpus;
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "utils/Status.h"
+
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace server {
+
+// NUMA topology read from /sys/devices/system/node, no libnuma needed.
+// Machines without the sysfs tree are reported as a single node holding every cpu.
+class NumaUtil {
+ public:
+    static int64_t
+    NodeCount();
+
+    static const std::vector<int64_t>&
+    NodeCpus(int64_t node);
+
+    // pin the calling thread to the cpus of the node, memory it touches first is then allocated on that node
+    static Status
+    BindCurrentThread(int64_t node);
+
+    // node a key (e.g. an index file location) is homed on, stable across restarts
+    static int64_t
+    HomeNode(const std::string& key, int64_t node_count);
+
+    // "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}
+    static std::vector<int64_t>
+    ParseCpuList(const std::string& cpu_list);
+};
+
+}  // namespace server
+}  // namespace milvus
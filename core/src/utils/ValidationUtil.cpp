@@ -71,6 +71,31 @@ ValidationUtil::ValidateTableName(const std::string& table_name) {
     return Status::OK();
 }
 
+Status
+ValidationUtil::ValidatePartitionTag(const std::string& partition_tag) {
+    // empty tag is the default partition
+    if (partition_tag.empty()) {
+        return Status::OK();
+    }
+
+    std::string invalid_msg = "Invalid partition tag: " + partition_tag + ". ";
+    if (partition_tag.size() > TABLE_NAME_SIZE_LIMIT) {
+        std::string msg = invalid_msg + "The length of a partition tag must be less than 255 characters.";
+        SERVER_LOG_ERROR << msg;
+        return Status(SERVER_INVALID_PARTITION_TAG, msg);
+    }
+
+    for (char tag_char : partition_tag) {
+        if (tag_char != '_' && tag_char != '-' && std::isalnum(tag_char) == 0) {
+            std::string msg = invalid_msg + "Partition tag can only contain numbers, letters, '-' and underscores.";
+            SERVER_LOG_ERROR << msg;
+            return Status(SERVER_INVALID_PARTITION_TAG, msg);
+        }
+    }
+
+    return Status::OK();
+}
+
 Status
 ValidationUtil::ValidateTableDimension(int64_t dimension) {
     if (dimension <= 0 || dimension > TABLE_DIMENSION_LIMIT) {
@@ -142,6 +167,21 @@ ValidationUtil::ValidateTableIndexMetricType(int32_t metric_type) {
     return Status::OK();
 }
 
+Status
+ValidationUtil::ValidateIndexMetricType(int32_t index_type, int32_t metric_type) {
+    // graph indexes are only built for L2, an IP table would fail in the background build
+    auto engine_type = static_cast<engine::EngineType>(index_type);
+    if (metric_type == static_cast<int32_t>(engine::MetricType::IP) &&
+        (engine_type == engine::EngineType::NSG_MIX || engine_type == engine::EngineType::SPTAG_KDT ||
+         engine_type == engine::EngineType::SPTAG_BKT)) {
+        std::string msg = "Index type " + std::to_string(index_type) + " does not support metric type " +
+                          std::to_string(metric_type) + ". Use MetricType.L2 for this index type.";
+        SERVER_LOG_ERROR << msg;
+        return Status(SERVER_INVALID_INDEX_METRIC_TYPE, msg);
+    }
+    return Status::OK();
+}
+
 Status
 ValidationUtil::ValidateSearchTopk(int64_t top_k, const engine::meta::TableSchema& table_schema) {
     if (top_k <= 0 || top_k > 2048) {
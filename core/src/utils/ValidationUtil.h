@@ -33,6 +33,9 @@ class ValidationUtil {
     static Status
     ValidateTableName(const std::string& table_name);
 
+    static Status
+    ValidatePartitionTag(const std::string& partition_tag);
+
     static Status
     ValidateTableDimension(int64_t dimension);
 
@@ -48,6 +51,9 @@ class ValidationUtil {
     static Status
     ValidateTableIndexMetricType(int32_t metric_type);
 
+    static Status
+    ValidateIndexMetricType(int32_t index_type, int32_t metric_type);
+
     static Status
     ValidateSearchTopk(int64_t top_k, const engine::meta::TableSchema& table_schema);
 
@@ -17,6 +17,7 @@
 
 #include "wrapper/ConfAdapter.h"
 #include "knowhere/index/vector_index/helpers/IndexParameter.h"
+#include "server/Config.h"
 #include "utils/Log.h"
 
 #include <cmath>
@@ -128,6 +129,8 @@ IVFPQConfAdapter::Match(const TempMetaConf& metaconf) {
     return conf;
 }
 
+static constexpr int64_t MB = 1024 * 1024;
+
 knowhere::Config
 NSGConfAdapter::Match(const TempMetaConf& metaconf) {
     auto conf = std::make_shared<knowhere::NSGCfg>();
@@ -143,8 +146,14 @@ NSGConfAdapter::Match(const TempMetaConf& metaconf) {
     conf->search_length = 40 + 5 * scale_factor;
     conf->out_degree = 50 + 5 * scale_factor;
     conf->candidate_pool_size = 200 + 100 * scale_factor;
+    conf->reorder = false;  // opt in, the gain depends on the data and was within noise on synthetic sets
     MatchBase(conf);
 
+    int64_t build_memory_cap = 0;
+    if (server::Config::GetInstance().GetEngineConfigNsgBuildMemoryCap(build_memory_cap).ok()) {
+        conf->build_memory_cap = build_memory_cap * MB;
+    }
+
     //    WRAPPER_LOG_DEBUG << "nlist: " << conf->nlist
     //    << ", gpu_id: " << conf->gpu_id << ", d: " << conf->d
     //    << ", nprobe: " << conf->nprobe << ", knng: " << conf->knng;
@@ -159,5 +168,40 @@ NSGConfAdapter::MatchSearch(const TempMetaConf& metaconf, const IndexType& type)
     return conf;
 }
 
+// the neighborhood graph of both sptag indexes, wider and checked longer for higher dimensions as nsg
+template <typename T>
+void
+MatchSPTAGGraph(const TempMetaConf& metaconf, T& conf) {
+    auto scale_factor = round(metaconf.dim / 128.0);
+    scale_factor = scale_factor >= 4 ? 4 : scale_factor;
+    conf->tptnumber = 1;
+    conf->neighborhood_size = 32 + 8 * scale_factor;
+    conf->max_check = 8192 + 2048 * scale_factor;
+}
+
+knowhere::Config
+SPTAGKDTConfAdapter::Match(const TempMetaConf& metaconf) {
+    auto conf = std::make_shared<knowhere::KDTCfg>();
+    conf->d = metaconf.dim;
+    conf->metric_type = metaconf.metric_type;
+    conf->kdtnumber = 1;
+    MatchSPTAGGraph(metaconf, conf);
+    MatchBase(conf);
+    return conf;
+}
+
+knowhere::Config
+SPTAGBKTConfAdapter::Match(const TempMetaConf& metaconf) {
+    auto conf = std::make_shared<knowhere::BKTCfg>();
+    conf->d = metaconf.dim;
+    conf->metric_type = metaconf.metric_type;
+    conf->bktnumber = 1;
+    conf->bkt_kmeans_k = 32;
+    conf->bkt_leaf_size = 8;
+    MatchSPTAGGraph(metaconf, conf);
+    MatchBase(conf);
+    return conf;
+}
+
 }  // namespace engine
 }  // namespace milvus
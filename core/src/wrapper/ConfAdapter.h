@@ -90,5 +90,17 @@ class NSGConfAdapter : public IVFConfAdapter {
     MatchSearch(const TempMetaConf& metaconf, const IndexType& type) final;
 };
 
+class SPTAGKDTConfAdapter : public ConfAdapter {
+ public:
+    knowhere::Config
+    Match(const TempMetaConf& metaconf) override;
+};
+
+class SPTAGBKTConfAdapter : public ConfAdapter {
+ public:
+    knowhere::Config
+    Match(const TempMetaConf& metaconf) override;
+};
+
 }  // namespace engine
 }  // namespace milvus
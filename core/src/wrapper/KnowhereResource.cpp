@@ -16,6 +16,7 @@
 // under the License.
 
 #include "wrapper/KnowhereResource.h"
+#include "knowhere/common/HugePage.h"
 #include "knowhere/index/vector_index/helpers/FaissGpuResourceMgr.h"
 #include "server/Config.h"
 
@@ -41,9 +42,24 @@ KnowhereResource::Initialize() {
     GpuResourcesArray gpu_resources;
     Status s;
 
-    // get build index gpu resource
     server::Config& config = server::Config::GetInstance();
 
+    // huge pages for index data
+    std::string huge_page;
+    s = config.GetEngineConfigHugePage(huge_page);
+    if (!s.ok())
+        return s;
+
+    if (huge_page == "madvise") {
+        knowhere::SetHugePageMode(knowhere::HugePageMode::MADVISE);
+    } else if (huge_page == "hugetlb") {
+        knowhere::SetHugePageMode(knowhere::HugePageMode::HUGETLB);
+    } else {
+        knowhere::SetHugePageMode(knowhere::HugePageMode::OFF);
+    }
+
+    // get build index gpu resource
+
     int32_t build_index_gpu;
     s = config.GetResourceConfigIndexBuildDevice(build_index_gpu);
     if (!s.ok())
@@ -20,10 +20,17 @@
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/IndexGPUIVF.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
+#include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexIVFSQHybrid.h"
+#include "knowhere/index/vector_index/IndexNSG.h"
 #include "knowhere/index/vector_index/helpers/Cloner.h"
 #include "utils/Log.h"
 
+#include <sys/stat.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
 /*
  * no parameter check in this layer.
  * only responsible for index combination
@@ -115,6 +122,111 @@ VecIndexImpl::Search(const int64_t& nq, const float* xq, float* dist, int64_t* i
     return Status::OK();
 }
 
+Status
+VecIndexImpl::Merge(const VecIndexPtr& other) {
+    auto other_impl = std::dynamic_pointer_cast<VecIndexImpl>(other);
+    if (other_impl == nullptr) {
+        return Status(KNOWHERE_INVALID_ARGUMENT, "Merge source is not a knowhere index");
+    }
+
+    // lists of gpu indexes live on the device, only cpu ivf indexes are merged in place
+    auto ivf = std::dynamic_pointer_cast<knowhere::IVF>(index_);
+    auto other_ivf = std::dynamic_pointer_cast<knowhere::IVF>(other_impl->index_);
+    if (ivf == nullptr || other_ivf == nullptr || std::dynamic_pointer_cast<knowhere::GPUIndex>(index_) != nullptr ||
+        std::dynamic_pointer_cast<knowhere::GPUIndex>(other_impl->index_) != nullptr) {
+        return Status(KNOWHERE_ERROR, "Merge only supports cpu ivf indexes");
+    }
+
+    try {
+        ivf->Merge(*other_ivf);
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
+Status
+VecIndexImpl::Delete(const int64_t& n, const int64_t* ids) {
+    // only graphs support lazy deletion, they are consolidated on serialize
+    auto nsg = std::dynamic_pointer_cast<knowhere::NSG>(index_);
+    if (nsg == nullptr) {
+        return Status(KNOWHERE_ERROR, "Delete only supports nsg indexes");
+    }
+
+    try {
+        nsg->Delete(ids, n);
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
+Status
+VecIndexImpl::GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots) {
+    auto nsg = std::dynamic_pointer_cast<knowhere::NSG>(index_);
+    auto ivf = std::dynamic_pointer_cast<knowhere::IVF>(index_);
+    if (nsg == nullptr && (ivf == nullptr || std::dynamic_pointer_cast<knowhere::GPUIndex>(index_) != nullptr)) {
+        return Status(KNOWHERE_ERROR, "GetIds only supports cpu ivf and nsg indexes");
+    }
+
+    try {
+        if (nsg != nullptr) {
+            nsg->GetIds(ids, slots);
+        } else {
+            ivf->GetIds(ids, slots);
+        }
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
+Status
+VecIndexImpl::Reconstruct(int64_t slot, float* vector) {
+    auto nsg = std::dynamic_pointer_cast<knowhere::NSG>(index_);
+    auto ivf = std::dynamic_pointer_cast<knowhere::IVF>(index_);
+    if (nsg == nullptr && (ivf == nullptr || std::dynamic_pointer_cast<knowhere::GPUIndex>(index_) != nullptr)) {
+        return Status(KNOWHERE_ERROR, "Reconstruct only supports cpu ivf and nsg indexes");
+    }
+
+    try {
+        if (nsg != nullptr) {
+            nsg->Reconstruct(slot, vector);
+        } else {
+            ivf->Reconstruct(slot, vector);
+        }
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
+int64_t
+VecIndexImpl::Size() {
+    // graphs keep visited lists for concurrent searches, charge them to the cache as well
+    auto nsg = std::dynamic_pointer_cast<knowhere::NSG>(index_);
+    if (nsg != nullptr) {
+        return VecIndex::Size() + nsg->SearchScratchBytes();
+    }
+    return VecIndex::Size();
+}
+
 knowhere::BinarySet
 VecIndexImpl::Serialize() {
     type = ConvertToCpuIndexType(type);
@@ -128,6 +240,35 @@ VecIndexImpl::Load(const knowhere::BinarySet& index_binary) {
     return Status::OK();
 }
 
+Status
+VecIndexImpl::LoadMapped(const std::string& location, int64_t offset) {
+    auto ivf = std::dynamic_pointer_cast<knowhere::IVF>(index_);
+    if (ivf == nullptr || std::dynamic_pointer_cast<knowhere::GPUIndex>(index_) != nullptr) {
+        return Status(KNOWHERE_ERROR, "LoadMapped only supports cpu ivf indexes");
+    }
+
+    struct stat file_stat;
+    if (stat(location.c_str(), &file_stat) != 0) {
+        return Status(KNOWHERE_INVALID_ARGUMENT, "Failed to stat index file: " + location);
+    }
+
+    try {
+        ivf->LoadMapped(location, offset);
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    dim = Dimension();
+
+    // the cache is charged with what is resident now: everything but the mapped lists, plus the list pages
+    // the OS already holds; lists paged in later belong to the page cache, which evicts them itself
+    set_size(file_stat.st_size - ivf->MappedSize() + ivf->ResidentSize());
+    return Status::OK();
+}
+
 int64_t
 VecIndexImpl::Dimension() {
     return index_->Dimension();
@@ -192,6 +333,30 @@ BFIndex::GetRawIds() {
     return std::static_pointer_cast<knowhere::IDMAP>(index_)->GetRawIds();
 }
 
+Status
+BFIndex::GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots) {
+    // raw vectors are stored in insertion order, the row is the position
+    auto raw_ids = GetRawIds();
+    auto count = Count();
+    ids.assign(raw_ids, raw_ids + count);
+    slots.resize(count);
+    for (int64_t i = 0; i < count; ++i) {
+        slots[i] = i;
+    }
+    return Status::OK();
+}
+
+Status
+BFIndex::Reconstruct(int64_t slot, float* vector) {
+    if (slot < 0 || slot >= Count()) {
+        return Status(KNOWHERE_INVALID_ARGUMENT, "slot out of range");
+    }
+    auto d = Dimension();
+    auto raw_vectors = GetRawVectors();
+    std::copy(raw_vectors + slot * d, raw_vectors + (slot + 1) * d, vector);
+    return Status::OK();
+}
+
 ErrorCode
 BFIndex::Build(const Config& cfg) {
     try {
@@ -18,7 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "VecIndex.h"
 #include "knowhere/index/vector_index/VectorIndex.h"
@@ -60,6 +62,9 @@ class VecIndexImpl : public VecIndex {
     Status
     Load(const knowhere::BinarySet& index_binary) override;
 
+    Status
+    LoadMapped(const std::string& location, int64_t offset) override;
+
     VecIndexPtr
     Clone() override;
 
@@ -69,6 +74,18 @@ class VecIndexImpl : public VecIndex {
     Status
     Search(const int64_t& nq, const float* xq, float* dist, int64_t* ids, const Config& cfg) override;
 
+    Status
+    Merge(const VecIndexPtr& other) override;
+
+    Status
+    Delete(const int64_t& n, const int64_t* ids) override;
+
+    Status
+    GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots) override;
+
+    Status
+    Reconstruct(int64_t slot, float* vector) override;
+
  protected:
     int64_t dim = 0;
 
@@ -130,6 +147,15 @@ class BFIndex : public VecIndexImpl {
 
     int64_t*
     GetRawIds();
+
+    Status
+    GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots) override;
+
+    Status
+    Reconstruct(int64_t slot, float* vector) override;
+
+    int64_t
+    Size() override;
 };
 
 class ToIndexData : public cache::DataObj {
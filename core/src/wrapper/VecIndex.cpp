@@ -26,11 +26,16 @@
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
 #include "knowhere/index/vector_index/IndexIVFSQ.h"
 #include "knowhere/index/vector_index/IndexIVFSQHybrid.h"
-#include "knowhere/index/vector_index/IndexKDT.h"
 #include "knowhere/index/vector_index/IndexNSG.h"
+#include "knowhere/index/vector_index/IndexSPTAG.h"
+#include "utils/FileIO.h"
 #include "utils/Log.h"
 
 #include <cuda.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
 
 namespace milvus {
 namespace engine {
@@ -48,64 +53,6 @@ VecIndex::set_size(int64_t size) {
     size_ = size;
 }
 
-struct FileIOReader {
-    std::fstream fs;
-    std::string name;
-
-    explicit FileIOReader(const std::string& fname);
-
-    ~FileIOReader();
-
-    size_t
-    operator()(void* ptr, size_t size);
-
-    size_t
-    operator()(void* ptr, size_t size, size_t pos);
-};
-
-FileIOReader::FileIOReader(const std::string& fname) {
-    name = fname;
-    fs = std::fstream(name, std::ios::in | std::ios::binary);
-}
-
-FileIOReader::~FileIOReader() {
-    fs.close();
-}
-
-size_t
-FileIOReader::operator()(void* ptr, size_t size) {
-    fs.read(reinterpret_cast<char*>(ptr), size);
-}
-
-size_t
-FileIOReader::operator()(void* ptr, size_t size, size_t pos) {
-    return 0;
-}
-
-struct FileIOWriter {
-    std::fstream fs;
-    std::string name;
-
-    explicit FileIOWriter(const std::string& fname);
-    ~FileIOWriter();
-    size_t
-    operator()(void* ptr, size_t size);
-};
-
-FileIOWriter::FileIOWriter(const std::string& fname) {
-    name = fname;
-    fs = std::fstream(name, std::ios::out | std::ios::binary);
-}
-
-FileIOWriter::~FileIOWriter() {
-    fs.close();
-}
-
-size_t
-FileIOWriter::operator()(void* ptr, size_t size) {
-    fs.write(reinterpret_cast<char*>(ptr), size);
-}
-
 VecIndexPtr
 GetVecIndexFactory(const IndexType& type, const Config& cfg) {
     std::shared_ptr<knowhere::VectorIndex> index;
@@ -139,6 +86,10 @@ GetVecIndexFactory(const IndexType& type, const Config& cfg) {
             index = std::make_shared<knowhere::CPUKDTRNG>();
             break;
         }
+        case IndexType::SPTAG_BKT_RNT_CPU: {
+            index = std::make_shared<knowhere::CPUBKTRNG>();
+            break;
+        }
         case IndexType::FAISS_IVFSQ8_MIX: {
             index = std::make_shared<knowhere::GPUIVFSQ>(gpu_device);
             return std::make_shared<IVFMixIndex>(index, IndexType::FAISS_IVFSQ8_MIX);
@@ -179,67 +130,140 @@ LoadVecIndex(const IndexType& index_type, const knowhere::BinarySet& index_binar
 
 VecIndexPtr
 read_index(const std::string& location) {
-    knowhere::BinarySet load_data_list;
-    FileIOReader reader(location);
-    reader.fs.seekg(0, reader.fs.end);
-    int64_t length = reader.fs.tellg();
-    if (length <= 0) {
+    std::shared_ptr<uint8_t> buffer;
+    uint64_t length = 0;
+    auto status = server::FileIO::GetInstance().ReadFile(location, buffer, length);
+    if (!status.ok()) {
+        WRAPPER_LOG_ERROR << status.message();
+        return nullptr;
+    }
+    if (length == 0) {
         return nullptr;
     }
 
-    reader.fs.seekg(0);
-
+    // binaries share the file buffer instead of being copied out of it
+    knowhere::BinarySet load_data_list;
+    uint8_t* data = buffer.get();
     size_t rp = 0;
+    auto read_field = [&](void* field, size_t size) {
+        if (rp + size > length) {
+            return false;
+        }
+        memcpy(field, data + rp, size);
+        rp += size;
+        return true;
+    };
+
     auto current_type = IndexType::INVALID;
-    reader(&current_type, sizeof(current_type));
-    rp += sizeof(current_type);
+    if (!read_field(&current_type, sizeof(current_type))) {
+        WRAPPER_LOG_ERROR << "Index file is corrupted: " << location;
+        return nullptr;
+    }
     while (rp < length) {
-        size_t meta_length;
-        reader(&meta_length, sizeof(meta_length));
-        rp += sizeof(meta_length);
-        reader.fs.seekg(rp);
-
-        auto meta = new char[meta_length];
-        reader(meta, meta_length);
+        size_t meta_length = 0;
+        if (!read_field(&meta_length, sizeof(meta_length)) || rp + meta_length > length) {
+            WRAPPER_LOG_ERROR << "Index file is corrupted: " << location;
+            return nullptr;
+        }
+        std::string meta(reinterpret_cast<char*>(data + rp), meta_length);
         rp += meta_length;
-        reader.fs.seekg(rp);
 
-        size_t bin_length;
-        reader(&bin_length, sizeof(bin_length));
-        rp += sizeof(bin_length);
-        reader.fs.seekg(rp);
-
-        auto bin = new uint8_t[bin_length];
-        reader(bin, bin_length);
+        size_t bin_length = 0;
+        if (!read_field(&bin_length, sizeof(bin_length)) || rp + bin_length > length) {
+            WRAPPER_LOG_ERROR << "Index file is corrupted: " << location;
+            return nullptr;
+        }
+        std::shared_ptr<uint8_t> binptr(buffer, data + rp);
         rp += bin_length;
 
-        auto binptr = std::make_shared<uint8_t>();
-        binptr.reset(bin);
-        load_data_list.Append(std::string(meta, meta_length), binptr, bin_length);
-        delete[] meta;
+        load_data_list.Append(meta, binptr, bin_length);
     }
 
     return LoadVecIndex(current_type, load_data_list, length);
 }
 
+VecIndexPtr
+read_index_mapped(const std::string& location) {
+    auto current_type = IndexType::INVALID;
+    int64_t offset = -1;
+    {
+        // walk the binary headers only, the faiss stream is mapped in place
+        FILE* file = fopen(location.c_str(), "rb");
+        if (file == nullptr) {
+            WRAPPER_LOG_ERROR << "Failed to open index file: " << location;
+            return nullptr;
+        }
+
+        if (fread(&current_type, sizeof(current_type), 1, file) == 1) {
+            size_t meta_length = 0;
+            while (fread(&meta_length, sizeof(meta_length), 1, file) == 1) {
+                std::string meta(meta_length, '\0');
+                size_t bin_length = 0;
+                if (fread(&meta[0], 1, meta_length, file) != meta_length ||
+                    fread(&bin_length, sizeof(bin_length), 1, file) != 1) {
+                    break;
+                }
+                if (meta == "IVF") {
+                    offset = ftell(file);
+                    break;
+                }
+                if (fseek(file, bin_length, SEEK_CUR) != 0) {
+                    break;
+                }
+            }
+        }
+        fclose(file);
+    }
+
+    if (offset < 0 || !IsMappableIndexType(current_type)) {
+        return read_index(location);
+    }
+
+    auto index = GetVecIndexFactory(current_type);
+    auto status = index->LoadMapped(location, offset);
+    if (!status.ok()) {
+        WRAPPER_LOG_WARNING << "Read " << location << " into memory since it can not be mapped: " << status.message();
+        return read_index(location);
+    }
+    return index;
+}
+
+bool
+IsMappableIndexType(const IndexType& type) {
+    return type == IndexType::FAISS_IVFFLAT_CPU || type == IndexType::FAISS_IVFSQ8_CPU ||
+           type == IndexType::FAISS_IVFPQ_CPU;
+}
+
 Status
 write_index(VecIndexPtr index, const std::string& location) {
     try {
         auto binaryset = index->Serialize();
         auto index_type = index->GetType();
 
-        FileIOWriter writer(location);
-        writer(&index_type, sizeof(IndexType));
+        // lengths must outlive the write, buffers only point to them
+        std::vector<size_t> lengths;
+        lengths.reserve(binaryset.binary_map_.size() * 2);
+        std::vector<server::IOBuffer> buffers;
+        buffers.push_back(server::IOBuffer{&index_type, sizeof(IndexType)});
         for (auto& iter : binaryset.binary_map_) {
-            auto meta = iter.first.c_str();
-            size_t meta_length = iter.first.length();
-            writer(&meta_length, sizeof(meta_length));
-            writer((void*)meta, meta_length);
+            lengths.push_back(iter.first.length());
+            buffers.push_back(server::IOBuffer{&lengths.back(), sizeof(size_t)});
+            buffers.push_back(server::IOBuffer{iter.first.c_str(), iter.first.length()});
 
             auto binary = iter.second;
-            int64_t binary_length = binary->size;
-            writer(&binary_length, sizeof(binary_length));
-            writer((void*)binary->data.get(), binary_length);
+            lengths.push_back(binary->size);
+            buffers.push_back(server::IOBuffer{&lengths.back(), sizeof(size_t)});
+            buffers.push_back(server::IOBuffer{binary->data.get(), static_cast<uint64_t>(binary->size)});
+        }
+
+        // the file is marked as index in meta once written, it must be on disk first
+        auto status = server::FileIO::GetInstance().WriteFile(location, buffers, true);
+        if (!status.ok()) {
+            WRAPPER_LOG_ERROR << status.message();
+            if (status.message().find("No space left on device") != std::string::npos) {
+                return Status(KNOWHERE_NO_SPACE, "No space left on the device");
+            }
+            return Status(KNOWHERE_ERROR, status.message());
         }
     } catch (knowhere::KnowhereException& e) {
         WRAPPER_LOG_ERROR << e.what();
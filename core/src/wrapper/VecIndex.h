@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cache/DataObj.h"
 #include "knowhere/common/BinarySet.h"
@@ -47,6 +48,7 @@ enum class IndexType {
     FAISS_IVFSQ8_GPU,
     FAISS_IVFSQ8_HYBRID,  // only support build on gpu.
     NSG_MIX,
+    SPTAG_BKT_RNT_CPU,
 };
 
 class VecIndex;
@@ -99,6 +101,36 @@ class VecIndex : public cache::DataObj {
     virtual Status
     Load(const knowhere::BinarySet& index_binary) = 0;
 
+    // map the index binary stored at offset of location instead of reading it, for index types that support it
+    virtual Status
+    LoadMapped(const std::string& location, int64_t offset) {
+        return Status(KNOWHERE_ERROR, "LoadMapped not supported by this index type");
+    }
+
+    // append the entries of other without retraining, for index types sharing a compatible layout
+    virtual Status
+    Merge(const VecIndexPtr& other) {
+        return Status(KNOWHERE_ERROR, "Merge not supported by this index type");
+    }
+
+    // mark the entries of ids deleted, they are dropped when the index is serialized
+    virtual Status
+    Delete(const int64_t& n, const int64_t* ids) {
+        return Status(KNOWHERE_ERROR, "Delete not supported by this index type");
+    }
+
+    // ids of all entries with an opaque position per entry, accepted by Reconstruct
+    virtual Status
+    GetIds(std::vector<int64_t>& ids, std::vector<int64_t>& slots) {
+        return Status(KNOWHERE_ERROR, "GetIds not supported by this index type");
+    }
+
+    // copy the stored vector at a position returned by GetIds, decoding it for quantized indexes
+    virtual Status
+    Reconstruct(int64_t slot, float* vector) {
+        return Status(KNOWHERE_ERROR, "Reconstruct not supported by this index type");
+    }
+
     // TODO(linxj): refactor later
     ////////////////
     virtual knowhere::QuantizerPtr
@@ -137,6 +169,15 @@ write_index(VecIndexPtr index, const std::string& location);
 extern VecIndexPtr
 read_index(const std::string& location);
 
+// Like read_index, but the inverted lists of cpu ivf indexes stay on disk and are paged in on demand.
+// Other index types and unmappable files are read as usual.
+extern VecIndexPtr
+read_index_mapped(const std::string& location);
+
+// whether read_index_mapped keeps the inverted lists of this index type on disk
+extern bool
+IsMappableIndexType(const IndexType& type);
+
 extern VecIndexPtr
 GetVecIndexFactory(const IndexType& type, const Config& cfg = Config());
 
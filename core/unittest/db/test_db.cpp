@@ -27,6 +27,8 @@
 
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <fstream>
 #include <thread>
 #include <random>
 
@@ -332,6 +334,264 @@ TEST_F(DBTest, SEARCH_TEST) {
 #endif
 }
 
+TEST_F(DBTest, GET_VECTOR_BY_ID_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 1000;
+    std::vector<float> xb;
+    BuildVectors(nb, xb);
+    milvus::engine::IDNumbers vector_ids;
+    for (int64_t i = 0; i < nb; i++) {
+        vector_ids.push_back(i * 10 + 7);
+    }
+    stat = db_->InsertVectors(TABLE_NAME, nb, xb.data(), vector_ids);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int) milvus::engine::EngineType::FAISS_IVFFLAT;
+    db_->CreateIndex(TABLE_NAME, index); // wait until build index finish
+
+    std::vector<float> vector;
+    stat = db_->GetVectorByID(TABLE_NAME, vector_ids[123], vector);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(vector.size(), TABLE_DIM);
+    for (int64_t j = 0; j < TABLE_DIM; j++) {
+        ASSERT_FLOAT_EQ(vector[j], xb[123 * TABLE_DIM + j]);
+    }
+
+    stat = db_->GetVectorByID(TABLE_NAME, 8, vector);
+    ASSERT_FALSE(stat.ok());
+
+    milvus::engine::meta::DatesT dates;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->QueryByID(TABLE_NAME, 5, 10, vector_ids[123], dates, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_FALSE(result_ids.empty());
+    ASSERT_EQ(result_ids[0], vector_ids[123]);
+}
+
+TEST_F(DBTest, GET_VECTOR_BY_ID_NSG_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 1000;
+    std::vector<float> xb;
+    BuildVectors(nb, xb);
+    milvus::engine::IDNumbers vector_ids;
+    for (int64_t i = 0; i < nb; i++) {
+        vector_ids.push_back(i * 10 + 7);
+    }
+    stat = db_->InsertVectors(TABLE_NAME, nb, xb.data(), vector_ids);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int) milvus::engine::EngineType::NSG_MIX;
+    db_->CreateIndex(TABLE_NAME, index); // wait until build index finish
+
+    // graphs keep the original vectors, they are answered from the index file
+    std::vector<float> vector;
+    stat = db_->GetVectorByID(TABLE_NAME, vector_ids[123], vector);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(vector.size(), TABLE_DIM);
+    for (int64_t j = 0; j < TABLE_DIM; j++) {
+        ASSERT_FLOAT_EQ(vector[j], xb[123 * TABLE_DIM + j]);
+    }
+
+    stat = db_->GetVectorByID(TABLE_NAME, 8, vector);
+    ASSERT_FALSE(stat.ok());
+
+    std::vector<float> xu(xb.begin(), xb.begin() + TABLE_DIM);
+    milvus::engine::IDNumbers upsert_ids{vector_ids[123]};
+    stat = db_->UpsertVectors(TABLE_NAME, 1, xu.data(), upsert_ids);
+    ASSERT_TRUE(stat.ok());
+}
+
+TEST_F(DBTest, UPSERT_UNSUPPORTED_INDEX_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 1000;
+    std::vector<float> xb;
+    BuildVectors(nb, xb);
+    milvus::engine::IDNumbers vector_ids;
+    for (int64_t i = 0; i < nb; i++) {
+        vector_ids.push_back(i * 10 + 7);
+    }
+    stat = db_->InsertVectors(TABLE_NAME, nb, xb.data(), vector_ids);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int) milvus::engine::EngineType::SPTAG_KDT;
+    db_->CreateIndex(TABLE_NAME, index); // wait until build index finish
+
+    // sptag files are skipped by lookups and rejected by upserts, nothing is loaded for them
+    std::vector<float> vector;
+    stat = db_->GetVectorByID(TABLE_NAME, vector_ids[123], vector);
+    ASSERT_EQ(stat.code(), milvus::DB_NOT_FOUND);
+
+    milvus::engine::IDNumbers upsert_ids{vector_ids[123]};
+    stat = db_->UpsertVectors(TABLE_NAME, 1, xb.data(), upsert_ids);
+    ASSERT_FALSE(stat.ok());
+}
+
+TEST_F(DBTest, UPSERT_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 1000;
+    std::vector<float> xb;
+    BuildVectors(nb, xb);
+    milvus::engine::IDNumbers vector_ids;
+    for (int64_t i = 0; i < nb; i++) {
+        vector_ids.push_back(i * 10 + 7);
+    }
+    stat = db_->InsertVectors(TABLE_NAME, nb, xb.data(), vector_ids);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int) milvus::engine::EngineType::FAISS_IDMAP;
+    db_->CreateIndex(TABLE_NAME, index); // wait until the vectors are serialized
+
+    // the first ids get the vectors of the last rows, twice: the copy of the second upsert replaces a
+    // serialized vector and a buffered one
+    int64_t nu = 10;
+    std::vector<float> xu(xb.begin() + (nb - nu) * TABLE_DIM, xb.end());
+    milvus::engine::IDNumbers upsert_ids(vector_ids.begin(), vector_ids.begin() + nu);
+    stat = db_->UpsertVectors(TABLE_NAME, nu, xu.data(), upsert_ids);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->UpsertVectors(TABLE_NAME, nu, xu.data(), upsert_ids);
+    ASSERT_TRUE(stat.ok());
+    db_->CreateIndex(TABLE_NAME, index);
+
+    std::vector<float> vector;
+    stat = db_->GetVectorByID(TABLE_NAME, vector_ids[0], vector);
+    ASSERT_TRUE(stat.ok());
+    for (int64_t j = 0; j < TABLE_DIM; j++) {
+        ASSERT_FLOAT_EQ(vector[j], xu[j]);
+    }
+
+    // the old vector does not find its id any more, the new one finds it once
+    milvus::engine::meta::DatesT dates;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(TABLE_NAME, 5, 1, 10, xb.data(), dates, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_NE(result_ids[0], vector_ids[0]);
+
+    stat = db_->Query(TABLE_NAME, 5, 1, 10, xu.data(), dates, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(std::count(result_ids.begin(), result_ids.end(), vector_ids[0]), 1);
+    ASSERT_EQ(std::count(result_ids.begin(), result_ids.end(), vector_ids[nb - nu]), 1);
+
+    // one id twice in a batch is ambiguous
+    milvus::engine::IDNumbers duplicate_ids = {vector_ids[0], vector_ids[0]};
+    stat = db_->UpsertVectors(TABLE_NAME, 2, xu.data(), duplicate_ids);
+    ASSERT_FALSE(stat.ok());
+}
+
+TEST_F(DBTest, ATTR_FILTER_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    table_info.attributes_ = "category:int64";
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 1000;
+    std::vector<float> xb;
+    BuildVectors(nb, xb);
+    milvus::engine::IDNumbers vector_ids;
+    milvus::engine::AttrColumns attrs(1);
+    attrs[0].name_ = "category";
+    for (int64_t i = 0; i < nb; i++) {
+        vector_ids.push_back(i);
+        attrs[0].int_data_.push_back(i % 4);
+    }
+    stat = db_->InsertVectors(TABLE_NAME, nb, xb.data(), vector_ids, attrs);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int) milvus::engine::EngineType::FAISS_IDMAP;
+    db_->CreateIndex(TABLE_NAME, index); // wait until the vectors are serialized
+
+    milvus::engine::AttrSchema schema;
+    milvus::engine::ParseAttrSchema(table_info.attributes_, schema);
+    milvus::engine::AttrFilterPtr filter;
+    stat = milvus::engine::AttrFilter::Parse("category == 1", schema, filter);
+    ASSERT_TRUE(stat.ok());
+
+    // the nearest vector of row 0 is itself, the filter only lets the rows of category 1 through
+    int64_t k = 10;
+    milvus::engine::meta::DatesT dates;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(TABLE_NAME, k, 1, 10, xb.data(), dates, result_ids, result_distances, filter);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), k);
+    for (auto id : result_ids) {
+        ASSERT_EQ(id % 4, 1);
+    }
+
+    stat = milvus::engine::AttrFilter::Parse("category > 3", schema, filter);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Query(TABLE_NAME, k, 1, 10, xb.data(), dates, result_ids, result_distances, filter);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_TRUE(std::none_of(result_ids.begin(), result_ids.end(), [](int64_t id) { return id >= 0; }));
+}
+
+TEST_F(DBTest, PARTITION_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 1000;
+    std::vector<float> xb;
+    BuildVectors(nb, xb);
+    milvus::engine::IDNumbers tagged_ids;
+    for (int64_t i = 0; i < nb; i++) {
+        tagged_ids.push_back(i);
+    }
+    stat = db_->InsertVectors(TABLE_NAME, nb, xb.data(), tagged_ids, milvus::engine::AttrColumns(), "t1");
+    ASSERT_TRUE(stat.ok());
+
+    // the same vectors with other ids go to the default partition
+    milvus::engine::IDNumbers default_ids;
+    for (int64_t i = 0; i < nb; i++) {
+        default_ids.push_back(nb + i);
+    }
+    stat = db_->InsertVectors(TABLE_NAME, nb, xb.data(), default_ids);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int) milvus::engine::EngineType::FAISS_IDMAP;
+    db_->CreateIndex(TABLE_NAME, index); // wait until the vectors are serialized
+
+    int64_t k = 10;
+    milvus::engine::meta::DatesT dates;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(TABLE_NAME, k, 1, 10, xb.data(), dates, result_ids, result_distances, nullptr, {"t1"});
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), k);
+    for (auto id : result_ids) {
+        ASSERT_LT(id, nb);
+    }
+
+    // without tags both partitions are searched, row 0 is found in each of them
+    stat = db_->Query(TABLE_NAME, k, 1, 10, xb.data(), dates, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_NE(std::find(result_ids.begin(), result_ids.end(), 0), result_ids.end());
+    ASSERT_NE(std::find(result_ids.begin(), result_ids.end(), nb), result_ids.end());
+
+    stat = db_->Query(TABLE_NAME, k, 1, 10, xb.data(), dates, result_ids, result_distances, nullptr, {"t2"});
+    ASSERT_TRUE(stat.ok());
+    ASSERT_TRUE(std::none_of(result_ids.begin(), result_ids.end(), [](int64_t id) { return id >= 0; }));
+}
+
 TEST_F(DBTest, PRELOADTABLE_TEST) {
     milvus::engine::meta::TableSchema table_info = BuildTableSchema();
     auto stat = db_->CreateTable(table_info);
@@ -358,10 +618,74 @@ TEST_F(DBTest, PRELOADTABLE_TEST) {
     db_->CreateIndex(TABLE_NAME, index); // wait until build index finish
 
     int64_t prev_cache_usage = milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage();
-    stat = db_->PreloadTable(TABLE_NAME);
+    milvus::engine::PreloadProgress progress;
+    stat = db_->PreloadTable(TABLE_NAME, &progress);
     ASSERT_TRUE(stat.ok());
     int64_t cur_cache_usage = milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage();
     ASSERT_TRUE(prev_cache_usage < cur_cache_usage);
+    ASSERT_GT(progress.files_total, 0);
+    ASSERT_EQ(progress.files_loaded, progress.files_total);
+    ASSERT_EQ(progress.files_failed, 0);
+
+    // searched tables rank before the others
+    std::vector<std::string> ranking;
+    stat = db_->TablesByAccess(ranking);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_TRUE(ranking.empty());
+
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(TABLE_NAME, 10, 1, 10, xb.data(), result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->TablesByAccess(ranking);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(ranking.size(), 1);
+    ASSERT_EQ(ranking[0], TABLE_NAME);
+}
+
+TEST_F(DBTest, WARM_RESTART_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+
+    int64_t nb = VECTOR_COUNT;
+    std::vector<float> xb;
+    BuildVectors(nb, xb);
+    milvus::engine::IDNumbers vector_ids;
+    db_->InsertVectors(TABLE_NAME, nb, xb.data(), vector_ids);
+    ASSERT_EQ(vector_ids.size(), nb);
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int) milvus::engine::EngineType::FAISS_IDMAP;
+    db_->CreateIndex(TABLE_NAME, index); // wait until build index finish
+    db_->Stop();
+
+    auto options = GetOptions();
+    options.warm_restart_ = true;
+    db_ = milvus::engine::DBFactory::Build(options);
+    // no snapshot yet, the cache is taken as warmed up and snapshotted on stop
+    stat = db_->WarmUpCache();
+    ASSERT_TRUE(stat.ok());
+    stat = db_->PreloadTable(TABLE_NAME);
+    ASSERT_TRUE(stat.ok());
+    db_->Stop();
+
+    // malformed lines of the snapshot are skipped
+    {
+        std::ofstream snapshot(options.meta_.path_ + "/cache_snapshot", std::ios::app);
+        snapshot << "abc /tmp/not_a_file\n"
+                 << "99999999999999999999999 /tmp/not_a_file\n"
+                 << "-1 /tmp/not_a_file\n"
+                 << "12\n";
+    }
+
+    milvus::cache::CpuCacheMgr::GetInstance()->ClearCache();
+    db_ = milvus::engine::DBFactory::Build(options);
+    milvus::engine::PreloadProgress progress;
+    stat = db_->WarmUpCache(&progress);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_GT(progress.files_loaded, 0);
+    ASSERT_EQ(progress.files_failed, 0);
+    ASSERT_GT(milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage(), 0);
 }
 
 TEST_F(DBTest, SHUTDOWN_TEST) {
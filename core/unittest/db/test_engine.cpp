@@ -19,8 +19,10 @@
 #include <boost/filesystem.hpp>
 #include <vector>
 
+#include "db/engine/AttrFilter.h"
 #include "db/engine/EngineFactory.h"
 #include "db/engine/ExecutionEngineImpl.h"
+#include "db/engine/SegmentIdIndex.h"
 #include "db/utils.h"
 
 TEST_F(EngineTest, FACTORY_TEST) {
@@ -120,3 +122,180 @@ TEST_F(EngineTest, ENGINE_IMPL_TEST) {
     auto engine_build = new_engine->BuildIndex("/tmp/milvus_index_2", milvus::engine::EngineType::FAISS_IVFSQ8);
     //ASSERT_TRUE(status.ok());
 }
+
+TEST_F(EngineTest, SEGMENT_ID_INDEX_TEST) {
+    std::vector<int64_t> ids, slots;
+    const int64_t row_count = 10000;
+    for (int64_t i = 0; i < row_count; i++) {
+        ids.push_back((row_count - i) * 3);
+        slots.push_back(i);
+    }
+
+    milvus::engine::SegmentIdIndex id_index(ids, slots);
+    ASSERT_EQ(id_index.Count(), row_count);
+
+    int64_t slot = -1;
+    ASSERT_TRUE(id_index.Find(ids[42], slot));
+    ASSERT_EQ(slot, 42);
+    ASSERT_FALSE(id_index.Find(ids[42] + 1, slot));
+
+    // absent ids are mostly rejected by the bloom filter alone
+    int64_t false_positive = 0;
+    for (int64_t i = 0; i < row_count; i++) {
+        if (id_index.MayContain(i * 3 + 1)) {
+            false_positive++;
+        }
+    }
+    ASSERT_LT(false_positive, row_count / 20);
+
+    std::string location = "/tmp/milvus_id_index";
+    auto status = id_index.Write(location);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::SegmentIdIndexPtr loaded;
+    status = milvus::engine::SegmentIdIndex::Read(location, loaded);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(loaded->Count(), row_count);
+    for (int64_t i = 0; i < row_count; i += 97) {
+        ASSERT_TRUE(loaded->Find(ids[i], slot));
+        ASSERT_EQ(slot, i);
+    }
+    boost::filesystem::remove(milvus::engine::SegmentIdIndex::FileName(location));
+
+    status = milvus::engine::SegmentIdIndex::Read(location, loaded);
+    ASSERT_FALSE(status.ok());
+
+    // a sorted batch, the ids of the even positions but 0 are held by the file
+    std::vector<int64_t> batch, found;
+    for (int64_t i = 0; i < 1000; i++) {
+        batch.push_back(i * 3 + i % 2);
+    }
+    id_index.FindBatch(batch, found);
+    ASSERT_EQ(found.size(), 499);
+    for (auto id : found) {
+        ASSERT_TRUE(id_index.Find(id, slot));
+    }
+}
+
+TEST_F(EngineTest, GET_VECTOR_BY_ID_TEST) {
+    uint16_t dimension = 64;
+    std::string file_path = "/tmp/milvus_index_3";
+    auto engine_ptr = milvus::engine::EngineFactory::Build(
+            dimension,
+            file_path,
+            milvus::engine::EngineType::FAISS_IDMAP,
+            milvus::engine::MetricType::L2,
+            1024);
+
+    std::vector<float> data;
+    std::vector<int64_t> ids;
+    const int row_count = 1000;
+    for (int64_t i = 0; i < row_count; i++) {
+        ids.push_back(i * 2 + 100);
+        for (uint16_t k = 0; k < dimension; k++) {
+            data.push_back(i*dimension + k);
+        }
+    }
+
+    auto status = engine_ptr->AddWithIds((int64_t)ids.size(), data.data(), ids.data());
+    ASSERT_TRUE(status.ok());
+    status = engine_ptr->Serialize();
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(boost::filesystem::exists(milvus::engine::SegmentIdIndex::FileName(file_path)));
+
+    // a fresh engine reads the id index before the index file
+    auto read_engine = milvus::engine::EngineFactory::Build(
+            dimension,
+            file_path,
+            milvus::engine::EngineType::FAISS_IDMAP,
+            milvus::engine::MetricType::L2,
+            1024);
+    int64_t slot = 0;
+    bool found = false;
+    status = read_engine->FindID(ids[10], slot, found);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(found);
+
+    std::vector<float> vector(dimension);
+    status = read_engine->GetVector(slot, vector.data());
+    ASSERT_TRUE(status.ok());
+    for (uint16_t k = 0; k < dimension; k++) {
+        ASSERT_EQ(vector[k], data[10 * dimension + k]);
+    }
+
+    status = read_engine->FindID(101, slot, found);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(found);
+
+    boost::filesystem::remove(file_path);
+    boost::filesystem::remove(milvus::engine::SegmentIdIndex::FileName(file_path));
+}
+
+TEST_F(EngineTest, ATTR_FILTER_TEST) {
+    milvus::engine::AttrSchema schema;
+    auto status = milvus::engine::ParseAttrSchema("category:int64,price:double", schema);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(milvus::engine::FormatAttrSchema(schema), "category:int64,price:double");
+
+    const int64_t row_count = 1000;
+    std::vector<int64_t> ids;
+    milvus::engine::AttrColumn category, price;
+    category.name_ = "category";
+    price.name_ = "price";
+    price.type_ = milvus::engine::AttrType::DOUBLE;
+    for (int64_t i = 0; i < row_count; i++) {
+        ids.push_back(i * 2 + 100);
+        category.int_data_.push_back(i % 10);
+        price.double_data_.push_back(i / 10.0);
+    }
+    status = milvus::engine::ValidateAttrColumns(schema, {category, price}, row_count);
+    ASSERT_TRUE(status.ok());
+    status = milvus::engine::ValidateAttrColumns(schema, {category}, row_count);
+    ASSERT_FALSE(status.ok());
+
+    std::string location = "/tmp/milvus_attr_1";
+    milvus::engine::SegmentAttrs attrs(ids, {price, category});
+    status = attrs.Write(location);
+    ASSERT_TRUE(status.ok());
+    auto loaded = milvus::engine::SegmentAttrs::Get(location);
+    ASSERT_EQ(loaded->Rows(), row_count);
+
+    milvus::engine::AttrFilterPtr filter;
+    status = milvus::engine::AttrFilter::Parse("category == 3 && price < 50.5", schema, filter);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(filter->MayMatch(*loaded));
+    milvus::engine::AttrBitmap bitmap;
+    filter->Evaluate(*loaded, bitmap);
+    for (int64_t i = 0; i < row_count; i++) {
+        ASSERT_EQ(bitmap.Test(i), i % 10 == 3 && i / 10.0 < 50.5);
+    }
+    ASSERT_EQ(bitmap.Count(), 51);
+
+    milvus::engine::AttrAllowList allow_list(loaded, bitmap);
+    ASSERT_EQ(allow_list.Count(), 51);
+    ASSERT_TRUE(allow_list.Contains(ids[3]));
+    ASSERT_FALSE(allow_list.Contains(ids[4]));
+
+    // the zone maps rule the file out
+    status = milvus::engine::AttrFilter::Parse("price > 1000", schema, filter);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(filter->MayMatch(*loaded));
+
+    status = milvus::engine::AttrFilter::Parse("size == 1", schema, filter);
+    ASSERT_FALSE(status.ok());
+    status = milvus::engine::AttrFilter::Parse("category == 1.5", schema, filter);
+    ASSERT_FALSE(status.ok());
+    status = milvus::engine::AttrFilter::Parse("category == 1 ||", schema, filter);
+    ASSERT_FALSE(status.ok());
+
+    // a merge keeps the rows of the sources in order
+    std::string merged = "/tmp/milvus_attr_2";
+    status = milvus::engine::SegmentAttrs::Merge(merged, {location, location});
+    ASSERT_TRUE(status.ok());
+    auto merged_attrs = milvus::engine::SegmentAttrs::Get(merged);
+    ASSERT_EQ(merged_attrs->Rows(), 2 * row_count);
+    ASSERT_EQ(merged_attrs->Ids()[row_count], ids[0]);
+
+    boost::filesystem::remove(milvus::engine::SegmentAttrs::FileName(location));
+    boost::filesystem::remove(milvus::engine::SegmentAttrs::FileName(merged));
+}
@@ -17,12 +17,18 @@
 
 #include "db/utils.h"
 #include "db/meta/SqliteMetaImpl.h"
+#include "db/meta/ChangeFeedMeta.h"
+#include "db/meta/TableFileCatalog.h"
 #include "db/Utils.h"
 #include "db/Constants.h"
 #include "db/meta/MetaConsts.h"
+#include "db/tier/TierManager.h"
 
 #include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <fstream>
 #include <thread>
+#include <algorithm>
 #include <stdlib.h>
 #include <time.h>
 
@@ -148,7 +154,10 @@ TEST_F(MetaTest, ARCHIVE_TEST_DAYS) {
         ids.push_back(table_file.id_);
     }
 
-    impl.Archive();
+    milvus::engine::meta::TableFilesSchema archived;
+    impl.Archive(archived);
+    size_t expired = std::count_if(days.begin(), days.end(), [&](int day) { return day >= days_num; });
+    ASSERT_EQ(archived.size(), expired);
     int i = 0;
 
     milvus::engine::meta::TableFilesSchema files_get;
@@ -193,7 +202,9 @@ TEST_F(MetaTest, ARCHIVE_TEST_DISK) {
         ids.push_back(table_file.id_);
     }
 
-    impl.Archive();
+    milvus::engine::meta::TableFilesSchema archived;
+    impl.Archive(archived);
+    ASSERT_EQ(archived.size(), 5);
     int i = 0;
 
     milvus::engine::meta::TableFilesSchema files_get;
@@ -210,6 +221,95 @@ TEST_F(MetaTest, ARCHIVE_TEST_DISK) {
     impl.DropAll();
 }
 
+TEST_F(MetaTest, TIER_TEST) {
+    auto table_id = "meta_test_table";
+    std::string tier_path = "/tmp/milvus_test_tier";
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = impl_->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    // one cold and one hot index file
+    int64_t ts = milvus::engine::utils::GetMicroSecTimeStamp();
+    milvus::engine::meta::TableFileSchema cold_file, hot_file;
+    cold_file.table_id_ = table_id;
+    hot_file.table_id_ = table_id;
+    std::vector<size_t> ids;
+    for (auto file : {&cold_file, &hot_file}) {
+        status = impl_->CreateTableFile(*file);
+        ASSERT_TRUE(status.ok());
+        file->file_type_ = milvus::engine::meta::TableFileSchema::INDEX;
+        std::ofstream out(file->location_, std::ios::binary);
+        out << "index data of " << file->file_id_;
+        out.close();
+        file->file_size_ = boost::filesystem::file_size(file->location_);
+        ids.push_back(file->id_);
+    }
+    cold_file.created_on_ = ts - 40 * milvus::engine::meta::D_SEC * milvus::engine::meta::US_PS;
+    status = impl_->UpdateTableFile(cold_file);
+    ASSERT_TRUE(status.ok());
+    status = impl_->UpdateTableFile(hot_file);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::TierConf conf;
+    conf.path_ = tier_path;
+    conf.cold_days_ = 30;
+    conf.local_capacity_ = 1;
+    auto& tier_mgr = milvus::engine::TierManager::GetInstance();
+    tier_mgr.Init(conf);
+    ASSERT_TRUE(tier_mgr.Enabled());
+
+    status = tier_mgr.Demote(impl_);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(boost::filesystem::exists(cold_file.location_));
+    ASSERT_TRUE(boost::filesystem::exists(hot_file.location_));
+    ASSERT_TRUE(tier_mgr.Exists(cold_file));
+    ASSERT_FALSE(tier_mgr.Exists(hot_file));
+
+    // demoted file is still searchable
+    milvus::engine::meta::DatePartionedTableFilesSchema dated_files;
+    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(),
+                                  milvus::engine::meta::PartitionTags(), dated_files);
+    ASSERT_TRUE(status.ok());
+    milvus::engine::meta::TableFilesSchema files;
+    for (auto& day_files : dated_files) {
+        files.insert(files.end(), day_files.second.begin(), day_files.second.end());
+    }
+    ASSERT_EQ(files.size(), 2);
+    for (auto& file : files) {
+        if (file.id_ == cold_file.id_) {
+            ASSERT_EQ(file.tier_, milvus::engine::meta::TableFileSchema::REMOTE);
+            ASSERT_EQ(file.location_, cold_file.location_);
+        } else {
+            ASSERT_EQ(file.tier_, milvus::engine::meta::TableFileSchema::LOCAL);
+        }
+    }
+
+    // nothing more to demote
+    milvus::engine::meta::TableFilesSchema to_demote;
+    status = impl_->FilesToDemote(ts, to_demote);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(to_demote.empty());
+
+    cold_file.tier_ = milvus::engine::meta::TableFileSchema::REMOTE;
+    status = tier_mgr.Fetch(cold_file);
+    ASSERT_TRUE(status.ok());
+    std::ifstream in(cold_file.location_, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ASSERT_EQ(content, "index data of " + cold_file.file_id_);
+    ASSERT_EQ(tier_mgr.LocalUsage(), cold_file.file_size_);
+
+    status = milvus::engine::utils::DeleteTableFilePath(GetOptions().meta_, cold_file);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(tier_mgr.Exists(cold_file));
+    ASSERT_EQ(tier_mgr.LocalUsage(), 0);
+
+    tier_mgr.Init(milvus::engine::TierConf());
+    ASSERT_FALSE(tier_mgr.Enabled());
+    boost::filesystem::remove_all(tier_path);
+}
+
 TEST_F(MetaTest, TABLE_FILES_TEST) {
     auto table_id = "meta_test_group";
 
@@ -292,20 +392,22 @@ TEST_F(MetaTest, TABLE_FILES_TEST) {
 
     milvus::engine::meta::DatesT dates = {table_file.date_};
     std::vector<size_t> ids;
-    status = impl_->FilesToSearch(table_id, ids, dates, dated_files);
+    status = impl_->FilesToSearch(table_id, ids, dates, milvus::engine::meta::PartitionTags(), dated_files);
     ASSERT_EQ(dated_files[table_file.date_].size(),
               to_index_files_cnt + raw_files_cnt + index_files_cnt);
 
-    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(), dated_files);
+    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(),
+                                  milvus::engine::meta::PartitionTags(), dated_files);
     ASSERT_EQ(dated_files[table_file.date_].size(),
               to_index_files_cnt + raw_files_cnt + index_files_cnt);
 
-    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(), dated_files);
+    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(),
+                                  milvus::engine::meta::PartitionTags(), dated_files);
     ASSERT_EQ(dated_files[table_file.date_].size(),
               to_index_files_cnt + raw_files_cnt + index_files_cnt);
 
     ids.push_back(size_t(9999999999));
-    status = impl_->FilesToSearch(table_id, ids, dates, dated_files);
+    status = impl_->FilesToSearch(table_id, ids, dates, milvus::engine::meta::PartitionTags(), dated_files);
     ASSERT_EQ(dated_files[table_file.date_].size(), 0);
 
     std::vector<int> file_types;
@@ -385,3 +487,147 @@ TEST_F(MetaTest, INDEX_TEST) {
     status = impl_->UpdateTableFilesToIndex(table_id);
     ASSERT_TRUE(status.ok());
 }
+
+TEST_F(MetaTest, CHANGE_FEED_TEST) {
+    auto options = GetOptions();
+    std::string feed_path = options.meta_.path_ + "/" + milvus::engine::meta::CHANGE_FEED_FILE;
+    milvus::engine::meta::ChangeFeedReader reader(feed_path);
+    auto feed_meta = std::make_shared<milvus::engine::meta::ChangeFeedMeta>(impl_, feed_path);
+    milvus::engine::meta::TableFileCatalog catalog(options.meta_);
+
+    auto table_id = "change_feed_test_table";
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = feed_meta->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    // the table is read from meta once, only one caller loads it
+    milvus::engine::meta::DatePartionedTableFilesSchema files;
+    ASSERT_FALSE(catalog.FilesToSearch(table_id, milvus::engine::meta::DatesT(), {}, files));
+    uint64_t token = catalog.BeginLoad(table_id);
+    ASSERT_NE(token, 0);
+    ASSERT_EQ(catalog.BeginLoad(table_id), 0);
+    std::vector<std::string> evicted;
+    catalog.FinishLoad(token, table, files, evicted);
+    ASSERT_TRUE(catalog.FilesToSearch(table_id, milvus::engine::meta::DatesT(), {}, files));
+    ASSERT_TRUE(files.empty());
+
+    // a new raw file is searchable once the change is applied
+    milvus::engine::meta::TableFileSchema raw_file;
+    raw_file.table_id_ = table_id;
+    status = feed_meta->CreateTableFile(raw_file);
+    ASSERT_TRUE(status.ok());
+    raw_file.file_type_ = milvus::engine::meta::TableFileSchema::RAW;
+    raw_file.row_count_ = 10;
+    status = feed_meta->UpdateTableFile(raw_file);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::FileChanges changes;
+    bool reset = false;
+    status = reader.Tail(changes, reset);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(reset);
+    ASSERT_EQ(changes.size(), 1);
+    ASSERT_EQ(changes[0].file_.file_id_, raw_file.file_id_);
+
+    milvus::engine::meta::TableFilesSchema indexed;
+    catalog.Apply(changes, evicted, indexed);
+    ASSERT_TRUE(evicted.empty());
+    ASSERT_TRUE(indexed.empty());
+    files.clear();
+    ASSERT_TRUE(catalog.FilesToSearch(table_id, milvus::engine::meta::DatesT(), {}, files));
+    ASSERT_EQ(files.size(), 1);
+    ASSERT_EQ(files.begin()->second.size(), 1);
+    ASSERT_EQ(files.begin()->second[0].row_count_, 10);
+
+    // the index file replaces the raw file, which is evicted
+    milvus::engine::meta::TableFileSchema index_file;
+    index_file.table_id_ = table_id;
+    status = feed_meta->CreateTableFile(index_file);
+    ASSERT_TRUE(status.ok());
+    index_file.file_type_ = milvus::engine::meta::TableFileSchema::INDEX;
+    raw_file.file_type_ = milvus::engine::meta::TableFileSchema::TO_DELETE;
+    milvus::engine::meta::TableFilesSchema update_files = {raw_file, index_file};
+    status = feed_meta->UpdateTableFiles(update_files);
+    ASSERT_TRUE(status.ok());
+
+    changes.clear();
+    status = reader.Tail(changes, reset);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(reset);
+    ASSERT_EQ(changes.size(), 2);
+    ASSERT_EQ(changes[1].version_, changes[0].version_ + 1);
+
+    catalog.Apply(changes, evicted, indexed);
+    ASSERT_EQ(evicted.size(), 1);
+    ASSERT_EQ(indexed.size(), 1);
+    ASSERT_EQ(indexed[0].file_id_, index_file.file_id_);
+    files.clear();
+    ASSERT_TRUE(catalog.FilesToSearch(table_id, milvus::engine::meta::DatesT(), {}, files));
+    ASSERT_EQ(files.begin()->second.size(), 1);
+    ASSERT_EQ(files.begin()->second[0].file_type_, milvus::engine::meta::TableFileSchema::INDEX);
+
+    // dropping the table evicts its files and takes it out of the catalog
+    status = feed_meta->DeleteTable(table_id);
+    ASSERT_TRUE(status.ok());
+    changes.clear();
+    status = reader.Tail(changes, reset);
+    ASSERT_TRUE(status.ok());
+    evicted.clear();
+    catalog.Apply(changes, evicted, indexed);
+    ASSERT_EQ(evicted.size(), 1);
+    ASSERT_FALSE(catalog.FilesToSearch(table_id, milvus::engine::meta::DatesT(), {}, files));
+}
+
+TEST_F(MetaTest, PARTITION_TEST) {
+    auto table_id = "partition_test";
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = impl_->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    std::vector<std::string> tags = {"a", "a", "b", ""};
+    for (auto& tag : tags) {
+        milvus::engine::meta::TableFileSchema table_file;
+        table_file.table_id_ = table_id;
+        table_file.partition_tag_ = tag;
+        status = impl_->CreateTableFile(table_file);
+        ASSERT_TRUE(status.ok());
+        table_file.file_type_ = milvus::engine::meta::TableFileSchema::RAW;
+        status = impl_->UpdateTableFile(table_file);
+        ASSERT_TRUE(status.ok());
+    }
+
+    std::vector<size_t> ids;
+    milvus::engine::meta::DatesT dates;
+    milvus::engine::meta::DatePartionedTableFilesSchema dated_files;
+    status = impl_->FilesToSearch(table_id, ids, dates, milvus::engine::meta::PartitionTags(), dated_files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(dated_files.begin()->second.size(), tags.size());
+
+    dated_files.clear();
+    status = impl_->FilesToSearch(table_id, ids, dates, {"a"}, dated_files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(dated_files.begin()->second.size(), 2);
+    for (auto& file : dated_files.begin()->second) {
+        ASSERT_EQ(file.partition_tag_, "a");
+    }
+
+    dated_files.clear();
+    status = impl_->FilesToSearch(table_id, ids, dates, {"b", "c"}, dated_files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(dated_files.begin()->second.size(), 1);
+
+    // files to merge keep their tags so compaction stays inside a partition
+    dated_files.clear();
+    status = impl_->FilesToMerge(table_id, dated_files);
+    ASSERT_TRUE(status.ok());
+    std::map<std::string, size_t> tag_count;
+    for (auto& file : dated_files.begin()->second) {
+        tag_count[file.partition_tag_]++;
+    }
+    ASSERT_EQ(tag_count["a"], 2);
+    ASSERT_EQ(tag_count["b"], 1);
+    ASSERT_EQ(tag_count[""], 1);
+}
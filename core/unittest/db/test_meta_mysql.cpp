@@ -22,6 +22,7 @@
 
 #include <iostream>
 #include <thread>
+#include <algorithm>
 #include <stdlib.h>
 #include <time.h>
 #include <gtest/gtest.h>
@@ -152,7 +153,10 @@ TEST_F(MySqlMetaTest, ARCHIVE_TEST_DAYS) {
         ids.push_back(table_file.id_);
     }
 
-    impl.Archive();
+    milvus::engine::meta::TableFilesSchema archived;
+    impl.Archive(archived);
+    size_t expired = std::count_if(days.begin(), days.end(), [&](int day) { return day >= days_num; });
+    ASSERT_EQ(archived.size(), expired);
     int i = 0;
 
     milvus::engine::meta::TableFilesSchema files_get;
@@ -212,7 +216,9 @@ TEST_F(MySqlMetaTest, ARCHIVE_TEST_DISK) {
         ids.push_back(table_file.id_);
     }
 
-    impl.Archive();
+    milvus::engine::meta::TableFilesSchema archived;
+    impl.Archive(archived);
+    ASSERT_EQ(archived.size(), 5);
     int i = 0;
 
     milvus::engine::meta::TableFilesSchema files_get;
@@ -312,20 +318,22 @@ TEST_F(MySqlMetaTest, TABLE_FILES_TEST) {
 
     milvus::engine::meta::DatesT dates = {table_file.date_};
     std::vector<size_t> ids;
-    status = impl_->FilesToSearch(table_id, ids, dates, dated_files);
+    status = impl_->FilesToSearch(table_id, ids, dates, milvus::engine::meta::PartitionTags(), dated_files);
     ASSERT_EQ(dated_files[table_file.date_].size(),
               to_index_files_cnt + raw_files_cnt + index_files_cnt);
 
-    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(), dated_files);
+    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(),
+                                  milvus::engine::meta::PartitionTags(), dated_files);
     ASSERT_EQ(dated_files[table_file.date_].size(),
               to_index_files_cnt + raw_files_cnt + index_files_cnt);
 
-    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(), dated_files);
+    status = impl_->FilesToSearch(table_id, ids, milvus::engine::meta::DatesT(),
+                                  milvus::engine::meta::PartitionTags(), dated_files);
     ASSERT_EQ(dated_files[table_file.date_].size(),
               to_index_files_cnt + raw_files_cnt + index_files_cnt);
 
     ids.push_back(size_t(9999999999));
-    status = impl_->FilesToSearch(table_id, ids, dates, dated_files);
+    status = impl_->FilesToSearch(table_id, ids, dates, milvus::engine::meta::PartitionTags(), dated_files);
     ASSERT_EQ(dated_files[table_file.date_].size(), 0);
 
     std::vector<int> file_types;
@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <limits>
 #include <vector>
 
 #include "scheduler/job/SearchJob.h"
@@ -168,6 +169,36 @@ TEST(DBSearchTest, MERGE_RESULT_SET_TEST) {
     MergeTopkToResultSetTest(TOP_K / 2, TOP_K / 3, NQ, TOP_K, false);
 }
 
+TEST(DBSearchTest, DROP_DELETED_TEST) {
+    size_t nq = 4, topk = 5, search_k = 8;
+    ms::ResultIds ids(nq * search_k);
+    ms::ResultDistances distances(nq * search_k);
+    for (size_t i = 0; i < nq; i++) {
+        for (size_t j = 0; j < search_k; j++) {
+            ids[i * search_k + j] = j;
+            distances[i * search_k + j] = j;
+        }
+    }
+    // the last row has fewer hits than topk once the deleted ones are dropped
+    for (size_t j = 2; j < search_k; j++) {
+        ids[(nq - 1) * search_k + j] = -1;
+        distances[(nq - 1) * search_k + j] = std::numeric_limits<float>::max();
+    }
+
+    milvus::engine::SegmentTombstones tombstones({1, 3});
+    ms::XSearchTask::DropDeleted(tombstones, nq, search_k, topk, true, ids, distances);
+    ASSERT_EQ(ids.size(), nq * topk);
+    ASSERT_EQ(distances.size(), nq * topk);
+    for (size_t i = 0; i + 1 < nq; i++) {
+        std::vector<int64_t> row(ids.begin() + i * topk, ids.begin() + (i + 1) * topk);
+        ASSERT_EQ(row, std::vector<int64_t>({0, 2, 4, 5, 6}));
+        ASSERT_FLOAT_EQ(distances[i * topk + 1], 2);
+    }
+    ASSERT_EQ(ids[(nq - 1) * topk], 0);
+    ASSERT_EQ(ids[(nq - 1) * topk + 1], -1);
+    ASSERT_EQ(distances[nq * topk - 1], std::numeric_limits<float>::max());
+}
+
 //void MergeTopkArrayTest(size_t topk_1, size_t topk_2, size_t nq, size_t topk, bool ascending) {
 //    std::vector<int64_t> ids1, ids2;
 //    std::vector<float> dist1, dist2;
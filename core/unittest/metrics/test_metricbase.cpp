@@ -64,4 +64,9 @@ TEST(MetricbaseTest, METRICBASE_TEST) {
     instance.ConnectionGaugeDecrement();
     instance.KeepingAliveCounterIncrement();
     instance.OctetsSet();
+    instance.SearchPhaseDurationSecondsHistogramObserve("load", "table", 1, "cpu", 1.0);
+    instance.TableCacheAccessIncrement("table", "cpu", true);
+    instance.TableDiskLoadBytesIncrement("table", 1.0);
+    instance.SearchNqHistogramObserve("table", 1.0);
+    instance.SearchTopkHistogramObserve("table", 1.0);
 }
@@ -25,7 +25,7 @@
 TEST(PrometheusTest, PROMETHEUS_TEST) {
     milvus::server::Config::GetInstance().SetMetricConfigEnableMonitor("on");
 
-    milvus::server::PrometheusMetrics instance = milvus::server::PrometheusMetrics::GetInstance();
+    milvus::server::PrometheusMetrics& instance = milvus::server::PrometheusMetrics::GetInstance();
     instance.Init();
     instance.SetStartup(true);
     milvus::server::SystemInfo::GetInstance().Init();
@@ -74,6 +74,21 @@ TEST(PrometheusTest, PROMETHEUS_TEST) {
     instance.GPUTemperature();
     instance.CPUTemperature();
 
+    instance.SearchPhaseDurationSecondsHistogramObserve("queue_wait", "table", 1, "disk", 1.0);
+    instance.SearchPhaseDurationSecondsHistogramObserve("load", "table", 2, "cpu", 1.0);
+    instance.SearchPhaseDurationSecondsHistogramObserve("execute", "table", 3, "gpu0", 1.0);
+    instance.SearchPhaseDurationSecondsHistogramObserve("reduce", "table", 3, "gpu0", 1.0);
+    instance.TableCacheAccessIncrement("table", "cpu", true);
+    instance.TableCacheAccessIncrement("table", "cpu", false);
+    instance.TableDiskLoadBytesIncrement("table", 1.0);
+    instance.SearchNqHistogramObserve("table", 1.0);
+    instance.SearchTopkHistogramObserve("table", 1.0);
+
+    // tables beyond the label limit share one label
+    milvus::server::Config::GetInstance().SetMetricConfigTableLabelLimit("1");
+    instance.Init();
+    instance.SearchNqHistogramObserve("another_table", 1.0);
+
     milvus::server::Config::GetInstance().SetMetricConfigEnableMonitor("off");
     instance.Init();
     instance.CPUCoreUsagePercentSet();
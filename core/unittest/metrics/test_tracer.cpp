@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "metrics/Tracer.h"
+#include "utils/CommonUtil.h"
+#include "utils/Json.h"
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+
+TEST(TracerTest, SAMPLE_TEST) {
+    milvus::server::Tracer& tracer = milvus::server::Tracer::GetInstance();
+
+    tracer.SetSampleRate(0.0);
+    ASSERT_EQ(tracer.StartTrace("Search"), nullptr);
+
+    // span on an unsampled request is a no-op
+    {
+        milvus::server::ScopedTraceSpan span(nullptr, "search");
+        span.SetAttribute("file_id", "1");
+    }
+
+    tracer.SetSampleRate(1.0);
+    auto context = tracer.StartTrace("Search");
+    ASSERT_NE(context, nullptr);
+    ASSERT_EQ(context->trace_id().size(), 32);
+}
+
+TEST(TracerTest, RING_BUFFER_TEST) {
+    milvus::server::Tracer& tracer = milvus::server::Tracer::GetInstance();
+    tracer.SetSampleRate(1.0);
+    tracer.SetCapacity(4);
+
+    std::string last_trace_id;
+    for (int i = 0; i < 10; ++i) {
+        auto context = tracer.StartTrace("Search");
+        {
+            milvus::server::ScopedThreadTraceContext thread_context(context);
+            milvus::server::ScopedTraceSpan span(milvus::server::GetThreadTraceContext(), "search");
+            span.SetAttribute("file_id", std::to_string(i));
+        }
+        ASSERT_EQ(milvus::server::GetThreadTraceContext(), nullptr);
+        context->AddSpan("reduce topk", context->start_us(), milvus::server::TraceContext::NowMicros());
+        context->Finish(milvus::Status::OK());
+        last_trace_id = context->trace_id();
+    }
+
+    milvus::json traces = tracer.Dump(100);
+    ASSERT_EQ(traces.size(), 4);
+    ASSERT_EQ(traces[0]["trace_id"], last_trace_id);
+    ASSERT_EQ(traces[0]["spans"].size(), 2);
+    ASSERT_EQ(traces[0]["spans"][0]["name"], "search");
+    ASSERT_EQ(traces[0]["spans"][0]["attributes"]["file_id"], "9");
+
+    ASSERT_EQ(tracer.Dump(2).size(), 2);
+
+    tracer.SetCapacity(2);
+    traces = tracer.Dump(100);
+    ASSERT_EQ(traces.size(), 2);
+    ASSERT_EQ(traces[0]["trace_id"], last_trace_id);
+}
+
+TEST(TracerTest, EXPORT_TEST) {
+    milvus::server::Tracer& tracer = milvus::server::Tracer::GetInstance();
+    tracer.SetSampleRate(1.0);
+    tracer.SetCapacity(8);
+
+    auto context = tracer.StartTrace("Search");
+    context->AddSpan("disk load", context->start_us(), milvus::server::TraceContext::NowMicros());
+    context->Finish(milvus::Status::OK());
+
+    std::string path = "/tmp/milvus_test/trace/trace.json";
+    auto status = tracer.Export(path);
+    ASSERT_TRUE(status.ok());
+
+    std::ifstream in(path);
+    milvus::json otlp = milvus::json::parse(in);
+    auto& spans = otlp["resourceSpans"][0]["scopeSpans"][0]["spans"];
+    ASSERT_GE(spans.size(), 2);
+    ASSERT_EQ(spans[0]["traceId"], spans[1]["traceId"]);
+    ASSERT_EQ(spans[1]["parentSpanId"], spans[0]["spanId"]);
+
+    milvus::server::CommonUtil::DeleteDirectory("/tmp/milvus_test/trace");
+}
@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "scheduler/AdmissionMgr.h"
+
+namespace milvus {
+namespace scheduler {
+
+namespace {
+
+void
+WaitFor(const std::function<bool()>& cond) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (not cond() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+}  // namespace
+
+TEST(AdmissionMgrTest, ADMIT_IN_ARRIVAL_ORDER) {
+    AdmissionMgr admission(10);
+    ASSERT_TRUE(admission.Admit(8, nullptr));
+
+    // the large job waits for the running one, the small one behind it would fit but must not overtake it
+    std::atomic<bool> large_admitted(false), small_admitted(false);
+    std::thread large([&] {
+        admission.Admit(10, nullptr);
+        large_admitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::thread small([&] {
+        admission.Admit(1, nullptr);
+        small_admitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(large_admitted);
+    ASSERT_FALSE(small_admitted);
+    ASSERT_EQ(admission.Running(), 1);
+
+    admission.Release(8);
+    WaitFor([&] { return large_admitted.load(); });
+    ASSERT_TRUE(large_admitted);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(small_admitted);
+
+    admission.Release(10);
+    WaitFor([&] { return small_admitted.load(); });
+    ASSERT_TRUE(small_admitted);
+    admission.Release(1);
+
+    large.join();
+    small.join();
+    ASSERT_EQ(admission.Running(), 0);
+}
+
+TEST(AdmissionMgrTest, EXPIRED_HEAD_LEAVES_QUEUE) {
+    AdmissionMgr admission(10);
+    ASSERT_TRUE(admission.Admit(8, nullptr));
+
+    // the head waiter gives up at its deadline, the waiter behind it takes over the head
+    auto token = std::make_shared<knowhere::CancelToken>(std::chrono::steady_clock::now() +
+                                                         std::chrono::milliseconds(100));
+    std::atomic<bool> small_admitted(false);
+    std::thread large([&] { ASSERT_FALSE(admission.Admit(10, token)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::thread small([&] {
+        admission.Admit(1, nullptr);
+        small_admitted = true;
+    });
+
+    large.join();
+    WaitFor([&] { return small_admitted.load(); });
+    ASSERT_TRUE(small_admitted);
+    ASSERT_EQ(admission.Running(), 2);
+
+    small.join();
+    admission.Release(1);
+    admission.Release(8);
+    ASSERT_EQ(admission.Running(), 0);
+}
+
+}  // namespace scheduler
+}  // namespace milvus
@@ -18,7 +18,11 @@
 
 #include "scheduler/task/SearchTask.h"
 #include "scheduler/task/BuildIndexTask.h"
+#include "scheduler/job/SearchJob.h"
+#include "knowhere/common/Cancel.h"
 #include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
 
 
 namespace milvus {
@@ -34,6 +38,52 @@ TEST(TaskTest, INVALID_INDEX) {
     build_task->Execute();
 }
 
+TEST(TaskTest, SEARCH_JOB_DEADLINE) {
+    std::vector<float> vectors(16);
+    auto file = std::make_shared<engine::meta::TableFileSchema>();
+    file->id_ = 1;
+
+    // without a cancel token the job waits for all its files
+    auto job = std::make_shared<SearchJob>(1, 1, 1, vectors.data());
+    job->AddIndexFile(file);
+    ASSERT_FALSE(job->Cancelled());
+    job->SearchDone(file->id_);
+    job->WaitResult();
+    ASSERT_TRUE(job->GetStatus().ok());
+
+    // past the deadline the job waits for the running task to stop, then fails
+    job = std::make_shared<SearchJob>(1, 1, 1, vectors.data());
+    job->AddIndexFile(file);
+    job->set_cancel_token(std::make_shared<knowhere::CancelToken>(knowhere::CancelToken::Clock::now() +
+                                                                  std::chrono::milliseconds(50)));
+    bool task_done = false;
+    std::thread task([&]() {
+        while (!job->Cancelled()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        task_done = true;
+        job->SearchDone(file->id_);
+    });
+    job->WaitResult();
+    ASSERT_TRUE(task_done);
+    ASSERT_EQ(job->GetStatus().code(), DB_TIMEOUT);
+    task.join();
+
+    // a cancelled batched search stops at the next batch boundary
+    int64_t searched = 0;
+    auto token = std::make_shared<knowhere::CancelToken>();
+    knowhere::SearchInBatches(token, 10, 3, [&](int64_t begin, int64_t count) {
+        searched += count;
+        if (begin >= 3) {
+            token->Cancel();
+        }
+    });
+    ASSERT_EQ(searched, 6);
+    searched = 0;
+    knowhere::SearchInBatches(nullptr, 10, 3, [&](int64_t begin, int64_t count) { searched += count; });
+    ASSERT_EQ(searched, 10);
+}
+
 } // namespace scheduler
 } // namespace milvus
 
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <gtest/gtest.h>
+#include "cache/CpuCacheMgr.h"
 #include "scheduler/TaskTable.h"
 #include "scheduler/task/TestTask.h"
 #include "scheduler/tasklabel/DefaultLabel.h"
@@ -156,6 +157,17 @@ TEST_F(TaskTableItemTest, MOVED) {
 
 /************ TaskTableBaseTest ************/
 
+namespace {
+
+// search tasks of an expired job are picked last, tasks of a priority test need a live job
+class PriorityTestJob : public milvus::scheduler::Job {
+ public:
+    PriorityTestJob() : Job(milvus::scheduler::JobType::SEARCH) {
+    }
+};
+
+}  // namespace
+
 class TaskTableBaseTest : public ::testing::Test {
  protected:
     void
@@ -260,6 +272,184 @@ TEST_F(TaskTableBaseTest, PICK_TO_LOAD_CACHE) {
     ASSERT_EQ(indexes[0] % empty_table_.capacity(), 2);
 }
 
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_MEMORY_BUDGET) {
+    const size_t NUM_TASKS = 4;
+    const size_t FILE_SIZE = 100;
+    auto label = std::make_shared<milvus::scheduler::DefaultLabel>();
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        milvus::scheduler::TableFileSchemaPtr dummy = nullptr;
+        auto task = std::make_shared<milvus::scheduler::TestTask>(dummy, label);
+        task->file_ = std::make_shared<milvus::scheduler::TableFileSchema>();
+        task->file_->location_ = "/tmp/milvus_test/budget_" + std::to_string(i);
+        task->file_->file_size_ = FILE_SIZE;
+        empty_table_.Put(task);
+    }
+
+    // nothing loading, budget fits two files
+    auto indexes = empty_table_.PickToLoad(10, 250);
+    ASSERT_EQ(indexes.size(), 2);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 0);
+    ASSERT_EQ(indexes[1] % empty_table_.capacity(), 1);
+
+    // one file loading, only one more fits
+    ASSERT_TRUE(empty_table_.Load(0));
+    indexes = empty_table_.PickToLoad(10, 250);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 1);
+
+    // loaded files hold memory until they are executed
+    ASSERT_TRUE(empty_table_.Loaded(0));
+    ASSERT_TRUE(empty_table_.Load(1));
+    ASSERT_TRUE(empty_table_.Loaded(1));
+    indexes = empty_table_.PickToLoad(10, 250);
+    ASSERT_EQ(indexes.size(), 0);
+
+    ASSERT_TRUE(empty_table_.Execute(0));
+    ASSERT_TRUE(empty_table_.Executed(0));
+    ASSERT_TRUE(empty_table_.Execute(1));
+    ASSERT_TRUE(empty_table_.Executed(1));
+    indexes = empty_table_.PickToLoad(10, 250);
+    ASSERT_EQ(indexes.size(), 2);
+}
+
+namespace {
+
+class BudgetCacheObj : public milvus::cache::DataObj {
+ public:
+    int64_t
+    Size() override {
+        return 100;
+    }
+};
+
+}  // namespace
+
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_MEMORY_BUDGET_CACHED) {
+    const size_t NUM_TASKS = 3;
+    const size_t FILE_SIZE = 100;
+    auto cpu_mgr = milvus::cache::CpuCacheMgr::GetInstance();
+    auto label = std::make_shared<milvus::scheduler::DefaultLabel>();
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        milvus::scheduler::TableFileSchemaPtr dummy = nullptr;
+        auto task = std::make_shared<milvus::scheduler::TestTask>(dummy, label);
+        task->file_ = std::make_shared<milvus::scheduler::TableFileSchema>();
+        task->file_->location_ = "/tmp/milvus_test/budget_cached_" + std::to_string(i);
+        task->file_->file_size_ = FILE_SIZE;
+        cpu_mgr->InsertItem(task->file_->location_, std::make_shared<BudgetCacheObj>());
+        empty_table_.Put(task);
+    }
+
+    // two loaded files fill the budget though they are cached, the third one waits
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    empty_table_[1]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    auto indexes = empty_table_.PickToLoad(10, 250);
+    ASSERT_EQ(indexes.size(), 0);
+
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::EXECUTED;
+    indexes = empty_table_.PickToLoad(10, 250);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 2);
+
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        cpu_mgr->EraseItem("/tmp/milvus_test/budget_cached_" + std::to_string(i));
+    }
+}
+
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_MEMORY_BUDGET_OVERSIZE) {
+    milvus::scheduler::TableFileSchemaPtr dummy = nullptr;
+    auto label = std::make_shared<milvus::scheduler::DefaultLabel>();
+    auto task = std::make_shared<milvus::scheduler::TestTask>(dummy, label);
+    task->file_ = std::make_shared<milvus::scheduler::TableFileSchema>();
+    task->file_->location_ = "/tmp/milvus_test/budget_oversize";
+    task->file_->file_size_ = 1000;
+    empty_table_.Put(task);
+    empty_table_.Put(task);
+
+    // a file larger than the budget is still loaded when nothing else is loading
+    auto indexes = empty_table_.PickToLoad(10, 100);
+    ASSERT_EQ(indexes.size(), 1);
+
+    ASSERT_TRUE(empty_table_.Load(indexes[0]));
+    indexes = empty_table_.PickToLoad(10, 100);
+    ASSERT_EQ(indexes.size(), 0);
+}
+
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_LOADED_STALL) {
+    const size_t NUM_TASKS = 5;
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        empty_table_.Put(task1_);
+    }
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    empty_table_[1]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    empty_table_[2]->state = milvus::scheduler::TaskTableItemState::LOADED;
+
+    // too many tasks waiting for executor
+    auto indexes = empty_table_.PickToLoad(1);
+    ASSERT_EQ(indexes.size(), 0);
+
+    // loading goes on once a loaded task is executed
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::EXECUTED;
+    indexes = empty_table_.PickToLoad(1);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 3);
+
+    // with a memory budget the bytes decide, not the number of loaded tasks
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    indexes = empty_table_.PickToLoad(1, 1000);
+    ASSERT_EQ(indexes.size(), 1);
+}
+
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_PRIORITY) {
+    milvus::scheduler::TableFileSchemaPtr dummy = nullptr;
+    auto label = std::make_shared<milvus::scheduler::DefaultLabel>();
+    std::vector<milvus::scheduler::JobPriority> priorities{
+        milvus::scheduler::JobPriority::BUILD, milvus::scheduler::JobPriority::BATCH,
+        milvus::scheduler::JobPriority::INTERACTIVE, milvus::scheduler::JobPriority::BATCH};
+    auto job = std::make_shared<PriorityTestJob>();
+    for (auto priority : priorities) {
+        auto task = std::make_shared<milvus::scheduler::TestTask>(dummy, label);
+        task->job_ = job;
+        task->priority_ = priority;
+        empty_table_.Put(task);
+    }
+
+    // higher priority first, same priority in fifo order
+    auto indexes = empty_table_.PickToLoad(10);
+    ASSERT_EQ(indexes.size(), 4);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 2);
+    ASSERT_EQ(indexes[1] % empty_table_.capacity(), 1);
+    ASSERT_EQ(indexes[2] % empty_table_.capacity(), 3);
+    ASSERT_EQ(indexes[3] % empty_table_.capacity(), 0);
+
+    // a build waiting long enough overtakes fresh searches
+    empty_table_[0]->timestamp.start -= 10000;
+    indexes = empty_table_.PickToLoad(1);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 0);
+}
+
+TEST_F(TaskTableBaseTest, PICK_TO_EXECUTE_PRIORITY) {
+    milvus::scheduler::TableFileSchemaPtr dummy = nullptr;
+    auto label = std::make_shared<milvus::scheduler::DefaultLabel>();
+    std::vector<milvus::scheduler::JobPriority> priorities{milvus::scheduler::JobPriority::BUILD,
+                                                           milvus::scheduler::JobPriority::INTERACTIVE};
+    auto job = std::make_shared<PriorityTestJob>();
+    for (auto priority : priorities) {
+        auto task = std::make_shared<milvus::scheduler::TestTask>(dummy, label);
+        task->job_ = job;
+        task->priority_ = priority;
+        empty_table_.Put(task);
+    }
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    empty_table_[1]->state = milvus::scheduler::TaskTableItemState::LOADED;
+
+    auto indexes = empty_table_.PickToExecute(1);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 1);
+    ASSERT_TRUE(empty_table_[0]->task->IsBackground());
+    ASSERT_FALSE(empty_table_[1]->task->IsBackground());
+}
+
 TEST_F(TaskTableBaseTest, PICK_TO_EXECUTE) {
     const size_t NUM_TASKS = 10;
     for (size_t i = 0; i < NUM_TASKS; ++i) {
@@ -231,3 +231,31 @@ TEST(CacheTest, INVALID_TEST) {
         ASSERT_EQ(mgr.GetItem("index_0"), nullptr);
     }
 }
+
+TEST(CacheTest, SNAPSHOT_TEST) {
+    LessItemCacheMgr mgr;
+    ASSERT_TRUE(mgr.Snapshot().empty());
+    for (int i = 0; i < 3; i++) {
+        milvus::engine::VecIndexPtr mock_index = std::make_shared<MockVecIndex>(256, 1);
+        mgr.InsertItem("index_" + std::to_string(i), std::static_pointer_cast<milvus::cache::DataObj>(mock_index));
+    }
+    mgr.GetItem("index_1");
+    mgr.GetItem("index_0");
+    mgr.GetItem("index_0");
+
+    // most recently used first, with the hits of each key
+    auto snapshot = mgr.Snapshot();
+    ASSERT_EQ(snapshot.size(), 3);
+    ASSERT_EQ(snapshot[0], std::make_pair(std::string("index_0"), uint64_t(2)));
+    ASSERT_EQ(snapshot[1], std::make_pair(std::string("index_1"), uint64_t(1)));
+    ASSERT_EQ(snapshot[2], std::make_pair(std::string("index_2"), uint64_t(0)));
+
+    mgr.EraseItem("index_0");
+    ASSERT_EQ(mgr.Snapshot().size(), 2);
+    mgr.ClearCache();
+    ASSERT_TRUE(mgr.Snapshot().empty());
+
+    milvus::engine::VecIndexPtr mock_index = std::make_shared<MockVecIndex>(256, 1);
+    mgr.InsertItem("index_0", std::static_pointer_cast<milvus::cache::DataObj>(mock_index));
+    ASSERT_EQ(mgr.Snapshot()[0].second, 0);
+}
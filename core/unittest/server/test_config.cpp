@@ -138,6 +138,29 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(s.ok());
     ASSERT_TRUE(str_val == server_time_zone);
 
+    std::string server_shards = "127.0.0.1:19531|127.0.0.1:19541,127.0.0.1:19532";
+    s = config.SetServerConfigShards(server_shards);
+    ASSERT_TRUE(s.ok());
+    std::vector<std::vector<std::string>> shards;
+    s = config.GetServerConfigShards(shards);
+    ASSERT_TRUE(s.ok());
+    ASSERT_EQ(shards.size(), 2);
+    ASSERT_EQ(shards[0].size(), 2);
+    ASSERT_EQ(shards[0][1], "127.0.0.1:19541");
+    ASSERT_EQ(shards[1].size(), 1);
+
+    int64_t server_shard_timeout = 1000;
+    s = config.SetServerConfigShardTimeout(std::to_string(server_shard_timeout));
+    ASSERT_TRUE(s.ok());
+    s = config.GetServerConfigShardTimeout(int64_val);
+    ASSERT_TRUE(int64_val == server_shard_timeout);
+
+    int64_t server_hedge_delay = 0;
+    s = config.SetServerConfigHedgeDelay(std::to_string(server_hedge_delay));
+    ASSERT_TRUE(s.ok());
+    s = config.GetServerConfigHedgeDelay(int64_val);
+    ASSERT_TRUE(int64_val == server_hedge_delay);
+
     /* db config */
     std::string db_primary_path = "/home/zilliz";
     s = config.SetDBConfigPrimaryPath(db_primary_path);
@@ -181,6 +204,27 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(s.ok());
     ASSERT_TRUE(int32_val == db_insert_buffer_size);
 
+    std::string db_tier_path = "/tmp/milvus_tier";
+    s = config.SetDBConfigTierPath(db_tier_path);
+    ASSERT_TRUE(s.ok());
+    s = config.GetDBConfigTierPath(str_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(str_val == db_tier_path);
+
+    int32_t db_tier_cold_days = 540;
+    s = config.SetDBConfigTierColdDays(std::to_string(db_tier_cold_days));
+    ASSERT_TRUE(s.ok());
+    s = config.GetDBConfigTierColdDays(int32_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int32_val == db_tier_cold_days);
+
+    int64_t db_tier_local_capacity = 100;
+    s = config.SetDBConfigTierLocalCapacity(std::to_string(db_tier_local_capacity));
+    ASSERT_TRUE(s.ok());
+    s = config.GetDBConfigTierLocalCapacity(int64_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int64_val == db_tier_local_capacity);
+
     /* metric config */
     bool metric_enable_monitor = false;
     s = config.SetMetricConfigEnableMonitor(std::to_string(metric_enable_monitor));
@@ -202,6 +246,34 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(s.ok());
     ASSERT_TRUE(str_val == metric_prometheus_port);
 
+    float metric_trace_sample_rate = 0.5;
+    s = config.SetMetricConfigTraceSampleRate(std::to_string(metric_trace_sample_rate));
+    ASSERT_TRUE(s.ok());
+    s = config.GetMetricConfigTraceSampleRate(float_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(float_val == metric_trace_sample_rate);
+
+    int64_t metric_trace_buffer_size = 100;
+    s = config.SetMetricConfigTraceBufferSize(std::to_string(metric_trace_buffer_size));
+    ASSERT_TRUE(s.ok());
+    s = config.GetMetricConfigTraceBufferSize(int64_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int64_val == metric_trace_buffer_size);
+
+    std::string metric_trace_export_path = "/tmp/milvus_trace.json";
+    s = config.SetMetricConfigTraceExportPath(metric_trace_export_path);
+    ASSERT_TRUE(s.ok());
+    s = config.GetMetricConfigTraceExportPath(str_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(str_val == metric_trace_export_path);
+
+    int64_t metric_table_label_limit = 16;
+    s = config.SetMetricConfigTableLabelLimit(std::to_string(metric_table_label_limit));
+    ASSERT_TRUE(s.ok());
+    s = config.GetMetricConfigTableLabelLimit(int64_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int64_val == metric_table_label_limit);
+
     /* cache config */
     int64_t cache_cpu_cache_capacity = 5;
     s = config.SetCacheConfigCpuCacheCapacity(std::to_string(cache_cpu_cache_capacity));
@@ -235,6 +307,18 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     s = config.GetCacheConfigCacheInsertData(bool_val);
     ASSERT_TRUE(bool_val == cache_insert_data);
 
+    bool cache_warm_restart = true;
+    s = config.SetCacheConfigWarmRestart(std::to_string(cache_warm_restart));
+    ASSERT_TRUE(s.ok());
+    s = config.GetCacheConfigWarmRestart(bool_val);
+    ASSERT_TRUE(bool_val == cache_warm_restart);
+
+    int64_t cache_warm_up_io_rate = 100;
+    s = config.SetCacheConfigWarmUpIoRate(std::to_string(cache_warm_up_io_rate));
+    ASSERT_TRUE(s.ok());
+    s = config.GetCacheConfigWarmUpIoRate(int64_val);
+    ASSERT_TRUE(int64_val == cache_warm_up_io_rate);
+
     /* engine config */
     int32_t engine_use_blas_threshold = 50;
     s = config.SetEngineConfigUseBlasThreshold(std::to_string(engine_use_blas_threshold));
@@ -257,6 +341,69 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(s.ok());
     ASSERT_TRUE(int32_val == engine_gpu_search_threshold);
 
+    int32_t engine_load_thread_num = 4;
+    s = config.SetEngineConfigLoadThreadNum(std::to_string(engine_load_thread_num));
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigLoadThreadNum(int32_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int32_val == engine_load_thread_num);
+
+    int32_t engine_io_thread_num = 8;
+    s = config.SetEngineConfigIoThreadNum(std::to_string(engine_io_thread_num));
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigIoThreadNum(int32_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int32_val == engine_io_thread_num);
+
+    int64_t engine_io_chunk_size = 32;
+    s = config.SetEngineConfigIoChunkSize(std::to_string(engine_io_chunk_size));
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigIoChunkSize(int64_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int64_val == engine_io_chunk_size);
+
+    bool engine_use_direct_io = true;
+    s = config.SetEngineConfigUseDirectIo(std::to_string(engine_use_direct_io));
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigUseDirectIo(bool_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(bool_val == engine_use_direct_io);
+
+    std::string engine_huge_page = "madvise";
+    s = config.SetEngineConfigHugePage(engine_huge_page);
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigHugePage(str_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(str_val == engine_huge_page);
+
+    bool engine_use_mmap = true;
+    s = config.SetEngineConfigUseMmap(std::to_string(engine_use_mmap));
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigUseMmap(bool_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(bool_val == engine_use_mmap);
+
+    int32_t engine_build_cpu_share = 25;
+    s = config.SetEngineConfigBuildCpuShare(std::to_string(engine_build_cpu_share));
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigBuildCpuShare(int32_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int32_val == engine_build_cpu_share);
+
+    int64_t engine_search_capacity = 100000;
+    s = config.SetEngineConfigSearchCapacity(std::to_string(engine_search_capacity));
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigSearchCapacity(int64_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int64_val == engine_search_capacity);
+
+    int64_t engine_nsg_build_memory_cap = 4096;
+    s = config.SetEngineConfigNsgBuildMemoryCap(std::to_string(engine_nsg_build_memory_cap));
+    ASSERT_TRUE(s.ok());
+    s = config.GetEngineConfigNsgBuildMemoryCap(int64_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int64_val == engine_nsg_build_memory_cap);
+
     /* resource config */
     std::string resource_mode = "simple";
     s = config.SetResourceConfigMode(resource_mode);
@@ -284,6 +431,19 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     s = config.GetResourceConfigIndexBuildDevice(int32_val);
     ASSERT_TRUE(s.ok());
     ASSERT_TRUE(int32_val == resource_index_build_device);
+
+    s = config.SetResourceConfigIndexBuildDevice("cpu");
+    ASSERT_TRUE(s.ok());
+    s = config.GetResourceConfigIndexBuildDevice(int32_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(int32_val == milvus::server::CPU_DEVICE_ID);
+
+    bool resource_numa_aware = true;
+    s = config.SetResourceConfigNumaAware(std::to_string(resource_numa_aware));
+    ASSERT_TRUE(s.ok());
+    s = config.GetResourceConfigNumaAware(bool_val);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(bool_val == resource_numa_aware);
 }
 
 TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
@@ -320,6 +480,17 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     s = config.SetServerConfigTimeZone("UTCA");
     ASSERT_FALSE(s.ok());
 
+    s = config.SetServerConfigShards("127.0.0.1");
+    ASSERT_FALSE(s.ok());
+    s = config.SetServerConfigShards("127.0.0.1:19531|:19532");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetServerConfigShardTimeout("0");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetServerConfigHedgeDelay("-1");
+    ASSERT_FALSE(s.ok());
+
     /* db config */
     s = config.SetDBConfigPrimaryPath("");
     ASSERT_FALSE(s.ok());
@@ -347,6 +518,16 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     s = config.SetDBConfigInsertBufferSize("2048");
     ASSERT_FALSE(s.ok());
 
+    s = config.SetDBConfigTierColdDays("a");
+    ASSERT_FALSE(s.ok());
+    s = config.SetDBConfigTierColdDays("0");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetDBConfigTierLocalCapacity("a");
+    ASSERT_FALSE(s.ok());
+    s = config.SetDBConfigTierLocalCapacity("0");
+    ASSERT_FALSE(s.ok());
+
     /* metric config */
     s = config.SetMetricConfigEnableMonitor("Y");
     ASSERT_FALSE(s.ok());
@@ -357,6 +538,24 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     s = config.SetMetricConfigPrometheusPort("0xff");
     ASSERT_FALSE(s.ok());
 
+    s = config.SetMetricConfigTraceSampleRate("a");
+    ASSERT_FALSE(s.ok());
+    s = config.SetMetricConfigTraceSampleRate("1.5");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetMetricConfigTraceBufferSize("a");
+    ASSERT_FALSE(s.ok());
+    s = config.SetMetricConfigTraceBufferSize("0");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetMetricConfigTraceExportPath("");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetMetricConfigTableLabelLimit("a");
+    ASSERT_FALSE(s.ok());
+    s = config.SetMetricConfigTableLabelLimit("0");
+    ASSERT_FALSE(s.ok());
+
     /* cache config */
     s = config.SetCacheConfigCpuCacheCapacity("a");
     ASSERT_FALSE(s.ok());
@@ -383,6 +582,12 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     s = config.SetCacheConfigCacheInsertData("N");
     ASSERT_FALSE(s.ok());
 
+    s = config.SetCacheConfigWarmRestart("N");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetCacheConfigWarmUpIoRate("0");
+    ASSERT_FALSE(s.ok());
+
     /* engine config */
     s = config.SetEngineConfigUseBlasThreshold("0xff");
     ASSERT_FALSE(s.ok());
@@ -395,6 +600,35 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     s = config.SetEngineConfigGpuSearchThreshold("-1");
     ASSERT_FALSE(s.ok());
 
+    s = config.SetEngineConfigLoadThreadNum("0");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetEngineConfigIoThreadNum("0");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetEngineConfigIoChunkSize("-1");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetEngineConfigUseDirectIo("N/A");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetEngineConfigHugePage("2MB");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetEngineConfigUseMmap("N/A");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetEngineConfigBuildCpuShare("0");
+    ASSERT_FALSE(s.ok());
+    s = config.SetEngineConfigBuildCpuShare("101");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetEngineConfigSearchCapacity("-1");
+    ASSERT_FALSE(s.ok());
+
+    s = config.SetEngineConfigNsgBuildMemoryCap("-1");
+    ASSERT_FALSE(s.ok());
+
     /* resource config */
     s = config.SetResourceConfigMode("default");
     ASSERT_FALSE(s.ok());
@@ -408,6 +642,9 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(s.ok());
     s = config.SetResourceConfigIndexBuildDevice("gpu16");
     ASSERT_FALSE(s.ok());
+
+    s = config.SetResourceConfigNumaAware("N/A");
+    ASSERT_FALSE(s.ok());
 }
 
 TEST_F(ConfigTest, SERVER_CONFIG_TEST) {
@@ -16,6 +16,10 @@
 // under the License.
 
 #include <gtest/gtest.h>
+#include <grpcpp/server_builder.h>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
 #include <thread>
 #include <boost/filesystem.hpp>
 
@@ -23,6 +27,7 @@
 #include "server/grpc_impl/GrpcRequestHandler.h"
 #include "server/grpc_impl/GrpcRequestScheduler.h"
 #include "server/grpc_impl/GrpcRequestTask.h"
+#include "server/grpc_impl/GrpcRouterHandler.h"
 #include "src/version.h"
 
 #include "grpc/gen-milvus/milvus.grpc.pb.h"
@@ -382,6 +387,10 @@ TEST_F(RpcHandlerTest, CMD_TEST) {
 
     command.set_cmd("tasktable");
     handler->Cmd(&context, &command, &reply);
+    command.set_cmd("ready");
+    handler->Cmd(&context, &command, &reply);
+    command.set_cmd("preload");
+    handler->Cmd(&context, &command, &reply);
     command.set_cmd("test");
     handler->Cmd(&context, &command, &reply);
 }
@@ -459,3 +468,182 @@ TEST_F(RpcSchedulerTest, BASE_TASK_TEST) {
     milvus::server::grpc::GrpcRequestScheduler::GetInstance().Stop();
 }
 
+
+namespace {
+
+// a shard holding vector ids only, the distance of a vector to any query is its id
+struct ShardData {
+    std::mutex mutex;
+    std::vector<int64_t> ids;
+};
+
+class MockShard : public ::milvus::grpc::MilvusService::Service {
+ public:
+    MockShard(const std::shared_ptr<ShardData>& data, int64_t search_delay_ms)
+        : data_(data), search_delay_ms_(search_delay_ms) {
+        ::grpc::ServerBuilder builder;
+        int port = 0;
+        builder.AddListeningPort("127.0.0.1:0", ::grpc::InsecureServerCredentials(), &port);
+        builder.RegisterService(this);
+        server_ = builder.BuildAndStart();
+        address_ = "127.0.0.1:" + std::to_string(port);
+    }
+
+    ~MockShard() override {
+        server_->Shutdown();
+    }
+
+    ::grpc::Status
+    Insert(::grpc::ServerContext* context, const ::milvus::grpc::InsertParam* request,
+           ::milvus::grpc::VectorIds* response) override {
+        std::lock_guard<std::mutex> lock(data_->mutex);
+        for (auto id : request->row_id_array()) {
+            data_->ids.push_back(id);
+            response->add_vector_id_array(id);
+        }
+        return ::grpc::Status::OK;
+    }
+
+    ::grpc::Status
+    Search(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+           ::milvus::grpc::TopKQueryResult* response) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(search_delay_ms_));
+        std::vector<int64_t> ids;
+        {
+            std::lock_guard<std::mutex> lock(data_->mutex);
+            ids = data_->ids;
+        }
+        std::sort(ids.begin(), ids.end());
+        ids.resize(std::min(ids.size(), static_cast<size_t>(request->topk())));
+
+        std::vector<int64_t> result_ids;
+        std::vector<float> result_distances;
+        for (int64_t i = 0; i < request->query_record_array_size(); i++) {
+            result_ids.insert(result_ids.end(), ids.begin(), ids.end());
+            for (auto id : ids) {
+                result_distances.push_back(static_cast<float>(id));
+            }
+        }
+        response->set_row_num(request->query_record_array_size());
+        response->add_ids(result_ids.begin(), result_ids.end());
+        response->add_distances(result_distances.begin(), result_distances.end());
+        return ::grpc::Status::OK;
+    }
+
+    ::grpc::Status
+    DescribeTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+                  ::milvus::grpc::TableSchema* response) override {
+        response->set_table_name(request->table_name());
+        response->set_metric_type(1);
+        return ::grpc::Status::OK;
+    }
+
+    ::grpc::Status
+    CountTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
+               ::milvus::grpc::TableRowCount* response) override {
+        std::lock_guard<std::mutex> lock(data_->mutex);
+        response->set_table_row_count(data_->ids.size());
+        return ::grpc::Status::OK;
+    }
+
+    const std::string&
+    address() const {
+        return address_;
+    }
+
+ private:
+    std::shared_ptr<ShardData> data_;
+    int64_t search_delay_ms_;
+    std::unique_ptr<::grpc::Server> server_;
+    std::string address_;
+};
+
+void
+BuildSearchParam(int64_t nq, int64_t topk, ::milvus::grpc::SearchParam& param) {
+    param.set_table_name(TABLE_NAME);
+    param.set_topk(topk);
+    param.set_nprobe(1);
+    std::vector<float> vector_data(TABLE_DIM, 0.0);
+    for (int64_t i = 0; i < nq; i++) {
+        param.add_query_record_array()->add_vector_data(vector_data.begin(), vector_data.end());
+    }
+}
+
+} // namespace
+
+TEST(RouterTest, SCATTER_GATHER_TEST) {
+    // shard 1 has a slow replica, a search to it is hedged to the fast one
+    auto data0 = std::make_shared<ShardData>();
+    auto data1 = std::make_shared<ShardData>();
+    MockShard shard0(data0, 0);
+    MockShard shard1_slow(data1, 1000);
+    MockShard shard1_fast(data1, 0);
+    milvus::server::grpc::GrpcRouterHandler router({{shard0.address()}, {shard1_slow.address(), shard1_fast.address()}},
+                                                   3000, 20);
+
+    ::grpc::ServerContext context;
+    ::milvus::grpc::InsertParam insert_param;
+    insert_param.set_table_name(TABLE_NAME);
+    std::vector<int64_t> ids;
+    std::vector<float> vector_data(TABLE_DIM, 0.0);
+    for (int64_t i = 0; i < VECTOR_COUNT; i++) {
+        ids.push_back(i);
+        insert_param.add_row_record_array()->add_vector_data(vector_data.begin(), vector_data.end());
+    }
+    insert_param.add_row_id_array(ids.begin(), ids.end());
+    ::milvus::grpc::VectorIds vector_ids;
+    router.Insert(&context, &insert_param, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ErrorCode::SUCCESS);
+    ASSERT_EQ(vector_ids.vector_id_array_size(), VECTOR_COUNT);
+
+    // every vector lands on the shard its id hashes to, both shards get some
+    ASSERT_FALSE(data0->ids.empty());
+    ASSERT_FALSE(data1->ids.empty());
+    ASSERT_EQ(data0->ids.size() + data1->ids.size(), VECTOR_COUNT);
+    for (auto id : data0->ids) {
+        ASSERT_EQ(milvus::server::grpc::GrpcRouterHandler::ShardOf(id, 2), 0);
+    }
+
+    ::milvus::grpc::TableName table_name;
+    table_name.set_table_name(TABLE_NAME);
+    ::milvus::grpc::TableRowCount row_count;
+    router.CountTable(&context, &table_name, &row_count);
+    ASSERT_EQ(row_count.table_row_count(), VECTOR_COUNT);
+
+    const int64_t nq = 3, topk = 10;
+    for (int64_t round = 0; round < 2; round++) {
+        ::milvus::grpc::SearchParam search_param;
+        BuildSearchParam(nq, topk, search_param);
+        ::milvus::grpc::TopKQueryResult result;
+        auto start = std::chrono::steady_clock::now();
+        router.Search(&context, &search_param, &result);
+        auto cost = std::chrono::steady_clock::now() - start;
+        ASSERT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(cost).count(), 500);
+
+        ASSERT_EQ(result.status().error_code(), ::milvus::grpc::ErrorCode::SUCCESS);
+        ASSERT_EQ(result.row_num(), nq);
+        ASSERT_EQ(result.ids_size(), nq * topk);
+        for (int64_t i = 0; i < nq; i++) {
+            for (int64_t k = 0; k < topk; k++) {
+                ASSERT_EQ(result.ids(i * topk + k), k);
+            }
+        }
+    }
+}
+
+TEST(RouterTest, DEADLINE_TEST) {
+    auto data = std::make_shared<ShardData>();
+    MockShard shard0(data, 0);
+    MockShard shard1(data, 1000);
+    milvus::server::grpc::GrpcRouterHandler router({{shard0.address()}, {shard1.address()}}, 100, 0);
+
+    ::grpc::ServerContext context;
+    ::milvus::grpc::SearchParam search_param;
+    BuildSearchParam(1, 10, search_param);
+    ::milvus::grpc::TopKQueryResult result;
+    auto start = std::chrono::steady_clock::now();
+    router.Search(&context, &search_param, &result);
+    auto cost = std::chrono::steady_clock::now() - start;
+    ASSERT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(cost).count(), 1000);
+    ASSERT_EQ(result.status().error_code(), ::milvus::grpc::ErrorCode::CONNECT_FAILED);
+}
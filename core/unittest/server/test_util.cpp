@@ -18,10 +18,12 @@
 #include "utils/SignalUtil.h"
 #include "utils/CommonUtil.h"
 #include "utils/Error.h"
+#include "utils/FileIO.h"
 #include "utils/StringHelpFunctions.h"
 #include "utils/TimeRecorder.h"
 #include "utils/BlockingQueue.h"
 #include "utils/LogUtil.h"
+#include "utils/NumaUtil.h"
 #include "utils/ValidationUtil.h"
 #include "db/engine/ExecutionEngine.h"
 
@@ -187,6 +189,77 @@ TEST(UtilTest, TIMERECORDER_TEST) {
     }
 }
 
+TEST(UtilTest, FILEIO_TEST) {
+    const std::string path = "/tmp/milvus_fileio_test";
+    // small chunk size so that one buffer is split into several parallel requests
+    milvus::server::FileIO file_io(3, 4096, false);
+
+    std::vector<uint8_t> data(4096 * 10 + 123);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i % 251);
+    }
+    uint64_t header = 0x1234;
+    std::vector<milvus::server::IOBuffer> buffers{
+        {&header, sizeof(header)}, {data.data(), data.size()}, {&header, sizeof(header)}};
+
+    milvus::Status status = file_io.WriteFile(path, buffers, true);
+    ASSERT_TRUE(status.ok());
+
+    std::shared_ptr<uint8_t> buffer;
+    uint64_t size = 0;
+    status = file_io.ReadFile(path, buffer, size);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(size, data.size() + 2 * sizeof(header));
+    ASSERT_EQ(memcmp(buffer.get(), &header, sizeof(header)), 0);
+    ASSERT_EQ(memcmp(buffer.get() + sizeof(header), data.data(), data.size()), 0);
+    ASSERT_EQ(memcmp(buffer.get() + sizeof(header) + data.size(), &header, sizeof(header)), 0);
+
+    std::vector<uint8_t> part(data.size() - 100);
+    status = file_io.Read(path, part.data(), part.size(), sizeof(header) + 100);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(memcmp(part.data(), data.data() + 100, part.size()), 0);
+
+    // read beyond end of file
+    status = file_io.Read(path, part.data(), part.size(), size);
+    ASSERT_FALSE(status.ok());
+
+    buffers = {{data.data(), data.size()}};
+    status = file_io.WriteFile(path, buffers);
+    ASSERT_TRUE(status.ok());
+
+    // direct io falls back to buffered io if the file system does not support it
+    milvus::server::FileIO direct_io(2, 4096, true);
+    status = direct_io.ReadFile(path, buffer, size);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(size, data.size());
+    ASSERT_EQ(memcmp(buffer.get(), data.data(), data.size()), 0);
+
+    status = file_io.ReadFile("/tmp/milvus_fileio_not_exist", buffer, size);
+    ASSERT_FALSE(status.ok());
+    status = file_io.WriteFile("/tmp/milvus_fileio_not_exist/file", buffers);
+    ASSERT_FALSE(status.ok());
+
+    boost::filesystem::remove(path);
+}
+
+TEST(UtilTest, NUMA_TEST) {
+    std::vector<int64_t> cpus = milvus::server::NumaUtil::ParseCpuList("0-3,8,10-11\n");
+    std::vector<int64_t> expect = {0, 1, 2, 3, 8, 10, 11};
+    ASSERT_EQ(cpus, expect);
+    ASSERT_TRUE(milvus::server::NumaUtil::ParseCpuList("").empty());
+
+    int64_t node_count = milvus::server::NumaUtil::NodeCount();
+    ASSERT_GE(node_count, 1);
+    ASSERT_FALSE(milvus::server::NumaUtil::NodeCpus(0).empty());
+    ASSERT_TRUE(milvus::server::NumaUtil::BindCurrentThread(0).ok());
+
+    ASSERT_EQ(milvus::server::NumaUtil::HomeNode("/tmp/milvus/table/file", 1), 0);
+    int64_t home = milvus::server::NumaUtil::HomeNode("/tmp/milvus/table/file", 4);
+    ASSERT_GE(home, 0);
+    ASSERT_LT(home, 4);
+    ASSERT_EQ(home, milvus::server::NumaUtil::HomeNode("/tmp/milvus/table/file", 4));
+}
+
 TEST(UtilTest, STATUS_TEST) {
     auto status = milvus::Status::OK();
     std::string str = status.ToString();
@@ -296,6 +369,17 @@ TEST(ValidationUtilTest, VALIDATE_INDEX_TEST) {
               milvus::SERVER_INVALID_INDEX_METRIC_TYPE);
     ASSERT_EQ(milvus::server::ValidationUtil::ValidateTableIndexMetricType(1).code(), milvus::SERVER_SUCCESS);
     ASSERT_EQ(milvus::server::ValidationUtil::ValidateTableIndexMetricType(2).code(), milvus::SERVER_SUCCESS);
+
+    int ip = (int)milvus::engine::MetricType::IP;
+    int l2 = (int)milvus::engine::MetricType::L2;
+    ASSERT_EQ(milvus::server::ValidationUtil::ValidateIndexMetricType(
+        (int)milvus::engine::EngineType::SPTAG_KDT, ip).code(), milvus::SERVER_INVALID_INDEX_METRIC_TYPE);
+    ASSERT_EQ(milvus::server::ValidationUtil::ValidateIndexMetricType(
+        (int)milvus::engine::EngineType::SPTAG_BKT, ip).code(), milvus::SERVER_INVALID_INDEX_METRIC_TYPE);
+    ASSERT_EQ(milvus::server::ValidationUtil::ValidateIndexMetricType(
+        (int)milvus::engine::EngineType::SPTAG_KDT, l2).code(), milvus::SERVER_SUCCESS);
+    ASSERT_EQ(milvus::server::ValidationUtil::ValidateIndexMetricType(
+        (int)milvus::engine::EngineType::FAISS_IVFFLAT, ip).code(), milvus::SERVER_SUCCESS);
 }
 
 TEST(ValidationUtilTest, VALIDATE_TOPK_TEST) {
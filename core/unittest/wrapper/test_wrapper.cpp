@@ -163,6 +163,26 @@ TEST_P(KnowhereWrapperTest, SERIALIZE_TEST) {
         new_index->Search(nq, xq.data(), res_dis.data(), res_ids.data(), conf);
         AssertResult(res_ids, res_dis);
     }
+
+    {
+        // indexes read from disk are cpu indexes, every entry can be located and reconstructed by its id
+        std::string file_location = "/tmp/knowhere";
+        auto new_index = milvus::engine::read_index(file_location);
+        std::vector<int64_t> all_ids, slots;
+        auto status = new_index->GetIds(all_ids, slots);
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(all_ids.size(), nb);
+        ASSERT_EQ(slots.size(), nb);
+
+        std::vector<float> vector(dim);
+        status = new_index->Reconstruct(slots[nb / 2], vector.data());
+        ASSERT_TRUE(status.ok());
+        auto row = all_ids[nb / 2];
+        for (int64_t j = 0; j < dim; ++j) {
+            // SQ8 codes are decoded with a quantization error
+            EXPECT_NEAR(vector[j], xb[row * dim + j], 0.1);
+        }
+    }
 }
 
 #include "wrapper/ConfAdapter.h"